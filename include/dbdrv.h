@@ -29,7 +29,7 @@
 /**
  * API version
  */
-#define DBDRV_API_VERSION           31
+#define DBDRV_API_VERSION           32
 
 /**
  * Database driver entry point declaration
@@ -95,6 +95,7 @@ struct DBDriverCallTable
    const char* (*GetColumnNameUnbuffered)(DBDRV_UNBUFFERED_RESULT, int);
    StringBuffer (*PrepareString)(const TCHAR*, size_t);
    int (*IsTableExist)(DBDRV_CONNECTION, const WCHAR*);
+   void (*ResetStatement)(DBDRV_STATEMENT);
 };
 
 //
@@ -25,7 +25,7 @@
 
 #define DB_LEGACY_SCHEMA_VERSION       700
 #define DB_SCHEMA_VERSION_MAJOR        43
-#define DB_SCHEMA_VERSION_MINOR        4
+#define DB_SCHEMA_VERSION_MINOR        15
 
 #define DB_SCHEMA_VERSION_V43_MINOR    DB_SCHEMA_VERSION_MINOR
 
@@ -691,6 +691,7 @@ typedef struct
 #define CMD_UPDATE_MAINTENANCE_JOURNAL    0x01C6
 #define CMD_GET_SSH_CREDENTIALS           0x01C7
 #define CMD_UPDATE_SSH_CREDENTIALS        0x01C8
+#define CMD_SET_OBJECT_UPDATE_FILTER      0x01C9
 
 #define CMD_RS_LIST_REPORTS               0x1100
 #define CMD_RS_GET_REPORT_DEFINITION      0x1101
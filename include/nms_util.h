@@ -2415,6 +2415,39 @@ class LIBNETXMS_EXPORTABLE StringSet
    }
 };
 
+/**
+ * Index of wildcard patterns (as accepted by MatchString) for fast case-insensitive lookup of first matching pattern.
+ * Patterns without metasymbols are indexed by full name, patterns with metasymbols only after opening parenthesis
+ * (like "System.CPU.Usage(*)") are indexed by literal prefix up to and including opening parenthesis, and
+ * remaining patterns are checked sequentially. Candidates are always verified with MatchString, so lookup result
+ * is the same as with sequential matching of all patterns in order of addition.
+ */
+class LIBNETXMS_EXPORTABLE PatternIndex
+{
+private:
+   StringList m_patterns;
+   StringObjectMap<IntegerArray<int32_t>> m_buckets;
+   IntegerArray<int32_t> m_unindexed;
+
+   int32_t findInBucket(const IntegerArray<int32_t> *bucket, const TCHAR *name, int32_t limit) const;
+
+public:
+   PatternIndex();
+   template<typename T> PatternIndex(const StructArray<T>& elements) : PatternIndex()
+   {
+      for(int i = 0; i < elements.size(); i++)
+         add(elements.get(i)->name);
+   }
+   PatternIndex(const PatternIndex& src) = delete;
+
+   int add(const TCHAR *pattern);
+   int find(const TCHAR *name) const;
+   void clear();
+
+   int size() const { return m_patterns.size(); }
+   const TCHAR *get(int index) const { return m_patterns.get(index); }
+};
+
 /**
  * Opaque hash set entry structure
  */
@@ -3588,6 +3621,10 @@ class LIBNETXMS_EXPORTABLE Table
    static Table *createFromPackedXML(const char *packedXml);
    char *createPackedXML() const;
 
+   static Table *createFromPackedData(const char *packedData, const Table *reference = nullptr, const StringList *columns = nullptr);
+   char *createPackedBinary(const Table *reference = nullptr, time_t referenceTimestamp = 0) const;
+   static time_t getPackedDataReference(const char *packedData);
+
    static Table *createFromCSV(const TCHAR *content, const TCHAR separator);
 };
 
@@ -5124,6 +5161,20 @@ static inline bool IsBlankString(const WCHAR* s)
    return true;
 }
 
+/**
+ * Target for batch ICMP ping. Caller sets address, packet size, and "don't fragment" flag;
+ * result (one of ICMP_xxx codes) and round trip time are set on completion.
+ */
+struct IcmpPingTarget
+{
+   InetAddress address;
+   uint32_t packetSize;
+   bool dontFragment;
+   uint32_t result;
+   uint32_t rtt;
+   void *userData;
+};
+
 TCHAR LIBNETXMS_EXPORTABLE *GetHeapInfo();
 INT64 LIBNETXMS_EXPORTABLE GetAllocatedHeapMemory();
 INT64 LIBNETXMS_EXPORTABLE GetActiveHeapMemory();
@@ -5134,6 +5185,8 @@ void LIBNETXMS_EXPORTABLE SetNetXMSDataDirectory(const TCHAR *dir);
 
 TcpPingResult LIBNETXMS_EXPORTABLE TcpPing(const InetAddress& addr, UINT16 port, UINT32 timeout);
 uint32_t LIBNETXMS_EXPORTABLE IcmpPing(const InetAddress& addr, int numRetries, uint32_t timeout, uint32_t *rtt, uint32_t packetSize, bool dontFragment);
+void LIBNETXMS_EXPORTABLE IcmpPingBatch(IcmpPingTarget *targets, size_t count, int numRetries, uint32_t timeout, void (*callback)(IcmpPingTarget*, void*) = nullptr, void *context = nullptr);
+void LIBNETXMS_EXPORTABLE IcmpSetBatchPacketRate(uint32_t packetsPerSecond);
 uint16_t LIBNETXMS_EXPORTABLE CalculateIPChecksum(const void *data, size_t len);
 
 TCHAR LIBNETXMS_EXPORTABLE *EscapeStringForXML(const TCHAR *str, int length);
@@ -66,7 +66,7 @@ class LIBNETXMS_EXPORTABLE NXCPMessage
    uint32_t m_controlData; // Data for control message
    BYTE *m_data;           // binary data
    size_t m_dataSize;      // binary data size
-   MemoryPool m_pool;
+   mutable MemoryPool m_pool; // Owns message fields and, for received messages, message data they point to
 
    NXCPMessage(const NXCP_MESSAGE *msg, int version);
 
@@ -156,6 +156,7 @@ class LIBNETXMS_EXPORTABLE NXCPMessage
    size_t getFieldAsInt32Array(uint32_t fieldId, size_t numElements, uint32_t *buffer) const;
    size_t getFieldAsInt32Array(uint32_t fieldId, IntegerArray<uint32_t> *data) const;
    const BYTE *getBinaryFieldPtr(uint32_t fieldId, size_t *size) const;
+   const char *getUtf8StringFieldPtr(uint32_t fieldId, size_t *length) const;
    TCHAR *getFieldAsString(uint32_t fieldId, MemoryPool *pool) const { return getFieldAsString(fieldId, pool, nullptr, 0); }
    TCHAR *getFieldAsString(uint32_t fieldId, TCHAR *buffer = nullptr, size_t bufferSize = 0) const { return getFieldAsString(fieldId, nullptr, buffer, bufferSize); }
    TCHAR *getFieldAsString(uint32_t fieldId, TCHAR **buffer) const { MemFree(*buffer); *buffer = getFieldAsString(fieldId, nullptr, nullptr, 0); return *buffer; }
@@ -167,6 +168,8 @@ class LIBNETXMS_EXPORTABLE NXCPMessage
    MacAddress getFieldAsMacAddress(uint32_t fieldId) const;
    uuid getFieldAsGUID(uint32_t fieldId) const;
 
+   MemoryPool *getMemoryPool() const { return &m_pool; }
+
    void deleteAllFields();
 
    void disableEncryption() { m_flags |= MF_DONT_ENCRYPT; }
@@ -81,6 +81,29 @@ typedef db_result_t * DB_RESULT;
 struct db_unbuffered_result_t;
 typedef db_unbuffered_result_t * DB_UNBUFFERED_RESULT;
 
+/**
+ * Connection pool class. Each class has its own set of connections, so that
+ * long running operations of one class cannot starve other classes.
+ */
+enum class DBConnectionPoolClass
+{
+   INTERACTIVE = 0,
+   WRITERS = 1,
+   HOUSEKEEPING = 2,
+   BACKGROUND = 3
+};
+
+/**
+ * Number of connection pool classes
+ */
+#define DB_POOL_CLASS_COUNT   4
+
+/**
+ * Number of buckets in connection pool time histograms. Bucket upper bounds are
+ * 1, 5, 10, 50, 100, 500, 1000, 5000, and 10000 milliseconds, last bucket is unbounded.
+ */
+#define DB_POOL_HISTOGRAM_SIZE   10
+
 /**
  * Pool connection information
  */
@@ -89,13 +112,41 @@ struct PoolConnectionInfo
    DB_HANDLE handle;
    bool inUse;
    bool resetOnRelease;
+   DBConnectionPoolClass poolClass;
    time_t lastAccessTime;
    time_t connectTime;
+   int64_t acquireTime;    // Time when connection was acquired (in milliseconds)
    uint32_t usageCount;
+   uint64_t statementCacheHits;
+   uint64_t statementCacheMisses;
    char srcFile[128];
    int srcLine;
 };
 
+/**
+ * Connection pool class statistics
+ */
+struct DBConnectionPoolClassStats
+{
+   int baseSize;
+   int maxSize;
+   int size;
+   int acquired;
+   int waiting;
+   uint64_t acquireCount;
+   uint64_t waitCount;         // Number of acquire requests that had to wait for free connection
+   uint64_t totalWaitTime;     // Total acquire wait time (milliseconds)
+   uint32_t maxWaitTime;
+   uint64_t waitTimeHistogram[DB_POOL_HISTOGRAM_SIZE];
+   uint64_t connectCount;      // Number of connections created on acquire request
+   uint64_t totalConnectTime;  // Total time spent creating connections on acquire (milliseconds)
+   uint32_t maxConnectTime;
+   uint64_t releaseCount;
+   uint64_t totalHoldTime;     // Total connection hold time (milliseconds)
+   uint32_t maxHoldTime;
+   uint64_t holdTimeHistogram[DB_POOL_HISTOGRAM_SIZE];
+};
+
 /**
  * DB library performance counters
  */
@@ -131,6 +182,8 @@ DB_DRIVER LIBNXDB_EXPORTABLE DBGetDriver(DB_HANDLE hConn);
 DB_STATEMENT LIBNXDB_EXPORTABLE DBPrepare(DB_HANDLE hConn, const TCHAR *query, bool optimizeForReuse = false);
 DB_STATEMENT LIBNXDB_EXPORTABLE DBPrepareEx(DB_HANDLE hConn, const TCHAR *query, bool optimizeForReuse, TCHAR *errorText);
 void LIBNXDB_EXPORTABLE DBFreeStatement(DB_STATEMENT hStmt);
+void LIBNXDB_EXPORTABLE DBSetStatementCacheSize(DB_HANDLE hConn, int size);
+void LIBNXDB_EXPORTABLE DBGetStatementCacheStats(DB_HANDLE hConn, uint64_t *hits, uint64_t *misses);
 const TCHAR LIBNXDB_EXPORTABLE *DBGetStatementSource(DB_STATEMENT hStmt);
 bool LIBNXDB_EXPORTABLE DBOpenBatch(DB_STATEMENT hStmt);
 void LIBNXDB_EXPORTABLE DBNextBatchRow(DB_STATEMENT hStmt);
@@ -229,11 +282,17 @@ bool LIBNXDB_EXPORTABLE DBConnectionPoolStartup(DB_DRIVER driver, const TCHAR *s
       int cooldownTime, int connTTL);
 void LIBNXDB_EXPORTABLE DBConnectionPoolShutdown();
 void LIBNXDB_EXPORTABLE DBConnectionPoolReset();
-DB_HANDLE LIBNXDB_EXPORTABLE __DBConnectionPoolAcquireConnection(const char *srcFile, int srcLine);
-#define DBConnectionPoolAcquireConnection() __DBConnectionPoolAcquireConnection(__FILE__, __LINE__)
+void LIBNXDB_EXPORTABLE DBConnectionPoolSetClassLimits(DBConnectionPoolClass poolClass, int baseSize, int maxSize);
+void LIBNXDB_EXPORTABLE DBConnectionPoolSetStatementCacheSize(int size);
+DB_HANDLE LIBNXDB_EXPORTABLE __DBConnectionPoolAcquireConnection(DBConnectionPoolClass poolClass, const char *srcFile, int srcLine);
+#define DBConnectionPoolAcquireConnection() __DBConnectionPoolAcquireConnection(DBConnectionPoolClass::INTERACTIVE, __FILE__, __LINE__)
+#define DBConnectionPoolAcquireConnectionEx(c) __DBConnectionPoolAcquireConnection((c), __FILE__, __LINE__)
 void LIBNXDB_EXPORTABLE DBConnectionPoolReleaseConnection(DB_HANDLE connection);
 int LIBNXDB_EXPORTABLE DBConnectionPoolGetSize();
 int LIBNXDB_EXPORTABLE DBConnectionPoolGetAcquiredCount();
+void LIBNXDB_EXPORTABLE DBConnectionPoolGetClassStats(DBConnectionPoolClass poolClass, DBConnectionPoolClassStats *stats);
+const TCHAR LIBNXDB_EXPORTABLE *DBConnectionPoolGetClassName(DBConnectionPoolClass poolClass);
+bool LIBNXDB_EXPORTABLE DBConnectionPoolClassFromName(const TCHAR *name, DBConnectionPoolClass *poolClass);
 
 void LIBNXDB_EXPORTABLE DBSetLongRunningThreshold(uint32_t threshold);
 void LIBNXDB_EXPORTABLE DBSetLongRunningThreshold(DB_HANDLE conn, uint32_t threshold);
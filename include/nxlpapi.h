@@ -162,6 +162,7 @@ typedef std::function<bool (const TCHAR* parameter, const TCHAR *value)> LogPars
 typedef void (*LogParserCopyCallback)(const TCHAR*, const TCHAR*, uint32_t, uint32_t, void*);
 
 class LIBNXLP_EXPORTABLE LogParser;
+struct TailedFile;
 
 #ifdef _WIN32
 
@@ -324,6 +325,8 @@ template class LIBNXLP_EXPORTABLE ObjectArray<LogParserRule>;
  */
 class LIBNXLP_EXPORTABLE LogParser
 {
+   friend void TailerCheckFile(TailedFile *file);
+
 private:
 	ObjectArray<LogParserRule> m_rules;
 	StringMap m_contexts;
@@ -360,6 +363,7 @@ class LIBNXLP_EXPORTABLE LogParser
    char *m_readBuffer;
    size_t m_readBufferSize;
    TCHAR *m_textBuffer;
+   TailedFile *m_tailedFile;  // Set if file is monitored by shared tailer
 
 	const TCHAR *checkContext(LogParserRule *rule);
 	bool matchLogRecord(bool hasAttributes, const TCHAR *source, uint32_t eventId, uint32_t level, const TCHAR *line,
@@ -374,6 +378,14 @@ class LIBNXLP_EXPORTABLE LogParser
    off_t processNewRecords(int fh, const TCHAR *fileName);
    bool monitorFile2(off_t startOffset);
 
+   int openLogFile(TCHAR *fname, size_t *size, time_t *mtime, bool *readFromStart);
+   void seekToStartPosition(int fh, const TCHAR *fname, bool *readFromStart, off_t *startOffset);
+   bool isLogFileReplaced(int fh, const TCHAR *fname, size_t *size, time_t *mtime);
+   void readLogFileChanges(int fh, const TCHAR *fname, size_t currSize, time_t currMTime, size_t *size, time_t *mtime);
+
+   uint32_t openTailedFile(TailedFile *file);
+   uint32_t checkTailedFile(TailedFile *file);
+
 #ifdef _WIN32
    bool monitorFileWithSnapshot(off_t startOffset);
    time_t readLastProcessedRecordTimestamp();
@@ -448,6 +460,7 @@ class LIBNXLP_EXPORTABLE LogParser
 
    off_t scanFile(int fh, off_t startOffset, const TCHAR *fileName);
 	bool monitorFile(off_t startOffset);
+   bool startTailing(off_t startOffset);
 #ifdef _WIN32
    bool monitorEventLog(const TCHAR *markerPrefix);
    void saveLastProcessedRecordTimestamp(time_t timestamp);
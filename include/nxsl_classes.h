@@ -270,6 +270,25 @@ struct NXSL_ExtMethod
       m_methods->set(#name, m); \
    }
 
+/**
+ * External attribute structure
+ */
+struct NXSL_ExtAttribute
+{
+   NXSL_Value *(*handler)(NXSL_Object *object, NXSL_VM *vm);
+};
+
+#define NXSL_ATTRIBUTE_DEFINITION(clazz, name) \
+   static NXSL_Value *A_##clazz##_##name (NXSL_Object *object, NXSL_VM *vm)
+
+#define NXSL_REGISTER_ATTRIBUTE_ALIAS(clazz, name, alias) { \
+      NXSL_ExtAttribute *a = new NXSL_ExtAttribute; \
+      a->handler = A_##clazz##_##name; \
+      m_attributeHandlers->set(#alias, a); \
+   }
+
+#define NXSL_REGISTER_ATTRIBUTE(clazz, name) NXSL_REGISTER_ATTRIBUTE_ALIAS(clazz, name, name)
+
 /**
  * Handle class attribute request. It is supposed to be used within getAttr methhod with standard parameter naming.
  */
@@ -291,6 +310,7 @@ class LIBNXSL_EXPORTABLE NXSL_Class
 
 protected:
    HashMap<NXSL_Identifier, NXSL_ExtMethod> *m_methods;
+   HashMap<NXSL_Identifier, NXSL_ExtAttribute> *m_attributeHandlers;
 
    void setName(const TCHAR *name);
    const StringList& getClassHierarchy() const { return m_classHierarchy; }
@@ -324,6 +344,13 @@ class LIBNXSL_EXPORTABLE NXSL_Class
 
 	virtual void toString(StringBuffer *sb, NXSL_Object *object);
 
+   /**
+    * Get handler for attribute registered with NXSL_REGISTER_ATTRIBUTE macro. Registered attributes are resolved by
+    * NXSL_Class::getAttr before any attributes handled by getAttr overrides, so interpreter can call handler
+    * directly and cache it.
+    */
+   const NXSL_ExtAttribute *getAttributeHandler(const NXSL_Identifier& name) const { return m_attributeHandlers->get(name); }
+
    const TCHAR *getName() const { return m_name; }
    bool instanceOf(const TCHAR *name) const { return !_tcscmp(name, m_name) || m_classHierarchy.contains(name); }
 
@@ -1102,11 +1129,42 @@ class LIBNXSL_EXPORTABLE NXSL_Program : public NXSL_ValueManager
    static NXSL_Program *load(ByteStream& s, TCHAR *errMsg, size_t errMsgSize);
 };
 
+class NXSL_Library;
+
+/**
+ * Pool of loaded VMs for same program. VMs are reset before returning to pool and can be reused
+ * without copying program code again. Pool is invalidated when given script library is changed
+ * (as loaded VMs may contain outdated modules) - VMs taken from pool before invalidation are
+ * destroyed when released.
+ */
+class LIBNXSL_EXPORTABLE NXSL_VMPool
+{
+private:
+   ObjectArray<NXSL_VM> m_vms;
+   Mutex m_mutex;
+   const NXSL_Library *m_library;
+   uint32_t m_libraryVersion;
+   int m_maxSize;
+   uint32_t m_generation;
+
+   void checkLibraryVersion();
+
+public:
+   NXSL_VMPool(const NXSL_Library *library, int maxSize = 16);
+   ~NXSL_VMPool();
+
+   NXSL_VM *acquire(uint32_t *generation);
+   void release(NXSL_VM *vm, uint32_t generation);
+   void invalidate();
+};
+
 /**
  * NXSL Script
  */
 class LIBNXSL_EXPORTABLE NXSL_LibraryScript
 {
+   friend class NXSL_Library;
+
 protected:
    uint32_t m_id;
    uuid m_guid;
@@ -1114,6 +1172,7 @@ class LIBNXSL_EXPORTABLE NXSL_LibraryScript
    TCHAR *m_source;
    NXSL_Program *m_program;
    TCHAR m_error[1024];
+   shared_ptr<NXSL_VMPool> m_vmPool;
 
 public:
    NXSL_LibraryScript();
@@ -1131,6 +1190,7 @@ class LIBNXSL_EXPORTABLE NXSL_LibraryScript
    const TCHAR *getError() const { return m_error; }
 
    NXSL_Program *getProgram() const { return m_program; }
+   const shared_ptr<NXSL_VMPool>& getVMPool() const { return m_vmPool; }
 
    void fillMessage(NXCPMessage *msg, uint32_t base) const;
    void fillMessage(NXCPMessage *msg) const;
@@ -1146,9 +1206,12 @@ class LIBNXSL_EXPORTABLE NXSL_Library
 {
 private:
    ObjectArray<NXSL_LibraryScript> *m_scriptList;
+   StringObjectMap<NXSL_LibraryScript> m_nameIndex;
+   HashMap<uint32_t, NXSL_LibraryScript> m_idIndex;
    Mutex m_mutex;
+   VolatileCounter m_version;
 
-   void deleteInternal(int nIndex);
+   void deleteInternal(int index);
 
 public:
    NXSL_Library();
@@ -1157,6 +1220,8 @@ class LIBNXSL_EXPORTABLE NXSL_Library
    void lock() { m_mutex.lock(); }
    void unlock() { m_mutex.unlock(); }
 
+   uint32_t getVersion() const { return m_version; }
+
    bool addScript(NXSL_LibraryScript *script);
    void deleteScript(const TCHAR *name);
    void deleteScript(uint32_t id);
@@ -1166,6 +1231,7 @@ class LIBNXSL_EXPORTABLE NXSL_Library
    StringList *getScriptDependencies(const TCHAR *name);
    NXSL_VM *createVM(const TCHAR *name, NXSL_Environment *env);
    ScriptVMHandle createVM(const TCHAR *name, std::function<NXSL_Environment *()> environmentCreator, std::function<ScriptVMFailureReason (NXSL_LibraryScript*)> scriptValidator);
+   ScriptVMHandle createPooledVM(const TCHAR *name, std::function<NXSL_Environment *()> environmentCreator, std::function<ScriptVMFailureReason (NXSL_LibraryScript*)> scriptValidator);
 
    void forEach(std::function<void (const NXSL_LibraryScript*)> callback);
 
@@ -1358,6 +1424,7 @@ class LIBNXSL_EXPORTABLE NXSL_VM : public NXSL_ValueManager
 	void setContextObject(NXSL_Value *value);
 
    bool load(const NXSL_Program *program);
+   void reset();
    bool run(const ObjectRefArray<NXSL_Value>& args, NXSL_VariableSystem **globals = nullptr,
             NXSL_VariableSystem **expressionVariables = nullptr,
             NXSL_VariableSystem *constants = nullptr, const char *entryPoint = nullptr);
@@ -1417,10 +1484,18 @@ class LIBNXSL_EXPORTABLE ScriptVMHandle
 private:
    NXSL_VM *m_vm;
    ScriptVMFailureReason m_failureReason;
+   shared_ptr<NXSL_VMPool> m_pool;
+   uint32_t m_poolGeneration;
 
 public:
-   ScriptVMHandle(NXSL_VM *vm) { m_vm = vm; m_failureReason = ScriptVMFailureReason::SUCCESS; }
-   ScriptVMHandle(ScriptVMFailureReason failureReason) { m_vm = nullptr; m_failureReason = failureReason; }
+   ScriptVMHandle(NXSL_VM *vm) { m_vm = vm; m_failureReason = ScriptVMFailureReason::SUCCESS; m_poolGeneration = 0; }
+   ScriptVMHandle(NXSL_VM *vm, const shared_ptr<NXSL_VMPool>& pool, uint32_t poolGeneration) : m_pool(pool)
+   {
+      m_vm = vm;
+      m_failureReason = ScriptVMFailureReason::SUCCESS;
+      m_poolGeneration = poolGeneration;
+   }
+   ScriptVMHandle(ScriptVMFailureReason failureReason) { m_vm = nullptr; m_failureReason = failureReason; m_poolGeneration = 0; }
 
    operator NXSL_VM *() { return m_vm; }
    NXSL_VM *operator->() { return m_vm; }
@@ -1429,7 +1504,16 @@ class LIBNXSL_EXPORTABLE ScriptVMHandle
    const TCHAR *failureReasonText() const;
    bool isValid() const { return m_vm != nullptr; }
 
-   void destroy() { delete m_vm; }
+   /**
+    * Destroy VM or return it to the pool if it was taken from pool
+    */
+   void destroy()
+   {
+      if (m_pool != nullptr)
+         m_pool->release(m_vm, m_poolGeneration);
+      else
+         delete m_vm;
+   }
 };
 
 /**
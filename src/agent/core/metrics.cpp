@@ -506,6 +506,14 @@ static StructArray<NETXMS_SUBAGENT_PUSHPARAM> s_pushMetrics(0, 64);
 static StructArray<NETXMS_SUBAGENT_LIST> s_lists(s_standardLists, sizeof(s_standardLists) / sizeof(NETXMS_SUBAGENT_LIST), 16);
 static StructArray<NETXMS_SUBAGENT_TABLE> s_tables(s_standardTables, sizeof(s_standardTables) / sizeof(NETXMS_SUBAGENT_TABLE), 16);
 
+/**
+ * Name indexes for provided metrics, lists, and tables. Position of each name in index matches position of
+ * handler in corresponding array.
+ */
+static PatternIndex s_metricIndex(s_metrics);
+static PatternIndex s_listIndex(s_lists);
+static PatternIndex s_tableIndex(s_tables);
+
 /**
  * Handler for metrics list
  */
@@ -626,6 +634,7 @@ void AddMetric(const TCHAR *name, LONG (*handler)(const TCHAR*, const TCHAR*, TC
       np.dataType = dataType;
       _tcslcpy(np.description, description, MAX_DB_STRING);
       s_metrics.add(np);
+      s_metricIndex.add(np.name);
    }
 }
 
@@ -656,6 +665,7 @@ void AddList(const TCHAR *name, LONG (*handler)(const TCHAR*, const TCHAR*, Stri
       np.handler = handler;
       np.arg = arg;
       s_lists.add(np);
+      s_listIndex.add(np.name);
    }
 }
 
@@ -695,6 +705,7 @@ void AddTable(const TCHAR *name, LONG (* handler)(const TCHAR *, const TCHAR *,
       np.numColumns = numColumns;
       np.columns = columns;
       s_tables.add(np);
+      s_tableIndex.add(np.name);
       nxlog_debug(7, _T("Table %s added (%d predefined columns, instance columns \"%s\")"), name, numColumns, instanceColumns);
    }
 }
@@ -903,42 +914,39 @@ uint32_t GetMetricValue(const TCHAR *param, TCHAR *value, AbstractCommSession *s
    uint32_t errorCode = ERR_UNKNOWN_METRIC;
 
    session->debugPrintf(5, _T("Requesting metric \"%s\""), param);
-   for(int i = 0; i < s_metrics.size(); i++)
-	{
-      NETXMS_SUBAGENT_PARAM *p = s_metrics.get(i);
-      if (MatchString(p->name, param, FALSE))
+   int index = s_metricIndex.find(param);
+   if (index != -1)
+   {
+      NETXMS_SUBAGENT_PARAM *p = s_metrics.get(index);
+      LONG rc = p->handler(param, p->arg, value, session);
+      switch(rc)
       {
-         LONG rc = p->handler(param, p->arg, value, session);
-         switch(rc)
-         {
-            case SYSINFO_RC_SUCCESS:
-               errorCode = ERR_SUCCESS;
-               InterlockedIncrement(&s_processedRequests);
-               break;
-            case SYSINFO_RC_ERROR:
-               errorCode = ERR_INTERNAL_ERROR;
-               InterlockedIncrement(&s_failedRequests);
-               break;
-            case SYSINFO_RC_NO_SUCH_INSTANCE:
-               errorCode = ERR_NO_SUCH_INSTANCE;
-               InterlockedIncrement(&s_failedRequests);
-               break;
-            case SYSINFO_RC_UNSUPPORTED:
-               errorCode = ERR_UNSUPPORTED_METRIC;
-               InterlockedIncrement(&s_unsupportedRequests);
-               break;
-            case SYSINFO_RC_UNKNOWN:
-               errorCode = ERR_UNKNOWN_METRIC;
-               break;
-            default:
-               nxlog_write(NXLOG_ERROR, _T("Internal error: unexpected return code %d in GetMetricValue(\"%s\")"), rc, param);
-               errorCode = ERR_INTERNAL_ERROR;
-               InterlockedIncrement(&s_failedRequests);
-               break;
-         }
-         break;
+         case SYSINFO_RC_SUCCESS:
+            errorCode = ERR_SUCCESS;
+            InterlockedIncrement(&s_processedRequests);
+            break;
+         case SYSINFO_RC_ERROR:
+            errorCode = ERR_INTERNAL_ERROR;
+            InterlockedIncrement(&s_failedRequests);
+            break;
+         case SYSINFO_RC_NO_SUCH_INSTANCE:
+            errorCode = ERR_NO_SUCH_INSTANCE;
+            InterlockedIncrement(&s_failedRequests);
+            break;
+         case SYSINFO_RC_UNSUPPORTED:
+            errorCode = ERR_UNSUPPORTED_METRIC;
+            InterlockedIncrement(&s_unsupportedRequests);
+            break;
+         case SYSINFO_RC_UNKNOWN:
+            errorCode = ERR_UNKNOWN_METRIC;
+            break;
+         default:
+            nxlog_write(NXLOG_ERROR, _T("Internal error: unexpected return code %d in GetMetricValue(\"%s\")"), rc, param);
+            errorCode = ERR_INTERNAL_ERROR;
+            InterlockedIncrement(&s_failedRequests);
+            break;
       }
-	}
+   }
 
    if (errorCode == ERR_UNKNOWN_METRIC)
    {
@@ -1012,39 +1020,36 @@ uint32_t GetListValue(const TCHAR *param, StringList *value, AbstractCommSession
 {
    uint32_t errorCode = ERR_UNKNOWN_METRIC;
    session->debugPrintf(5, _T("Requesting list \"%s\""), param);
-   for(int i = 0; i < s_lists.size(); i++)
-	{
-      NETXMS_SUBAGENT_LIST *list = s_lists.get(i);
-      if (MatchString(list->name, param, false))
+   int index = s_listIndex.find(param);
+   if (index != -1)
+   {
+      NETXMS_SUBAGENT_LIST *list = s_lists.get(index);
+      LONG rc = list->handler(param, list->arg, value, session);
+      switch(rc)
       {
-         LONG rc = list->handler(param, list->arg, value, session);
-         switch(rc)
-         {
-            case SYSINFO_RC_SUCCESS:
-               errorCode = ERR_SUCCESS;
-               InterlockedIncrement(&s_processedRequests);
-               break;
-            case SYSINFO_RC_ERROR:
-               errorCode = ERR_INTERNAL_ERROR;
-               InterlockedIncrement(&s_failedRequests);
-               break;
-            case SYSINFO_RC_NO_SUCH_INSTANCE:
-               errorCode = ERR_NO_SUCH_INSTANCE;
-               InterlockedIncrement(&s_failedRequests);
-               break;
-            case SYSINFO_RC_UNSUPPORTED:
-               errorCode = ERR_UNSUPPORTED_METRIC;
-               InterlockedIncrement(&s_unsupportedRequests);
-               break;
-            default:
-               nxlog_write(NXLOG_ERROR, _T("Internal error: unexpected return code %d in GetListValue(\"%s\")"), rc, param);
-               errorCode = ERR_INTERNAL_ERROR;
-               InterlockedIncrement(&s_failedRequests);
-               break;
-         }
-         break;
+         case SYSINFO_RC_SUCCESS:
+            errorCode = ERR_SUCCESS;
+            InterlockedIncrement(&s_processedRequests);
+            break;
+         case SYSINFO_RC_ERROR:
+            errorCode = ERR_INTERNAL_ERROR;
+            InterlockedIncrement(&s_failedRequests);
+            break;
+         case SYSINFO_RC_NO_SUCH_INSTANCE:
+            errorCode = ERR_NO_SUCH_INSTANCE;
+            InterlockedIncrement(&s_failedRequests);
+            break;
+         case SYSINFO_RC_UNSUPPORTED:
+            errorCode = ERR_UNSUPPORTED_METRIC;
+            InterlockedIncrement(&s_unsupportedRequests);
+            break;
+         default:
+            nxlog_write(NXLOG_ERROR, _T("Internal error: unexpected return code %d in GetListValue(\"%s\")"), rc, param);
+            errorCode = ERR_INTERNAL_ERROR;
+            InterlockedIncrement(&s_failedRequests);
+            break;
       }
-	}
+   }
 
 	if (errorCode == ERR_UNKNOWN_METRIC)
    {
@@ -1074,49 +1079,46 @@ uint32_t GetTableValue(const TCHAR *param, Table *value, AbstractCommSession *se
 {
    uint32_t errorCode = ERR_UNKNOWN_METRIC;
    session->debugPrintf(5, _T("Requesting table \"%s\""), param);
-   for(int i = 0; i < s_tables.size(); i++)
-	{
-      NETXMS_SUBAGENT_TABLE *t = s_tables.get(i);
-      if (MatchString(t->name, param, FALSE))
+   int index = s_tableIndex.find(param);
+   if (index != -1)
+   {
+      NETXMS_SUBAGENT_TABLE *t = s_tables.get(index);
+      // pre-fill table columns if specified in table definition
+      if (t->numColumns > 0)
       {
-         // pre-fill table columns if specified in table definition
-         if (t->numColumns > 0)
+         for(int c = 0; c < t->numColumns; c++)
          {
-            for(int c = 0; c < t->numColumns; c++)
-            {
-               NETXMS_SUBAGENT_TABLE_COLUMN *col = &t->columns[c];
-               value->addColumn(col->name, col->dataType, col->displayName, col->isInstance);
-            }
+            NETXMS_SUBAGENT_TABLE_COLUMN *col = &t->columns[c];
+            value->addColumn(col->name, col->dataType, col->displayName, col->isInstance);
          }
+      }
 
-         LONG rc = t->handler(param, t->arg, value, session);
-         switch(rc)
-         {
-            case SYSINFO_RC_SUCCESS:
-               errorCode = ERR_SUCCESS;
-               InterlockedIncrement(&s_processedRequests);
-               break;
-            case SYSINFO_RC_ERROR:
-               errorCode = ERR_INTERNAL_ERROR;
-               InterlockedIncrement(&s_failedRequests);
-               break;
-            case SYSINFO_RC_NO_SUCH_INSTANCE:
-               errorCode = ERR_NO_SUCH_INSTANCE;
-               InterlockedIncrement(&s_failedRequests);
-               break;
-            case SYSINFO_RC_UNSUPPORTED:
-               errorCode = ERR_UNSUPPORTED_METRIC;
-               InterlockedIncrement(&s_unsupportedRequests);
-               break;
-            default:
-               nxlog_write(NXLOG_ERROR, _T("Internal error: unexpected return code %d in GetTableValue(\"%s\")"), rc, param);
-               errorCode = ERR_INTERNAL_ERROR;
-               InterlockedIncrement(&s_failedRequests);
-               break;
-         }
-         break;
+      LONG rc = t->handler(param, t->arg, value, session);
+      switch(rc)
+      {
+         case SYSINFO_RC_SUCCESS:
+            errorCode = ERR_SUCCESS;
+            InterlockedIncrement(&s_processedRequests);
+            break;
+         case SYSINFO_RC_ERROR:
+            errorCode = ERR_INTERNAL_ERROR;
+            InterlockedIncrement(&s_failedRequests);
+            break;
+         case SYSINFO_RC_NO_SUCH_INSTANCE:
+            errorCode = ERR_NO_SUCH_INSTANCE;
+            InterlockedIncrement(&s_failedRequests);
+            break;
+         case SYSINFO_RC_UNSUPPORTED:
+            errorCode = ERR_UNSUPPORTED_METRIC;
+            InterlockedIncrement(&s_unsupportedRequests);
+            break;
+         default:
+            nxlog_write(NXLOG_ERROR, _T("Internal error: unexpected return code %d in GetTableValue(\"%s\")"), rc, param);
+            errorCode = ERR_INTERNAL_ERROR;
+            InterlockedIncrement(&s_failedRequests);
+            break;
       }
-	}
+   }
 
    if (errorCode == ERR_UNKNOWN_METRIC)
    {
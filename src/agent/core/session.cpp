@@ -928,7 +928,7 @@ void CommSession::getParameter(NXCPMessage *request, NXCPMessage *response)
  */
 void CommSession::getList(NXCPMessage *request, NXCPMessage *response)
 {
-   TCHAR *name = request->getFieldAsString(VID_PARAMETER);
+   TCHAR *name = request->getFieldAsString(VID_PARAMETER, request->getMemoryPool());
    StringList value;
    uint32_t rcc = GetListValue(name, &value, this);
    response->setField(VID_RCC, rcc);
@@ -936,7 +936,6 @@ void CommSession::getList(NXCPMessage *request, NXCPMessage *response)
    {
       value.fillMessage(response, VID_ENUM_VALUE_BASE, VID_NUM_STRINGS);
    }
-   MemFree(name);
 }
 
 /**
@@ -944,7 +943,7 @@ void CommSession::getList(NXCPMessage *request, NXCPMessage *response)
  */
 void CommSession::getTable(NXCPMessage *request, NXCPMessage *response)
 {
-   TCHAR *name = request->getFieldAsString(VID_PARAMETER);
+   TCHAR *name = request->getFieldAsString(VID_PARAMETER, request->getMemoryPool());
    Table value;
    uint32_t rcc = GetTableValue(name, &value, this);
    response->setField(VID_RCC, rcc);
@@ -952,7 +951,6 @@ void CommSession::getTable(NXCPMessage *request, NXCPMessage *response)
    {
 		value.fillMessage(response, 0, -1);	// no row limit
    }
-   MemFree(name);
 }
 
 /**
@@ -108,6 +108,7 @@ static bool SubAgentInit(Config *config)
    StartCpuUsageCollector();
    StartIoStatCollector();
    InitDrbdCollector();
+   InitProcessSnapshot(config);
    return true;
 }
 
@@ -119,6 +120,7 @@ static void SubAgentShutdown()
    ShutdownCpuUsageCollector();
    ShutdownIoStatCollector();
    StopDrbdCollector();
+   ReleaseProcessSnapshot();
 }
 
 /**
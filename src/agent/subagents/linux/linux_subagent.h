@@ -242,4 +242,7 @@ void StopDrbdCollector();
 
 void ReadCPUVendorId();
 
+void InitProcessSnapshot(Config *config);
+void ReleaseProcessSnapshot();
+
 #endif // __LINUX_SUBAGENT_H__
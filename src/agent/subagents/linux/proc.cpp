@@ -79,10 +79,12 @@ struct Process
    long rss;             // Process's resident set size in pages
    unsigned long minflt; // Number of minor page faults
    unsigned long majflt; // Number of major page faults
-   ObjectArray<FileDescriptor> *fd;
-   char *cmdLine; // Process command line
+   ObjectArray<FileDescriptor> *fd;   // Loaded on first use
+   char *cmdLine;        // Process command line (loaded on first use)
+   bool fdLoaded;
+   bool cmdLineLoaded;
 
-   Process(uint32_t _pid, const char *_name, char *_user, char *_cmdLine)
+   Process(uint32_t _pid, const char *_name, const char *_user)
    {
       pid = _pid;
       strlcpy(name, _name, MAX_PROCESS_NAME_LEN);
@@ -98,7 +100,9 @@ struct Process
       minflt = 0;
       majflt = 0;
       fd = nullptr;
-      cmdLine = _cmdLine;
+      cmdLine = nullptr;
+      fdLoaded = false;
+      cmdLineLoaded = false;
    }
 
    ~Process()
@@ -137,29 +141,94 @@ static ObjectArray<FileDescriptor> *ReadProcessHandles(const char *path)
 }
 
 /**
- * Read process information from /proc system
- * Parameters:
- *    plist    - array to fill, can be NULL
- *    procNameFilter - If not NULL, only processes with matched name will
- *               be counted and read. If cmdLineFilter is NULL, then exact
- *               match required to pass filter; otherwise procNameFilter can
- *               be a regular expression.
- *    cmdLineFilter - If not NULL, only processes with command line matched to
- *              regular expression will be counted and read.
- *    procUser - If not NULL, only processes run by this user will be counted.
- * Return value: number of matched processes or -1 in case of error.
+ * Read process command line. Arguments are separated by spaces.
  */
-static int ProcRead(ObjectArray<Process> *plist, const char *procNameFilter, const char *cmdLineFilter, const char *procUserFilter, bool readHandles, bool readCmdLine)
+static char *ReadProcessCommandLine(uint32_t pid)
 {
-   nxlog_debug_tag(DEBUG_TAG, 6, _T("ProcRead(%p, \"%hs\",\"%hs\",\"%hs\")"), plist, CHECK_NULL_A(procNameFilter), CHECK_NULL_A(cmdLineFilter), CHECK_NULL_A(procUserFilter));
+   char fileName[MAX_PATH];
+   snprintf(fileName, MAX_PATH, "/proc/%u/cmdline", pid);
+   int hFile = _open(fileName, O_RDONLY);
+   if (hFile == -1)
+      return nullptr;
+
+   size_t len = 0, pos = 0;
+   char *processCmdLine = MemAllocStringA(4096);
+   while (true)
+   {
+      ssize_t bytes = _read(hFile, &processCmdLine[pos], 4096);
+      if (bytes < 0)
+         bytes = 0;
+      len += bytes;
+      if (bytes < 4096)
+      {
+         processCmdLine[len] = 0;
+         break;
+      }
+      pos += bytes;
+      processCmdLine = MemRealloc(processCmdLine, pos + 4096);
+   }
+   _close(hFile);
+   if (len > 0)
+   {
+      // got a valid record in format: argv[0]\x00argv[1]\x00...
+      // Note: to behave identicaly on different platforms,
+      // full command line including argv[0] should be matched
+      // replace 0x00 with spaces
+      for (size_t j = 0; j < len - 1; j++)
+      {
+         if (processCmdLine[j] == 0)
+         {
+            processCmdLine[j] = ' ';
+         }
+      }
+   }
+   return processCmdLine;
+}
+
+/**
+ * Snapshot of process table. Snapshot is shared between all process related handlers and
+ * re-read from /proc only when it is older than configured TTL. Command line and open handles
+ * are read only for processes where they are actually requested.
+ */
+class ProcessSnapshot
+{
+private:
+   ObjectArray<Process> m_processes;
+   int64_t m_timestamp;
+   Mutex m_lock;   // Protects lazily loaded process attributes
+
+public:
+   ProcessSnapshot() : m_processes(256, 256, Ownership::True), m_lock(MutexType::FAST)
+   {
+      m_timestamp = GetCurrentTimeMs();
+   }
+
+   bool read();
 
+   int64_t getTimestamp() const { return m_timestamp; }
+   int size() const { return m_processes.size(); }
+   Process *get(int index) const { return m_processes.get(index); }
+
+   const char *getCommandLine(Process *p);
+   const ObjectArray<FileDescriptor> *getHandles(Process *p);
+   int getHandleCount(Process *p)
+   {
+      const ObjectArray<FileDescriptor> *fd = getHandles(p);
+      return (fd != nullptr) ? fd->size() : 0;
+   }
+};
+
+/**
+ * Read process table from /proc file system. Returns false if /proc cannot be read.
+ */
+bool ProcessSnapshot::read()
+{
    DIR *dir = opendir("/proc");
    if (dir == nullptr)
-      return -1;
+      return false;
 
    char fileName[MAX_PATH] = "/proc/";
 
-   int count = 0;
    struct dirent *d;
    while ((d = readdir(dir)) != nullptr)
    {
@@ -177,7 +246,6 @@ static int ProcRead(ObjectArray<Process> *plist, const char *procNameFilter, con
 
       // Read stat file
       char szProcStat[1024], *pProcStat = nullptr, *pProcName = nullptr;
-      bool procNameMatch = false;
       strcpy(&fileName[fileNamePos], "stat");
       int hFile = _open(fileName, O_RDONLY);
       if (hFile != -1)
@@ -199,27 +267,13 @@ static int ProcRead(ObjectArray<Process> *plist, const char *procNameFilter, con
                      *pProcStat = 0;
                      pProcStat++;
                   }
-                  if (pProcName != nullptr)
-                  {
-                     if ((procNameFilter != nullptr) && (*procNameFilter != 0))
-                     {
-                        if (cmdLineFilter == nullptr) // use old style compare
-                           procNameMatch = (strcmp(pProcName, procNameFilter) == 0);
-                        else
-                           procNameMatch = RegexpMatchA(pProcName, procNameFilter, false);
-                     }
-                     else
-                     {
-                        procNameMatch = true;
-                     }
-                  }
                }
             }
          }
          _close(hFile);
       }
 
-      if (!procNameMatch)
+      if (pProcName == nullptr)
          continue;
 
       // Read status file
@@ -253,86 +307,157 @@ static int ProcRead(ObjectArray<Process> *plist, const char *procNameFilter, con
          _close(hFile);
       }
 
-      // Check if user name matches pattern
-      if ((procUserFilter != nullptr) && (*procUserFilter != 0)  && !RegexpMatchA(CHECK_NULL_EX_A(userName), procUserFilter, true))
-         continue;
-
-      char *processCmdLine = nullptr;
-      if (readCmdLine || ((cmdLineFilter != nullptr) && (*cmdLineFilter != 0)))
+      auto p = new Process(pid, pProcName, userName);
+      // Parse rest of /proc/pid/stat file
+      if (sscanf(pProcStat, " %c %d %d %*d %*d %*d %*u %lu %*u %lu %*u %lu %lu %*u %*u %*d %*d %ld %*d %*u %lu %ld ",
+                 &p->state, &p->parent, &p->group, &p->minflt, &p->majflt,
+                 &p->utime, &p->ktime, &p->threads, &p->vmsize, &p->rss) != 10)
       {
-         strcpy(&fileName[fileNamePos], "cmdline");
-         hFile = _open(fileName, O_RDONLY);
-         if (hFile != -1)
-         {
-            size_t len = 0, pos = 0;
-            processCmdLine = MemAllocStringA(4096);
-            while (true)
-            {
-               ssize_t bytes = _read(hFile, &processCmdLine[pos], 4096);
-               if (bytes < 0)
-                  bytes = 0;
-               len += bytes;
-               if (bytes < 4096)
-               {
-                  processCmdLine[len] = 0;
-                  break;
-               }
-               pos += bytes;
-               processCmdLine = MemRealloc(processCmdLine, pos + 4096);
-            }
-            _close(hFile);
-            if (len > 0)
-            {
-               // got a valid record in format: argv[0]\x00argv[1]\x00...
-               // Note: to behave identicaly on different platforms,
-               // full command line including argv[0] should be matched
-               // replace 0x00 with spaces
-               for (int j = 0; j < len - 1; j++)
-               {
-                  if (processCmdLine[j] == 0)
-                  {
-                     processCmdLine[j] = ' ';
-                  }
-               }
-            }
-         }
+         nxlog_debug_tag(DEBUG_TAG, 5, _T("Error parsing /proc/%u/stat"), pid);
+      }
+      m_processes.add(p);
+   }
+   closedir(dir);
 
-         if ((cmdLineFilter != nullptr) && (*cmdLineFilter != 0))
-         {
-            if (!RegexpMatchA(CHECK_NULL_EX_A(processCmdLine), cmdLineFilter, true))
-            {
-               MemFree(processCmdLine);
-               continue;
-            }
-            if (!readCmdLine)
-               MemFreeAndNull(processCmdLine);
-         }
+   m_timestamp = GetCurrentTimeMs();
+   return true;
+}
+
+/**
+ * Get command line for given process (will read it on first call)
+ */
+const char *ProcessSnapshot::getCommandLine(Process *p)
+{
+   m_lock.lock();
+   if (!p->cmdLineLoaded)
+   {
+      p->cmdLine = ReadProcessCommandLine(p->pid);
+      p->cmdLineLoaded = true;
+   }
+   m_lock.unlock();
+   return p->cmdLine;
+}
+
+/**
+ * Get open handles for given process (will read them on first call). Returns null if handles cannot be read.
+ */
+const ObjectArray<FileDescriptor> *ProcessSnapshot::getHandles(Process *p)
+{
+   m_lock.lock();
+   if (!p->fdLoaded)
+   {
+      char path[MAX_PATH];
+      snprintf(path, MAX_PATH, "/proc/%u/fd", p->pid);
+      p->fd = ReadProcessHandles(path);
+      p->fdLoaded = true;
+   }
+   m_lock.unlock();
+   return p->fd;
+}
+
+/**
+ * Current process table snapshot
+ */
+static shared_ptr<ProcessSnapshot> s_processSnapshot;
+static Mutex s_processSnapshotLock(MutexType::FAST);
+
+/**
+ * Process snapshot TTL in milliseconds (0 to read /proc on every request)
+ */
+static uint32_t s_processSnapshotTTL = 1000;
+
+/**
+ * Read process snapshot configuration
+ */
+void InitProcessSnapshot(Config *config)
+{
+   s_processSnapshotTTL = config->getValueAsUInt(_T("/Linux/ProcessSnapshotTTL"), s_processSnapshotTTL);
+   nxlog_debug_tag(DEBUG_TAG, 3, _T("Process table snapshot TTL set to %u milliseconds"), s_processSnapshotTTL);
+}
+
+/**
+ * Get process table snapshot. Snapshot is re-read if existing one is older than configured TTL.
+ * Lock is held while reading so concurrent requests will wait for single scan of /proc.
+ * Returns null on failure.
+ */
+static shared_ptr<ProcessSnapshot> GetProcessSnapshot()
+{
+   s_processSnapshotLock.lock();
+   if ((s_processSnapshot == nullptr) || (GetCurrentTimeMs() - s_processSnapshot->getTimestamp() >= s_processSnapshotTTL))
+   {
+      auto snapshot = make_shared<ProcessSnapshot>();
+      if (snapshot->read())
+      {
+         nxlog_debug_tag(DEBUG_TAG, 7, _T("Process table snapshot updated (%d processes)"), snapshot->size());
+         s_processSnapshot = snapshot;
       }
+      else
+      {
+         s_processSnapshot.reset();
+      }
+   }
+   shared_ptr<ProcessSnapshot> snapshot = s_processSnapshot;
+   s_processSnapshotLock.unlock();
+   return snapshot;
+}
+
+/**
+ * Release process table snapshot
+ */
+void ReleaseProcessSnapshot()
+{
+   s_processSnapshotLock.lock();
+   s_processSnapshot.reset();
+   s_processSnapshotLock.unlock();
+}
+
+/**
+ * Select processes from snapshot
+ * Parameters:
+ *    snapshot - process table snapshot
+ *    plist    - array to fill (should not own objects), can be NULL
+ *    procNameFilter - If not NULL, only processes with matched name will
+ *               be counted and read. If cmdLineFilter is NULL, then exact
+ *               match required to pass filter; otherwise procNameFilter can
+ *               be a regular expression.
+ *    cmdLineFilter - If not NULL, only processes with command line matched to
+ *              regular expression will be counted and read.
+ *    procUser - If not NULL, only processes run by this user will be counted.
+ * Return value: number of matched processes.
+ */
+static int ProcRead(ProcessSnapshot *snapshot, ObjectArray<Process> *plist, const char *procNameFilter, const char *cmdLineFilter, const char *procUserFilter)
+{
+   nxlog_debug_tag(DEBUG_TAG, 6, _T("ProcRead(%p, \"%hs\",\"%hs\",\"%hs\")"), plist, CHECK_NULL_A(procNameFilter), CHECK_NULL_A(cmdLineFilter), CHECK_NULL_A(procUserFilter));
+
+   int count = 0;
+   for(int i = 0; i < snapshot->size(); i++)
+   {
+      Process *p = snapshot->get(i);
 
-      if ((plist != nullptr) && (pProcName != nullptr))
+      if ((procNameFilter != nullptr) && (*procNameFilter != 0))
       {
-         auto p = new Process(pid, pProcName, userName, processCmdLine);
-         // Parse rest of /proc/pid/stat file
-         if (pProcStat != nullptr)
+         if (cmdLineFilter == nullptr) // use old style compare
          {
-            if (sscanf(pProcStat, " %c %d %d %*d %*d %*d %*u %lu %*u %lu %*u %lu %lu %*u %*u %*d %*d %ld %*d %*u %lu %ld ",
-                       &p->state, &p->parent, &p->group, &p->minflt, &p->majflt,
-                       &p->utime, &p->ktime, &p->threads, &p->vmsize, &p->rss) != 10)
-            {
-               nxlog_debug_tag(DEBUG_TAG, 5, _T("Error parsing /proc/%u/stat"), pid);
-            }
+            if (strcmp(p->name, procNameFilter) != 0)
+               continue;
          }
-         if (readHandles)
+         else if (!RegexpMatchA(p->name, procNameFilter, false))
          {
-            strcpy(&fileName[fileNamePos], "fd");
-            p->fd = ReadProcessHandles(fileName);
+            continue;
          }
-         plist->add(p);
       }
 
+      // Check if user name matches pattern
+      if ((procUserFilter != nullptr) && (*procUserFilter != 0) && !RegexpMatchA(p->user, procUserFilter, true))
+         continue;
+
+      if ((cmdLineFilter != nullptr) && (*cmdLineFilter != 0) && !RegexpMatchA(CHECK_NULL_EX_A(snapshot->getCommandLine(p)), cmdLineFilter, true))
+         continue;
+
+      if (plist != nullptr)
+         plist->add(p);
       count++;
    }
-   closedir(dir);
    return count;
 }
 
@@ -372,10 +497,11 @@ LONG H_ProcessCount(const TCHAR *pszParam, const TCHAR *pArg, TCHAR *pValue, Abs
       AgentGetParameterArgA(pszParam, 3, userFilter, sizeof(userFilter));
    }
 
-   int count = ProcRead(nullptr, procNameFilter, (*pArg == _T('E')) ? cmdLineFilter : nullptr, (*pArg == _T('E')) ? userFilter : nullptr, false, false);
-   if (count == -1)
+   shared_ptr<ProcessSnapshot> snapshot = GetProcessSnapshot();
+   if (snapshot == nullptr)
       return SYSINFO_RC_ERROR;
 
+   int count = ProcRead(snapshot.get(), nullptr, procNameFilter, (*pArg == _T('E')) ? cmdLineFilter : nullptr, (*pArg == _T('E')) ? userFilter : nullptr);
    ret_int(pValue, count);
    return SYSINFO_RC_SUCCESS;
 }
@@ -385,19 +511,15 @@ LONG H_ProcessCount(const TCHAR *pszParam, const TCHAR *pArg, TCHAR *pValue, Abs
  */
 LONG H_ThreadCount(const TCHAR *param, const TCHAR *arg, TCHAR *value, AbstractCommSession *session)
 {
-   int i, sum, count, ret = SYSINFO_RC_ERROR;
-   ObjectArray<Process> procList(128, 128, Ownership::True);
-
-   count = ProcRead(&procList, nullptr, nullptr, nullptr, false, false);
-   if (count >= 0)
-   {
-      for (i = 0, sum = 0; i < procList.size(); i++)
-         sum += procList.get(i)->threads;
-      ret_int(value, sum);
-      ret = SYSINFO_RC_SUCCESS;
-   }
+   shared_ptr<ProcessSnapshot> snapshot = GetProcessSnapshot();
+   if (snapshot == nullptr)
+      return SYSINFO_RC_ERROR;
 
-   return ret;
+   int sum = 0;
+   for (int i = 0; i < snapshot->size(); i++)
+      sum += snapshot->get(i)->threads;
+   ret_int(value, sum);
+   return SYSINFO_RC_SUCCESS;
 }
 
 /**
@@ -405,22 +527,15 @@ LONG H_ThreadCount(const TCHAR *param, const TCHAR *arg, TCHAR *value, AbstractC
  */
 LONG H_HandleCount(const TCHAR *param, const TCHAR *arg, TCHAR *value, AbstractCommSession *session)
 {
-   int i, sum, count, ret = SYSINFO_RC_ERROR;
-   ObjectArray<Process> procList(128, 128, Ownership::True);
-
-   count = ProcRead(&procList, nullptr, nullptr, nullptr, true, false);
-   if (count >= 0)
-   {
-      for (i = 0, sum = 0; i < procList.size(); i++)
-      {
-         if (procList.get(i)->fd != NULL)
-            sum += procList.get(i)->fd->size();
-      }
-      ret_int(value, sum);
-      ret = SYSINFO_RC_SUCCESS;
-   }
+   shared_ptr<ProcessSnapshot> snapshot = GetProcessSnapshot();
+   if (snapshot == nullptr)
+      return SYSINFO_RC_ERROR;
 
-   return ret;
+   int sum = 0;
+   for (int i = 0; i < snapshot->size(); i++)
+      sum += snapshot->getHandleCount(snapshot->get(i));
+   ret_int(value, sum);
+   return SYSINFO_RC_SUCCESS;
 }
 
 /**
@@ -495,14 +610,13 @@ LONG H_ProcessDetails(const TCHAR *param, const TCHAR *arg, TCHAR *value, Abstra
    AgentGetParameterArgA(param, 4, userFilter, sizeof(userFilter));
    TrimA(cmdLineFilter);
 
-   ObjectArray<Process> procList(128, 128, Ownership::True);
-   count = ProcRead(&procList, procNameFilter, (cmdLineFilter[0] != 0) ? cmdLineFilter : nullptr,
-                    (userFilter[0] != 0) ? userFilter : nullptr, CAST_FROM_POINTER(arg, int) == PROCINFO_HANDLES, false);
-   nxlog_debug_tag(DEBUG_TAG, 5, _T("H_ProcessDetails(\"%hs\"): ProcRead() returns %d"), param, count);
-   if (count == -1)
+   shared_ptr<ProcessSnapshot> snapshot = GetProcessSnapshot();
+   if (snapshot == nullptr)
       return SYSINFO_RC_ERROR;
-   if (count == -2)
-      return SYSINFO_RC_UNSUPPORTED;
+
+   ObjectArray<Process> procList(128, 128, Ownership::False);
+   count = ProcRead(snapshot.get(), &procList, procNameFilter, (cmdLineFilter[0] != 0) ? cmdLineFilter : nullptr, (userFilter[0] != 0) ? userFilter : nullptr);
+   nxlog_debug_tag(DEBUG_TAG, 5, _T("H_ProcessDetails(\"%hs\"): ProcRead() returns %d"), param, count);
 
    long pageSize = getpagesize();
    long ticksPerSecond = sysconf(_SC_CLK_TCK);
@@ -515,7 +629,7 @@ LONG H_ProcessDetails(const TCHAR *param, const TCHAR *arg, TCHAR *value, Abstra
             currVal = (p->ktime + p->utime) * 1000 / ticksPerSecond;
             break;
          case PROCINFO_HANDLES:
-            currVal = (p->fd != NULL) ? p->fd->size() : 0;
+            currVal = snapshot->getHandleCount(p);
             break;
          case PROCINFO_KTIME:
             currVal = p->ktime * 1000 / ticksPerSecond;
@@ -570,23 +684,18 @@ LONG H_ProcessDetails(const TCHAR *param, const TCHAR *arg, TCHAR *value, Abstra
  */
 LONG H_ProcessList(const TCHAR *pszParam, const TCHAR *pArg, StringList *value, AbstractCommSession *session)
 {
-   int nRet = SYSINFO_RC_ERROR;
+   shared_ptr<ProcessSnapshot> snapshot = GetProcessSnapshot();
+   if (snapshot == nullptr)
+      return SYSINFO_RC_ERROR;
 
-   ObjectArray<Process> procList(128, 128, Ownership::True);
-   int nCount = ProcRead(&procList, nullptr, nullptr, nullptr, false, false);
-   if (nCount >= 0)
+   for (int i = 0; i < snapshot->size(); i++)
    {
-      nRet = SYSINFO_RC_SUCCESS;
-
-      for (int i = 0; i < procList.size(); i++)
-      {
-         Process *p = procList.get(i);
-         TCHAR szBuff[128];
-         _sntprintf(szBuff, sizeof(szBuff), _T("%d %hs"), p->pid, p->name);
-         value->add(szBuff);
-      }
+      Process *p = snapshot->get(i);
+      TCHAR szBuff[128];
+      _sntprintf(szBuff, sizeof(szBuff), _T("%d %hs"), p->pid, p->name);
+      value->add(szBuff);
    }
-   return nRet;
+   return SYSINFO_RC_SUCCESS;
 }
 
 /**
@@ -606,39 +715,34 @@ LONG H_ProcessTable(const TCHAR *cmd, const TCHAR *arg, Table *value, AbstractCo
    value->addColumn(_T("PAGE_FAULTS"), DCI_DT_UINT64, _T("Page Faults"));
    value->addColumn(_T("CMDLINE"), DCI_DT_STRING, _T("Command Line"));
 
-   int rc = SYSINFO_RC_ERROR;
+   shared_ptr<ProcessSnapshot> snapshot = GetProcessSnapshot();
+   if (snapshot == nullptr)
+      return SYSINFO_RC_ERROR;
 
-   ObjectArray<Process> procList(128, 128, Ownership::True);
-   int nCount = ProcRead(&procList, nullptr, nullptr, nullptr, true, true);
-   if (nCount >= 0)
+   uint64_t pageSize = getpagesize();
+   uint64_t ticksPerSecond = sysconf(_SC_CLK_TCK);
+   for (int i = 0; i < snapshot->size(); i++)
    {
-      rc = SYSINFO_RC_SUCCESS;
-
-      uint64_t pageSize = getpagesize();
-      uint64_t ticksPerSecond = sysconf(_SC_CLK_TCK);
-      for (int i = 0; i < procList.size(); i++)
-      {
-         Process *p = procList.get(i);
-         value->addRow();
-         value->set(0, p->pid);
+      Process *p = snapshot->get(i);
+      value->addRow();
+      value->set(0, p->pid);
 #ifdef UNICODE
-         value->setPreallocated(1, WideStringFromMBString(p->name));
-         value->setPreallocated(2, WideStringFromMBString(p->user));
+      value->setPreallocated(1, WideStringFromMBString(p->name));
+      value->setPreallocated(2, WideStringFromMBString(p->user));
 #else
-         value->set(1, p->name);
-         value->set(2, p->user);
+      value->set(1, p->name);
+      value->set(2, p->user);
 #endif
-         value->set(3, static_cast<uint32_t>(p->threads));
-         value->set(4, static_cast<uint32_t>((p->fd != nullptr) ? p->fd->size() : 0));
-         value->set(5, static_cast<uint64_t>(p->ktime) * 1000 / ticksPerSecond);
-         value->set(6, static_cast<uint64_t>(p->utime) * 1000 / ticksPerSecond);
-         value->set(7, static_cast<uint64_t>(p->vmsize));
-         value->set(8, static_cast<uint64_t>(p->rss) * pageSize);
-         value->set(9, static_cast<uint64_t>(p->minflt) + static_cast<uint64_t>(p->majflt));
-         value->set(10, p->cmdLine);
-      }
+      value->set(3, static_cast<uint32_t>(p->threads));
+      value->set(4, static_cast<uint32_t>(snapshot->getHandleCount(p)));
+      value->set(5, static_cast<uint64_t>(p->ktime) * 1000 / ticksPerSecond);
+      value->set(6, static_cast<uint64_t>(p->utime) * 1000 / ticksPerSecond);
+      value->set(7, static_cast<uint64_t>(p->vmsize));
+      value->set(8, static_cast<uint64_t>(p->rss) * pageSize);
+      value->set(9, static_cast<uint64_t>(p->minflt) + static_cast<uint64_t>(p->majflt));
+      value->set(10, snapshot->getCommandLine(p));
    }
-   return rc;
+   return SYSINFO_RC_SUCCESS;
 }
 
 /**
@@ -651,35 +755,31 @@ LONG H_OpenFilesTable(const TCHAR *cmd, const TCHAR *arg, Table *value, Abstract
    value->addColumn(_T("HANDLE"), DCI_DT_UINT, _T("Handle"), true);
    value->addColumn(_T("NAME"), DCI_DT_STRING, _T("Name"));
 
-   int rc = SYSINFO_RC_ERROR;
+   shared_ptr<ProcessSnapshot> snapshot = GetProcessSnapshot();
+   if (snapshot == nullptr)
+      return SYSINFO_RC_ERROR;
 
-   ObjectArray<Process> procList(128, 128, Ownership::True);
-   int nCount = ProcRead(&procList, nullptr, nullptr, nullptr, true, false);
-   if (nCount >= 0)
+   for (int i = 0; i < snapshot->size(); i++)
    {
-      rc = SYSINFO_RC_SUCCESS;
-
-      for (int i = 0; i < procList.size(); i++)
+      Process *p = snapshot->get(i);
+      const ObjectArray<FileDescriptor> *fd = snapshot->getHandles(p);
+      if (fd != nullptr)
       {
-         Process *p = procList.get(i);
-         if (p->fd != nullptr)
+         for (int j = 0; j < fd->size(); j++)
          {
-            for (int j = 0; j < p->fd->size(); j++)
-            {
-               FileDescriptor *f = p->fd->get(j);
-               value->addRow();
-               value->set(0, p->pid);
-               value->set(2, f->handle);
+            FileDescriptor *f = fd->get(j);
+            value->addRow();
+            value->set(0, p->pid);
+            value->set(2, f->handle);
 #ifdef UNICODE
-               value->setPreallocated(1, WideStringFromMBString(p->name));
-               value->setPreallocated(3, WideStringFromMBString(f->name));
+            value->setPreallocated(1, WideStringFromMBString(p->name));
+            value->setPreallocated(3, WideStringFromMBString(f->name));
 #else
-               value->set(1, p->name);
-               value->set(3, f->name);
+            value->set(1, p->name);
+            value->set(3, f->name);
 #endif
-            }
          }
       }
    }
-   return rc;
+   return SYSINFO_RC_SUCCESS;
 }
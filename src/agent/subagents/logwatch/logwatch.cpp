@@ -45,6 +45,15 @@ static void ParserThreadFile(LogParser *parser)
    parser->monitorFile(-1);
 }
 
+/**
+ * Start file parser. Parser is attached to shared tailer if possible, otherwise dedicated thread is created.
+ */
+static void StartFileParser(LogParser *parser)
+{
+   if (!parser->startTailing(-1))
+      parser->setThread(ThreadCreateEx(ParserThreadFile, parser));
+}
+
 #ifdef _WIN32
 
 /**
@@ -249,7 +258,7 @@ static void ParserThreadTemplate(LogParser *parser)
          p->setCallback(LogParserMatch);
          p->setDataPushCallback(AgentPushParameterData);
          p->setActionCallback(ExecuteAction);
-         p->setThread(ThreadCreateEx(ParserThreadFile, p));
+         StartFileParser(p);
          currentWatchedFiles.set(matchingFileList.get(i), p);
       }
 
@@ -420,10 +429,10 @@ static bool SubagentInit(Config *config)
 		}
 		else	// regular file
 		{
-			p->setThread(ThreadCreateEx(ParserThreadFile, p));
+			StartFileParser(p);
 		}
 #else
-		p->setThread(ThreadCreateEx(ParserThreadFile, p));
+		StartFileParser(p);
 #endif
 	}
 
@@ -496,10 +505,10 @@ static void OnAgentNotify(UINT32 code, void *data)
       }
       else	// regular file
       {
-         p->setThread(ThreadCreateEx(ParserThreadFile, p));
+         StartFileParser(p);
       }
 #else
-      p->setThread(ThreadCreateEx(ParserThreadFile, p));
+      StartFileParser(p);
 #endif
    }
 
@@ -35,55 +35,14 @@ static uint32_t s_pollsPerMinute = 4;
 static uint32_t s_maxTargetInactivityTime = 86400;
 static uint32_t s_movingAverageTimePeriod = 3600;
 static uint32_t s_options = PING_OPT_ALLOW_AUTOCONFIGURE;
+static uint32_t s_maxTransmitRate = 1000;
 
 /**
- * Poller
+ * Update target statistics with result of last poll (RTT 10000 indicates unreachable target)
  */
-static void Poller(PING_TARGET *target)
+static void UpdateStatistics(PING_TARGET *target)
 {
-	bool unreachable = false;
-	int64_t startTime = GetCurrentTimeMs();
-
-   if (target->automatic && (startTime / 1000 - target->lastDataRead > s_maxTargetInactivityTime))
-   {
-      nxlog_debug_tag(DEBUG_TAG, 3, _T("Target %s (%s) removed because of inactivity"), target->name, (const TCHAR *)target->ipAddr.toString());
-      s_targetLock.lock();
-      s_targets.remove(target);
-      s_targetLock.unlock();
-      return;
-   }
-
-   // recheck IP every 5 minutes
-   target->ipAddrAge++;
-   if (target->ipAddrAge >= s_pollsPerMinute * 5)
-   {
-      InetAddress ip = InetAddress::resolveHostName(target->dnsName);
-      if (!ip.equals(target->ipAddr))
-      {
-         TCHAR ip1[64], ip2[64];
-         nxlog_debug_tag(DEBUG_TAG, 6, _T("IP address for target %s changed from %s to %s"), target->name,
-                         target->ipAddr.toString(ip1), ip.toString(ip2));
-         target->ipAddr = ip;
-      }
-      target->ipAddrAge = 0;
-   }
-
-retry:
-   if (IcmpPing(target->ipAddr, 1, s_timeout, &target->lastRTT, target->packetSize, target->dontFragment) != ICMP_SUCCESS)
-   {
-      InetAddress ip = InetAddress::resolveHostName(target->dnsName);
-      if (!ip.equals(target->ipAddr))
-      {
-         TCHAR ip1[64], ip2[64];
-         nxlog_debug_tag(DEBUG_TAG, 6, _T("IP address for target %s changed from %s to %s"), target->name,
-                  target->ipAddr.toString(ip1), ip.toString(ip2));
-         target->ipAddr = ip;
-         goto retry;
-      }
-      target->lastRTT = 10000;
-      unreachable = true;
-   }
-
+   bool unreachable = (target->lastRTT == 10000);
    target->rttHistory[target->bufPos] = target->lastRTT;
 
    uint32_t sum = 0, count = 0, lost = 0, localMin = 0x7FFFFFFF, localMax = 0;
@@ -182,11 +141,126 @@ static void Poller(PING_TARGET *target)
    target->bufPos++;
    if (target->bufPos == (int)s_pollsPerMinute)
       target->bufPos = 0;
+}
+
+/**
+ * Re-resolve target's DNS name. Executed on poller thread pool, so slow name resolution does not delay
+ * polling of other targets. New address will be used starting from next poll.
+ */
+static void ResolveTargetAddress(PING_TARGET *target, TCHAR *dnsName)
+{
+   InetAddress ip = InetAddress::resolveHostName(dnsName);
+
+   s_targetLock.lock();
+   // Target could be removed while name was being resolved
+   if ((s_targets.indexOf(target) != -1) && !_tcscmp(target->dnsName, dnsName))
+   {
+      if (!ip.equals(target->ipAddr))
+      {
+         TCHAR ip1[64], ip2[64];
+         nxlog_debug_tag(DEBUG_TAG, 6, _T("IP address for target %s changed from %s to %s"), target->name,
+                         target->ipAddr.toString(ip1), ip.toString(ip2));
+         target->ipAddr = ip;
+      }
+      target->resolveInProgress = false;
+   }
+   s_targetLock.unlock();
+
+   MemFree(dnsName);
+}
+
+/**
+ * Schedule re-resolve of target's DNS name (should be called with target lock held)
+ */
+static void ScheduleAddressUpdate(PING_TARGET *target)
+{
+   if (target->resolveInProgress)
+      return;
+   target->resolveInProgress = true;
+   ThreadPoolExecute(s_pollers, ResolveTargetAddress, target, MemCopyString(target->dnsName));
+}
+
+/**
+ * Ping given targets as single batch
+ */
+static void PingTargets(const ObjectArray<PING_TARGET>& targets)
+{
+   IcmpPingTarget *pingTargets = new IcmpPingTarget[targets.size()];
+   s_targetLock.lock();
+   for(int i = 0; i < targets.size(); i++)
+   {
+      PING_TARGET *t = targets.get(i);
+      pingTargets[i].address = t->ipAddr;
+      pingTargets[i].packetSize = t->packetSize;
+      pingTargets[i].dontFragment = t->dontFragment;
+      pingTargets[i].userData = t;
+   }
+   s_targetLock.unlock();
+
+   IcmpPingBatch(pingTargets, targets.size(), 1, s_timeout);
+
+   for(int i = 0; i < targets.size(); i++)
+   {
+      PING_TARGET *t = targets.get(i);
+      t->lastRTT = (pingTargets[i].result == ICMP_SUCCESS) ? pingTargets[i].rtt : 10000;
+   }
+   delete[] pingTargets;
+}
+
+/**
+ * Poller. All targets are polled at once using batch ping.
+ */
+static void Poller()
+{
+   int64_t startTime = GetCurrentTimeMs();
+
+   ObjectArray<PING_TARGET> targets(s_targets.size(), 64, Ownership::False);
+   s_targetLock.lock();
+   for(int i = 0; i < s_targets.size(); i++)
+   {
+      PING_TARGET *t = s_targets.get(i);
+      if (t->automatic && (startTime / 1000 - t->lastDataRead > s_maxTargetInactivityTime))
+      {
+         nxlog_debug_tag(DEBUG_TAG, 3, _T("Target %s (%s) removed because of inactivity"), t->name, (const TCHAR *)t->ipAddr.toString());
+         s_targets.remove(i);
+         i--;
+      }
+      else
+      {
+         // recheck IP every 5 minutes
+         t->ipAddrAge++;
+         if (t->ipAddrAge >= s_pollsPerMinute * 5)
+         {
+            ScheduleAddressUpdate(t);
+            t->ipAddrAge = 0;
+         }
+         targets.add(t);
+      }
+   }
+   s_targetLock.unlock();
+
+   if (!targets.isEmpty())
+   {
+      PingTargets(targets);
+
+      // Recheck IP address of targets which are not responding
+      s_targetLock.lock();
+      for(int i = 0; i < targets.size(); i++)
+      {
+         PING_TARGET *t = targets.get(i);
+         if (t->lastRTT == 10000)
+            ScheduleAddressUpdate(t);
+      }
+      s_targetLock.unlock();
+
+      for(int i = 0; i < targets.size(); i++)
+         UpdateStatistics(targets.get(i));
+   }
 
    uint32_t elapsedTime = static_cast<uint32_t>(GetCurrentTimeMs() - startTime);
    uint32_t interval = 60000 / s_pollsPerMinute;
 
-   ThreadPoolScheduleRelative(s_pollers, (interval > elapsedTime) ? interval - elapsedTime : 1, Poller, target);
+   ThreadPoolScheduleRelative(s_pollers, (interval > elapsedTime) ? interval - elapsedTime : 1, Poller);
 }
 
 /**
@@ -318,8 +392,6 @@ static LONG H_PollResult(const TCHAR *param, const TCHAR *arg, TCHAR *value, Abs
          s_targets.add(t);
 
          nxlog_debug_tag(DEBUG_TAG, 3, _T("New ping target %s (%s) created from request"), t->name, (const TCHAR *)t->ipAddr.toString());
-
-         ThreadPoolExecute(s_pollers, Poller, t);
       }
       else
       {
@@ -586,6 +658,7 @@ static NX_CFG_TEMPLATE m_cfgTemplate[] =
 	{ _T("DefaultPacketSize"), CT_LONG, 0, 0, 0, 0, &s_defaultPacketSize, nullptr },
    { _T("DefaultDoNotFragmentFlag"), CT_BOOLEAN_FLAG_32, 0, 0, PING_OPT_DONT_FRAGMENT, 0, &s_options, nullptr },
    { _T("MaxTargetInactivityTime"), CT_LONG, 0, 0, 0, 0, &s_maxTargetInactivityTime, nullptr },
+   { _T("MaxTransmitRate"), CT_LONG, 0, 0, 0, 0, &s_maxTransmitRate, nullptr },
    { _T("MovingAverageTimePeriod"), CT_LONG, 0, 0, 0, 0, &s_movingAverageTimePeriod, nullptr },
 	{ _T("PacketRate"), CT_LONG, 0, 0, 0, 0, &s_pollsPerMinute, nullptr },
 	{ _T("Target"), CT_STRING_CONCAT, _T('\n'), 0, 0, 0, &m_pszTargetList, nullptr },
@@ -616,6 +689,9 @@ static bool SubagentInit(Config *config)
       s_pollsPerMinute = MAX_POLLS_PER_MINUTE;
    nxlog_debug_tag(DEBUG_TAG, 1, _T("Packet rate set to %d packets per minute (%d ms between packets)"), s_pollsPerMinute, 60000 / s_pollsPerMinute);
 
+   IcmpSetBatchPacketRate(s_maxTransmitRate);
+   nxlog_debug_tag(DEBUG_TAG, 1, _T("Maximum transmit rate set to %u packets per second"), s_maxTransmitRate);
+
    // Parse target list
    if (m_pszTargetList != nullptr)
    {
@@ -636,11 +712,7 @@ static bool SubagentInit(Config *config)
    }
 
    // First poll
-   for(int i = 0; i < s_targets.size(); i++)
-   {
-      PING_TARGET *t = s_targets.get(i);
-      ThreadPoolExecute(s_pollers, Poller, t);
-   }
+   ThreadPoolExecute(s_pollers, Poller);
 
 	return true;
 }
@@ -66,6 +66,7 @@ struct PING_TARGET
 	uint32_t ipAddrAge;
 	bool dontFragment;
 	bool automatic;
+	bool resolveInProgress;
 	time_t lastDataRead;
 };
 
@@ -4561,6 +4561,33 @@ public void unsubscribe(String channel) throws IOException, NXCException
       waitForRCC(msg.getMessageId());
    }
 
+   /**
+    * Limit object change notifications sent by server to given subset of objects. Object will be reported as changed
+    * only if it is one of given root objects or their child (directly or indirectly), and its class is in given class list.
+    * Empty or null root object or class list matches any object. Setting both lists empty removes filter.
+    * Notifications about deleted objects are always sent.
+    *
+    * @param rootObjects root objects (can be null)
+    * @param classes object classes (can be null)
+    * @throws IOException  if socket I/O error occurs
+    * @throws NXCException if NetXMS server returns an error or operation was timed out
+    */
+   public void setObjectUpdateFilter(long[] rootObjects, int[] classes) throws IOException, NXCException
+   {
+      NXCPMessage msg = newMessage(NXCPCodes.CMD_SET_OBJECT_UPDATE_FILTER);
+      if ((rootObjects != null) && (rootObjects.length > 0))
+         msg.setField(NXCPCodes.VID_OBJECT_LIST, rootObjects);
+      if ((classes != null) && (classes.length > 0))
+      {
+         long[] classList = new long[classes.length];
+         for(int i = 0; i < classes.length; i++)
+            classList[i] = classes[i];
+         msg.setField(NXCPCodes.VID_CLASS_ID_LIST, classList);
+      }
+      sendMessage(msg);
+      waitForRCC(msg.getMessageId());
+   }
+
    /**
     * Synchronize user database and subscribe to user change notifications
     *
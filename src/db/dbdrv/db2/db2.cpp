@@ -1143,7 +1143,8 @@ static DBDriverCallTable s_callTable =
    GetColumnCountUnbuffered,
    GetColumnNameUnbuffered,
    PrepareString,
-   IsTableExist
+   IsTableExist,
+   nullptr  // ResetStatement
 };
 
 DB_DRIVER_ENTRY_POINT("DB2", s_callTable)
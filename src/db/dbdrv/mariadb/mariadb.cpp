@@ -441,6 +441,19 @@ static void FreeStatement(DBDRV_STATEMENT hStmt)
 	MemFree(stmt);
 }
 
+/**
+ * Reset prepared statement to initial state (clear all bound parameters)
+ */
+static void ResetStatement(DBDRV_STATEMENT hStmt)
+{
+   auto stmt = static_cast<MARIADB_STATEMENT*>(hStmt);
+   memset(stmt->bindings, 0, sizeof(MYSQL_BIND) * stmt->paramCount);
+   memset(stmt->lengthFields, 0, sizeof(unsigned long) * stmt->paramCount);
+   for(int i = 0; i < stmt->paramCount; i++)
+      stmt->bindings[i].buffer_type = MYSQL_TYPE_NULL;
+   stmt->buffers->clear();
+}
+
 /**
  * Perform actual non-SELECT query
  */
@@ -1251,7 +1264,8 @@ static DBDriverCallTable s_callTable =
    GetColumnCountUnbuffered,
    GetColumnNameUnbuffered,
    PrepareString,
-   IsTableExist
+   IsTableExist,
+   ResetStatement
 };
 
 DB_DRIVER_ENTRY_POINT("MARIADB", s_callTable)
@@ -976,7 +976,8 @@ static DBDriverCallTable s_callTable =
    GetColumnCountUnbuffered,
    GetColumnNameUnbuffered,
    PrepareString,
-   IsTableExist
+   IsTableExist,
+   nullptr  // ResetStatement
 };
 
 DB_DRIVER_ENTRY_POINT("MSSQL", s_callTable)
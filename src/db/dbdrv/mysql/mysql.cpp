@@ -367,6 +367,19 @@ static void FreeStatement(DBDRV_STATEMENT hStmt)
 	MemFree(statement);
 }
 
+/**
+ * Reset prepared statement to initial state (clear all bound parameters)
+ */
+static void ResetStatement(DBDRV_STATEMENT hStmt)
+{
+   auto statement = static_cast<MYSQL_STATEMENT*>(hStmt);
+   memset(statement->bindings, 0, sizeof(MYSQL_BIND) * statement->paramCount);
+   memset(statement->lengthFields, 0, sizeof(unsigned long) * statement->paramCount);
+   for(int i = 0; i < statement->paramCount; i++)
+      statement->bindings[i].buffer_type = MYSQL_TYPE_NULL;
+   statement->buffers->clear();
+}
+
 /**
  * Perform actual non-SELECT query
  */
@@ -1178,7 +1191,8 @@ static DBDriverCallTable s_callTable =
    GetColumnCountUnbuffered,
    GetColumnNameUnbuffered,
    PrepareString,
-   IsTableExist
+   IsTableExist,
+   ResetStatement
 };
 
 DB_DRIVER_ENTRY_POINT("MYSQL", s_callTable)
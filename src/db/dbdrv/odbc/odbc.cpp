@@ -1267,7 +1267,8 @@ static DBDriverCallTable s_callTable =
    GetColumnCountUnbuffered,
    GetColumnNameUnbuffered,
    PrepareString,
-   IsTableExist
+   IsTableExist,
+   nullptr  // ResetStatement
 };
 
 DB_DRIVER_ENTRY_POINT("ODBC", s_callTable)
@@ -910,6 +910,36 @@ static void FreeStatement(DBDRV_STATEMENT hStmt)
 	MemFree(stmt);
 }
 
+/**
+ * Indicator for parameters reset to NULL
+ */
+static sb2 s_nullIndicator = -1;
+
+/**
+ * Reset prepared statement to initial state (clear all bound parameters)
+ */
+static void ResetStatement(DBDRV_STATEMENT hStmt)
+{
+   auto stmt = static_cast<ORACLE_STATEMENT*>(hStmt);
+   if (stmt->batchMode)
+   {
+      stmt->batchMode = false;
+      stmt->batchBindings->clear();
+   }
+
+   for(int i = 0; i < stmt->bindings->size(); i++)
+   {
+      OracleBind *bind = stmt->bindings->get(i);
+      if (bind == nullptr)
+         continue;
+
+      // Parameter is re-bound as NULL so statement handle does not reference released buffers
+      OCIBindByPos(stmt->handleStmt, &bind->handle, stmt->handleError, i + 1, nullptr, 0, SQLT_STR, &s_nullIndicator, nullptr, nullptr, 0, nullptr, OCI_DEFAULT);
+      MemFreeAndNull(bind->data);
+      bind->freeTemporaryLob();
+   }
+}
+
 /**
  * Perform non-SELECT query
  */
@@ -1740,7 +1770,8 @@ static DBDriverCallTable s_callTable =
    GetColumnCountUnbuffered,
    GetColumnNameUnbuffered,
    PrepareString,
-   IsTableExist
+   IsTableExist,
+   ResetStatement
 };
 
 DB_DRIVER_ENTRY_POINT("ORACLE", s_callTable)
@@ -460,6 +460,14 @@ static void FreeStatement(DBDRV_STATEMENT hStmt)
    delete stmt;
 }
 
+/**
+ * Reset prepared statement to initial state (clear all bound parameters)
+ */
+static void ResetStatement(DBDRV_STATEMENT hStmt)
+{
+   static_cast<PG_STATEMENT*>(hStmt)->buffers.clear();
+}
+
 /**
  * Perform non-SELECT query - internal implementation
  */
@@ -1204,7 +1212,8 @@ static DBDriverCallTable s_callTable =
    GetColumnCountUnbuffered,
    GetColumnNameUnbuffered,
    PrepareString,
-   IsTableExist
+   IsTableExist,
+   ResetStatement
 };
 
 DB_DRIVER_ENTRY_POINT("PGSQL", s_callTable)
@@ -249,6 +249,15 @@ static void FreeStatement(DBDRV_STATEMENT hStmt)
    sqlite3_finalize(static_cast<sqlite3_stmt*>(hStmt));
 }
 
+/**
+ * Reset prepared statement to initial state (clear all bound parameters)
+ */
+static void ResetStatement(DBDRV_STATEMENT hStmt)
+{
+   sqlite3_reset(static_cast<sqlite3_stmt*>(hStmt));
+   sqlite3_clear_bindings(static_cast<sqlite3_stmt*>(hStmt));
+}
+
 /**
  * Internal query
  */
@@ -781,7 +790,8 @@ static DBDriverCallTable s_callTable =
    GetColumnCountUnbuffered,
    GetColumnNameUnbuffered,
    PrepareString,
-   IsTableExist
+   IsTableExist,
+   ResetStatement
 };
 
 DB_DRIVER_ENTRY_POINT("SQLITE", s_callTable)
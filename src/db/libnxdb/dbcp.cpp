@@ -1,7 +1,7 @@
 /* 
 ** NetXMS - Network Management System
 ** Database Abstraction Library
-** Copyright (C) 2008-2021 Raden Solutions
+** Copyright (C) 2008-2022 Raden Solutions
 **
 ** This program is free software; you can redistribute it and/or modify
 ** it under the terms of the GNU Lesser General Public License as published by
@@ -31,19 +31,148 @@ static TCHAR m_password[256];
 static TCHAR m_dbName[256];
 static TCHAR m_schema[256];
 
-static int m_basePoolSize;
-static int m_maxPoolSize;
 static int m_cooldownTime;
 static int m_connectionTTL;
+static int m_statementCacheSize = 32;
 
 static Mutex m_poolAccessMutex;
 static ObjectArray<PoolConnectionInfo> m_connections;
 static THREAD m_maintThread = INVALID_THREAD_HANDLE;
 static Condition m_condShutdown(true);
-static Condition m_condRelease(false);
 
 #define DEBUG_TAG _T("db.cpool")
 
+/**
+ * Thread waiting for connection
+ */
+struct PoolWaiter
+{
+   PoolConnectionInfo *connection;  // Connection handed over by releasing thread
+   Condition wakeup;
+
+   PoolWaiter() : wakeup(false)
+   {
+      connection = nullptr;
+   }
+};
+
+/**
+ * Connection pool class data
+ */
+struct PoolClass
+{
+   const TCHAR *name;
+   int baseSize;
+   int maxSize;
+   ObjectArray<PoolWaiter> waiters;   // Waiting threads in arrival order
+   uint64_t acquireCount;
+   uint64_t waitCount;
+   uint64_t totalWaitTime;
+   uint32_t maxWaitTime;
+   uint64_t waitTimeHistogram[DB_POOL_HISTOGRAM_SIZE];
+   uint64_t connectCount;
+   uint64_t totalConnectTime;
+   uint32_t maxConnectTime;
+   uint64_t releaseCount;
+   uint64_t totalHoldTime;
+   uint32_t maxHoldTime;
+   uint64_t holdTimeHistogram[DB_POOL_HISTOGRAM_SIZE];
+
+   PoolClass(const TCHAR *_name, int _baseSize, int _maxSize) : waiters(16, 16, Ownership::False)
+   {
+      name = _name;
+      baseSize = _baseSize;
+      maxSize = _maxSize;
+      acquireCount = 0;
+      waitCount = 0;
+      totalWaitTime = 0;
+      maxWaitTime = 0;
+      memset(waitTimeHistogram, 0, sizeof(waitTimeHistogram));
+      connectCount = 0;
+      totalConnectTime = 0;
+      maxConnectTime = 0;
+      releaseCount = 0;
+      totalHoldTime = 0;
+      maxHoldTime = 0;
+      memset(holdTimeHistogram, 0, sizeof(holdTimeHistogram));
+   }
+};
+
+/**
+ * Pool classes (limits for interactive class are set on pool startup)
+ */
+static PoolClass m_classes[DB_POOL_CLASS_COUNT] =
+{
+   { _T("interactive"), 10, 30 },
+   { _T("writers"), 2, 20 },
+   { _T("housekeeping"), 0, 4 },
+   { _T("background"), 0, 10 }
+};
+
+/**
+ * Upper bounds of histogram buckets (in milliseconds)
+ */
+static const uint32_t s_histogramBounds[DB_POOL_HISTOGRAM_SIZE - 1] = { 1, 5, 10, 50, 100, 500, 1000, 5000, 10000 };
+
+/**
+ * Add value to histogram
+ */
+static inline void UpdateHistogram(uint64_t *histogram, uint32_t value)
+{
+   int i;
+   for(i = 0; i < DB_POOL_HISTOGRAM_SIZE - 1; i++)
+      if (value <= s_histogramBounds[i])
+         break;
+   histogram[i]++;
+}
+
+/**
+ * Get pool class data
+ */
+static inline PoolClass *GetPoolClass(DBConnectionPoolClass poolClass)
+{
+   return &m_classes[static_cast<int>(poolClass)];
+}
+
+/**
+ * Get number of connections in given class (pool access mutex must be locked by caller)
+ */
+static int GetClassConnectionCount(DBConnectionPoolClass poolClass)
+{
+   int count = 0;
+   for(int i = 0; i < m_connections.size(); i++)
+      if (m_connections.get(i)->poolClass == poolClass)
+         count++;
+   return count;
+}
+
+/**
+ * Create new connection for given class. Returns nullptr on failure.
+ */
+static PoolConnectionInfo *CreateConnection(DBConnectionPoolClass poolClass, TCHAR *errorText)
+{
+   DB_HANDLE handle = DBConnect(m_driver, m_server, m_dbName, m_login, m_password, m_schema, errorText);
+   if (handle == nullptr)
+      return nullptr;
+   DBSetStatementCacheSize(handle, m_statementCacheSize);
+
+   PoolConnectionInfo *conn = new PoolConnectionInfo;
+   conn->handle = handle;
+   conn->inUse = false;
+   conn->resetOnRelease = false;
+   conn->poolClass = poolClass;
+   conn->connectTime = time(nullptr);
+   conn->lastAccessTime = conn->connectTime;
+   conn->acquireTime = 0;
+   conn->usageCount = 0;
+   conn->statementCacheHits = 0;
+   conn->statementCacheMisses = 0;
+   conn->srcFile[0] = 0;
+   conn->srcLine = 0;
+   nxlog_debug_tag(DEBUG_TAG, 3, _T("Connection %p created (class %s)"), conn, GetPoolClass(poolClass)->name);
+   return conn;
+}
+
 /**
  * Create connections on pool initialization
  */
@@ -53,33 +182,57 @@ static bool DBConnectionPoolPopulate()
 	bool success = false;
 
 	m_poolAccessMutex.lock();
-	for(int i = 0; i < m_basePoolSize; i++)
+	for(int c = 0; c < DB_POOL_CLASS_COUNT; c++)
 	{
-      PoolConnectionInfo *conn = new PoolConnectionInfo;
-      conn->handle = DBConnect(m_driver, m_server, m_dbName, m_login, m_password, m_schema, errorText);
-      if (conn->handle != NULL)
-      {
-         conn->inUse = false;
-         conn->resetOnRelease = false;
-         conn->connectTime = time(NULL);
-         conn->lastAccessTime = conn->connectTime;
-         conn->usageCount = 0;
-         conn->srcFile[0] = 0;
-         conn->srcLine = 0;
-         m_connections.add(conn);
-         nxlog_debug_tag(DEBUG_TAG, 3, _T("Connection %p created"), conn);
-         success = true;
-      }
-      else
-      {
-         nxlog_debug_tag(DEBUG_TAG, 3, _T("Cannot create DB connection %d (%s)"), i, errorText);
-         delete conn;
-      }
+	   for(int i = 0; i < m_classes[c].baseSize; i++)
+	   {
+	      PoolConnectionInfo *conn = CreateConnection(static_cast<DBConnectionPoolClass>(c), errorText);
+	      if (conn != nullptr)
+	      {
+	         m_connections.add(conn);
+	         success = true;
+	      }
+	      else
+	      {
+	         nxlog_debug_tag(DEBUG_TAG, 3, _T("Cannot create DB connection %d for class %s (%s)"), i, m_classes[c].name, errorText);
+	      }
+	   }
 	}
 	m_poolAccessMutex.unlock();
 	return success;
 }
 
+/**
+ * Wake up first thread waiting for connection in given class, so it can try to create new connection
+ * (pool access mutex must be locked by caller)
+ */
+static inline void WakeUpFirstWaiter(DBConnectionPoolClass poolClass)
+{
+   PoolClass *pc = GetPoolClass(poolClass);
+   if (!pc->waiters.isEmpty())
+      pc->waiters.get(0)->wakeup.set();
+}
+
+/**
+ * Return connection to pool or hand it over directly to first waiting thread
+ * (pool access mutex must be locked by caller)
+ */
+static void ReturnConnectionToPool(PoolConnectionInfo *conn)
+{
+   PoolClass *pc = GetPoolClass(conn->poolClass);
+   if (!pc->waiters.isEmpty())
+   {
+      PoolWaiter *waiter = pc->waiters.get(0);
+      pc->waiters.remove(0);
+      waiter->connection = conn;
+      waiter->wakeup.set();
+   }
+   else
+   {
+      conn->inUse = false;
+   }
+}
+
 /**
  * Shrink connection pool up to base size when possible
  */
@@ -87,16 +240,21 @@ static void DBConnectionPoolShrink()
 {
 	m_poolAccessMutex.lock();
 
+	int counts[DB_POOL_CLASS_COUNT];
+	for(int c = 0; c < DB_POOL_CLASS_COUNT; c++)
+	   counts[c] = GetClassConnectionCount(static_cast<DBConnectionPoolClass>(c));
+
    time_t now = time(nullptr);
-   for(int i = m_basePoolSize; i < m_connections.size(); i++)
+   for(int i = m_connections.size() - 1; i >= 0; i--)
 	{
       PoolConnectionInfo *conn = m_connections.get(i);
-		if (!conn->inUse && (now - conn->lastAccessTime > m_cooldownTime))
+      int c = static_cast<int>(conn->poolClass);
+		if (!conn->inUse && (counts[c] > m_classes[c].baseSize) && (now - conn->lastAccessTime > m_cooldownTime))
 		{
 			DBDisconnect(conn->handle);
 	      nxlog_debug_tag(DEBUG_TAG, 3, _T("Connection %p terminated"), conn);
          m_connections.remove(i);
-         i--;
+         counts[c]--;
 		}
 	}
 
@@ -115,6 +273,7 @@ static bool ResetConnection(PoolConnectionInfo *conn)
 	conn->handle = DBConnect(m_driver, m_server, m_dbName, m_login, m_password, m_schema, errorText);
 	if (conn->handle != NULL)
    {
+	   DBSetStatementCacheSize(conn->handle, m_statementCacheSize);
 		conn->connectTime = now;
 		conn->lastAccessTime = now;
 		conn->usageCount = 0;
@@ -181,11 +340,13 @@ static void ResetExpiredConnections()
    	m_poolAccessMutex.lock();
 		if (success)
 		{
-			conn->inUse = false;
+		   ReturnConnectionToPool(conn);
 		}
 		else
 		{
+		   DBConnectionPoolClass poolClass = conn->poolClass;
 			m_connections.remove(conn);
+			WakeUpFirstWaiter(poolClass);
 		}
 		m_poolAccessMutex.unlock();
 	}
@@ -212,6 +373,29 @@ static THREAD_RESULT THREAD_CALL MaintenanceThread(void *arg)
    return THREAD_OK;
 }
 
+/**
+ * Set base and maximum number of connections for given pool class. Limits for interactive
+ * class are also set by DBConnectionPoolStartup.
+ */
+void LIBNXDB_EXPORTABLE DBConnectionPoolSetClassLimits(DBConnectionPoolClass poolClass, int baseSize, int maxSize)
+{
+   m_poolAccessMutex.lock();
+   PoolClass *pc = GetPoolClass(poolClass);
+   pc->baseSize = std::max(baseSize, 0);
+   pc->maxSize = std::max(maxSize, std::max(pc->baseSize, 1));
+   m_poolAccessMutex.unlock();
+   nxlog_debug_tag(DEBUG_TAG, 3, _T("Connection limits for class %s set to %d/%d"), pc->name, pc->baseSize, pc->maxSize);
+}
+
+/**
+ * Set size of prepared statement cache for pooled connections (0 to disable cache).
+ * Should be called before pool startup.
+ */
+void LIBNXDB_EXPORTABLE DBConnectionPoolSetStatementCacheSize(int size)
+{
+   m_statementCacheSize = std::max(size, 0);
+}
+
 /**
  * Start connection pool
  */
@@ -230,8 +414,7 @@ bool LIBNXDB_EXPORTABLE DBConnectionPoolStartup(DB_DRIVER driver, const TCHAR *s
 	_tcslcpy(m_password, CHECK_NULL_EX(password), 256);
 	_tcslcpy(m_schema, CHECK_NULL_EX(schema), 256);
 
-	m_basePoolSize = basePoolSize;
-	m_maxPoolSize = maxPoolSize;
+	DBConnectionPoolSetClassLimits(DBConnectionPoolClass::INTERACTIVE, basePoolSize, maxPoolSize);
 	m_cooldownTime = cooldownTime;
    m_connectionTTL = connTTL;
 
@@ -280,17 +463,23 @@ void LIBNXDB_EXPORTABLE DBConnectionPoolReset()
 {
    m_poolAccessMutex.lock();
 
+   int counts[DB_POOL_CLASS_COUNT];
+   for(int c = 0; c < DB_POOL_CLASS_COUNT; c++)
+      counts[c] = GetClassConnectionCount(static_cast<DBConnectionPoolClass>(c));
+
    for(int i = 0; i < m_connections.size(); i++)
    {
       PoolConnectionInfo *conn = m_connections.get(i);
+      int c = static_cast<int>(conn->poolClass);
       if (conn->inUse)
       {
          conn->resetOnRelease = true;
       }
-      else if (m_connections.size() > m_basePoolSize)
+      else if (counts[c] > m_classes[c].baseSize)
       {
          DBDisconnect(conn->handle);
          m_connections.remove(i);
+         counts[c]--;
          i--;
       }
       else
@@ -298,6 +487,7 @@ void LIBNXDB_EXPORTABLE DBConnectionPoolReset()
          if (!ResetConnection(conn))
          {
             m_connections.remove(i);
+            counts[c]--;
             i--;
          }
       }
@@ -307,75 +497,122 @@ void LIBNXDB_EXPORTABLE DBConnectionPoolReset()
 }
 
 /**
- * Acquire connection from pool. This function never fails - if it's impossible to acquire
- * pooled connection, calling thread will be suspended until there will be connection available.
+ * Take least used idle connection of given class or create new one if class limit is not reached yet.
+ * Returned connection is marked as in use. Time spent creating new connection is added to connectTime.
+ * Pool access mutex must be locked by caller.
  */
-DB_HANDLE LIBNXDB_EXPORTABLE __DBConnectionPoolAcquireConnection(const char *srcFile, int srcLine)
+static PoolConnectionInfo *TakeIdleConnection(DBConnectionPoolClass poolClass, uint32_t *connectTime)
 {
-retry:
-	m_poolAccessMutex.lock();
-
-	DB_HANDLE handle = nullptr;
-
-	// find less used connection
    uint32_t count = 0xFFFFFFFF;
-	int index = -1;
-   for(int i = 0; (i < m_connections.size()) && (count > 0); i++)
-	{
+   PoolConnectionInfo *selected = nullptr;
+   int classSize = 0;
+   for(int i = 0; i < m_connections.size(); i++)
+   {
       PoolConnectionInfo *conn = m_connections.get(i);
+      if (conn->poolClass != poolClass)
+         continue;
+      classSize++;
       if (!conn->inUse && (conn->usageCount < count))
       {
          count = conn->usageCount;
-         index = i;
-		}
-	}
+         selected = conn;
+      }
+   }
 
-	if (index > -1)
-	{
-		PoolConnectionInfo *conn = m_connections.get(index);
-		handle = conn->handle;
-		conn->inUse = true;
-		conn->lastAccessTime = time(nullptr);
-		conn->usageCount++;
-		strlcpy(conn->srcFile, srcFile, 128);
-		conn->srcLine = srcLine;
-	}
-   else if (m_connections.size() < m_maxPoolSize)
-	{
-	   TCHAR errorText[DBDRV_MAX_ERROR_TEXT];
-      PoolConnectionInfo *conn = new PoolConnectionInfo;
-      conn->handle = DBConnect(m_driver, m_server, m_dbName, m_login, m_password, m_schema, errorText);
-      if (conn->handle != NULL)
+   if ((selected == nullptr) && (classSize < GetPoolClass(poolClass)->maxSize))
+   {
+      TCHAR errorText[DBDRV_MAX_ERROR_TEXT];
+      int64_t startTime = GetCurrentTimeMs();
+      selected = CreateConnection(poolClass, errorText);
+      uint32_t elapsed = static_cast<uint32_t>(GetCurrentTimeMs() - startTime);
+      *connectTime += elapsed;
+      if (selected != nullptr)
       {
-         conn->inUse = true;
-         conn->resetOnRelease = false;
-         conn->connectTime = time(NULL);
-         conn->lastAccessTime = conn->connectTime;
-         conn->usageCount = 0;
-         strlcpy(conn->srcFile, srcFile, 128);
-         conn->srcLine = srcLine;
-         m_connections.add(conn);
-         handle = conn->handle;
-         nxlog_debug_tag(DEBUG_TAG, 3, _T("Connection %p created"), conn);
+         m_connections.add(selected);
+
+         PoolClass *pc = GetPoolClass(poolClass);
+         pc->connectCount++;
+         pc->totalConnectTime += elapsed;
+         if (elapsed > pc->maxConnectTime)
+            pc->maxConnectTime = elapsed;
       }
       else
       {
-         nxlog_debug_tag(DEBUG_TAG, 3, _T("Cannot create additional DB connection (%s)"), errorText);
-         delete conn;
+         nxlog_debug_tag(DEBUG_TAG, 3, _T("Cannot create additional DB connection for class %s (%s)"), GetPoolClass(poolClass)->name, errorText);
       }
-	}
+   }
 
-	m_poolAccessMutex.unlock();
+   if (selected != nullptr)
+      selected->inUse = true;
+   return selected;
+}
+
+/**
+ * Acquire connection from pool. This function never fails - if it's impossible to acquire
+ * pooled connection, calling thread will be suspended until there will be connection available.
+ * Waiting threads are served in order of arrival.
+ */
+DB_HANDLE LIBNXDB_EXPORTABLE __DBConnectionPoolAcquireConnection(DBConnectionPoolClass poolClass, const char *srcFile, int srcLine)
+{
+   PoolClass *pc = GetPoolClass(poolClass);
+   int64_t startTime = GetCurrentTimeMs();
+   uint32_t connectTime = 0;  // Time spent creating new connections is not counted as wait time
+
+	m_poolAccessMutex.lock();
 
-	if (handle == NULL)
+	// Do not take connection ahead of already waiting threads
+	PoolConnectionInfo *conn = pc->waiters.isEmpty() ? TakeIdleConnection(poolClass, &connectTime) : nullptr;
+	if (conn == nullptr)
 	{
-   	nxlog_debug_tag(DEBUG_TAG, 1, _T("Database connection pool exhausted (call from %hs:%d)"), srcFile, srcLine);
-      m_condRelease.wait(10000);
-      nxlog_debug_tag(DEBUG_TAG, 5, _T("Retry acquire connection (call from %hs:%d)"), srcFile, srcLine);
-      goto retry;
+	   PoolWaiter waiter;
+	   pc->waiters.add(&waiter);
+	   pc->waitCount++;
+	   nxlog_debug_tag(DEBUG_TAG, 1, _T("Database connection pool exhausted for class %s (call from %hs:%d)"), pc->name, srcFile, srcLine);
+	   while(true)
+	   {
+	      m_poolAccessMutex.unlock();
+	      waiter.wakeup.wait(10000);
+	      m_poolAccessMutex.lock();
+
+	      if (waiter.connection != nullptr)
+	      {
+	         conn = waiter.connection;
+	         break;
+	      }
+
+	      // Connections could be removed from pool, try to create new one if this thread is first in queue
+	      if (pc->waiters.get(0) == &waiter)
+	      {
+	         conn = TakeIdleConnection(poolClass, &connectTime);
+	         if (conn != nullptr)
+	         {
+	            pc->waiters.remove(0);
+	            break;
+	         }
+	      }
+	      nxlog_debug_tag(DEBUG_TAG, 5, _T("Retry acquire connection for class %s (call from %hs:%d)"), pc->name, srcFile, srcLine);
+	   }
 	}
 
-   nxlog_debug_tag(DEBUG_TAG, 7, _T("Handle %p acquired (call from %hs:%d)"), handle, srcFile, srcLine);
+	int64_t now = GetCurrentTimeMs();
+	conn->lastAccessTime = static_cast<time_t>(now / 1000);
+	conn->acquireTime = now;
+	conn->usageCount++;
+	strlcpy(conn->srcFile, srcFile, 128);
+	conn->srcLine = srcLine;
+
+	uint32_t waitTime = static_cast<uint32_t>(now - startTime);
+	waitTime = (waitTime > connectTime) ? waitTime - connectTime : 0;
+	pc->acquireCount++;
+	pc->totalWaitTime += waitTime;
+	if (waitTime > pc->maxWaitTime)
+	   pc->maxWaitTime = waitTime;
+	UpdateHistogram(pc->waitTimeHistogram, waitTime);
+
+	DB_HANDLE handle = conn->handle;
+	m_poolAccessMutex.unlock();
+
+   nxlog_debug_tag(DEBUG_TAG, 7, _T("Handle %p acquired (class %s, call from %hs:%d)"), handle, pc->name, srcFile, srcLine);
 	return handle;
 }
 
@@ -391,6 +628,14 @@ void LIBNXDB_EXPORTABLE DBConnectionPoolReleaseConnection(DB_HANDLE handle)
       PoolConnectionInfo *conn = m_connections.get(i);
       if (conn->handle == handle)
 		{
+         PoolClass *pc = GetPoolClass(conn->poolClass);
+         uint32_t holdTime = static_cast<uint32_t>(GetCurrentTimeMs() - conn->acquireTime);
+         pc->releaseCount++;
+         pc->totalHoldTime += holdTime;
+         if (holdTime > pc->maxHoldTime)
+            pc->maxHoldTime = holdTime;
+         UpdateHistogram(pc->holdTimeHistogram, holdTime);
+
          conn->srcFile[0] = 0;
          conn->srcLine = 0;
          if (conn->resetOnRelease)
@@ -400,17 +645,19 @@ void LIBNXDB_EXPORTABLE DBConnectionPoolReleaseConnection(DB_HANDLE handle)
             m_poolAccessMutex.lock();
             if (success)
             {
-               conn->inUse = false;
+               ReturnConnectionToPool(conn);
             }
             else
             {
-               m_connections.remove(i);
+               DBConnectionPoolClass poolClass = conn->poolClass;
+               m_connections.remove(conn);
+               WakeUpFirstWaiter(poolClass);
             }
          }
          else
          {
-            conn->inUse = false;
             conn->lastAccessTime = time(NULL);
+            ReturnConnectionToPool(conn);
          }
 			break;
 		}
@@ -419,7 +666,6 @@ void LIBNXDB_EXPORTABLE DBConnectionPoolReleaseConnection(DB_HANDLE handle)
 	m_poolAccessMutex.unlock();
 
    nxlog_debug_tag(DEBUG_TAG, 7, _T("Handle %p released"), handle);
-   m_condRelease.pulse();
 }
 
 /**
@@ -447,6 +693,67 @@ int LIBNXDB_EXPORTABLE DBConnectionPoolGetAcquiredCount()
    return count;
 }
 
+/**
+ * Get statistics for given pool class
+ */
+void LIBNXDB_EXPORTABLE DBConnectionPoolGetClassStats(DBConnectionPoolClass poolClass, DBConnectionPoolClassStats *stats)
+{
+   PoolClass *pc = GetPoolClass(poolClass);
+   m_poolAccessMutex.lock();
+   stats->baseSize = pc->baseSize;
+   stats->maxSize = pc->maxSize;
+   stats->size = 0;
+   stats->acquired = 0;
+   for(int i = 0; i < m_connections.size(); i++)
+   {
+      PoolConnectionInfo *conn = m_connections.get(i);
+      if (conn->poolClass == poolClass)
+      {
+         stats->size++;
+         if (conn->inUse)
+            stats->acquired++;
+      }
+   }
+   stats->waiting = pc->waiters.size();
+   stats->acquireCount = pc->acquireCount;
+   stats->waitCount = pc->waitCount;
+   stats->totalWaitTime = pc->totalWaitTime;
+   stats->maxWaitTime = pc->maxWaitTime;
+   memcpy(stats->waitTimeHistogram, pc->waitTimeHistogram, sizeof(stats->waitTimeHistogram));
+   stats->connectCount = pc->connectCount;
+   stats->totalConnectTime = pc->totalConnectTime;
+   stats->maxConnectTime = pc->maxConnectTime;
+   stats->releaseCount = pc->releaseCount;
+   stats->totalHoldTime = pc->totalHoldTime;
+   stats->maxHoldTime = pc->maxHoldTime;
+   memcpy(stats->holdTimeHistogram, pc->holdTimeHistogram, sizeof(stats->holdTimeHistogram));
+   m_poolAccessMutex.unlock();
+}
+
+/**
+ * Get name of pool class
+ */
+const TCHAR LIBNXDB_EXPORTABLE *DBConnectionPoolGetClassName(DBConnectionPoolClass poolClass)
+{
+   return GetPoolClass(poolClass)->name;
+}
+
+/**
+ * Find pool class by name (case insensitive)
+ */
+bool LIBNXDB_EXPORTABLE DBConnectionPoolClassFromName(const TCHAR *name, DBConnectionPoolClass *poolClass)
+{
+   for(int c = 0; c < DB_POOL_CLASS_COUNT; c++)
+   {
+      if (!_tcsicmp(m_classes[c].name, name))
+      {
+         *poolClass = static_cast<DBConnectionPoolClass>(c);
+         return true;
+      }
+   }
+   return false;
+}
+
 /**
  * Get copy of active DB connections.
  * Returned list must be deleted by the caller.
@@ -462,6 +769,7 @@ ObjectArray<PoolConnectionInfo> LIBNXDB_EXPORTABLE *DBConnectionPoolGetConnectio
       {
          PoolConnectionInfo *ci = new PoolConnectionInfo;
          memcpy(ci, curr, sizeof(PoolConnectionInfo));
+         DBGetStatementCacheStats(curr->handle, &ci->statementCacheHits, &ci->statementCacheMisses);
          list->add(ci);
       }
    }
@@ -67,6 +67,8 @@ struct db_statement_t
 	DB_HANDLE m_connection;
 	DBDRV_STATEMENT m_statement;
 	TCHAR *m_query;
+	uint32_t m_queryHash;
+	bool m_cacheable;    // Statement can be returned to connection's statement cache
 };
 
 /**
@@ -86,16 +88,24 @@ struct db_handle_t
    char *m_dbName;
    char *m_schema;
    ObjectArray<db_statement_t> m_preparedStatements;
+   ObjectArray<db_statement_t> m_statementCache;   // Idle cached statements, most recently used last
+   int m_statementCacheSize;
+   uint64_t m_statementCacheHits;
+   uint64_t m_statementCacheMisses;
    Mutex m_preparedStatementsLock;
 
    db_handle_t(DB_DRIVER driver, DBDRV_CONNECTION connection, char *dbName, char *login, char *password, char *server, char *schema) :
-         m_mutexTransLock(MutexType::RECURSIVE), m_preparedStatements(4, 4, Ownership::False), m_preparedStatementsLock(MutexType::FAST)
+         m_mutexTransLock(MutexType::RECURSIVE), m_preparedStatements(4, 4, Ownership::False),
+         m_statementCache(0, 16, Ownership::False), m_preparedStatementsLock(MutexType::FAST)
    {
       m_driver = driver;
       m_reconnectEnabled = true;
       m_sqlQueryExecTimeThreshold = 0;
       m_connection = connection;
       m_transactionLevel = 0;
+      m_statementCacheSize = 0;
+      m_statementCacheHits = 0;
+      m_statementCacheMisses = 0;
       m_dbName = dbName;
       m_login = login;
       m_password = password;
@@ -47,6 +47,17 @@ static bool s_queryTrace = false;
  */
 static void (*s_sessionInitCb)(DB_HANDLE session) = nullptr;
 
+/**
+ * Destroy statement object
+ */
+static inline void DestroyStatement(DB_STATEMENT hStmt)
+{
+   if (hStmt->m_statement != nullptr)
+      hStmt->m_driver->m_callTable.FreeStatement(hStmt->m_statement);
+   MemFree(hStmt->m_query);
+   MemFree(hStmt);
+}
+
 /**
  * Invalidate all prepared statements on connection
  */
@@ -61,6 +72,54 @@ static void InvalidatePreparedStatements(DB_HANDLE hConn)
       stmt->m_connection = nullptr;
    }
    hConn->m_preparedStatements.clear();
+
+   // Cached statements are not referenced outside connection and can be destroyed
+   for(int i = 0; i < hConn->m_statementCache.size(); i++)
+      DestroyStatement(hConn->m_statementCache.get(i));
+   hConn->m_statementCache.clear();
+   hConn->m_preparedStatementsLock.unlock();
+}
+
+/**
+ * Calculate hash for query text (FNV-1a)
+ */
+static uint32_t HashQuery(const TCHAR *query)
+{
+   uint32_t hash = 2166136261U;
+   for(const TCHAR *p = query; *p != 0; p++)
+   {
+      hash ^= static_cast<uint32_t>(*p);
+      hash *= 16777619U;
+   }
+   return hash;
+}
+
+/**
+ * Set size of prepared statement cache for connection. Statements prepared on connection with
+ * enabled cache are returned to cache by DBFreeStatement and reused by subsequent DBPrepare calls
+ * with same query text. Bound parameters of cached statement are cleared before it is reused.
+ * Cache is not used if database driver cannot reset statement. Setting size to 0 disables cache.
+ */
+void LIBNXDB_EXPORTABLE DBSetStatementCacheSize(DB_HANDLE hConn, int size)
+{
+   hConn->m_preparedStatementsLock.lock();
+   hConn->m_statementCacheSize = std::max(size, 0);
+   while(hConn->m_statementCache.size() > hConn->m_statementCacheSize)
+   {
+      DestroyStatement(hConn->m_statementCache.get(0));
+      hConn->m_statementCache.remove(0);
+   }
+   hConn->m_preparedStatementsLock.unlock();
+}
+
+/**
+ * Get prepared statement cache statistics for connection
+ */
+void LIBNXDB_EXPORTABLE DBGetStatementCacheStats(DB_HANDLE hConn, uint64_t *hits, uint64_t *misses)
+{
+   hConn->m_preparedStatementsLock.lock();
+   *hits = hConn->m_statementCacheHits;
+   *misses = hConn->m_statementCacheMisses;
    hConn->m_preparedStatementsLock.unlock();
 }
 
@@ -1132,6 +1191,43 @@ DB_STATEMENT LIBNXDB_EXPORTABLE DBPrepareEx(DB_HANDLE hConn, const TCHAR *query,
 	DB_STATEMENT result = nullptr;
 	INT64 ms;
 
+	// Check statement cache first (only for drivers which can reset statement to initial state)
+	uint32_t queryHash = 0;
+	bool cacheable = false;
+	if ((hConn->m_statementCacheSize > 0) && (hConn->m_driver->m_callTable.ResetStatement != nullptr))
+	{
+	   queryHash = HashQuery(query);
+	   hConn->m_preparedStatementsLock.lock();
+	   for(int i = hConn->m_statementCache.size() - 1; i >= 0; i--)
+	   {
+	      db_statement_t *stmt = hConn->m_statementCache.get(i);
+	      if ((stmt->m_queryHash == queryHash) && !_tcscmp(stmt->m_query, query))
+	      {
+	         hConn->m_statementCache.remove(i);
+	         hConn->m_preparedStatements.add(stmt);
+	         hConn->m_statementCacheHits++;
+	         result = stmt;
+	         break;
+	      }
+	   }
+	   if (result == nullptr)
+	      hConn->m_statementCacheMisses++;
+	   hConn->m_preparedStatementsLock.unlock();
+
+	   if (result != nullptr)
+	   {
+	      // Clear parameters bound by previous user of cached statement
+	      hConn->m_driver->m_callTable.ResetStatement(result->m_statement);
+	      if (s_queryTrace)
+	         nxlog_debug_tag(DEBUG_TAG_QUERY, 9, _T("{%p} prepare from cache: \"%s\""), result, query);
+	      return result;
+	   }
+
+	   // Statement will be reused, so let driver optimize it
+	   optimizeForReuse = true;
+	   cacheable = true;
+	}
+
 #ifdef UNICODE
 #define wcQuery query
 #define wcErrorText errorText
@@ -1161,6 +1257,8 @@ DB_STATEMENT LIBNXDB_EXPORTABLE DBPrepareEx(DB_HANDLE hConn, const TCHAR *query,
 		result->m_connection = hConn;
 		result->m_statement = stmt;
 		result->m_query = _tcsdup(query);
+		result->m_queryHash = queryHash;
+		result->m_cacheable = cacheable;
 	}
 	else
 	{
@@ -1209,25 +1307,37 @@ DB_STATEMENT LIBNXDB_EXPORTABLE DBPrepare(DB_HANDLE hConn, const TCHAR *query, b
 }
 
 /**
- * Destroy prepared statement
+ * Destroy prepared statement or return it to connection's statement cache
  */
 void LIBNXDB_EXPORTABLE DBFreeStatement(DB_STATEMENT hStmt)
 {
    if (hStmt == nullptr)
       return;
 
-   if (hStmt->m_connection != nullptr)
-   {
-      hStmt->m_connection->m_preparedStatementsLock.lock();
-      hStmt->m_connection->m_preparedStatements.remove(hStmt);
-      hStmt->m_connection->m_preparedStatementsLock.unlock();
-   }
-   if (hStmt->m_statement != nullptr)
+   DB_HANDLE hConn = hStmt->m_connection;
+   if (hConn != nullptr)
    {
-      hStmt->m_driver->m_callTable.FreeStatement(hStmt->m_statement);
+      hConn->m_preparedStatementsLock.lock();
+      hConn->m_preparedStatements.remove(hStmt);
+      if (hStmt->m_cacheable && (hConn->m_statementCacheSize > 0))
+      {
+         hConn->m_statementCache.add(hStmt);
+         if (hConn->m_statementCache.size() > hConn->m_statementCacheSize)
+         {
+            // Evict least recently used statement
+            hStmt = hConn->m_statementCache.get(0);
+            hConn->m_statementCache.remove(0);
+         }
+         else
+         {
+            hStmt = nullptr;
+         }
+      }
+      hConn->m_preparedStatementsLock.unlock();
    }
-   MemFree(hStmt->m_query);
-   MemFree(hStmt);
+
+   if (hStmt != nullptr)
+      DestroyStatement(hStmt);
 }
 
 /**
@@ -22,6 +22,42 @@
 
 #include "libnetxms.h"
 
+/**
+ * Transmission pacing for batch ping (packets per second, 0 = unlimited)
+ */
+static uint32_t s_batchPacketRate = 0;
+static int64_t s_nextTransmitSlot = 0;   // in microseconds
+static Mutex s_pacerLock(MutexType::FAST);
+
+/**
+ * Set maximum packet rate for batch ping (0 to disable pacing). Rate is shared by all concurrent batches.
+ * Single target requests (including IcmpPing calls) are not paced.
+ */
+void LIBNETXMS_EXPORTABLE IcmpSetBatchPacketRate(uint32_t packetsPerSecond)
+{
+   s_batchPacketRate = packetsPerSecond;
+}
+
+/**
+ * Wait for next transmit slot according to configured packet rate
+ */
+static void WaitForTransmitSlot()
+{
+   uint32_t rate = s_batchPacketRate;
+   if (rate == 0)
+      return;
+
+   int64_t now = GetCurrentTimeMs() * 1000;
+   s_pacerLock.lock();
+   int64_t slot = std::max(now, s_nextTransmitSlot);
+   s_nextTransmitSlot = slot + 1000000 / rate;
+   s_pacerLock.unlock();
+
+   // Sleep only if ahead of schedule by at least one millisecond, smaller gaps are sent in bursts
+   if (slot - now >= 1000)
+      ThreadSleepMs(static_cast<uint32_t>((slot - now) / 1000));
+}
+
 #ifdef _WIN32
 
 #include <iphlpapi.h>
@@ -144,6 +180,23 @@ uint32_t LIBNETXMS_EXPORTABLE IcmpPing(const InetAddress &addr, int numRetries,
    return rc;
 }
 
+/**
+ * Ping multiple targets. Windows version executes requests sequentially.
+ */
+void LIBNETXMS_EXPORTABLE IcmpPingBatch(IcmpPingTarget *targets, size_t count, int numRetries, uint32_t timeout, void (*callback)(IcmpPingTarget*, void*), void *context)
+{
+   for(size_t i = 0; i < count; i++)
+   {
+      IcmpPingTarget *t = &targets[i];
+      if (count > 1)
+         WaitForTransmitSlot();
+      t->rtt = 0;
+      t->result = IcmpPing(t->address, numRetries, timeout, &t->rtt, t->packetSize, t->dontFragment);
+      if (callback != nullptr)
+         callback(t, context);
+   }
+}
+
 #else	/* not _WIN32 */
 
 #include <nxnet.h>
@@ -158,43 +211,82 @@ enum PingRequestState
    COMPLETED = 2
 };
 
+struct PingBatch;
+
 /**
  * Ping request
  */
 struct PingRequest
 {
-   PingRequest *next;
    uint64_t timestamp;
    InetAddress address;
    uint32_t packetSize;
-   uint32_t timeout;
    uint32_t result;
    uint32_t rtt;
    uint16_t sequence;
    bool dontFragment;
    PingRequestState state;
-#ifdef _USE_GNU_PTH
-   pth_cond_t wakeupCondition;
-#else
-   pthread_cond_t wakeupCondition;
-#endif
+   PingBatch *batch;
+
+   PingRequest()
+   {
+      timestamp = 0;
+      packetSize = 0;
+      result = ICMP_SUCCESS;
+      rtt = 0;
+      sequence = 0;
+      dontFragment = false;
+      state = PENDING;
+      batch = nullptr;
+   }
 };
 
 /**
- * Mark request as completed from processing thread
+ * Key for outstanding request lookup. Identifier is the same for all requests sent by one processor,
+ * so requests are matched by destination address and sequence number.
  */
-static inline void CloseRequest(PingRequest *r, int32_t result)
+struct PingRequestKey
 {
-   if (r->state != COMPLETED)
+   BYTE address[18];
+   uint16_t sequence;
+
+   PingRequestKey(const InetAddress& a, uint16_t s)
    {
-      r->state = COMPLETED;
-      r->result = result;
-#ifdef _USE_GNU_PTH
-      pth_cond_notify(&r->wakeupCondition, false);
-#else
-      pthread_cond_signal(&r->wakeupCondition);
-#endif
+      a.buildHashKey(address);
+      sequence = s;
+   }
+};
+
+/**
+ * Batch of ping requests. Completed requests are queued by processing thread and handled by batch owner thread.
+ */
+struct PingBatch
+{
+   Mutex mutex;
+   Condition wakeup;
+   ObjectArray<PingRequest> completed;
+
+   PingBatch() : mutex(MutexType::FAST), wakeup(false), completed(64, 64, Ownership::False)
+   {
+   }
+
+   void complete(PingRequest *r)
+   {
+      mutex.lock();
+      completed.add(r);
+      mutex.unlock();
+      wakeup.set();
    }
+};
+
+/**
+ * Mark request as completed from processing thread (request should be already removed from outstanding request list)
+ */
+static inline void CloseRequest(PingRequest *r, uint32_t result)
+{
+   r->state = COMPLETED;
+   r->result = result;
+   r->batch->complete(r);
 }
 
 /**
@@ -203,12 +295,8 @@ static inline void CloseRequest(PingRequest *r, int32_t result)
 class PingRequestProcessor
 {
 private:
-   PingRequest *m_head;
-#ifdef _USE_GNU_PTH
-   pth_mutex_t m_mutex;
-#else
-   pthread_mutex_t m_mutex;
-#endif
+   HashMap<PingRequestKey, PingRequest> m_requests;
+   Mutex m_mutex;
    SOCKET m_dataSocket;
    SOCKET m_controlSockets[2];
    THREAD m_processingThread;
@@ -241,15 +329,15 @@ class PingRequestProcessor
    PingRequestProcessor(int family);
    ~PingRequestProcessor();
 
-   uint32_t ping(const InetAddress &addr, uint32_t timeout, uint32_t *rtt, uint32_t packetSize, bool dontFragment);
+   bool start(PingRequest *request);
+   bool cancel(PingRequest *request);
 };
 
 /**
  * Constructor
  */
-PingRequestProcessor::PingRequestProcessor(int family)
+PingRequestProcessor::PingRequestProcessor(int family) : m_requests(Ownership::False), m_mutex(MutexType::FAST)
 {
-   m_head = MemAllocStruct<PingRequest>();
    m_dataSocket = INVALID_SOCKET;
    m_controlSockets[0] = INVALID_SOCKET;
    m_controlSockets[1] = INVALID_SOCKET;
@@ -259,19 +347,6 @@ PingRequestProcessor::PingRequestProcessor(int family)
    m_sequence = 0;
    m_family = family;
    m_shutdown = false;
-#ifdef _USE_GNU_PTH
-   pth_mutex_init(&m_mutex);
-#else
-#if HAVE_DECL_PTHREAD_MUTEX_ADAPTIVE_NP
-   pthread_mutexattr_t a;
-   pthread_mutexattr_init(&a);
-   MUTEXATTR_SETTYPE(&a, PTHREAD_MUTEX_ADAPTIVE_NP);
-   pthread_mutex_init(&m_mutex, &a);
-   pthread_mutexattr_destroy(&a);
-#else
-   pthread_mutex_init(&m_mutex, nullptr);
-#endif
-#endif
 }
 
 /**
@@ -279,26 +354,14 @@ PingRequestProcessor::PingRequestProcessor(int family)
  */
 PingRequestProcessor::~PingRequestProcessor()
 {
-#ifdef _USE_GNU_PTH
-   pth_mutex_acquire(&m_mutex, FALSE, nullptr);
-#else
-   pthread_mutex_lock(&m_mutex);
-#endif
+   m_mutex.lock();
    m_shutdown = true;
-#ifdef _USE_GNU_PTH
-   pth_mutex_release(&m_mutex);
-#else
-   pthread_mutex_unlock(&m_mutex);
-#endif
+   m_mutex.unlock();
 
    if (m_controlSockets[1] != INVALID_SOCKET)
       write(m_controlSockets[1], "S", 1);
 
    ThreadJoin(m_processingThread);
-   MemFree(m_head);
-#ifndef _USE_GNU_PTH
-   pthread_mutex_destroy(&m_mutex);
-#endif
 
    close(m_dataSocket);
    close(m_controlSockets[0]);
@@ -354,37 +417,25 @@ void PingRequestProcessor::processingThread()
 
       if (sp.isSet(m_dataSocket))
       {
-#ifdef _USE_GNU_PTH
-         pth_mutex_acquire(&m_mutex, FALSE, nullptr);
-#else
-         pthread_mutex_lock(&m_mutex);
-#endif
+         m_mutex.lock();
          if (m_family == AF_INET)
             receivePacketV4();
          else
             receivePacketV6();
-#ifdef _USE_GNU_PTH
-         pth_mutex_release(&m_mutex);
-#else
-         pthread_mutex_unlock(&m_mutex);
-#endif
+         m_mutex.unlock();
       }
    }
 
    // Cancel all pending requests
-#ifdef _USE_GNU_PTH
-   pth_mutex_acquire(&m_mutex, FALSE, nullptr);
-#else
-   pthread_mutex_lock(&m_mutex);
-#endif
-   for(PingRequest *r = m_head->next; r != nullptr; r = r->next)
+   m_mutex.lock();
+   auto it = m_requests.begin();
+   while(it.hasNext())
+   {
+      PingRequest *r = it.next();
+      it.unlink();
       CloseRequest(r, ICMP_API_ERROR);
-   m_head->next = nullptr;
-#ifdef _USE_GNU_PTH
-   pth_mutex_release(&m_mutex);
-#else
-   pthread_mutex_unlock(&m_mutex);
-#endif
+   }
+   m_mutex.unlock();
 }
 
 /**
@@ -392,14 +443,13 @@ void PingRequestProcessor::processingThread()
  */
 void PingRequestProcessor::processEchoReply(const InetAddress& addr, uint16_t sequence)
 {
-   for(PingRequest *r = m_head->next; r != nullptr; r = r->next)
+   PingRequestKey key(addr, sequence);
+   PingRequest *r = m_requests.get(key);
+   if (r != nullptr)
    {
-      if (r->address.equals(addr) && (r->sequence == sequence))
-      {
-         r->rtt = GetCurrentTimeMs() - r->timestamp;
-         CloseRequest(r, ICMP_SUCCESS);
-         break;
-      }
+      r->rtt = static_cast<uint32_t>(GetCurrentTimeMs() - r->timestamp);
+      m_requests.unlink(key);
+      CloseRequest(r, ICMP_SUCCESS);
    }
 }
 
@@ -408,9 +458,16 @@ void PingRequestProcessor::processEchoReply(const InetAddress& addr, uint16_t se
  */
 void PingRequestProcessor::processHostUnreachable(const InetAddress& addr)
 {
-   for(PingRequest *r = m_head->next; r != nullptr; r = r->next)
+   auto it = m_requests.begin();
+   while(it.hasNext())
+   {
+      PingRequest *r = it.next();
       if (r->address.equals(addr))
+      {
+         it.unlink();
          CloseRequest(r, ICMP_UNREACHABLE);
+      }
+   }
 }
 
 /**
@@ -649,125 +706,74 @@ void PingRequestProcessor::sendRequestV6(PingRequest *request)
 }
 
 /**
- * Do ping
+ * Start request. Returns true if request packet was sent and completion will be reported to request's batch.
+ * If false is returned request is already completed with error.
  */
-uint32_t PingRequestProcessor::ping(const InetAddress &addr, uint32_t timeout, uint32_t *rtt, uint32_t packetSize, bool dontFragment)
+bool PingRequestProcessor::start(PingRequest *request)
 {
-   PingRequest request;
-   memset(&request, 0, sizeof(request));
-   request.address = addr;
-   request.packetSize = packetSize;
-   request.dontFragment = dontFragment;
-   request.timeout = timeout;
-   request.timestamp = GetCurrentTimeMs();
-#ifdef _USE_GNU_PTH
-   pth_cond_init(&request.wakeupCondition);
-#else
-   pthread_cond_init(&request.wakeupCondition, nullptr);
-#endif
+   m_mutex.lock();
+   if (m_shutdown)
+   {
+      m_mutex.unlock();
+      request->result = ICMP_API_ERROR;
+      request->state = COMPLETED;
+      return false;
+   }
 
-#ifdef _USE_GNU_PTH
-   pth_mutex_acquire(&m_mutex, FALSE, nullptr);
-#else
-   pthread_mutex_lock(&m_mutex);
-#endif
-   if (!m_shutdown)
+   uint32_t rc = ICMP_SUCCESS;
+   if ((m_dataSocket == INVALID_SOCKET) && !openSocket())
    {
-      if (m_dataSocket == INVALID_SOCKET)
+      rc = ICMP_RAW_SOCK_FAILED;
+   }
+   if (m_processingThread == INVALID_THREAD_HANDLE)
+   {
+      if (pipe(m_controlSockets) == 0)
       {
-         if (!openSocket())
-         {
-            request.result = ICMP_RAW_SOCK_FAILED;
-         }
+         m_processingThread = ThreadCreateEx(this, &PingRequestProcessor::processingThread);
       }
-      if (m_processingThread == INVALID_THREAD_HANDLE)
+      else
       {
-         if (pipe(m_controlSockets) == 0)
-         {
-            m_processingThread = ThreadCreateEx(this, &PingRequestProcessor::processingThread);
-         }
-         else
-         {
-            request.result = ICMP_API_ERROR;
-         }
+         rc = ICMP_API_ERROR;
       }
+   }
 
-      if (request.result == ICMP_SUCCESS) // Continue only if request processor is ready
+   bool success;
+   if (rc == ICMP_SUCCESS) // Continue only if request processor is ready
+   {
+      request->sequence = m_sequence++;
+      request->timestamp = GetCurrentTimeMs();
+      success = sendRequest(request);
+      if (success)
       {
-         request.sequence = m_sequence++;
-         if (sendRequest(&request))
-         {
-            // Only add request to list if request packet was sent successfully
-            request.next = m_head->next;
-            m_head->next = &request;
-
-#ifdef _USE_GNU_PTH
-            pth_event_t ev = pth_event(PTH_EVENT_TIME, pth_timeout(timeout / 1000, (timeout % 1000) * 1000));
-            int waitResult = pth_cond_await(&request.wakeupCondition, &m_mutex, ev);
-            if (waitResult > 0)
-            {
-               if (pth_event_status(ev) != PTH_STATUS_OCCURRED)
-                  waitResult = 0; // Success, condition signalled
-            }
-            else
-            {
-               waitResult = -1; // Failure
-            }
-            pth_event_free(ev, PTH_FREE_ALL);
-#else /* not _USE_GNU_PTH */
-#if HAVE_PTHREAD_COND_RELTIMEDWAIT_NP
-            struct timespec ts;
-            ts.tv_sec = timeout / 1000;
-            ts.tv_nsec = (timeout % 1000) * 1000000;
-            int waitResult = pthread_cond_reltimedwait_np(&request.wakeupCondition, &m_mutex, &ts);
-#else
-            struct timeval now;
-            gettimeofday(&now, nullptr);
-            now.tv_usec += (timeout % 1000) * 1000;
-
-            struct timespec ts;
-            ts.tv_sec = now.tv_sec + (timeout / 1000) + now.tv_usec / 1000000;
-            ts.tv_nsec = (now.tv_usec % 1000000) * 1000;
-            int waitResult = pthread_cond_timedwait(&request.wakeupCondition, &m_mutex, &ts);
-#endif
-#endif
-
-            // Check request state in addition to timeout for case when response was received and processed
-            // after pthread_cond_timedwait timeouts but before mutex was acquired by waiting thread
-            if ((waitResult != 0) && (request.state == IN_PROGRESS))
-            {
-               request.result = ICMP_TIMEOUT;
-            }
-
-            // Remove request from list
-            for(PingRequest *p = m_head; p->next != nullptr; p = p->next)
-            {
-               if (p->next == &request)
-               {
-                  p->next = request.next;
-                  break;
-               }
-            }
-         }
+         // Only add request to list if request packet was sent successfully
+         m_requests.set(PingRequestKey(request->address, request->sequence), request);
       }
    }
    else
    {
-      request.result = ICMP_API_ERROR;
+      request->result = rc;
+      request->state = COMPLETED;
+      success = false;
    }
-#ifdef _USE_GNU_PTH
-   pth_mutex_release(&m_mutex);
-#else
-   pthread_mutex_unlock(&m_mutex);
-#endif
-
-#ifndef _USE_GNU_PTH
-   pthread_cond_destroy(&request.wakeupCondition);
-#endif
+   m_mutex.unlock();
+   return success;
+}
 
-   if (rtt != nullptr)
-      *rtt = request.rtt;
-   return request.result;
+/**
+ * Cancel outstanding request on timeout. Returns false if request was completed before cancellation.
+ */
+bool PingRequestProcessor::cancel(PingRequest *request)
+{
+   m_mutex.lock();
+   bool cancelled = (request->state == IN_PROGRESS);
+   if (cancelled)
+   {
+      m_requests.unlink(PingRequestKey(request->address, request->sequence));
+      request->result = ICMP_TIMEOUT;
+      request->state = COMPLETED;
+   }
+   m_mutex.unlock();
+   return cancelled;
 }
 
 /**
@@ -779,17 +785,195 @@ static PingRequestProcessor s_processorV6(AF_INET6);
 #endif
 
 /**
- * Ping with retries
+ * Get request processor for given address
+ */
+static inline PingRequestProcessor *GetRequestProcessor(const InetAddress& addr)
+{
+   if (addr.getFamily() == AF_INET)
+      return &s_processorV4;
+#ifdef WITH_IPV6
+   if (addr.getFamily() == AF_INET6)
+      return &s_processorV6;
+#endif
+   return nullptr;
+}
+
+/**
+ * Batch execution context
+ */
+struct PingBatchContext
+{
+   PingBatch batch;
+   PingRequest *requests;
+   IcmpPingTarget *targets;
+   PingRequest **sent;     // Requests sent in current round, in order of transmission
+   size_t sentCount;
+   size_t expiryCursor;    // First sent request which is not checked for expiration yet
+   size_t outstanding;     // Number of requests sent in current round and not completed yet
+   size_t remaining;       // Number of targets without final result
+   bool lastAttempt;
+   uint32_t timeout;
+   void (*callback)(IcmpPingTarget*, void*);
+   void *context;
+
+   PingBatchContext(IcmpPingTarget *_targets, size_t count, uint32_t _timeout, void (*_callback)(IcmpPingTarget*, void*), void *_context)
+   {
+      requests = new PingRequest[count];
+      targets = _targets;
+      sent = MemAllocArrayNoInit<PingRequest*>(count);
+      sentCount = 0;
+      expiryCursor = 0;
+      outstanding = 0;
+      remaining = count;
+      lastAttempt = false;
+      timeout = _timeout;
+      callback = _callback;
+      context = _context;
+   }
+
+   ~PingBatchContext()
+   {
+      delete[] requests;
+      MemFree(sent);
+   }
+
+   void setFinalResult(PingRequest *r)
+   {
+      IcmpPingTarget *t = &targets[r - requests];
+      t->result = r->result;
+      t->rtt = r->rtt;
+      remaining--;
+      if (callback != nullptr)
+         callback(t, context);
+   }
+
+   void processCompletions();
+   void processExpiredRequests();
+};
+
+/**
+ * Process requests completed by processing thread
  */
-static inline uint32_t PingLoop(PingRequestProcessor *p, const InetAddress &addr, int numRetries, uint32_t timeout, uint32_t *rtt, uint32_t packetSize, bool dontFragment)
+void PingBatchContext::processCompletions()
 {
-   while(numRetries-- > 0)
+   ObjectArray<PingRequest> completed(64, 64, Ownership::False);
+   batch.mutex.lock();
+   for(int i = 0; i < batch.completed.size(); i++)
+      completed.add(batch.completed.get(i));
+   batch.completed.clear();
+   batch.mutex.unlock();
+
+   for(int i = 0; i < completed.size(); i++)
    {
-      uint32_t result = p->ping(addr, timeout, rtt, packetSize, dontFragment);
-      if (result != ICMP_TIMEOUT)
-         return result;
+      outstanding--;
+      setFinalResult(completed.get(i));
+   }
+}
+
+/**
+ * Cancel requests with expired timeout. Requests are checked in order of transmission, so
+ * check stops at first request which is not expired yet.
+ */
+void PingBatchContext::processExpiredRequests()
+{
+   uint64_t now = GetCurrentTimeMs();
+   for(; expiryCursor < sentCount; expiryCursor++)
+   {
+      PingRequest *r = sent[expiryCursor];
+      if (r->timestamp + timeout > now)
+         break;
+      if (!GetRequestProcessor(r->address)->cancel(r))
+         continue;   // Already completed, will be picked up from completion queue
+
+      outstanding--;
+      if (lastAttempt)
+      {
+         setFinalResult(r);
+      }
+      else
+      {
+         r->state = PENDING;   // Will be re-sent in next round
+         r->result = ICMP_SUCCESS;
+      }
+   }
+}
+
+/**
+ * Ping multiple targets. Requests are sent asynchronously with rate limited by IcmpSetBatchPacketRate,
+ * and replies are matched by processing thread. Callback (if provided) is called from calling thread
+ * as soon as final result for target is known. Function returns when all targets are completed.
+ */
+void LIBNETXMS_EXPORTABLE IcmpPingBatch(IcmpPingTarget *targets, size_t count, int numRetries, uint32_t timeout, void (*callback)(IcmpPingTarget*, void*), void *context)
+{
+   if (count == 0)
+      return;
+
+   PingBatchContext ctx(targets, count, timeout, callback, context);
+   for(size_t i = 0; i < count; i++)
+   {
+      PingRequest *r = &ctx.requests[i];
+      r->address = targets[i].address;
+      r->packetSize = targets[i].packetSize;
+      if (r->packetSize < MIN_PING_SIZE)
+         r->packetSize = MIN_PING_SIZE;
+      else if (r->packetSize > MAX_PING_SIZE)
+         r->packetSize = MAX_PING_SIZE;
+      r->dontFragment = targets[i].dontFragment;
+      r->batch = &ctx.batch;
+      targets[i].result = ICMP_TIMEOUT;
+      targets[i].rtt = 0;
+   }
+
+   if (numRetries < 1)
+      numRetries = 1;
+   for(int attempt = 0; (attempt < numRetries) && (ctx.remaining > 0); attempt++)
+   {
+      ctx.lastAttempt = (attempt == numRetries - 1);
+      ctx.sentCount = 0;
+      ctx.expiryCursor = 0;
+
+      for(size_t i = 0; i < count; i++)
+      {
+         PingRequest *r = &ctx.requests[i];
+         if (r->state != PENDING)
+            continue;
+
+         if (count > 1)
+            WaitForTransmitSlot();
+         PingRequestProcessor *p = GetRequestProcessor(r->address);
+         if (p == nullptr)
+         {
+            r->result = ICMP_API_ERROR;
+            r->state = COMPLETED;
+            ctx.setFinalResult(r);
+         }
+         else if (p->start(r))
+         {
+            ctx.sent[ctx.sentCount++] = r;
+            ctx.outstanding++;
+         }
+         else
+         {
+            ctx.setFinalResult(r);
+         }
+
+         ctx.processCompletions();
+         ctx.processExpiredRequests();
+      }
+
+      while(ctx.outstanding > 0)
+      {
+         ctx.processCompletions();
+         ctx.processExpiredRequests();
+         if ((ctx.outstanding == 0) || (ctx.expiryCursor == ctx.sentCount))
+            continue;   // All remaining requests (if any) are already in completion queue
+
+         uint64_t expirationTime = ctx.sent[ctx.expiryCursor]->timestamp + timeout;
+         uint64_t now = GetCurrentTimeMs();
+         if (expirationTime > now)
+            ctx.batch.wakeup.wait(static_cast<uint32_t>(expirationTime - now));
+      }
    }
-   return ICMP_TIMEOUT;
 }
 
 /**
@@ -804,18 +988,15 @@ static inline uint32_t PingLoop(PingRequestProcessor *p, const InetAddress &addr
  */
 uint32_t LIBNETXMS_EXPORTABLE IcmpPing(const InetAddress &addr, int numRetries, uint32_t timeout, uint32_t *rtt, uint32_t packetSize, bool dontFragment)
 {
-   if (packetSize < MIN_PING_SIZE)
-      packetSize = MIN_PING_SIZE;
-   else if (packetSize > MAX_PING_SIZE)
-      packetSize = MAX_PING_SIZE;
-
-   if (addr.getFamily() == AF_INET)
-      return PingLoop(&s_processorV4, addr, numRetries, timeout, rtt, packetSize, dontFragment);
-#ifdef WITH_IPV6
-   if (addr.getFamily() == AF_INET6)
-      return PingLoop(&s_processorV6, addr, numRetries, timeout, rtt, packetSize, dontFragment);
-#endif
-   return ICMP_API_ERROR;
+   IcmpPingTarget target;
+   target.address = addr;
+   target.packetSize = packetSize;
+   target.dontFragment = dontFragment;
+   target.userData = nullptr;
+   IcmpPingBatch(&target, 1, numRetries, timeout);
+   if (rtt != nullptr)
+      *rtt = target.rtt;
+   return target.result;
 }
 
 #endif   /* _WIN32 */
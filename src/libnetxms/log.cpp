@@ -158,22 +158,41 @@ static inline void FreeFormattedString(TCHAR *message, msg_buffer_t localBuffer)
 }
 
 /**
- * Write string to file
+ * Convert string to file encoding (UTF-8) using local or dynamic buffer. Returned string should be freed with FreeEncodedString.
  */
-static inline void FileWrite(int fh, const TCHAR *text)
+static inline char *EncodeForFile(const TCHAR *text, char *localBuffer)
 {
 #ifdef UNICODE
    size_t len = wchar_utf8len(text, -1);
-   char localBuffer[LOCAL_MSG_BUFFER_SIZE];
    char *buffer = AllocateStringBufferA(len + 1, localBuffer);
    wchar_to_utf8(text, -1, buffer, len + 1);
-   _write(fh, buffer, strlen(buffer));
-   FreeStringBuffer(buffer, localBuffer);
+   return buffer;
 #else
-   _write(fh, text, strlen(text));
+   return const_cast<char*>(text);
 #endif
 }
 
+/**
+ * Free string returned by EncodeForFile
+ */
+static inline void FreeEncodedString(char *encoded, char *localBuffer)
+{
+#ifdef UNICODE
+   FreeStringBuffer(encoded, localBuffer);
+#endif
+}
+
+/**
+ * Write string to file
+ */
+static inline void FileWrite(int fh, const TCHAR *text)
+{
+   char localBuffer[LOCAL_MSG_BUFFER_SIZE];
+   char *buffer = EncodeForFile(text, localBuffer);
+   _write(fh, buffer, strlen(buffer));
+   FreeEncodedString(buffer, localBuffer);
+}
+
 /**
  * Write formatted string to file
  */
@@ -346,11 +365,10 @@ void LIBNETXMS_EXPORTABLE nxlog_set_debug_writer(NxLogDebugWriter writer)
 }
 
 /**
- * Format current time for output
+ * Format given time (in milliseconds since epoch) for output
  */
-static TCHAR *FormatLogTimestamp(TCHAR *buffer)
+static TCHAR *FormatLogTimestamp(TCHAR *buffer, int64_t now)
 {
-	INT64 now = GetCurrentTimeMs();
 	time_t t = now / 1000;
 #if HAVE_LOCALTIME_R
 	struct tm ltmBuffer;
@@ -363,6 +381,14 @@ static TCHAR *FormatLogTimestamp(TCHAR *buffer)
 	return buffer;
 }
 
+/**
+ * Format current time for output
+ */
+static inline TCHAR *FormatLogTimestamp(TCHAR *buffer)
+{
+   return FormatLogTimestamp(buffer, GetCurrentTimeMs());
+}
+
 /**
  * Format tag for printing
  */
@@ -457,6 +483,371 @@ static TCHAR *EscapeForJSON(const TCHAR *text, TCHAR *localBuffer, size_t *len)
    return buffer;
 }
 
+/**
+ * Get severity marker for text log format
+ */
+static inline const TCHAR *GetTextSeverityMarker(int16_t severity)
+{
+   switch(severity)
+   {
+      case NXLOG_ERROR:
+         return _T("*E* [");
+      case NXLOG_WARNING:
+         return _T("*W* [");
+      case NXLOG_INFO:
+         return _T("*I* [");
+      case NXLOG_DEBUG:
+         return _T("*D* [");
+      default:
+         return _T("*?* [");
+   }
+}
+
+/**
+ * Get severity name for JSON log format
+ */
+static inline const TCHAR *GetJsonSeverityName(int16_t severity)
+{
+   switch(severity)
+   {
+      case NXLOG_ERROR:
+         return _T("error");
+      case NXLOG_WARNING:
+         return _T("warning");
+      case NXLOG_DEBUG:
+         return _T("debug");
+      default:
+         return _T("info");
+   }
+}
+
+/**
+ * Append log record formatted according to current log format to given string buffer
+ */
+static void AppendFormattedRecord(StringBuffer *output, int16_t severity, const TCHAR *tag, const TCHAR *message, const TCHAR *timestamp)
+{
+   if (s_flags & NXLOG_JSON_FORMAT)
+   {
+      TCHAR escapedTagBuffer[LOCAL_MSG_BUFFER_SIZE], escapedMessageBuffer[LOCAL_MSG_BUFFER_SIZE];
+      size_t tagLen, messageLen;
+      TCHAR *escapedTag = EscapeForJSON(CHECK_NULL_EX(tag), escapedTagBuffer, &tagLen);
+      TCHAR *escapedMessage = EscapeForJSON(message, escapedMessageBuffer, &messageLen);
+      output->append(_T("{\"timestamp\":\""));
+      output->append(timestamp);
+      output->append(_T("\",\"severity\":\""));
+      output->append(GetJsonSeverityName(severity));
+      output->append(_T("\",\"tag\":\""));
+      output->append(escapedTag, tagLen);
+      output->append(_T("\",\"message\":\""));
+      output->append(escapedMessage, messageLen);
+      output->append(_T("\"}\n"));
+      FreeStringBuffer(escapedMessage, escapedMessageBuffer);
+      FreeStringBuffer(escapedTag, escapedTagBuffer);
+   }
+   else
+   {
+      TCHAR tagf[20];
+      output->append(timestamp);
+      output->append(_T(" "));
+      output->append(GetTextSeverityMarker(severity));
+      output->append(FormatTag(tag, tagf));
+      output->append(_T("] "));
+      output->append(message);
+      output->append(_T("\n"));
+   }
+}
+
+#if HAVE_THREAD_LOCAL_STORAGE
+
+/**
+ * Size of per-thread log buffer (should be power of 2)
+ */
+#define THREAD_LOG_BUFFER_SIZE   16384
+
+/**
+ * Time (in milliseconds) after which idle per-thread buffer can be reassigned to another thread
+ */
+#define THREAD_LOG_BUFFER_IDLE_TIME 300000
+
+/**
+ * Owner state flag indicating that owner thread is writing to buffer
+ */
+#define THREAD_LOG_BUFFER_BUSY   _ULL(0x100000000)
+
+/**
+ * Header of log record in per-thread buffer. Record is stored in binary form (timestamp, severity,
+ * tag and message text) and formatted into final form by background writer thread.
+ */
+struct LogRecordHeader
+{
+   uint32_t size;          // Total record size including header; 0 indicates wrap to buffer start
+   int16_t severity;
+   uint16_t tagLength;     // In characters
+   uint32_t messageLength; // In characters
+   uint32_t reserved;
+   uint64_t sequence;
+   int64_t timestamp;
+};
+
+/**
+ * Per-thread log buffer. This is single producer/single consumer ring buffer - only owner thread
+ * puts records into it and records are read only with log access mutex held.
+ */
+struct ThreadLogBuffer
+{
+   ThreadLogBuffer *next;
+   std::atomic<uint64_t> state;     // Owner thread ID (0 if not owned) combined with busy flag
+   std::atomic<size_t> head;        // Write position (updated only by producer)
+   std::atomic<size_t> tail;        // Read position (updated only by consumer)
+   std::atomic<int64_t> lastWriteTime;
+   BYTE data[THREAD_LOG_BUFFER_SIZE];
+
+   ThreadLogBuffer(uint64_t initialState) : state(initialState), head(0), tail(0), lastWriteTime(0)
+   {
+      next = nullptr;
+   }
+
+   /**
+    * Lock buffer for writing by given thread. Will fail if buffer was reassigned to another thread.
+    */
+   bool lock(uint32_t threadId)
+   {
+      uint64_t expected = threadId;
+      return state.compare_exchange_strong(expected, static_cast<uint64_t>(threadId) | THREAD_LOG_BUFFER_BUSY);
+   }
+
+   /**
+    * Unlock buffer after writing
+    */
+   void unlock(uint32_t threadId)
+   {
+      state.store(threadId);
+   }
+
+   /**
+    * Get number of bytes currently used
+    */
+   size_t usage() const
+   {
+      return head.load(std::memory_order_relaxed) - tail.load(std::memory_order_relaxed);
+   }
+
+   bool put(int16_t severity, const TCHAR *tag, const TCHAR *message, uint64_t sequence);
+};
+
+/**
+ * Put record into buffer. Returns false if there is not enough space.
+ */
+bool ThreadLogBuffer::put(int16_t severity, const TCHAR *tag, const TCHAR *message, uint64_t sequence)
+{
+   size_t tagLength = (tag != nullptr) ? _tcslen(tag) : 0;
+   size_t messageLength = _tcslen(message);
+   size_t recordSize = (sizeof(LogRecordHeader) + (tagLength + messageLength) * sizeof(TCHAR) + 7) & ~static_cast<size_t>(7);
+   if ((recordSize > THREAD_LOG_BUFFER_SIZE / 2) || (tagLength > 0xFFFF))
+      return false;
+
+   size_t writePos = head.load(std::memory_order_relaxed);
+   size_t readPos = tail.load(std::memory_order_acquire);
+   size_t offset = writePos & (THREAD_LOG_BUFFER_SIZE - 1);
+   size_t contiguous = THREAD_LOG_BUFFER_SIZE - offset;
+   size_t required = (recordSize > contiguous) ? recordSize + contiguous : recordSize;
+   if (THREAD_LOG_BUFFER_SIZE - (writePos - readPos) < required)
+      return false;
+
+   if (recordSize > contiguous)
+   {
+      // Not enough space till the end of buffer, mark remaining space as skipped
+      reinterpret_cast<LogRecordHeader*>(&data[offset])->size = 0;
+      writePos += contiguous;
+      offset = 0;
+   }
+
+   auto header = reinterpret_cast<LogRecordHeader*>(&data[offset]);
+   header->size = static_cast<uint32_t>(recordSize);
+   header->severity = severity;
+   header->tagLength = static_cast<uint16_t>(tagLength);
+   header->messageLength = static_cast<uint32_t>(messageLength);
+   header->sequence = sequence;
+   header->timestamp = GetCurrentTimeMs();
+   TCHAR *text = reinterpret_cast<TCHAR*>(&data[offset + sizeof(LogRecordHeader)]);
+   if (tagLength > 0)
+      memcpy(text, tag, tagLength * sizeof(TCHAR));
+   memcpy(&text[tagLength], message, messageLength * sizeof(TCHAR));
+
+   lastWriteTime.store(header->timestamp, std::memory_order_relaxed);
+   head.store(writePos + recordSize, std::memory_order_release);
+   return true;
+}
+
+/**
+ * List of all per-thread buffers. Buffers are never deleted, idle buffers are reassigned to other threads.
+ */
+static std::atomic<ThreadLogBuffer*> s_threadLogBuffers(nullptr);
+
+/**
+ * Buffer assigned to current thread
+ */
+static thread_local ThreadLogBuffer *s_threadLogBuffer = nullptr;
+
+/**
+ * Global log record sequence number (used for ordering records from different threads)
+ */
+static VolatileCounter64 s_logRecordSequence = 0;
+
+/**
+ * Wakeup condition for background writer
+ */
+static Condition s_writerWakeupCondition(false);
+
+/**
+ * Acquire free buffer or create new one. Returned buffer is locked for writing.
+ */
+static ThreadLogBuffer *AcquireThreadLogBuffer(uint32_t threadId)
+{
+   uint64_t lockedState = static_cast<uint64_t>(threadId) | THREAD_LOG_BUFFER_BUSY;
+   for(ThreadLogBuffer *b = s_threadLogBuffers.load(); b != nullptr; b = b->next)
+   {
+      uint64_t expected = 0;
+      if (b->state.compare_exchange_strong(expected, lockedState))
+         return b;
+   }
+
+   auto buffer = new ThreadLogBuffer(lockedState);
+   ThreadLogBuffer *head = s_threadLogBuffers.load();
+   do
+   {
+      buffer->next = head;
+   } while(!s_threadLogBuffers.compare_exchange_weak(head, buffer));
+   return buffer;
+}
+
+/**
+ * Write record to current thread's log buffer. Returns false if record cannot be buffered
+ * and should be written using shared buffer.
+ */
+static bool WriteLogToThreadBuffer(int16_t severity, const TCHAR *tag, const TCHAR *message)
+{
+   uint32_t threadId = GetCurrentThreadId();
+   ThreadLogBuffer *buffer = s_threadLogBuffer;
+   if ((buffer == nullptr) || !buffer->lock(threadId))
+   {
+      buffer = AcquireThreadLogBuffer(threadId);
+      s_threadLogBuffer = buffer;
+   }
+
+   bool success = buffer->put(severity, tag, message, static_cast<uint64_t>(InterlockedIncrement64(&s_logRecordSequence)));
+   buffer->unlock(threadId);
+
+   if (!success || (buffer->usage() > THREAD_LOG_BUFFER_SIZE / 2))
+      s_writerWakeupCondition.set();
+   return success;
+}
+
+/**
+ * Formatted record reference used for ordering records from different threads
+ */
+struct FormattedRecordRef
+{
+   uint64_t sequence;
+   size_t offset;
+   size_t length;
+};
+
+/**
+ * Compare formatted record references by sequence number
+ */
+static int CompareFormattedRecords(const void *e1, const void *e2)
+{
+   uint64_t s1 = static_cast<const FormattedRecordRef*>(e1)->sequence;
+   uint64_t s2 = static_cast<const FormattedRecordRef*>(e2)->sequence;
+   return (s1 < s2) ? -1 : ((s1 > s2) ? 1 : 0);
+}
+
+/**
+ * Read all records from per-thread buffers, format them, and append to output in original order.
+ * Caller must hold log access mutex. Called by background writer thread, and by logging thread
+ * when its own buffer is full and record has to be written to shared buffer.
+ */
+static void CollectThreadLogBuffers(StringBuffer *output)
+{
+   StringBuffer formattedRecords;
+   StructArray<FormattedRecordRef> records(0, 256);
+   StringBuffer tag, message;
+   int64_t now = GetCurrentTimeMs();
+   for(ThreadLogBuffer *b = s_threadLogBuffers.load(); b != nullptr; b = b->next)
+   {
+      size_t readPos = b->tail.load(std::memory_order_relaxed);
+      size_t writePos = b->head.load(std::memory_order_acquire);
+      if (readPos == writePos)
+      {
+         // Release buffer owned by thread that was not logging anything for long time
+         uint64_t state = b->state.load();
+         if ((state != 0) && !(state & THREAD_LOG_BUFFER_BUSY) && (now - b->lastWriteTime.load(std::memory_order_relaxed) > THREAD_LOG_BUFFER_IDLE_TIME))
+            b->state.compare_exchange_strong(state, 0);
+         continue;
+      }
+
+      while(readPos != writePos)
+      {
+         size_t offset = readPos & (THREAD_LOG_BUFFER_SIZE - 1);
+         auto header = reinterpret_cast<const LogRecordHeader*>(&b->data[offset]);
+         if (header->size == 0)
+         {
+            readPos += THREAD_LOG_BUFFER_SIZE - offset;
+            continue;
+         }
+
+         const TCHAR *text = reinterpret_cast<const TCHAR*>(&b->data[offset + sizeof(LogRecordHeader)]);
+         tag.clear();
+         tag.append(text, header->tagLength);
+         message.clear();
+         message.append(&text[header->tagLength], header->messageLength);
+
+         TCHAR timestamp[64];
+         FormattedRecordRef *r = records.addPlaceholder();
+         r->sequence = header->sequence;
+         r->offset = formattedRecords.length();
+         AppendFormattedRecord(&formattedRecords, header->severity, (header->tagLength > 0) ? tag.cstr() : nullptr,
+                  message.cstr(), FormatLogTimestamp(timestamp, header->timestamp));
+         r->length = formattedRecords.length() - r->offset;
+
+         readPos += header->size;
+      }
+      b->tail.store(readPos, std::memory_order_release);
+   }
+
+   records.sort(CompareFormattedRecords);
+   for(int i = 0; i < records.size(); i++)
+   {
+      FormattedRecordRef *r = records.get(i);
+      output->append(&formattedRecords.cstr()[r->offset], r->length);
+   }
+}
+
+#endif   /* HAVE_THREAD_LOCAL_STORAGE */
+
+/**
+ * Get all pending log records for background writer as UTF-8 string. Returns nullptr if there are no pending records.
+ */
+static char *GetPendingLogRecords()
+{
+   StringBuffer output;
+
+   // Records in shared buffer are older than records in per-thread buffers
+   s_mutexLogAccess.lock();
+   if (!s_logBuffer.isEmpty())
+   {
+      output.append(s_logBuffer);
+      s_logBuffer.clear();
+   }
+#if HAVE_THREAD_LOCAL_STORAGE
+   CollectThreadLogBuffers(&output);
+#endif
+   s_mutexLogAccess.unlock();
+
+   return output.isEmpty() ? nullptr : output.getUTF8String();
+}
+
 /**
  * Set timestamp of start of the current day
  */
@@ -722,6 +1113,19 @@ bool LIBNETXMS_EXPORTABLE nxlog_rotate()
    return (s_logFileHandle != -1) ? RotateLog(true) : false;
 }
 
+/**
+ * Wait for new records or stop signal. Returns true if writer should stop.
+ */
+static inline bool WaitForLogRecords()
+{
+#if HAVE_THREAD_LOCAL_STORAGE
+   s_writerWakeupCondition.wait(1000);
+   return s_writerStopCondition.wait(0);
+#else
+   return s_writerStopCondition.wait(1000);
+#endif
+}
+
 /**
  * Background writer thread - file
  */
@@ -730,7 +1134,7 @@ static void BackgroundWriterThread()
    bool stop = false;
    while(!stop)
    {
-      stop = s_writerStopCondition.wait(1000);
+      stop = WaitForLogRecords();
 
       // Check for new day start
       time_t t = time(nullptr);
@@ -739,24 +1143,20 @@ static void BackgroundWriterThread()
 		   RotateLog(false);
 	   }
 
-      s_mutexLogAccess.lock();
-      if (!s_logBuffer.isEmpty())
+      char *data = GetPendingLogRecords();
+      if (data != nullptr)
       {
-         size_t buflen = s_logBuffer.length();
-         char *data = s_logBuffer.getUTF8String();
-         s_logBuffer.clear();
-         s_mutexLogAccess.unlock();
-
+         size_t buflen = strlen(data);
          if (s_logFileHandle != -1)
          {
             if (s_flags & NXLOG_DEBUG_MODE)
             {
                char buffer[256];
-               snprintf(buffer, 256, "##(" INT64_FMTA ")" INT64_FMTA " @" INT64_FMTA "\n", (int64_t)buflen, (int64_t)strlen(data), GetCurrentTimeMs());
+               snprintf(buffer, 256, "##(" INT64_FMTA ") @" INT64_FMTA "\n", (int64_t)buflen, GetCurrentTimeMs());
                _write(s_logFileHandle, buffer, strlen(buffer));
             }
 
-            _write(s_logFileHandle, data, strlen(data));
+            _write(s_logFileHandle, data, buflen);
 
             // Check log size
             if ((s_rotationMode == NXLOG_ROTATION_BY_SIZE) && (s_maxLogSize != 0))
@@ -770,10 +1170,6 @@ static void BackgroundWriterThread()
 
 	      MemFree(data);
       }
-      else
-      {
-         s_mutexLogAccess.unlock();
-      }
    }
 }
 
@@ -785,22 +1181,14 @@ static void BackgroundWriterThreadStdOut()
    bool stop = false;
    while(!stop)
    {
-      stop = s_writerStopCondition.wait(1000);
+      stop = WaitForLogRecords();
 
-      s_mutexLogAccess.lock();
-      if (!s_logBuffer.isEmpty())
+      char *data = GetPendingLogRecords();
+      if (data != nullptr)
       {
-         char *data = s_logBuffer.getUTF8String();
-         s_logBuffer.clear();
-         s_mutexLogAccess.unlock();
-
          _write(STDOUT_FILENO, data, strlen(data));
          MemFree(data);
       }
-      else
-      {
-         s_mutexLogAccess.unlock();
-      }
    }
 }
 
@@ -912,6 +1300,9 @@ void LIBNETXMS_EXPORTABLE nxlog_close()
          if (s_flags & NXLOG_BACKGROUND_WRITER)
          {
             s_writerStopCondition.set();
+#if HAVE_THREAD_LOCAL_STORAGE
+            s_writerWakeupCondition.set();
+#endif
             ThreadJoin(s_writerThread);
             s_writerThread = INVALID_THREAD_HANDLE;
             s_writerStopCondition.reset();
@@ -922,6 +1313,9 @@ void LIBNETXMS_EXPORTABLE nxlog_close()
          if (s_flags & NXLOG_BACKGROUND_WRITER)
          {
             s_writerStopCondition.set();
+#if HAVE_THREAD_LOCAL_STORAGE
+            s_writerWakeupCondition.set();
+#endif
             ThreadJoin(s_writerThread);
             s_writerThread = INVALID_THREAD_HANDLE;
             s_writerStopCondition.reset();
@@ -938,131 +1332,118 @@ void LIBNETXMS_EXPORTABLE nxlog_close()
 }
 
 /**
- * Write log to console (assume that lock already set)
+ * Write formatted log record line to console (assume that lock already set)
  */
-static void WriteLogToConsole(INT16 severity, const TCHAR *timestamp, const TCHAR *tag, const TCHAR *message)
+static inline void WriteLogToConsole(const TCHAR *line)
 {
-   const TCHAR *loglevel;
-   switch(severity)
-   {
-      case NXLOG_ERROR:
-         loglevel = _T("*E* [");
-         break;
-      case NXLOG_WARNING:
-         loglevel = _T("*W* [");
-         break;
-      case NXLOG_INFO:
-         loglevel = _T("*I* [");
-         break;
-      case NXLOG_DEBUG:
-         loglevel = _T("*D* [");
-         break;
-      default:
-         loglevel = _T("*?* [");
-         break;
-   }
-
-   TCHAR tagf[20];
-   s_consoleWriter(_T("%s %s%s] %s\n"), timestamp, loglevel, FormatTag(tag, tagf), message);
+   s_consoleWriter(_T("%s"), line);
 }
 
 /**
- * Write record to log file (text format)
+ * Format log record as text line into local or dynamic buffer. Returned buffer should be freed with FreeStringBuffer.
  */
-static void WriteLogToFileAsText(INT16 severity, const TCHAR *tag, const TCHAR *message)
+static TCHAR *FormatTextRecord(int16_t severity, const TCHAR *timestamp, const TCHAR *tag, const TCHAR *message, TCHAR *localBuffer)
 {
-   const TCHAR *loglevel;
-   switch(severity)
-   {
-      case NXLOG_ERROR:
-         loglevel = _T("*E* [");
-	      break;
-      case NXLOG_WARNING:
-         loglevel = _T("*W* [");
-	      break;
-      case NXLOG_INFO:
-         loglevel = _T("*I* [");
-	      break;
-      case NXLOG_DEBUG:
-         loglevel = _T("*D* [");
-	      break;
-      default:
-         loglevel = _T("*?* [");
-	      break;
-   }
+   const TCHAR *loglevel = GetTextSeverityMarker(severity);
 
    TCHAR tagf[20];
    FormatTag(tag, tagf);
 
+   TCHAR *line = AllocateStringBuffer(_tcslen(timestamp) + _tcslen(loglevel) + _tcslen(message) + 24, localBuffer);
+   _tcscpy(line, timestamp);
+   _tcscat(line, _T(" "));
+   _tcscat(line, loglevel);
+   _tcscat(line, tagf);
+   _tcscat(line, _T("] "));
+   _tcscat(line, message);
+   _tcscat(line, _T("\n"));
+   return line;
+}
+
+/**
+ * Print log record to console
+ */
+static void PrintLogRecordToConsole(int16_t severity, const TCHAR *tag, const TCHAR *message)
+{
+   TCHAR timestamp[64], lineBuffer[LOCAL_MSG_BUFFER_SIZE];
+   TCHAR *line = FormatTextRecord(severity, FormatLogTimestamp(timestamp), tag, message, lineBuffer);
+   s_mutexLogAccess.lock();
+   WriteLogToConsole(line);
+   s_mutexLogAccess.unlock();
+   FreeStringBuffer(line, lineBuffer);
+}
+
+/**
+ * Write fully formatted log record to log file. Record should be formatted and converted
+ * by the caller, so only buffer append or file write is done while holding log access lock.
+ */
+static void WriteRecordToFile(const TCHAR *record, const TCHAR *consoleLine)
+{
+   bool directWrite = ((s_flags & NXLOG_BACKGROUND_WRITER) == 0);
+   char encodedBuffer[LOCAL_MSG_BUFFER_SIZE];
+   char *encoded = directWrite ? EncodeForFile(record, encodedBuffer) : nullptr;
+
    s_mutexLogAccess.lock();
 
-   TCHAR timestamp[64];
-   FormatLogTimestamp(timestamp);
-   if (s_flags & NXLOG_BACKGROUND_WRITER)
+   if (!directWrite)
    {
-      s_logBuffer.append(timestamp);
-      s_logBuffer.append(_T(" "));
-      s_logBuffer.append(loglevel);
-      s_logBuffer.append(tagf);
-      s_logBuffer.append(_T("] "));
-      s_logBuffer.append(message);
-      s_logBuffer.append(_T("\n"));
+#if HAVE_THREAD_LOCAL_STORAGE
+      // Move records from per-thread buffers first to keep original order
+      CollectThreadLogBuffers(&s_logBuffer);
+#endif
+      s_logBuffer.append(record);
    }
    else if (s_flags & NXLOG_USE_STDOUT)
    {
-      FileFormattedWrite(STDOUT_FILENO, _T("%s %s%s] %s\n"), timestamp, loglevel, tagf, message);
+      _write(STDOUT_FILENO, encoded, strlen(encoded));
    }
    else if (s_logFileHandle != -1)
    {
-	   // Check for new day start
-      time_t t = time(NULL);
-	   if ((s_rotationMode == NXLOG_ROTATION_DAILY) && (t >= s_currentDayStart + 86400))
-	   {
-		   RotateLog(false);
-	   }
+      // Check for new day start
+      time_t t = time(nullptr);
+      if ((s_rotationMode == NXLOG_ROTATION_DAILY) && (t >= s_currentDayStart + 86400))
+      {
+         RotateLog(false);
+      }
 
-	   FileFormattedWrite(s_logFileHandle, _T("%s %s%s] %s\n"), timestamp, loglevel, tagf, message);
+      _write(s_logFileHandle, encoded, strlen(encoded));
 
       // Check log size
-	   if ((s_rotationMode == NXLOG_ROTATION_BY_SIZE) && (s_maxLogSize != 0))
-	   {
-	      NX_STAT_STRUCT st;
-		   NX_FSTAT(s_logFileHandle, &st);
-		   if ((UINT64)st.st_size >= s_maxLogSize)
-			   RotateLog(false);
-	   }
+      if ((s_rotationMode == NXLOG_ROTATION_BY_SIZE) && (s_maxLogSize != 0))
+      {
+         NX_STAT_STRUCT st;
+         NX_FSTAT(s_logFileHandle, &st);
+         if ((UINT64)st.st_size >= s_maxLogSize)
+            RotateLog(false);
+      }
    }
 
-   if (s_flags & NXLOG_PRINT_TO_STDOUT)
-      WriteLogToConsole(severity, timestamp, tag, message);
+   if ((consoleLine != nullptr) && (s_flags & NXLOG_PRINT_TO_STDOUT))
+      WriteLogToConsole(consoleLine);
 
    s_mutexLogAccess.unlock();
+
+   if (encoded != nullptr)
+      FreeEncodedString(encoded, encodedBuffer);
+}
+
+/**
+ * Write record to log file (text format)
+ */
+static void WriteLogToFileAsText(int16_t severity, const TCHAR *tag, const TCHAR *message)
+{
+   TCHAR timestamp[64], lineBuffer[LOCAL_MSG_BUFFER_SIZE];
+   TCHAR *line = FormatTextRecord(severity, FormatLogTimestamp(timestamp), tag, message, lineBuffer);
+   WriteRecordToFile(line, line);
+   FreeStringBuffer(line, lineBuffer);
 }
 
 /**
  * Write record to log file (JSON format)
  */
-static void WriteLogToFileAsJSON(INT16 severity, const TCHAR *tag, const TCHAR *message)
+static void WriteLogToFileAsJSON(int16_t severity, const TCHAR *tag, const TCHAR *message)
 {
-   const TCHAR *loglevel;
-   switch(severity)
-   {
-      case NXLOG_ERROR:
-         loglevel = _T("error");
-         break;
-      case NXLOG_WARNING:
-         loglevel = _T("warning");
-         break;
-      case NXLOG_INFO:
-         loglevel = _T("info");
-         break;
-      case NXLOG_DEBUG:
-         loglevel = _T("debug");
-         break;
-      default:
-         loglevel = _T("info");
-         break;
-   }
+   const TCHAR *loglevel = GetJsonSeverityName(severity);
 
    TCHAR escapedTagBuffer[LOCAL_MSG_BUFFER_SIZE], escapedMessageBuffer[LOCAL_MSG_BUFFER_SIZE];
    size_t tagLen, messageLen;
@@ -1081,52 +1462,35 @@ static void WriteLogToFileAsJSON(INT16 severity, const TCHAR *tag, const TCHAR *
    _tcscat(json, escapedMessage);
    _tcscat(json, _T("\"}\n"));
 
-   s_mutexLogAccess.lock();
-
-   if (s_flags & NXLOG_BACKGROUND_WRITER)
-   {
-      s_logBuffer.append(json);
-   }
-   else if (s_flags & NXLOG_USE_STDOUT)
-   {
-      FileWrite(STDOUT_FILENO, json);
-   }
-   else if (s_logFileHandle != -1)
-   {
-      // Check for new day start
-      time_t t = time(NULL);
-      if ((s_rotationMode == NXLOG_ROTATION_DAILY) && (t >= s_currentDayStart + 86400))
-      {
-         RotateLog(false);
-      }
-
-      FileWrite(s_logFileHandle, json);
-
-      // Check log size
-      if ((s_rotationMode == NXLOG_ROTATION_BY_SIZE) && (s_maxLogSize != 0))
-      {
-         NX_STAT_STRUCT st;
-         NX_FSTAT(s_logFileHandle, &st);
-         if ((UINT64)st.st_size >= s_maxLogSize)
-            RotateLog(false);
-      }
-   }
+   FreeStringBuffer(escapedMessage, escapedMessageBuffer);
+   FreeStringBuffer(escapedTag, escapedTagBuffer);
 
-   if (s_flags & NXLOG_PRINT_TO_STDOUT)
-      WriteLogToConsole(severity, timestamp, tag, message);
+   // Console output is always in text format
+   TCHAR consoleBuffer[LOCAL_MSG_BUFFER_SIZE];
+   TCHAR *consoleLine = (s_flags & NXLOG_PRINT_TO_STDOUT) ? FormatTextRecord(severity, timestamp, tag, message, consoleBuffer) : nullptr;
 
-   s_mutexLogAccess.unlock();
+   WriteRecordToFile(json, consoleLine);
 
+   if (consoleLine != nullptr)
+      FreeStringBuffer(consoleLine, consoleBuffer);
    FreeStringBuffer(json, jsonBuffer);
-   FreeStringBuffer(escapedMessage, escapedMessageBuffer);
-   FreeStringBuffer(escapedTag, escapedTagBuffer);
 }
 
 /**
- * Write record to log file (JSON format)
+ * Write record to log file
  */
 static inline void WriteLogToFile(int16_t severity, const TCHAR *tag, const TCHAR *message)
 {
+#if HAVE_THREAD_LOCAL_STORAGE
+   // Lock-free path: put record into per-thread buffer, background writer will format it
+   if ((s_flags & NXLOG_BACKGROUND_WRITER) && WriteLogToThreadBuffer(severity, tag, message))
+   {
+      if (s_flags & NXLOG_PRINT_TO_STDOUT)
+         PrintLogRecordToConsole(severity, tag, message);
+      return;
+   }
+#endif
+
    if (s_flags & NXLOG_JSON_FORMAT)
       WriteLogToFileAsJSON(severity, tag, message);
    else
@@ -1204,12 +1568,7 @@ static void WriteLog(int16_t severity, const TCHAR *tag, const TCHAR *format, va
 #endif
 #endif   /* _WIN32 */
       if (s_flags & NXLOG_PRINT_TO_STDOUT)
-      {
-         s_mutexLogAccess.lock();
-         TCHAR timestamp[64];
-         WriteLogToConsole(severity, FormatLogTimestamp(timestamp), tag, message);
-         s_mutexLogAccess.unlock();
-      }
+         PrintLogRecordToConsole(severity, tag, message);
       FreeFormattedString(message, localBuffer);
    }
    else if (s_flags & NXLOG_USE_SYSTEMD)
@@ -1234,16 +1593,24 @@ static void WriteLog(int16_t severity, const TCHAR *tag, const TCHAR *format, va
             break;
       }
 
-      TCHAR tagf[20];
-      s_mutexLogAccess.lock();
-      if (tag != NULL)
-         _ftprintf(stderr, _T("<%d>[%s] "), level, FormatTag(tag, tagf));
+      msg_buffer_t localBuffer;
+      TCHAR *message = FormatString(localBuffer, format, args);
+
+      TCHAR tagf[20], lineBuffer[LOCAL_MSG_BUFFER_SIZE];
+      size_t lineSize = _tcslen(message) + 32;
+      TCHAR *line = AllocateStringBuffer(lineSize, lineBuffer);
+      if (tag != nullptr)
+         _sntprintf(line, lineSize, _T("<%d>[%s] %s\n"), level, FormatTag(tag, tagf), message);
       else
-         _ftprintf(stderr, _T("<%d> "), level);
-      _vftprintf(stderr, format, args);
-      _fputtc(_T('\n'), stderr);
+         _sntprintf(line, lineSize, _T("<%d> %s\n"), level, message);
+      FreeFormattedString(message, localBuffer);
+
+      s_mutexLogAccess.lock();
+      _fputts(line, stderr);
       fflush(stderr);
       s_mutexLogAccess.unlock();
+
+      FreeStringBuffer(line, lineBuffer);
    }
    else
    {
@@ -1389,10 +1756,7 @@ void LIBNETXMS_EXPORTABLE nxlog_report_event(DWORD msg, int level, int stringCou
          TCHAR *message = FormatString(localBuffer, altMessage, args2);
          va_end(args2);
 
-         s_mutexLogAccess.lock();
-         TCHAR timestamp[64];
-         WriteLogToConsole(level, FormatLogTimestamp(timestamp), NULL, message);
-         s_mutexLogAccess.unlock();
+         PrintLogRecordToConsole(level, nullptr, message);
          FreeFormattedString(message, localBuffer);
       }
 
@@ -93,7 +93,8 @@ struct MessageField
    UT_hash_handle hh;
    uint32_t id;
    size_t size;
-   NXCP_MESSAGE_FIELD data;
+   NXCP_MESSAGE_FIELD *data;     // Points either to storage or to field within message buffer
+   NXCP_MESSAGE_FIELD storage;   // Actual size determined by field size
 };
 
 /**
@@ -105,6 +106,20 @@ static inline MessageField *CreateMessageField(MemoryPool& pool, size_t fieldSiz
    MessageField *entry = static_cast<MessageField*>(pool.allocate(entrySize));
    memset(entry, 0, entrySize);
    entry->size = entrySize;
+   entry->data = &entry->storage;
+   return entry;
+}
+
+/**
+ * Create new hash entry for field located within message buffer
+ */
+static inline MessageField *CreateMessageFieldReference(MemoryPool& pool, NXCP_MESSAGE_FIELD *field)
+{
+   size_t entrySize = sizeof(MessageField) - sizeof(NXCP_MESSAGE_FIELD);
+   MessageField *entry = static_cast<MessageField*>(pool.allocate(entrySize));
+   memset(entry, 0, entrySize);
+   entry->size = entrySize;
+   entry->data = field;
    return entry;
 }
 
@@ -163,7 +178,10 @@ NXCPMessage::NXCPMessage(const NXCPMessage& msg) : m_pool(msg.m_pool.regionSize(
       MessageField *entry, *tmp;
       HASH_ITER(hh, msg.m_fields, entry, tmp)
       {
-         MessageField *f = m_pool.copyMemoryBlock(entry, entry->size);
+         size_t fieldSize = CalculateFieldSize(entry->data, false);
+         MessageField *f = CreateMessageField(m_pool, fieldSize);
+         f->id = entry->id;
+         memcpy(f->data, entry->data, fieldSize);
          HASH_ADD_INT(m_fields, id, f);
       }
    }
@@ -303,10 +321,17 @@ NXCPMessage::NXCPMessage(const NXCP_MESSAGE *msg, int version) : m_pool(SizeHint
       }
       else
       {
-         msgData = (BYTE *)msg + NXCP_HEADER_SIZE;
          msgDataSize = (size_t)ntohl(msg->size) - NXCP_HEADER_SIZE;
+         if (m_version >= 2)
+            msgData = m_pool.copyMemoryBlock(reinterpret_cast<const BYTE*>(msg) + NXCP_HEADER_SIZE, msgDataSize);
+         else
+            msgData = (BYTE *)msg + NXCP_HEADER_SIZE;
       }
 
+      // Starting from version 2 all fields are 8-byte aligned, so they are parsed in place within
+      // message data buffer which is owned by memory pool (either copy of received data or decompressed data)
+      bool inPlace = (m_version >= 2);
+
       int fieldCount = (int)ntohl(msg->numFields);
       size_t pos = 0;
       for(int f = 0; f < fieldCount; f++)
@@ -335,42 +360,50 @@ NXCPMessage::NXCPMessage(const NXCP_MESSAGE *msg, int version) : m_pool(SizeHint
          }
 
          // Create new entry
-         MessageField *entry = CreateMessageField(m_pool, fieldSize);
+         MessageField *entry;
+         if (inPlace)
+         {
+            entry = CreateMessageFieldReference(m_pool, field);
+         }
+         else
+         {
+            entry = CreateMessageField(m_pool, fieldSize);
+            memcpy(entry->data, field, fieldSize);
+         }
          entry->id = ntohl(field->fieldId);
-         memcpy(&entry->data, field, fieldSize);
 
          // Convert values to host format
-         entry->data.fieldId = ntohl(entry->data.fieldId);
+         entry->data->fieldId = entry->id;
          switch(field->type)
          {
             case NXCP_DT_INT32:
-               entry->data.df_int32 = ntohl(entry->data.df_int32);
+               entry->data->df_int32 = ntohl(entry->data->df_int32);
                break;
             case NXCP_DT_INT64:
-               entry->data.df_int64 = ntohq(entry->data.df_int64);
+               entry->data->df_int64 = ntohq(entry->data->df_int64);
                break;
             case NXCP_DT_INT16:
-               entry->data.df_int16 = ntohs(entry->data.df_int16);
+               entry->data->df_int16 = ntohs(entry->data->df_int16);
                break;
             case NXCP_DT_FLOAT:
-               entry->data.df_real = ntohd(entry->data.df_real);
+               entry->data->df_real = ntohd(entry->data->df_real);
                break;
             case NXCP_DT_STRING:
 #if !(WORDS_BIGENDIAN)
-               entry->data.df_string.length = ntohl(entry->data.df_string.length);
-               bswap_array_16(entry->data.df_string.value, entry->data.df_string.length / 2);
+               entry->data->df_string.length = ntohl(entry->data->df_string.length);
+               bswap_array_16(entry->data->df_string.value, entry->data->df_string.length / 2);
 #endif
                break;
             case NXCP_DT_BINARY:
-               entry->data.df_binary.length = ntohl(entry->data.df_binary.length);
+               entry->data->df_binary.length = ntohl(entry->data->df_binary.length);
                break;
             case NXCP_DT_UTF8_STRING:
-               entry->data.df_utf8string.length = ntohl(entry->data.df_utf8string.length);
+               entry->data->df_utf8string.length = ntohl(entry->data->df_utf8string.length);
                break;
             case NXCP_DT_INETADDR:
-               if (entry->data.df_inetaddr.family == NXCP_AF_INET)
+               if (entry->data->df_inetaddr.family == NXCP_AF_INET)
                {
-                  entry->data.df_inetaddr.addr.v4 = ntohl(entry->data.df_inetaddr.addr.v4);
+                  entry->data->df_inetaddr.addr.v4 = ntohl(entry->data->df_inetaddr.addr.v4);
                }
                break;
          }
@@ -400,7 +433,7 @@ NXCP_MESSAGE_FIELD *NXCPMessage::find(uint32_t fieldId) const
 {
    MessageField *entry;
    HASH_FIND_INT(m_fields, &fieldId, entry);
-   return (entry != nullptr) ? &entry->data : nullptr;
+   return (entry != nullptr) ? entry->data : nullptr;
 }
 
 /**
@@ -419,19 +452,19 @@ void *NXCPMessage::set(uint32_t fieldId, BYTE type, const void *value, bool isSi
    {
       case NXCP_DT_INT32:
          entry = CreateMessageField(m_pool, 12);
-         entry->data.df_int32 = *static_cast<const uint32_t*>(value);
+         entry->data->df_int32 = *static_cast<const uint32_t*>(value);
          break;
       case NXCP_DT_INT16:
          entry = CreateMessageField(m_pool, 8);
-         entry->data.df_int16 = *static_cast<const uint16_t*>(value);
+         entry->data->df_int16 = *static_cast<const uint16_t*>(value);
          break;
       case NXCP_DT_INT64:
          entry = CreateMessageField(m_pool, 16);
-         entry->data.df_int64 = *static_cast<const uint64_t*>(value);
+         entry->data->df_int64 = *static_cast<const uint64_t*>(value);
          break;
       case NXCP_DT_FLOAT:
          entry = CreateMessageField(m_pool, 16);
-         entry->data.df_real = *static_cast<const double*>(value);
+         entry->data->df_real = *static_cast<const double*>(value);
          break;
       case NXCP_DT_STRING:
          if (isUtf8)
@@ -444,8 +477,8 @@ void *NXCPMessage::set(uint32_t fieldId, BYTE type, const void *value, bool isSi
             size_t ucs2length = utf8_to_ucs2(static_cast<const char*>(value), -1, buffer, length + 1);
             ucs2length--;  // Do not count terminating 0
             entry = CreateMessageField(m_pool, 12 + ucs2length * 2);
-            entry->data.df_string.length = (UINT32)(ucs2length * 2);
-            memcpy(entry->data.df_string.value, buffer, entry->data.df_string.length);
+            entry->data->df_string.length = (UINT32)(ucs2length * 2);
+            memcpy(entry->data->df_string.value, buffer, entry->data->df_string.length);
          }
          else
          {
@@ -467,8 +500,8 @@ void *NXCPMessage::set(uint32_t fieldId, BYTE type, const void *value, bool isSi
             size_t ucs2length = mb_to_ucs2(static_cast<const char*>(value), length, ucs2buffer, length + 1);
 #endif
             entry = CreateMessageField(m_pool, 12 + ucs2length * 2);
-            entry->data.df_string.length = static_cast<uint32_t>(ucs2length * 2);
-            memcpy(entry->data.df_string.value, ucs2buffer, entry->data.df_string.length);
+            entry->data->df_string.length = static_cast<uint32_t>(ucs2length * 2);
+            memcpy(entry->data->df_string.value, ucs2buffer, entry->data->df_string.length);
 #undef ucs2buffer
 #undef ucs2length
          }
@@ -480,8 +513,8 @@ void *NXCPMessage::set(uint32_t fieldId, BYTE type, const void *value, bool isSi
             if ((size > 0) && (length > size))
                length = size;
             entry = CreateMessageField(m_pool, 12 + length);
-            entry->data.df_utf8string.length = static_cast<uint32_t>(length);
-            memcpy(entry->data.df_utf8string.value, value, length);
+            entry->data->df_utf8string.length = static_cast<uint32_t>(length);
+            memcpy(entry->data->df_utf8string.value, value, length);
          }
          else
          {
@@ -500,44 +533,44 @@ void *NXCPMessage::set(uint32_t fieldId, BYTE type, const void *value, bool isSi
             entry = CreateMessageField(m_pool, 12 + bufferLength);
 #ifdef UNICODE
 #ifdef UNICODE_UCS4
-            entry->data.df_utf8string.length = (UINT32)ucs4_to_utf8(static_cast<const WCHAR*>(value), length, entry->data.df_utf8string.value, bufferLength);
+            entry->data->df_utf8string.length = (UINT32)ucs4_to_utf8(static_cast<const WCHAR*>(value), length, entry->data->df_utf8string.value, bufferLength);
 #else
-            entry->data.df_utf8string.length = (UINT32)ucs2_to_utf8(static_cast<const WCHAR*>(value), length, entry->data.df_utf8string.value, bufferLength);
+            entry->data->df_utf8string.length = (UINT32)ucs2_to_utf8(static_cast<const WCHAR*>(value), length, entry->data->df_utf8string.value, bufferLength);
 #endif
 #else    /* not UNICODE */
-            entry->data.df_utf8string.length = (UINT32)mb_to_utf8(static_cast<const TCHAR*>(value), length, entry->data.df_utf8string.value, bufferLength);
+            entry->data->df_utf8string.length = (UINT32)mb_to_utf8(static_cast<const TCHAR*>(value), length, entry->data->df_utf8string.value, bufferLength);
 #endif
          }
          break;
       case NXCP_DT_BINARY:
          entry = CreateMessageField(m_pool, 12 + size);
-         entry->data.df_binary.length = static_cast<uint32_t>(size);
-         if ((entry->data.df_binary.length > 0) && (value != nullptr))
-            memcpy(entry->data.df_binary.value, value, entry->data.df_binary.length);
+         entry->data->df_binary.length = static_cast<uint32_t>(size);
+         if ((entry->data->df_binary.length > 0) && (value != nullptr))
+            memcpy(entry->data->df_binary.value, value, entry->data->df_binary.length);
          break;
       case NXCP_DT_INETADDR:
          entry = CreateMessageField(m_pool, 32);
-         entry->data.df_inetaddr.family =
+         entry->data->df_inetaddr.family =
                   (((InetAddress *)value)->getFamily() == AF_INET) ? NXCP_AF_INET :
                            ((((InetAddress *)value)->getFamily() == AF_INET6) ? NXCP_AF_INET6 : NXCP_AF_UNSPEC);
-         entry->data.df_inetaddr.maskBits = (BYTE)((InetAddress *)value)->getMaskBits();
+         entry->data->df_inetaddr.maskBits = (BYTE)((InetAddress *)value)->getMaskBits();
          if (((InetAddress *)value)->getFamily() == AF_INET)
          {
-            entry->data.df_inetaddr.addr.v4 = ((InetAddress *)value)->getAddressV4();
+            entry->data->df_inetaddr.addr.v4 = ((InetAddress *)value)->getAddressV4();
          }
          else if (((InetAddress *)value)->getFamily() == AF_INET6)
          {
-            memcpy(entry->data.df_inetaddr.addr.v6, ((InetAddress *)value)->getAddressV6(), 16);
+            memcpy(entry->data->df_inetaddr.addr.v6, ((InetAddress *)value)->getAddressV6(), 16);
          }
          break;
       default:
          return nullptr;  // Invalid data type, unable to handle
    }
    entry->id = fieldId;
-   entry->data.fieldId = fieldId;
-   entry->data.type = type;
+   entry->data->fieldId = fieldId;
+   entry->data->type = type;
    if (isSigned)
-      entry->data.flags |= NXCP_MFF_SIGNED;
+      entry->data->flags |= NXCP_MFF_SIGNED;
 
    // add or replace field
    MessageField *curr;
@@ -548,7 +581,7 @@ void *NXCPMessage::set(uint32_t fieldId, BYTE type, const void *value, bool isSi
    }
    HASH_ADD_INT(m_fields, id, entry);
 
-   return (type == NXCP_DT_INT16) ? ((void *)((BYTE *)&entry->data + 6)) : ((void *)((BYTE *)&entry->data + 8));
+   return (type == NXCP_DT_INT16) ? ((void *)((BYTE *)entry->data + 6)) : ((void *)((BYTE *)entry->data + 8));
 }
 
 /**
@@ -1097,6 +1130,23 @@ const BYTE *NXCPMessage::getBinaryFieldPtr(uint32_t fieldId, size_t *size) const
    return data;
 }
 
+/**
+ * Get pointer to UTF-8 string field value within message. Returned string is not null terminated
+ * and remains valid until message is destroyed or field is replaced. Returns NULL if field
+ * does not exist or is not an UTF-8 string.
+ */
+const char *NXCPMessage::getUtf8StringFieldPtr(uint32_t fieldId, size_t *length) const
+{
+   void *value = get(fieldId, NXCP_DT_UTF8_STRING);
+   if (value == nullptr)
+   {
+      *length = 0;
+      return nullptr;
+   }
+   *length = static_cast<size_t>(*static_cast<uint32_t*>(value));
+   return static_cast<char*>(value) + 4;
+}
+
 /**
  * Get field as GUID
  * Returns NULL GUID on error
@@ -1139,7 +1189,7 @@ NXCP_MESSAGE *NXCPMessage::serialize(bool allowCompression) const
       MessageField *entry, *tmp;
       HASH_ITER(hh, m_fields, entry, tmp)
       {
-         size_t fieldSize = CalculateFieldSize(&entry->data, false);
+         size_t fieldSize = CalculateFieldSize(entry->data, false);
          if (m_version >= 2)
             size += fieldSize + ((8 - (fieldSize % 8)) & 7);
          else
@@ -1174,8 +1224,8 @@ NXCP_MESSAGE *NXCPMessage::serialize(bool allowCompression) const
       MessageField *entry, *tmp;
       HASH_ITER(hh, m_fields, entry, tmp)
       {
-         size_t fieldSize = CalculateFieldSize(&entry->data, false);
-         memcpy(field, &entry->data, fieldSize);
+         size_t fieldSize = CalculateFieldSize(entry->data, false);
+         memcpy(field, entry->data, fieldSize);
 
          // Convert numeric values to network format
          field->fieldId = htonl(field->fieldId);
@@ -1650,7 +1700,7 @@ void NXCPMessage::setProtocolVersion(int version)
       MessageField *entry, *tmp;
       HASH_ITER(hh, m_fields, entry, tmp)
       {
-         if (entry->data.type == NXCP_DT_UTF8_STRING)
+         if (entry->data->type == NXCP_DT_UTF8_STRING)
             stringFields.add(entry->id);
       }
 
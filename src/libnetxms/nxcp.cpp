@@ -499,7 +499,8 @@ TCHAR LIBNETXMS_EXPORTABLE *NXCPMessageCodeName(uint16_t code, TCHAR *buffer)
       _T("CMD_WRITE_MAINTENANCE_JOURNAL"),
       _T("CMD_UPDATE_MAINTENANCE_JOURNAL"),
       _T("CMD_GET_SSH_CREDENTIALS"),
-      _T("CMD_UPDATE_SSH_CREDENTIALS")
+      _T("CMD_UPDATE_SSH_CREDENTIALS"),
+      _T("CMD_SET_OBJECT_UPDATE_FILTER")
    };
    static const TCHAR *reportingMessageNames[] =
    {
@@ -512,7 +513,7 @@ TCHAR LIBNETXMS_EXPORTABLE *NXCPMessageCodeName(uint16_t code, TCHAR *buffer)
       _T("CMD_RS_NOTIFY")
    };
 
-   if ((code >= CMD_LOGIN) && (code <= CMD_UPDATE_SSH_CREDENTIALS))
+   if ((code >= CMD_LOGIN) && (code <= CMD_SET_OBJECT_UPDATE_FILTER))
    {
       _tcscpy(buffer, messageNames[code - CMD_LOGIN]);
    }
@@ -0,0 +1,138 @@
+/*
+** NetXMS - Network Management System
+** NetXMS Foundation Library
+** Copyright (C) 2003-2022 Raden Solutions
+**
+** This program is free software; you can redistribute it and/or modify
+** it under the terms of the GNU Lesser General Public License as published
+** by the Free Software Foundation; either version 3 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU Lesser General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+**
+** File: pattern_index.cpp
+**
+**/
+
+#include "libnetxms.h"
+
+/**
+ * Get length of index key for given pattern. Returns 0 if pattern cannot be indexed.
+ */
+static size_t GetPatternKeyLength(const TCHAR *pattern)
+{
+   for(const TCHAR *p = pattern; *p != 0; p++)
+   {
+      if ((*p == _T('*')) || (*p == _T('?')))
+         return 0;
+      if (*p == _T('('))
+      {
+         // Pattern can be indexed by literal prefix if there are no metasymbols before opening parenthesis
+         return (_tcspbrk(p, _T("*?")) != nullptr) ? p - pattern + 1 : _tcslen(pattern);
+      }
+   }
+   return _tcslen(pattern);
+}
+
+/**
+ * Create empty index
+ */
+PatternIndex::PatternIndex() : m_patterns(), m_buckets(Ownership::True), m_unindexed(0, 16)
+{
+}
+
+/**
+ * Add pattern to index. Returns index of added pattern.
+ */
+int PatternIndex::add(const TCHAR *pattern)
+{
+   int32_t index = m_patterns.size();
+   m_patterns.add(pattern);
+
+   size_t keyLen = GetPatternKeyLength(pattern);
+   if (keyLen > 0)
+   {
+      IntegerArray<int32_t> *bucket = m_buckets.get(pattern, keyLen);
+      if (bucket == nullptr)
+      {
+         bucket = new IntegerArray<int32_t>(0, 4);
+         TCHAR *key = MemAllocString(keyLen + 1);
+         memcpy(key, pattern, keyLen * sizeof(TCHAR));
+         key[keyLen] = 0;
+         m_buckets.setPreallocated(key, bucket);
+      }
+      bucket->add(index);
+   }
+   else
+   {
+      m_unindexed.add(index);
+   }
+   return index;
+}
+
+/**
+ * Find first matching pattern in bucket with index below given limit. Returns -1 if there are no such pattern.
+ */
+int32_t PatternIndex::findInBucket(const IntegerArray<int32_t> *bucket, const TCHAR *name, int32_t limit) const
+{
+   for(int i = 0; i < bucket->size(); i++)
+   {
+      int32_t index = bucket->get(i);
+      if (index >= limit)
+         break;   // Indexes in bucket are ascending
+      if (MatchString(m_patterns.get(index), name, false))
+         return index;
+   }
+   return -1;
+}
+
+/**
+ * Find first (in order of addition) pattern matching given name. Returns index of pattern or -1 if there are no match.
+ */
+int PatternIndex::find(const TCHAR *name) const
+{
+   int32_t result = m_patterns.size();
+
+   IntegerArray<int32_t> *bucket = m_buckets.get(name);
+   if (bucket != nullptr)
+   {
+      int32_t index = findInBucket(bucket, name, result);
+      if (index != -1)
+         result = index;
+   }
+
+   const TCHAR *p = _tcschr(name, _T('('));
+   if ((p != nullptr) && (p[1] != 0))
+   {
+      bucket = m_buckets.get(name, p - name + 1);
+      if (bucket != nullptr)
+      {
+         int32_t index = findInBucket(bucket, name, result);
+         if (index != -1)
+            result = index;
+      }
+   }
+
+   int32_t index = findInBucket(&m_unindexed, name, result);
+   if (index != -1)
+      result = index;
+
+   return (result < m_patterns.size()) ? result : -1;
+}
+
+/**
+ * Remove all patterns from index
+ */
+void PatternIndex::clear()
+{
+   m_patterns.clear();
+   m_buckets.clear();
+   m_unindexed.clear();
+}
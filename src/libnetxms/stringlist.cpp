@@ -482,7 +482,9 @@ void StringList::addAllFromMessage(const NXCPMessage& msg, uint32_t baseId, uint
    uint32_t id = baseId;
    for(int i = 0; i < count; i++)
    {
-      addPreallocated(msg.getFieldAsString(id++));
+      // Convert directly into list's memory pool to avoid intermediate heap copy
+      CHECK_ALLOCATION;
+      m_values[m_count++] = msg.getFieldAsString(id++, &m_pool);
    }
 }
 
@@ -297,6 +297,9 @@ Table *Table::createFromXML(const char *xml)
  */
 Table *Table::createFromPackedXML(const char *packedXml)
 {
+   if (*packedXml == '#')
+      return createFromPackedData(packedXml);  // Packed binary format without reference
+
    char *compressedXml = nullptr;
    size_t compressedSize = 0;
    base64_decode_alloc(packedXml, strlen(packedXml), &compressedXml, &compressedSize);
@@ -411,6 +414,562 @@ char *Table::createPackedXML() const
    return encodedBuffer;
 }
 
+/**
+ * Packed binary table format version
+ */
+#define PACKED_BINARY_VERSION    1
+
+/**
+ * Column value encodings in packed binary format
+ */
+#define COLUMN_ENCODING_DICTIONARY  0
+#define COLUMN_ENCODING_INTEGER     1
+
+/**
+ * Column block flags in packed binary format
+ */
+#define COLUMN_FLAG_STATUS       0x01
+#define COLUMN_FLAG_OBJECT_ID    0x02
+#define COLUMN_FLAG_DELTA        0x04
+
+/**
+ * Row flags in packed binary format
+ */
+#define ROW_FLAG_OBJECT_ID       0x01
+#define ROW_FLAG_BASE_ROW        0x02
+
+/**
+ * Write unsigned variable length integer
+ */
+static inline void WriteVarUInt(ByteStream *out, uint64_t value)
+{
+   while(value >= 0x80)
+   {
+      out->write(static_cast<BYTE>(value | 0x80));
+      value >>= 7;
+   }
+   out->write(static_cast<BYTE>(value));
+}
+
+/**
+ * Write signed variable length integer (zigzag encoded)
+ */
+static inline void WriteVarInt(ByteStream *out, int64_t value)
+{
+   WriteVarUInt(out, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+}
+
+/**
+ * Write string as UTF-8 prefixed with length. Length 0 indicates null string.
+ */
+static void WritePackedString(ByteStream *out, const TCHAR *value)
+{
+   if (value == nullptr)
+   {
+      WriteVarUInt(out, 0);
+      return;
+   }
+   char *utf8 = UTF8StringFromTString(value);
+   size_t len = strlen(utf8);
+   WriteVarUInt(out, len + 1);
+   out->write(utf8, len);
+   MemFree(utf8);
+}
+
+/**
+ * Parse integer in canonical decimal form (one that will be reproduced exactly by formatting parsed value back)
+ */
+static bool ParseCanonicalInteger(const TCHAR *s, int64_t *value)
+{
+   const TCHAR *p = s;
+   bool negative = (*p == _T('-'));
+   if (negative)
+      p++;
+   if ((*p < _T('0')) || (*p > _T('9')) || ((*p == _T('0')) && ((*(p + 1) != 0) || negative)))
+      return false;
+
+   uint64_t n = 0;
+   int digits = 0;
+   for(; *p != 0; p++)
+   {
+      if ((*p < _T('0')) || (*p > _T('9')) || (++digits > 18))
+         return false;
+      n = n * 10 + (*p - _T('0'));
+   }
+   *value = negative ? -static_cast<int64_t>(n) : static_cast<int64_t>(n);
+   return true;
+}
+
+/**
+ * Encode single column into packed binary format. If reference table is provided,
+ * only cells that differ from same cells in reference table are encoded.
+ */
+static void EncodeColumn(ByteStream *out, const Table& table, int col, const Table *reference)
+{
+   int rows = table.getNumRows();
+
+   BYTE flags = (reference != nullptr) ? COLUMN_FLAG_DELTA : 0;
+   IntegerArray<int> present(rows);
+   Buffer<BYTE, 256> changed((rows + 7) / 8);
+   for(int r = 0; r < rows; r++)
+   {
+      if (reference != nullptr)
+      {
+         const TCHAR *v = table.getAsString(r, col);
+         const TCHAR *rv = reference->getAsString(r, col);
+         if ((v == nullptr) ? (rv == nullptr) : ((rv != nullptr) && !_tcscmp(v, rv)))
+            continue;
+         changed[r >> 3] |= static_cast<BYTE>(1 << (r & 7));
+      }
+      present.add(r);
+   }
+
+   bool integerEncoding = !present.isEmpty();
+   for(int i = 0; (i < present.size()) && integerEncoding; i++)
+   {
+      const TCHAR *v = table.getAsString(present.get(i), col);
+      int64_t n;
+      integerEncoding = (v != nullptr) && ParseCanonicalInteger(v, &n);
+   }
+
+   for(int r = 0; r < rows; r++)
+   {
+      if (table.getStatus(r, col) != DEFAULT_STATUS)
+         flags |= COLUMN_FLAG_STATUS;
+      if (table.getCellObjectId(r, col) != DEFAULT_OBJECT_ID)
+         flags |= COLUMN_FLAG_OBJECT_ID;
+   }
+
+   out->write(static_cast<BYTE>(integerEncoding ? COLUMN_ENCODING_INTEGER : COLUMN_ENCODING_DICTIONARY));
+   out->write(flags);
+   if (flags & COLUMN_FLAG_DELTA)
+      out->write(changed, (rows + 7) / 8);
+
+   if (integerEncoding)
+   {
+      // Each value is stored as difference from previous value in same column
+      int64_t prev = 0;
+      for(int i = 0; i < present.size(); i++)
+      {
+         int64_t n;
+         ParseCanonicalInteger(table.getAsString(present.get(i), col), &n);
+         WriteVarInt(out, n - prev);
+         prev = n;
+      }
+   }
+   else
+   {
+      StringObjectMap<uint32_t> dictionary(Ownership::False);
+      dictionary.setIgnoreCase(false);
+      StringList values;
+      IntegerArray<uint32_t> indexes(present.size());
+      for(int i = 0; i < present.size(); i++)
+      {
+         const TCHAR *v = table.getAsString(present.get(i), col);
+         if (v == nullptr)
+         {
+            indexes.add(0);
+            continue;
+         }
+         uint32_t index = CAST_FROM_POINTER(dictionary.get(v), uint32_t);
+         if (index == 0)
+         {
+            values.add(v);
+            index = values.size();
+            dictionary.set(v, CAST_TO_POINTER(index, uint32_t*));
+         }
+         indexes.add(index);
+      }
+
+      WriteVarUInt(out, values.size());
+      for(int i = 0; i < values.size(); i++)
+         WritePackedString(out, values.get(i));
+      for(int i = 0; i < indexes.size(); i++)
+         WriteVarUInt(out, indexes.get(i));
+   }
+
+   if (flags & COLUMN_FLAG_STATUS)
+   {
+      for(int r = 0; r < rows; r++)
+         WriteVarInt(out, table.getStatus(r, col));
+   }
+   if (flags & COLUMN_FLAG_OBJECT_ID)
+   {
+      for(int r = 0; r < rows; r++)
+         WriteVarUInt(out, table.getCellObjectId(r, col));
+   }
+}
+
+/**
+ * Create packed binary representation of the table. Data is organized by columns, with string values
+ * dictionary encoded and integer values delta encoded within column. If reference table (usually
+ * previous sample of same table) is provided and has same structure, only cells that differ from
+ * reference are stored, and same reference table should be provided for decoding. Reference
+ * timestamp is stored in packed data as is and can be retrieved with getPackedDataReference().
+ * Returned string is in the same textual form as packed XML and should be freed by caller.
+ */
+char *Table::createPackedBinary(const Table *reference, time_t referenceTimestamp) const
+{
+   if ((reference != nullptr) && (reference->getNumRows() != m_data.size()))
+      reference = nullptr;
+
+   ByteStream out(8192);
+   out.write(static_cast<BYTE>(m_extendedFormat ? 1 : 0));
+   WriteVarInt(&out, m_source);
+   WritePackedString(&out, m_title);
+   WriteVarUInt(&out, m_columns.size());
+   for(int i = 0; i < m_columns.size(); i++)
+   {
+      TableColumnDefinition *c = m_columns.get(i);
+      WritePackedString(&out, c->getName());
+      WritePackedString(&out, c->getDisplayName());
+      WriteVarInt(&out, c->getDataType());
+      out.write(static_cast<BYTE>(c->isInstanceColumn() ? 1 : 0));
+   }
+
+   WriteVarUInt(&out, m_data.size());
+   BYTE rowFlags = 0;
+   for(int i = 0; i < m_data.size(); i++)
+   {
+      if (m_data.get(i)->getObjectId() != DEFAULT_OBJECT_ID)
+         rowFlags |= ROW_FLAG_OBJECT_ID;
+      if (m_data.get(i)->getBaseRow() != -1)
+         rowFlags |= ROW_FLAG_BASE_ROW;
+   }
+   out.write(rowFlags);
+   if (rowFlags & ROW_FLAG_OBJECT_ID)
+   {
+      for(int i = 0; i < m_data.size(); i++)
+         WriteVarUInt(&out, m_data.get(i)->getObjectId());
+   }
+   if (rowFlags & ROW_FLAG_BASE_ROW)
+   {
+      for(int i = 0; i < m_data.size(); i++)
+         WriteVarInt(&out, m_data.get(i)->getBaseRow());
+   }
+
+   // Each column block is prefixed with its size so reader can skip columns it does not need
+   ByteStream block(4096);
+   for(int i = 0; i < m_columns.size(); i++)
+   {
+      bool delta = (reference != nullptr) && (i < reference->getNumColumns()) && !_tcscmp(reference->getColumnName(i), m_columns.get(i)->getName());
+      block.clear();
+      EncodeColumn(&block, *this, i, delta ? reference : nullptr);
+      WriteVarUInt(&out, block.size());
+      out.write(block.buffer(), block.size());
+   }
+
+   uLongf buflen = compressBound(static_cast<uLong>(out.size()));
+   BYTE *buffer = MemAllocArrayNoInit<BYTE>(buflen + 4);
+   if (compress(&buffer[4], &buflen, out.buffer(), static_cast<uLong>(out.size())) != Z_OK)
+   {
+      MemFree(buffer);
+      return nullptr;
+   }
+   *reinterpret_cast<uint32_t*>(buffer) = htonl(static_cast<uint32_t>(out.size()));
+
+   char *encodedBuffer = nullptr;
+   size_t encodedSize = base64_encode_alloc(reinterpret_cast<char*>(buffer), buflen + 4, &encodedBuffer);
+   MemFree(buffer);
+   if (encodedBuffer == nullptr)
+      return nullptr;
+
+   // Binary format is marked by # character which cannot appear in packed XML
+   char header[64];
+   int headerLen = snprintf(header, sizeof(header), "#%d:" INT64_FMTA ":", PACKED_BINARY_VERSION, static_cast<int64_t>((reference != nullptr) ? referenceTimestamp : 0));
+   char *result = MemAllocArrayNoInit<char>(headerLen + encodedSize + 1);
+   memcpy(result, header, headerLen);
+   memcpy(&result[headerLen], encodedBuffer, encodedSize + 1);
+   MemFree(encodedBuffer);
+   return result;
+}
+
+/**
+ * Reader for packed binary table data
+ */
+class PackedTableReader
+{
+private:
+   const BYTE *m_curr;
+   const BYTE *m_end;
+   bool m_error;
+
+public:
+   PackedTableReader(const BYTE *data, size_t size)
+   {
+      m_curr = data;
+      m_end = data + size;
+      m_error = false;
+   }
+
+   bool isError() const { return m_error; }
+   const BYTE *position() const { return m_curr; }
+
+   BYTE readByte()
+   {
+      if (m_curr >= m_end)
+      {
+         m_error = true;
+         return 0;
+      }
+      return *m_curr++;
+   }
+
+   uint64_t readVarUInt()
+   {
+      uint64_t value = 0;
+      for(int shift = 0; shift < 64; shift += 7)
+      {
+         BYTE b = readByte();
+         value |= static_cast<uint64_t>(b & 0x7F) << shift;
+         if (!(b & 0x80))
+            return value;
+      }
+      m_error = true;
+      return 0;
+   }
+
+   int64_t readVarInt()
+   {
+      uint64_t n = readVarUInt();
+      return static_cast<int64_t>(n >> 1) ^ -static_cast<int64_t>(n & 1);
+   }
+
+   const BYTE *readBytes(size_t size)
+   {
+      if (static_cast<size_t>(m_end - m_curr) < size)
+      {
+         m_error = true;
+         return nullptr;
+      }
+      const BYTE *p = m_curr;
+      m_curr += size;
+      return p;
+   }
+
+   TCHAR *readString()
+   {
+      size_t len = static_cast<size_t>(readVarUInt());
+      if (len == 0)
+         return nullptr;
+      len--;
+      const BYTE *p = readBytes(len);
+      if (p == nullptr)
+         return nullptr;
+      TCHAR *s = MemAllocString(len + 1);
+#ifdef UNICODE
+      size_t chars = utf8_to_wchar(reinterpret_cast<const char*>(p), len, s, len + 1);
+      s[chars] = 0;
+#else
+      memcpy(s, p, len);
+      s[len] = 0;
+#endif
+      return s;
+   }
+};
+
+/**
+ * Decode single column from packed binary format into given column of destination table
+ */
+static bool DecodeColumn(PackedTableReader *reader, Table *table, int col, const Table *reference, int refCol)
+{
+   int rows = table->getNumRows();
+   BYTE encoding = reader->readByte();
+   BYTE flags = reader->readByte();
+
+   const BYTE *changed = nullptr;
+   if (flags & COLUMN_FLAG_DELTA)
+   {
+      if ((reference == nullptr) || (refCol < 0) || (reference->getNumRows() != rows))
+         return false;  // Reference sample is required to decode this column
+      changed = reader->readBytes((rows + 7) / 8);
+   }
+   if (reader->isError())
+      return false;
+
+   IntegerArray<int> present(rows);
+   for(int r = 0; r < rows; r++)
+   {
+      if ((changed == nullptr) || (changed[r >> 3] & (1 << (r & 7))))
+         present.add(r);
+      else
+         table->setAt(r, col, reference->getAsString(r, refCol));
+   }
+
+   if (encoding == COLUMN_ENCODING_INTEGER)
+   {
+      int64_t value = 0;
+      TCHAR buffer[32];
+      for(int i = 0; (i < present.size()) && !reader->isError(); i++)
+      {
+         value += reader->readVarInt();
+         _sntprintf(buffer, 32, INT64_FMT, value);
+         table->setAt(present.get(i), col, buffer);
+      }
+   }
+   else if (encoding == COLUMN_ENCODING_DICTIONARY)
+   {
+      uint32_t count = static_cast<uint32_t>(reader->readVarUInt());
+      if (reader->isError() || (count > static_cast<uint32_t>(rows)))
+         return false;
+      TCHAR **dictionary = MemAllocArray<TCHAR*>(count);
+      for(uint32_t i = 0; (i < count) && !reader->isError(); i++)
+         dictionary[i] = reader->readString();
+      for(int i = 0; (i < present.size()) && !reader->isError(); i++)
+      {
+         uint32_t index = static_cast<uint32_t>(reader->readVarUInt());
+         if ((index > 0) && (index <= count))
+            table->setAt(present.get(i), col, dictionary[index - 1]);
+      }
+      for(uint32_t i = 0; i < count; i++)
+         MemFree(dictionary[i]);
+      MemFree(dictionary);
+   }
+   else
+   {
+      return false;
+   }
+
+   if (flags & COLUMN_FLAG_STATUS)
+   {
+      for(int r = 0; r < rows; r++)
+         table->setStatusAt(r, col, static_cast<int>(reader->readVarInt()));
+   }
+   if (flags & COLUMN_FLAG_OBJECT_ID)
+   {
+      for(int r = 0; r < rows; r++)
+         table->setCellObjectIdAt(r, col, static_cast<uint32_t>(reader->readVarUInt()));
+   }
+   return !reader->isError();
+}
+
+/**
+ * Get reference timestamp from packed table data. Returns 0 if data is not delta encoded.
+ */
+time_t Table::getPackedDataReference(const char *packedData)
+{
+   if (*packedData != '#')
+      return 0;
+   const char *p = strchr(packedData, ':');
+   return (p != nullptr) ? static_cast<time_t>(strtoll(p + 1, nullptr, 10)) : 0;
+}
+
+/**
+ * Create table from packed data in either packed XML or packed binary format. For delta encoded
+ * binary data same reference table as used for encoding should be provided. If list of columns is
+ * provided, only those columns and instance columns are decoded; other columns are skipped without
+ * parsing their data.
+ */
+Table *Table::createFromPackedData(const char *packedData, const Table *reference, const StringList *columns)
+{
+   if (*packedData != '#')
+      return createFromPackedXML(packedData);
+
+   char *eptr;
+   int version = strtol(packedData + 1, &eptr, 10);
+   if ((version != PACKED_BINARY_VERSION) || (*eptr != ':'))
+      return nullptr;
+   const char *encodedData = strchr(eptr + 1, ':');
+   if (encodedData == nullptr)
+      return nullptr;
+   encodedData++;
+
+   char *compressedData = nullptr;
+   size_t compressedSize = 0;
+   base64_decode_alloc(encodedData, strlen(encodedData), &compressedData, &compressedSize);
+   if ((compressedData == nullptr) || (compressedSize < 4))
+   {
+      MemFree(compressedData);
+      return nullptr;
+   }
+
+   size_t dataSize = ntohl(*reinterpret_cast<uint32_t*>(compressedData));
+   BYTE *data = MemAllocArrayNoInit<BYTE>(dataSize);
+   uLongf uncompSize = static_cast<uLongf>(dataSize);
+   if (uncompress(data, &uncompSize, reinterpret_cast<BYTE*>(&compressedData[4]), static_cast<uLong>(compressedSize) - 4) != Z_OK)
+   {
+      MemFree(data);
+      MemFree(compressedData);
+      return nullptr;
+   }
+   MemFree(compressedData);
+
+   PackedTableReader reader(data, dataSize);
+   Table *table = new Table();
+   table->m_extendedFormat = (reader.readByte() != 0);
+   table->m_source = static_cast<int>(reader.readVarInt());
+   table->m_title = reader.readString();
+
+   // Map from source column index to table column index (-1 if column is not decoded)
+   int columnCount = static_cast<int>(reader.readVarUInt());
+   IntegerArray<int> columnMap(columnCount);
+   for(int i = 0; (i < columnCount) && !reader.isError(); i++)
+   {
+      TCHAR *name = reader.readString();
+      TCHAR *displayName = reader.readString();
+      int32_t dataType = static_cast<int32_t>(reader.readVarInt());
+      bool isInstance = (reader.readByte() != 0);
+      if ((columns == nullptr) || isInstance || ((name != nullptr) && columns->containsIgnoreCase(name)))
+         columnMap.add(table->addColumn(CHECK_NULL_EX(name), dataType, displayName, isInstance));
+      else
+         columnMap.add(-1);
+      MemFree(name);
+      MemFree(displayName);
+   }
+
+   int rowCount = static_cast<int>(reader.readVarUInt());
+   if (!reader.isError() && (rowCount >= 0) && (static_cast<size_t>(rowCount) <= dataSize))
+   {
+      for(int i = 0; i < rowCount; i++)
+         table->addRow();
+   }
+   else
+   {
+      rowCount = 0;
+      reader.readBytes(dataSize);  // Set error condition
+   }
+
+   BYTE rowFlags = reader.readByte();
+   if (rowFlags & ROW_FLAG_OBJECT_ID)
+   {
+      for(int i = 0; i < rowCount; i++)
+         table->setObjectIdAt(i, static_cast<uint32_t>(reader.readVarUInt()));
+   }
+   if (rowFlags & ROW_FLAG_BASE_ROW)
+   {
+      for(int i = 0; i < rowCount; i++)
+         table->setBaseRowAt(i, static_cast<int>(reader.readVarInt()));
+   }
+
+   bool success = !reader.isError();
+   for(int i = 0; (i < columnCount) && success; i++)
+   {
+      size_t blockSize = static_cast<size_t>(reader.readVarUInt());
+      const BYTE *block = reader.readBytes(blockSize);
+      if (block == nullptr)
+      {
+         success = false;
+         break;
+      }
+
+      int col = columnMap.get(i);
+      if (col == -1)
+         continue;   // Column not requested
+
+      int refCol = ((reference != nullptr) && (i < reference->getNumColumns()) && !_tcscmp(reference->getColumnName(i), table->getColumnName(col))) ? i : -1;
+      PackedTableReader blockReader(block, blockSize);
+      success = DecodeColumn(&blockReader, table, col, reference, refCol);
+   }
+   MemFree(data);
+
+   if (!success)
+   {
+      delete table;
+      return nullptr;
+   }
+   return table;
+}
+
 Table *Table::createFromCSV(const TCHAR *content, const TCHAR separator)
 {
    if (content == nullptr)
@@ -44,6 +44,11 @@ static const TCHAR *s_encodingName[] =
    _T("UCS-4BE")
 };
 
+/**
+ * Initial size of read buffer
+ */
+#define READ_BUFFER_INITIAL_SIZE    16384
+
 /**
  * Find byte sequence in the stream
  */
@@ -165,7 +170,7 @@ off_t LogParser::processNewRecords(int fh, const TCHAR *fileName)
 
    if (m_readBuffer == nullptr)
    {
-      m_readBufferSize = 4096;
+      m_readBufferSize = READ_BUFFER_INITIAL_SIZE;
       m_readBuffer = MemAllocStringA(m_readBufferSize);
       m_textBuffer = MemAllocString(m_readBufferSize);
    }
@@ -191,7 +196,7 @@ off_t LogParser::processNewRecords(int fh, const TCHAR *fileName)
                if (remaining == m_readBufferSize)
                {
                   // buffer is full, and no new line in buffer
-                  m_readBufferSize += 4096;
+                  m_readBufferSize *= 2;
                   m_readBuffer = MemRealloc(m_readBuffer, m_readBufferSize);
                   m_textBuffer = MemReallocArray(m_textBuffer, m_readBufferSize);
                }
@@ -520,6 +525,179 @@ static void SeekToZero(int fh, int chsize, bool detectBrokenPrealloc)
    }
 }
 
+/**
+ * Open log file with name expanded from configured name pattern. On success returns file handle and
+ * sets current file size and modification time, otherwise returns -1 and sets parser status.
+ */
+int LogParser::openLogFile(TCHAR *fname, size_t *size, time_t *mtime, bool *readFromStart)
+{
+   ExpandFileName(getFileName(), fname, MAX_PATH, true);
+   NX_STAT_STRUCT st;
+   if (CALL_STAT(fname, &st) != 0)
+   {
+      if (errno == ENOENT)
+         *readFromStart = true;
+      setStatus(LPS_NO_FILE);
+      return -1;
+   }
+
+#ifdef _WIN32
+   int fh = _tsopen(fname, O_RDONLY | O_BINARY, _SH_DENYNO);
+#else
+   int fh = _topen(fname, O_RDONLY);
+#endif
+   if (fh == -1)
+   {
+      setStatus(LPS_OPEN_ERROR);
+      return -1;
+   }
+
+   setStatus(LPS_RUNNING);
+   nxlog_debug_tag(DEBUG_TAG, 3, _T("File \"%s\" (pattern \"%s\") successfully opened"), fname, m_fileName);
+
+   if (m_fileEncoding == LP_FCP_AUTO)
+   {
+      m_fileEncoding = ScanFileEncoding(fh);
+      _lseek(fh, 0, SEEK_SET);
+      nxlog_debug_tag(DEBUG_TAG, 3, _T("Detected encoding %s for file \"%s\""), s_encodingName[m_fileEncoding], fname);
+   }
+
+   *size = (size_t)st.st_size;
+   *mtime = st.st_mtime;
+   return fh;
+}
+
+/**
+ * Process existing records in just opened log file if needed and set read position for monitoring
+ */
+void LogParser::seekToStartPosition(int fh, const TCHAR *fname, bool *readFromStart, off_t *startOffset)
+{
+   if (*readFromStart)
+   {
+      nxlog_debug_tag(DEBUG_TAG, 5, _T("Parsing existing records in file \"%s\""), fname);
+      off_t resetPos = processNewRecords(fh, fname);
+      _lseek(fh, resetPos, SEEK_SET);
+      *readFromStart = m_rescan;
+      *startOffset = -1;
+   }
+   else if (*startOffset > 0)
+   {
+      nxlog_debug_tag(DEBUG_TAG, 5, _T("Parsing existing records in file \"%s\" starting at offset ") INT64_FMT, fname, static_cast<int64_t>(*startOffset));
+      _lseek(fh, *startOffset, SEEK_SET);
+      off_t resetPos = processNewRecords(fh, fname);
+      _lseek(fh, resetPos, SEEK_SET);
+      *startOffset = -1;
+   }
+   else if (m_preallocatedFile)
+   {
+      SeekToZero(fh, getCharSize(), m_detectBrokenPrealloc);
+   }
+   else
+   {
+      _lseek(fh, 0, SEEK_END);
+   }
+}
+
+/**
+ * Check if open log file was renamed or replaced (or file name pattern now expands to different name).
+ * If file was not replaced, current file size and modification time are returned via arguments.
+ */
+bool LogParser::isLogFileReplaced(int fh, const TCHAR *fname, size_t *size, time_t *mtime)
+{
+   // Check if file name was changed
+   TCHAR temp[MAX_PATH];
+   ExpandFileName(getFileName(), temp, MAX_PATH, true);
+   if (_tcscmp(temp, fname))
+   {
+      nxlog_debug_tag(DEBUG_TAG, 5, _T("File name change for \"%s\" (\"%s\" -> \"%s\")"), m_fileName, fname, temp);
+      return true;
+   }
+
+   NX_STAT_STRUCT st;
+   if (NX_FSTAT(fh, &st) < 0)
+   {
+      nxlog_debug_tag(DEBUG_TAG, 1, _T("fstat(%d) failed, errno=%d"), fh, errno);
+      return true;
+   }
+
+   NX_STAT_STRUCT stn;
+   if (CALL_STAT(fname, &stn) < 0)
+   {
+      nxlog_debug_tag(DEBUG_TAG, 1, _T("stat(%s) failed, errno=%d"), fname, errno);
+      return true;
+   }
+
+#ifdef _WIN32
+   if (st.st_ctime != stn.st_ctime)
+   {
+      nxlog_debug_tag(DEBUG_TAG, 3, _T("Creation time for fstat(%d) is not equal to creation time for stat(%s), assume file rename"), fh, fname);
+      return true;
+   }
+#else
+   if ((st.st_ino != stn.st_ino) || (st.st_dev != stn.st_dev))
+   {
+      nxlog_debug_tag(DEBUG_TAG, 3, _T("File device or inode differs for stat(%d) and fstat(%s), assume file rename"), fh, fname);
+      return true;
+   }
+#endif
+
+   *size = (size_t)st.st_size;
+   *mtime = st.st_mtime;
+   return false;
+}
+
+/**
+ * Read new records from open log file. Known file size and modification time are updated from
+ * current values. Handles file truncation (rotation by copy) and preallocated files.
+ */
+void LogParser::readLogFileChanges(int fh, const TCHAR *fname, size_t currSize, time_t currMTime, size_t *size, time_t *mtime)
+{
+   if ((currSize != *size) || (!m_ignoreMTime && m_rescan && (*mtime != currMTime)))
+   {
+      if ((currSize < *size) || m_rescan)
+      {
+         // File was cleared, start from the beginning
+         _lseek(fh, 0, SEEK_SET);
+         if (!m_rescan)
+            nxlog_debug_tag(DEBUG_TAG, 3, _T("File \"%s\" st_size < size, assume file rotation"), fname);
+      }
+      *size = currSize;
+      *mtime = currMTime;
+      nxlog_debug_tag(DEBUG_TAG, 6, _T("New data available in file \"%s\""), fname);
+      off_t resetPos = processNewRecords(fh, fname);
+      _lseek(fh, resetPos, SEEK_SET);
+   }
+   else if (m_preallocatedFile)
+   {
+      char buffer[4];
+      int bytes = _read(fh, buffer, 4);
+      if ((bytes == 4) && memcmp(buffer, "\x00\x00\x00\x00", 4))
+      {
+         _lseek(fh, -4, SEEK_CUR);
+         nxlog_debug_tag(DEBUG_TAG, 6, _T("New data available in file \"%s\""), fname);
+         off_t resetPos = processNewRecords(fh, fname);
+         _lseek(fh, resetPos, SEEK_SET);
+      }
+      else
+      {
+         off_t pos = _lseek(fh, -bytes, SEEK_CUR);
+         if (pos > 0)
+         {
+            int readSize = std::min(pos, (off_t)4);
+            _lseek(fh, -readSize, SEEK_CUR);
+            int bytes = _read(fh, buffer, readSize);
+            if ((bytes == readSize) && !memcmp(buffer, "\x00\x00\x00\x00", readSize))
+            {
+               nxlog_debug_tag(DEBUG_TAG, 6, _T("Detected reset of preallocated file \"%s\""), fname);
+               _lseek(fh, 0, SEEK_SET);
+               off_t resetPos = processNewRecords(fh, fname);
+               _lseek(fh, resetPos, SEEK_SET);
+            }
+         }
+      }
+   }
+}
+
 /**
  * File parser thread
  */
@@ -571,67 +749,17 @@ bool LogParser::monitorFile(off_t startOffset)
 	   }
 
       TCHAR fname[MAX_PATH];
-      ExpandFileName(getFileName(), fname, MAX_PATH, true);
-      NX_STAT_STRUCT st;
-      if (CALL_STAT(fname, &st) != 0)
+      size_t size;
+      time_t mtime;
+      int fh = openLogFile(fname, &size, &mtime, &readFromStart);
+      if (fh == -1)
       {
-         if (errno == ENOENT)
-            readFromStart = true;
-         setStatus(LPS_NO_FILE);
          if (m_stopCondition.wait(10000))
             break;
          continue;
       }
 
-#ifdef _WIN32
-      int fh = _tsopen(fname, O_RDONLY | O_BINARY, _SH_DENYNO);
-#else
-		int fh = _topen(fname, O_RDONLY);
-#endif
-		if (fh == -1)
-      {
-         setStatus(LPS_OPEN_ERROR);
-         if (m_stopCondition.wait(10000))
-            break;
-         continue;
-      }
-
-		setStatus(LPS_RUNNING);
-		nxlog_debug_tag(DEBUG_TAG, 3, _T("File \"%s\" (pattern \"%s\") successfully opened"), fname, m_fileName);
-
-      if (m_fileEncoding == LP_FCP_AUTO)
-      {
-         m_fileEncoding = ScanFileEncoding(fh);
-         _lseek(fh, 0, SEEK_SET);
-         nxlog_debug_tag(DEBUG_TAG, 3, _T("Detected encoding %s for file \"%s\""), s_encodingName[m_fileEncoding], fname);
-      }
-
-		size_t size = (size_t)st.st_size;
-		time_t mtime = st.st_mtime;
-		if (readFromStart)
-		{
-			nxlog_debug_tag(DEBUG_TAG, 5, _T("Parsing existing records in file \"%s\""), fname);
-			off_t resetPos = processNewRecords(fh, fname);
-         _lseek(fh, resetPos, SEEK_SET);
-         readFromStart = m_rescan;
-         startOffset = -1;
-      }
-      else if (startOffset > 0)
-      {
-         nxlog_debug_tag(DEBUG_TAG, 5, _T("Parsing existing records in file \"%s\" starting at offset ") INT64_FMT, fname, static_cast<int64_t>(startOffset));
-         _lseek(fh, startOffset, SEEK_SET);
-         off_t resetPos = processNewRecords(fh, fname);
-         _lseek(fh, resetPos, SEEK_SET);
-         startOffset = -1;
-      }
-		else if (m_preallocatedFile)
-		{
-			SeekToZero(fh, getCharSize(), m_detectBrokenPrealloc);
-		}
-		else
-		{
-			_lseek(fh, 0, SEEK_END);
-		}
+      seekToStartPosition(fh, fname, &readFromStart, &startOffset);
 
 		while(true)
 		{
@@ -641,92 +769,15 @@ bool LogParser::monitorFile(off_t startOffset)
 				goto stop_parser;
 			}
 
-			// Check if file name was changed
-         TCHAR temp[MAX_PATH];
-			ExpandFileName(getFileName(), temp, MAX_PATH, true);
-			if (_tcscmp(temp, fname))
-			{
-				nxlog_debug_tag(DEBUG_TAG, 5, _T("File name change for \"%s\" (\"%s\" -> \"%s\")"), m_fileName, fname, temp);
-				readFromStart = true;
-				break;
-			}
-
-			if (NX_FSTAT(fh, &st) < 0)
-			{
-				nxlog_debug_tag(DEBUG_TAG, 1, _T("fstat(%d) failed, errno=%d"), fh, errno);
-				readFromStart = true;
-				break;
-			}
+         size_t currSize;
+         time_t currMTime;
+         if (isLogFileReplaced(fh, fname, &currSize, &currMTime))
+         {
+            readFromStart = true;
+            break;
+         }
 
-         NX_STAT_STRUCT stn;
-         if (CALL_STAT(fname, &stn) < 0)
-			{
-				nxlog_debug_tag(DEBUG_TAG, 1, _T("stat(%s) failed, errno=%d"), fname, errno);
-				readFromStart = true;
-				break;
-			}
-
-#ifdef _WIN32
-			if (st.st_ctime != stn.st_ctime)
-			{
-				nxlog_debug_tag(DEBUG_TAG, 3, _T("Creation time for fstat(%d) is not equal to creation time for stat(%s), assume file rename"), fh, fname);
-				readFromStart = true;
-				break;
-			}
-#else
-			if ((st.st_ino != stn.st_ino) || (st.st_dev != stn.st_dev))
-			{
-				nxlog_debug_tag(DEBUG_TAG, 3, _T("File device or inode differs for stat(%d) and fstat(%s), assume file rename"), fh, fname);
-				readFromStart = true;
-				break;
-			}
-#endif
-
-			if (((size_t)st.st_size != size) ||
-			    (!m_ignoreMTime && m_rescan && (mtime != st.st_mtime)))
-			{
-				if (((size_t)st.st_size < size) || m_rescan)
-				{
-					// File was cleared, start from the beginning
-					_lseek(fh, 0, SEEK_SET);
-					if (!m_rescan)
-					   nxlog_debug_tag(DEBUG_TAG, 3, _T("File \"%s\" st_size < size, assume file rotation"), fname);
-				}
-				size = (size_t)st.st_size;
-				mtime = st.st_mtime;
-				nxlog_debug_tag(DEBUG_TAG, 6, _T("New data available in file \"%s\""), fname);
-				off_t resetPos = processNewRecords(fh, fname);
-				_lseek(fh, resetPos, SEEK_SET);
-			}
-			else if (m_preallocatedFile)
-			{
-				char buffer[4];
-				int bytes = _read(fh, buffer, 4);
-				if ((bytes == 4) && memcmp(buffer, "\x00\x00\x00\x00", 4))
-				{
-               _lseek(fh, -4, SEEK_CUR);
-	            nxlog_debug_tag(DEBUG_TAG, 6, _T("New data available in file \"%s\""), fname);
-	            off_t resetPos = processNewRecords(fh, fname);
-	            _lseek(fh, resetPos, SEEK_SET);
-				}
-				else
-				{
-               off_t pos = _lseek(fh, -bytes, SEEK_CUR);
-               if (pos > 0)
-               {
-                  int readSize = std::min(pos, (off_t)4);
-                  _lseek(fh, -readSize, SEEK_CUR);
-                  int bytes = _read(fh, buffer, readSize);
-                  if ((bytes == readSize) && !memcmp(buffer, "\x00\x00\x00\x00", readSize))
-                  {
-                     nxlog_debug_tag(DEBUG_TAG, 6, _T("Detected reset of preallocated file \"%s\""), fname);
-                     _lseek(fh, 0, SEEK_SET);
-                     off_t resetPos = processNewRecords(fh, fname);
-                     _lseek(fh, resetPos, SEEK_SET);
-                  }
-               }
-				}
-			}
+         readLogFileChanges(fh, fname, currSize, currMTime, &size, &mtime);
 
 			if (isExclusionPeriod())
 			{
@@ -744,6 +795,78 @@ bool LogParser::monitorFile(off_t startOffset)
 	return true;
 }
 
+/**
+ * Interval in milliseconds for safety checks of files with active change notification watch
+ */
+#define WATCHED_FILE_CHECK_INTERVAL    30000
+
+/**
+ * Open file monitored by shared tailer and position it for reading. Returns time in milliseconds until next check.
+ */
+uint32_t LogParser::openTailedFile(TailedFile *file)
+{
+   file->fh = openLogFile(file->fname, &file->size, &file->mtime, &file->readFromStart);
+   if (file->fh == -1)
+      return 10000;
+
+   // Start watch before reading existing records so that no changes will be missed
+   TailerWatchFile(file);
+
+   seekToStartPosition(file->fh, file->fname, &file->readFromStart, &file->startOffset);
+
+   return (file->watch != -1) ? std::max(m_fileCheckInterval, static_cast<uint32_t>(WATCHED_FILE_CHECK_INTERVAL)) : m_fileCheckInterval;
+}
+
+/**
+ * Check file monitored by shared tailer for new records. Performs single iteration of monitoring loop
+ * from monitorFile() and is called from tailer worker thread when file change notification received
+ * or check interval expires. Returns time in milliseconds until next check if there will be no change
+ * notifications.
+ */
+uint32_t LogParser::checkTailedFile(TailedFile *file)
+{
+   if (isExclusionPeriod())
+   {
+      if (!file->exclusionPeriod)
+      {
+         file->exclusionPeriod = true;
+         if (file->fh != -1)
+         {
+            nxlog_debug_tag(DEBUG_TAG, 6, _T("Closing file \"%s\" because of exclusion period"), file->fname);
+            TailerCloseFile(file);
+         }
+         else
+         {
+            nxlog_debug_tag(DEBUG_TAG, 6, _T("Will not open file \"%s\" because of exclusion period"), getFileName());
+         }
+         setStatus(LPS_SUSPENDED);
+      }
+      return 30000;
+   }
+
+   if (file->exclusionPeriod)
+   {
+      file->exclusionPeriod = false;
+      nxlog_debug_tag(DEBUG_TAG, 6, _T("Exclusion period for file \"%s\" ended"), getFileName());
+   }
+
+   if (file->fh == -1)
+      return openTailedFile(file);
+
+   size_t currSize;
+   time_t currMTime;
+   if (isLogFileReplaced(file->fh, file->fname, &currSize, &currMTime))
+   {
+      TailerCloseFile(file);
+      file->readFromStart = true;
+      return openTailedFile(file);
+   }
+
+   readLogFileChanges(file->fh, file->fname, currSize, currMTime, &file->size, &file->mtime);
+
+   return (file->watch != -1) ? std::max(m_fileCheckInterval, static_cast<uint32_t>(WATCHED_FILE_CHECK_INTERVAL)) : m_fileCheckInterval;
+}
+
 /**
  * File parser thread (do not keep it open)
  */
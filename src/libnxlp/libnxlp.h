@@ -30,6 +30,30 @@
 
 #define DEBUG_TAG _T("logwatch")
 
+/**
+ * File monitored by shared tailer
+ */
+struct TailedFile
+{
+   LogParser *parser;
+   TCHAR fname[MAX_PATH];  // Expanded name of currently open file
+   int fh;
+   size_t size;
+   time_t mtime;
+   off_t startOffset;
+   int64_t nextCheckTime;
+   int watch;              // inotify watch descriptor or -1
+   bool readFromStart;
+   bool exclusionPeriod;
+   bool busy;              // Check is running on worker thread
+   bool pending;           // Change notification received while check was running
+};
+
+void TailerCloseFile(TailedFile *file);
+void TailerWatchFile(TailedFile *file);
+void TailerRemoveFile(TailedFile *file);
+void ShutdownTailer();
+
 #ifdef _WIN32
 
 THREAD_RESULT THREAD_CALL ParserThreadEventLog(void *);
@@ -151,6 +151,7 @@ LogParser::LogParser() : m_rules(0, 16, Ownership::True), m_stopCondition(true)
    m_readBuffer = nullptr;
    m_readBufferSize = 0;
    m_textBuffer = nullptr;
+   m_tailedFile = nullptr;
 }
 
 /**
@@ -205,6 +206,7 @@ LogParser::LogParser(const LogParser *src) : m_rules(src->m_rules.size(), 16, Ow
    m_readBuffer = nullptr;
    m_readBufferSize = 0;
    m_textBuffer = nullptr;
+   m_tailedFile = nullptr;
 }
 
 /**
@@ -212,6 +214,8 @@ LogParser::LogParser(const LogParser *src) : m_rules(src->m_rules.size(), 16, Ow
  */
 LogParser::~LogParser()
 {
+   if (m_tailedFile != nullptr)
+      TailerRemoveFile(m_tailedFile);
 	MemFree(m_name);
 	MemFree(m_fileName);
 #ifdef _WIN32
@@ -1051,6 +1055,12 @@ bool LogParser::isExclusionPeriod()
 void LogParser::stop()
 {
    m_stopCondition.set();
+   if (m_tailedFile != nullptr)
+   {
+      TailerRemoveFile(m_tailedFile);
+      m_tailedFile = nullptr;
+      nxlog_debug_tag(DEBUG_TAG, 0, _T("File \"%s\" removed from shared tailer"), m_fileName);
+   }
    ThreadJoin(m_thread);
    m_thread = INVALID_THREAD_HANDLE;
 }
@@ -0,0 +1,365 @@
+/*
+** NetXMS - Network Management System
+** Log Parsing Library
+** Copyright (C) 2003-2022 Raden Solutions
+**
+** This program is free software; you can redistribute it and/or modify
+** it under the terms of the GNU Lesser General Public License as published by
+** the Free Software Foundation; either version 3 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU Lesser General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+**
+** File: tailer.cpp
+**
+**/
+
+#include "libnxlp.h"
+
+#if HAVE_SYS_INOTIFY_H
+#include <sys/inotify.h>
+#include <poll.h>
+#endif
+
+/**
+ * Maximum number of worker threads in tailer pool
+ */
+#define TAILER_MAX_WORKERS    8
+
+/**
+ * Files monitored by shared tailer
+ */
+static ObjectArray<TailedFile> s_files(64, 64, Ownership::False);
+static Mutex s_lock(MutexType::FAST);
+
+/**
+ * Tailer engine thread and worker pool
+ */
+static THREAD s_tailerThread = INVALID_THREAD_HANDLE;
+static ThreadPool *s_workers = nullptr;
+static bool s_shutdown = false;
+
+#if HAVE_SYS_INOTIFY_H
+static int s_inotifyFd = -1;
+static int s_wakeupPipe[2] = { -1, -1 };
+#else
+static Condition s_wakeupCondition(false);
+#endif
+
+/**
+ * Wake up tailer thread
+ */
+static void WakeupTailer()
+{
+#if HAVE_SYS_INOTIFY_H
+   if (s_wakeupPipe[1] != -1)
+   {
+      char c = 0;
+      if (write(s_wakeupPipe[1], &c, 1) < 0)
+         nxlog_debug_tag(DEBUG_TAG, 7, _T("WakeupTailer: write to wakeup pipe failed"));
+   }
+#else
+   s_wakeupCondition.set();
+#endif
+}
+
+/**
+ * Check single file on worker thread
+ */
+void TailerCheckFile(TailedFile *file)
+{
+   uint32_t delay = file->parser->checkTailedFile(file);
+
+   s_lock.lock();
+   file->busy = false;
+   if (file->pending)
+   {
+      file->pending = false;
+      file->nextCheckTime = 0;
+      WakeupTailer();
+   }
+   else
+   {
+      file->nextCheckTime = GetCurrentTimeMs() + delay;
+   }
+   s_lock.unlock();
+}
+
+#if HAVE_SYS_INOTIFY_H
+
+/**
+ * Read pending inotify events and mark affected files for immediate check
+ */
+static void ProcessNotifications()
+{
+   char buffer[4096] __attribute__ ((aligned(__alignof__(struct inotify_event))));
+   ssize_t bytes = read(s_inotifyFd, buffer, sizeof(buffer));
+   if (bytes <= 0)
+      return;
+
+   s_lock.lock();
+   for(char *p = buffer; p < buffer + bytes; p += sizeof(struct inotify_event) + reinterpret_cast<struct inotify_event*>(p)->len)
+   {
+      int wd = reinterpret_cast<struct inotify_event*>(p)->wd;
+      for(int i = 0; i < s_files.size(); i++)
+      {
+         TailedFile *file = s_files.get(i);
+         if (file->watch != wd)
+            continue;
+         if (file->busy)
+            file->pending = true;
+         else
+            file->nextCheckTime = 0;
+      }
+   }
+   s_lock.unlock();
+}
+
+#endif
+
+/**
+ * Tailer thread. Schedules checks for files which have change notifications or which check interval expired.
+ */
+static void TailerThread()
+{
+   nxlog_debug_tag(DEBUG_TAG, 1, _T("Shared log file tailer started"));
+   while(!s_shutdown)
+   {
+      int64_t now = GetCurrentTimeMs();
+      int64_t nextWakeup = now + 60000;
+
+      s_lock.lock();
+      for(int i = 0; i < s_files.size(); i++)
+      {
+         TailedFile *file = s_files.get(i);
+         if (file->busy)
+            continue;
+         if (file->nextCheckTime <= now)
+         {
+            file->busy = true;
+            ThreadPoolExecute(s_workers, TailerCheckFile, file);
+         }
+         else if (file->nextCheckTime < nextWakeup)
+         {
+            nextWakeup = file->nextCheckTime;
+         }
+      }
+      s_lock.unlock();
+
+      uint32_t timeout = static_cast<uint32_t>(nextWakeup - now);
+#if HAVE_SYS_INOTIFY_H
+      struct pollfd pfd[2];
+      pfd[0].fd = s_wakeupPipe[0];
+      pfd[0].events = POLLIN;
+      pfd[0].revents = 0;
+      pfd[1].fd = s_inotifyFd;
+      pfd[1].events = POLLIN;
+      pfd[1].revents = 0;
+      int rc = poll(pfd, (s_inotifyFd != -1) ? 2 : 1, timeout);
+      if (rc > 0)
+      {
+         if (pfd[0].revents & POLLIN)
+         {
+            char buffer[64];
+            if (read(s_wakeupPipe[0], buffer, sizeof(buffer)) < 0)
+               nxlog_debug_tag(DEBUG_TAG, 7, _T("TailerThread: read from wakeup pipe failed"));
+         }
+         if (pfd[1].revents & POLLIN)
+            ProcessNotifications();
+      }
+#else
+      s_wakeupCondition.wait(timeout);
+#endif
+   }
+   nxlog_debug_tag(DEBUG_TAG, 1, _T("Shared log file tailer stopped"));
+}
+
+/**
+ * Start tailer engine if needed (must be called with lock held)
+ */
+static bool StartTailer()
+{
+   if (s_tailerThread != INVALID_THREAD_HANDLE)
+      return true;
+
+#if HAVE_SYS_INOTIFY_H
+   if (pipe(s_wakeupPipe) != 0)
+   {
+      nxlog_debug_tag(DEBUG_TAG, 1, _T("Cannot create wakeup pipe for shared log file tailer"));
+      return false;
+   }
+   s_inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+   if (s_inotifyFd == -1)
+      nxlog_debug_tag(DEBUG_TAG, 1, _T("inotify is not available (%s), log files will be polled"), _tcserror(errno));
+#endif
+
+   s_shutdown = false;
+   s_workers = ThreadPoolCreate(_T("LOGTAIL"), 1, TAILER_MAX_WORKERS);
+   s_tailerThread = ThreadCreateEx(TailerThread);
+   return true;
+}
+
+/**
+ * Stop tailer engine. All parsers should be stopped before this call.
+ */
+void ShutdownTailer()
+{
+   s_lock.lock();
+   if (s_tailerThread == INVALID_THREAD_HANDLE)
+   {
+      s_lock.unlock();
+      return;
+   }
+   s_shutdown = true;
+   WakeupTailer();
+   s_lock.unlock();
+
+   ThreadJoin(s_tailerThread);
+   s_tailerThread = INVALID_THREAD_HANDLE;
+   ThreadPoolDestroy(s_workers);
+   s_workers = nullptr;
+
+#if HAVE_SYS_INOTIFY_H
+   if (s_inotifyFd != -1)
+   {
+      _close(s_inotifyFd);
+      s_inotifyFd = -1;
+   }
+   _close(s_wakeupPipe[0]);
+   _close(s_wakeupPipe[1]);
+   s_wakeupPipe[0] = -1;
+   s_wakeupPipe[1] = -1;
+#endif
+}
+
+/**
+ * Start inotify watch for open file
+ */
+void TailerWatchFile(TailedFile *file)
+{
+#if HAVE_SYS_INOTIFY_H
+   if (s_inotifyFd == -1)
+      return;
+
+#ifdef UNICODE
+   char *path = MBStringFromWideStringSysLocale(file->fname);
+   int wd = inotify_add_watch(s_inotifyFd, path, IN_MODIFY | IN_ATTRIB | IN_MOVE_SELF | IN_DELETE_SELF);
+   MemFree(path);
+#else
+   int wd = inotify_add_watch(s_inotifyFd, file->fname, IN_MODIFY | IN_ATTRIB | IN_MOVE_SELF | IN_DELETE_SELF);
+#endif
+   if (wd == -1)
+   {
+      nxlog_debug_tag(DEBUG_TAG, 4, _T("Cannot add inotify watch for file \"%s\" (%s), file will be polled"), file->fname, _tcserror(errno));
+      return;
+   }
+
+   s_lock.lock();
+   file->watch = wd;
+   s_lock.unlock();
+#endif
+}
+
+/**
+ * Close file and remove inotify watch. Watch is shared by all parsers monitoring same file,
+ * so it is removed only when no other parser uses it.
+ */
+void TailerCloseFile(TailedFile *file)
+{
+   if (file->fh != -1)
+   {
+      _close(file->fh);
+      file->fh = -1;
+   }
+
+#if HAVE_SYS_INOTIFY_H
+   s_lock.lock();
+   if (file->watch != -1)
+   {
+      bool shared = false;
+      for(int i = 0; i < s_files.size(); i++)
+      {
+         TailedFile *f = s_files.get(i);
+         if ((f != file) && (f->watch == file->watch))
+         {
+            shared = true;
+            break;
+         }
+      }
+      if (!shared)
+         inotify_rm_watch(s_inotifyFd, file->watch);
+      file->watch = -1;
+   }
+   s_lock.unlock();
+#endif
+}
+
+/**
+ * Remove file from tailer. Will wait for running check to complete.
+ */
+void TailerRemoveFile(TailedFile *file)
+{
+   s_lock.lock();
+   s_files.remove(file);
+   while(file->busy)
+   {
+      s_lock.unlock();
+      ThreadSleepMs(10);
+      s_lock.lock();
+   }
+   s_lock.unlock();
+
+   TailerCloseFile(file);
+   delete file;
+}
+
+/**
+ * Start monitoring file using shared tailer instead of dedicated thread. Returns false if parser
+ * configuration requires dedicated thread (file is not kept open or VSS snapshots are used).
+ */
+bool LogParser::startTailing(off_t startOffset)
+{
+   if ((m_fileName == nullptr) || !m_keepFileOpen || (m_tailedFile != nullptr))
+      return false;
+
+#ifdef _WIN32
+   if (m_useSnapshot)
+      return false;
+#endif
+
+   TailedFile *file = new TailedFile();
+   file->parser = this;
+   file->fname[0] = 0;
+   file->fh = -1;
+   file->size = 0;
+   file->mtime = 0;
+   file->startOffset = startOffset;
+   file->nextCheckTime = 0;
+   file->watch = -1;
+   file->readFromStart = (m_rescan || (startOffset == 0));
+   file->exclusionPeriod = false;
+   file->busy = false;
+   file->pending = false;
+
+   s_lock.lock();
+   if (!StartTailer())
+   {
+      s_lock.unlock();
+      delete file;
+      return false;
+   }
+   m_tailedFile = file;
+   s_files.add(file);
+   WakeupTailer();
+   s_lock.unlock();
+
+   nxlog_debug_tag(DEBUG_TAG, 0, _T("File \"%s\" added to shared tailer"), m_fileName);
+   return true;
+}
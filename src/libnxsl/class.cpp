@@ -73,6 +73,7 @@ NXSL_Class::NXSL_Class() : m_metadataLock(MutexType::FAST)
 {
    setName(_T("Object"));
    m_methods = new HashMap<NXSL_Identifier, NXSL_ExtMethod>(Ownership::True);
+   m_attributeHandlers = new HashMap<NXSL_Identifier, NXSL_ExtAttribute>(Ownership::True);
 
    NXSL_REGISTER_METHOD(Object, __get, 1);
    NXSL_REGISTER_METHOD(Object, __invoke, -1);
@@ -91,6 +92,7 @@ NXSL_Class::NXSL_Class() : m_metadataLock(MutexType::FAST)
 NXSL_Class::~NXSL_Class()
 {
    delete m_methods;
+   delete m_attributeHandlers;
 }
 
 /**
@@ -104,13 +106,14 @@ void NXSL_Class::setName(const TCHAR *name)
 
 /**
  * Get attribute
- * Default implementation always returns error
+ * Default implementation calls attribute handlers registered with NXSL_REGISTER_ATTRIBUTE macro.
  */
 NXSL_Value *NXSL_Class::getAttr(NXSL_Object *object, const NXSL_Identifier& attr)
 {
    if (NXSL_COMPARE_ATTRIBUTE_NAME("__class"))
       return object->vm()->createValue(object->vm()->createObject(&g_nxslMetaClass, object->getClass()));
-   return nullptr;
+   NXSL_ExtAttribute *a = m_attributeHandlers->get(attr);
+   return (a != nullptr) ? a->handler(object, object->vm()) : nullptr;
 }
 
 /**
@@ -122,6 +125,19 @@ bool NXSL_Class::setAttr(NXSL_Object *object, const NXSL_Identifier& attr, NXSL_
    return false;
 }
 
+/**
+ * Callback for adding names of registered attributes to attribute set
+ */
+static EnumerationCallbackResult AddAttributeName(const NXSL_Identifier& name, NXSL_ExtAttribute *attribute, StringSet *attributes)
+{
+#ifdef UNICODE
+   attributes->addPreallocated(WideStringFromUTF8String(name.value));
+#else
+   attributes->add(name.value);
+#endif
+   return _CONTINUE;
+}
+
 /**
  * Scan class attributes
  */
@@ -136,6 +152,7 @@ void NXSL_Class::scanAttributes()
       if (v != nullptr)
          vm.destroyValue(v);
       vm.destroyObject(object);
+      m_attributeHandlers->forEach(AddAttributeName, &m_attributes);
    }
    m_metadataLock.unlock();
 }
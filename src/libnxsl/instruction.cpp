@@ -56,6 +56,8 @@ void NXSL_Instruction::copyFrom(const NXSL_Instruction *src, NXSL_ValueManager *
          break;
    }
    m_addr2 = src->m_addr2;
+   m_cachedClass = nullptr;
+   m_cachedAttribute = nullptr;
 }
 
 /**
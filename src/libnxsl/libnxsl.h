@@ -204,6 +204,8 @@ struct NXSL_Instruction
       uint64_t m_valueUInt64;
    } m_operand;
    int32_t m_sourceLine;
+   NXSL_Class *m_cachedClass;                   // Inline cache for attribute access - class of last accessed object
+   const NXSL_ExtAttribute *m_cachedAttribute;  // Inline cache for attribute access - attribute handler for cached class
 
    OperandType getOperandType() const;
    void copyFrom(const NXSL_Instruction *src, NXSL_ValueManager *vm);
@@ -26,9 +26,11 @@
 /**
  * Constructor
  */
-NXSL_Library::NXSL_Library() : m_mutex(MutexType::FAST)
+NXSL_Library::NXSL_Library() : m_nameIndex(Ownership::False), m_idIndex(Ownership::False), m_mutex(MutexType::FAST)
 {
    m_scriptList = new ObjectArray<NXSL_LibraryScript>(16, 16, Ownership::True);
+   m_nameIndex.setIgnoreCase(true);
+   m_version = 0;
 }
 
 /**
@@ -45,18 +47,50 @@ NXSL_Library::~NXSL_Library()
 bool NXSL_Library::addScript(NXSL_LibraryScript *script)
 {
    m_scriptList->add(script);
+   if (m_nameIndex.get(script->getName()) == nullptr)
+      m_nameIndex.set(script->getName(), script);
+   if (m_idIndex.get(script->getId()) == nullptr)
+      m_idIndex.set(script->getId(), script);
+   script->m_vmPool = make_shared<NXSL_VMPool>(this);
+   InterlockedIncrement(&m_version);  // Invalidate VM pools
    return true;
 }
 
+/**
+ * Delete script at given position in script list
+ */
+void NXSL_Library::deleteInternal(int index)
+{
+   NXSL_LibraryScript *script = m_scriptList->get(index);
+   if (m_nameIndex.get(script->getName()) == script)
+      m_nameIndex.remove(script->getName());
+   if (m_idIndex.get(script->getId()) == script)
+      m_idIndex.remove(script->getId());
+   m_scriptList->unlink(index);
+
+   // Make other script with same name or ID (if any) visible through index
+   for(int i = 0; i < m_scriptList->size(); i++)
+   {
+      NXSL_LibraryScript *s = m_scriptList->get(i);
+      if (!_tcsicmp(s->getName(), script->getName()) && (m_nameIndex.get(s->getName()) == nullptr))
+         m_nameIndex.set(s->getName(), s);
+      if ((s->getId() == script->getId()) && (m_idIndex.get(s->getId()) == nullptr))
+         m_idIndex.set(s->getId(), s);
+   }
+
+   delete script;
+   InterlockedIncrement(&m_version);  // Invalidate VM pools
+}
+
 /**
  * Delete script by name
  */
-void NXSL_Library::deleteScript(const TCHAR *pszName)
+void NXSL_Library::deleteScript(const TCHAR *name)
 {
    for(int i = 0; i < m_scriptList->size(); i++)
-      if (!_tcsicmp(m_scriptList->get(i)->getName(), pszName))
+      if (!_tcsicmp(m_scriptList->get(i)->getName(), name))
       {
-         m_scriptList->remove(i);
+         deleteInternal(i);
          break;
       }
 }
@@ -69,7 +103,7 @@ void NXSL_Library::deleteScript(uint32_t id)
    for(int i = 0; i < m_scriptList->size(); i++)
       if (m_scriptList->get(i)->getId() == id)
       {
-         m_scriptList->remove(i);
+         deleteInternal(i);
          break;
       }
 }
@@ -79,15 +113,8 @@ void NXSL_Library::deleteScript(uint32_t id)
  */
 NXSL_Program *NXSL_Library::findNxslProgram(const TCHAR *name)
 {
-   for(int i = 0; i < m_scriptList->size(); i++)
-   {
-      NXSL_LibraryScript *script = m_scriptList->get(i);
-      if (!_tcsicmp(script->getName(), name))
-      {
-         return script->isValid() ? script->getProgram() : nullptr;
-      }
-   }
-   return nullptr;
+   NXSL_LibraryScript *script = m_nameIndex.get(name);
+   return ((script != nullptr) && script->isValid()) ? script->getProgram() : nullptr;
 }
 
 /**
@@ -95,15 +122,7 @@ NXSL_Program *NXSL_Library::findNxslProgram(const TCHAR *name)
  */
 NXSL_LibraryScript *NXSL_Library::findScript(uint32_t id)
 {
-   for(int i = 0; i < m_scriptList->size(); i++)
-   {
-      NXSL_LibraryScript *script = m_scriptList->get(i);
-      if (script->getId() == id)
-      {
-         return script;
-      }
-   }
-   return nullptr;
+   return m_idIndex.get(id);
 }
 
 /**
@@ -111,15 +130,7 @@ NXSL_LibraryScript *NXSL_Library::findScript(uint32_t id)
  */
 NXSL_LibraryScript *NXSL_Library::findScript(const TCHAR *name)
 {
-   for(int i = 0; i < m_scriptList->size(); i++)
-   {
-      NXSL_LibraryScript *script = m_scriptList->get(i);
-      if (!_tcsicmp(script->getName(), name))
-      {
-         return script;
-      }
-   }
-   return nullptr;
+   return m_nameIndex.get(name);
 }
 
 /**
@@ -171,6 +182,45 @@ ScriptVMHandle NXSL_Library::createVM(const TCHAR *name, std::function<NXSL_Envi
    return (vm != nullptr) ? ScriptVMHandle(vm) : ScriptVMHandle(reson);
 }
 
+/**
+ * Create ready to run VM for given script or take one from script's VM pool. VM from pool
+ * has environment created for previous use, so environment creator should create stateless environments.
+ * This method will do library lock internally. VM must be released by calling ScriptVMHandle::destroy().
+ */
+ScriptVMHandle NXSL_Library::createPooledVM(const TCHAR *name, std::function<NXSL_Environment *()> environmentCreator, std::function<ScriptVMFailureReason (NXSL_LibraryScript*)> scriptValidator)
+{
+   lock();
+   NXSL_LibraryScript *s = findScript(name);
+   if (s == nullptr)
+   {
+      unlock();
+      return ScriptVMHandle(ScriptVMFailureReason::SCRIPT_NOT_FOUND);
+   }
+
+   ScriptVMFailureReason reason = s->isValid() ? ((scriptValidator != nullptr) ? scriptValidator(s) : ScriptVMFailureReason::SUCCESS) : ScriptVMFailureReason::SCRIPT_VALIDATION_ERROR;
+   if (reason != ScriptVMFailureReason::SUCCESS)
+   {
+      unlock();
+      return ScriptVMHandle(reason);
+   }
+
+   shared_ptr<NXSL_VMPool> pool = s->getVMPool();
+   uint32_t generation = 0;
+   NXSL_VM *vm = (pool != nullptr) ? pool->acquire(&generation) : nullptr;
+   if (vm == nullptr)
+   {
+      vm = new NXSL_VM(environmentCreator());
+      if (!vm->load(s->getProgram()))
+      {
+         delete vm;
+         unlock();
+         return ScriptVMHandle(ScriptVMFailureReason::SCRIPT_LOAD_ERROR);
+      }
+   }
+   unlock();
+   return (pool != nullptr) ? ScriptVMHandle(vm, pool, generation) : ScriptVMHandle(vm);
+}
+
 /**
  * Create ready to run VM for given script. This method will do library lock internally.
  * VM must be deleted by caller when no longer needed.
@@ -278,3 +328,83 @@ void NXSL_LibraryScript::fillMessage(NXCPMessage *msg) const
    msg->setField(VID_NAME, m_name);
    msg->setField(VID_SCRIPT_CODE, m_source);
 }
+
+/**
+ * Create VM pool
+ */
+NXSL_VMPool::NXSL_VMPool(const NXSL_Library *library, int maxSize) : m_vms(0, 16, Ownership::True), m_mutex(MutexType::FAST)
+{
+   m_library = library;
+   m_libraryVersion = (library != nullptr) ? library->getVersion() : 0;
+   m_maxSize = maxSize;
+   m_generation = 0;
+}
+
+/**
+ * VM pool destructor
+ */
+NXSL_VMPool::~NXSL_VMPool()
+{
+}
+
+/**
+ * Invalidate pool if library was changed (must be called with pool lock held)
+ */
+void NXSL_VMPool::checkLibraryVersion()
+{
+   if ((m_library != nullptr) && (m_library->getVersion() != m_libraryVersion))
+   {
+      m_vms.clear();
+      m_generation++;
+      m_libraryVersion = m_library->getVersion();
+   }
+}
+
+/**
+ * Take VM from pool. Returns nullptr if pool is empty. Current pool generation is returned in
+ * generation argument (it should be passed back when VM is released).
+ */
+NXSL_VM *NXSL_VMPool::acquire(uint32_t *generation)
+{
+   m_mutex.lock();
+   checkLibraryVersion();
+   NXSL_VM *vm = !m_vms.isEmpty() ? m_vms.get(m_vms.size() - 1) : nullptr;
+   if (vm != nullptr)
+      m_vms.unlink(m_vms.size() - 1);
+   *generation = m_generation;
+   m_mutex.unlock();
+   return vm;
+}
+
+/**
+ * Return VM to pool. VM will be destroyed if pool is full or was invalidated after VM was taken.
+ */
+void NXSL_VMPool::release(NXSL_VM *vm, uint32_t generation)
+{
+   if (vm == nullptr)
+      return;
+
+   vm->reset();
+
+   m_mutex.lock();
+   checkLibraryVersion();
+   if ((generation == m_generation) && (m_vms.size() < m_maxSize))
+   {
+      m_vms.add(vm);
+      vm = nullptr;
+   }
+   m_mutex.unlock();
+
+   delete vm;
+}
+
+/**
+ * Destroy all pooled VMs and prevent VMs currently in use from returning to pool
+ */
+void NXSL_VMPool::invalidate()
+{
+   m_mutex.lock();
+   m_vms.clear();
+   m_generation++;
+   m_mutex.unlock();
+}
@@ -307,6 +307,32 @@ bool NXSL_VM::load(const NXSL_Program *program)
    return success;
 }
 
+/**
+ * Reset VM state so it can be used again for running same program. Loaded code, functions,
+ * and modules are kept, while global variables, context object, storage, security context,
+ * user data, and results of previous run are cleared.
+ */
+void NXSL_VM::reset()
+{
+   m_globalVariables->clear();
+   setContextObject(nullptr);
+   setSecurityContext(nullptr);
+
+   delete m_localStorage;
+   m_localStorage = new NXSL_LocalStorage(this);
+   m_storage = m_localStorage;
+
+   destroyValue(m_pRetValue);
+   m_pRetValue = nullptr;
+   m_userData = nullptr;
+   m_stopFlag = false;
+   m_instructionTraceFile = nullptr;
+   m_errorCode = 0;
+   m_errorLine = 0;
+   MemFreeAndNull(m_errorText);
+   MemFreeAndNull(m_assertMessage);
+}
+
 /**
  * Run program
  * Returns true on success and false on error
@@ -1662,7 +1688,15 @@ void NXSL_VM::execute()
                NXSL_Object *object = pValue->getValueAsObject();
                if (object != nullptr)
                {
-                  NXSL_Value *attr = object->getClass()->getAttr(object, *cp->m_operand.m_identifier);
+                  // Inline cache: registered attribute handler is resolved once per class for each access point
+                  NXSL_Class *nxslClass = object->getClass();
+                  if (cp->m_cachedClass != nxslClass)
+                  {
+                     cp->m_cachedAttribute = nxslClass->getAttributeHandler(*cp->m_operand.m_identifier);
+                     cp->m_cachedClass = nxslClass;
+                  }
+                  NXSL_Value *attr = (cp->m_cachedAttribute != nullptr) ?
+                           cp->m_cachedAttribute->handler(object, this) : nxslClass->getAttr(object, *cp->m_operand.m_identifier);
                   if (attr != nullptr)
                   {
                      m_dataStack.push(attr);
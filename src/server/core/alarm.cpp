@@ -46,27 +46,56 @@ AlarmComment::AlarmComment(uint32_t id, time_t changeTime, uint32_t userId, TCHA
 }
 
 /**
- * Alarm list
+ * Number of alarm list shards
  */
-class AlarmList
+#define ALARM_SHARDS    16
+
+/**
+ * Database action for alarm update. When pending updates are coalesced action with higher value wins.
+ */
+enum class AlarmDatabaseAction
+{
+   NONE = 0,
+   UPDATE = 1,
+   CREATE = 2,
+   REMOVE = 3
+};
+
+/**
+ * Alarm key index (maps alarm key to alarm ID)
+ */
+static StringObjectMap<uint32_t> s_keyIndex(Ownership::True);
+static Mutex s_keyIndexLock(MutexType::FAST);
+
+/**
+ * Number of active alarms
+ */
+static VolatileCounter s_alarmCount = 0;
+
+static void UpdateSubordinateLink(uint32_t parentAlarmId, uint32_t alarmId, bool add);
+
+/**
+ * Alarm list shard. Alarms are distributed between shards by alarm ID, so operations on different
+ * alarms do not contend for single lock. Functions which lock one shard should not lock another one.
+ */
+class AlarmShard
 {
 private:
    Mutex m_lock;
    ObjectArray<Alarm> m_list;
-   StringObjectMap<Alarm> m_keyIndex;
+   HashMap<uint32_t, Alarm> m_index;
 
 public:
-   AlarmList() : m_list(256, 256, Ownership::True), m_keyIndex(Ownership::False) { }
-   ~AlarmList() { }
+   AlarmShard() : m_lock(MutexType::FAST), m_list(64, 64, Ownership::True), m_index(Ownership::False) { }
 
    void lock() { m_lock.lock(); }
    void unlock() { m_lock.unlock(); }
 
-   int size() { return m_list.size(); }
+   int size() const { return m_list.size(); }
 
    uint64_t memoryUsage()
    {
-      uint64_t memUsage = sizeof(AlarmList);
+      uint64_t memUsage = sizeof(AlarmShard);
       lock();
       for(int i = 0; i < m_list.size(); i++)
          memUsage += m_list.get(i)->getMemoryUsage();
@@ -75,55 +104,78 @@ class AlarmList
    }
 
    Alarm *get(int index) { return m_list.get(index); }
-
-   Alarm *find(const TCHAR *key) { return m_keyIndex.get(key); }
-   Alarm *find(uint32_t id)
-   {
-      for(int i = 0; i < m_list.size(); i++)
-         if (m_list.get(i)->getAlarmId() == id)
-            return m_list.get(i);
-      return nullptr;
-   }
+   Alarm *find(uint32_t id) { return m_index.get(id); }
 
    void add(Alarm *alarm)
    {
       m_list.add(alarm);
+      m_index.set(alarm->getAlarmId(), alarm);
       if (*alarm->getKey() != 0)
-         m_keyIndex.set(alarm->getKey(), alarm);
-   }
-
-   void remove(int index)
-   {
-      Alarm *alarm = m_list.get(index);
-      if (alarm->getParentAlarmId() != 0)
       {
-         Alarm *parent = find(alarm->getParentAlarmId());
-         if (parent != nullptr)
-            parent->removeSubordinateAlarm(alarm->getAlarmId());
+         s_keyIndexLock.lock();
+         s_keyIndex.set(alarm->getKey(), new uint32_t(alarm->getAlarmId()));
+         s_keyIndexLock.unlock();
       }
-      if (*alarm->getKey() != 0)
-         m_keyIndex.remove(alarm->getKey());
-      m_list.remove(index);
+      InterlockedIncrement(&s_alarmCount);
    }
 
+   void remove(int index);
    void remove(Alarm *alarm)
    {
-      if (alarm->getParentAlarmId() != 0)
-      {
-         Alarm *parent = find(alarm->getParentAlarmId());
-         if (parent != nullptr)
-            parent->removeSubordinateAlarm(alarm->getAlarmId());
-      }
-      if (*alarm->getKey() != 0)
-         m_keyIndex.remove(alarm->getKey());
-      m_list.remove(alarm);
+      int index = m_list.indexOf(alarm);
+      if (index != -1)
+         remove(index);
    }
 };
 
 /**
- * Global instance of alarm manager
+ * Alarm list shards
+ */
+static AlarmShard s_shards[ALARM_SHARDS];
+
+/**
+ * Get shard for given alarm ID
+ */
+static inline AlarmShard *GetShard(uint32_t alarmId)
+{
+   return &s_shards[alarmId % ALARM_SHARDS];
+}
+
+/**
+ * Number of alarm key locks
+ */
+#define ALARM_KEY_LOCKS    64
+
+/**
+ * Alarm key locks. Lock for alarm key is held from key lookup until new alarm with that key is added
+ * to alarm list, so concurrent events with same alarm key cannot create duplicate alarms.
+ * Key lock should be acquired before any shard lock.
+ */
+static Mutex s_keyLocks[ALARM_KEY_LOCKS];
+
+/**
+ * Get lock for given alarm key
+ */
+static inline Mutex *GetKeyLock(const TCHAR *key)
+{
+   return &s_keyLocks[CalculateDJB2Hash(key, _tcslen(key) * sizeof(TCHAR)) % ALARM_KEY_LOCKS];
+}
+
+/**
+ * Find ID of active alarm with given key. Returns 0 if there are no such alarm.
+ */
+static uint32_t FindAlarmIdByKey(const TCHAR *key)
+{
+   s_keyIndexLock.lock();
+   uint32_t *id = s_keyIndex.get(key);
+   uint32_t alarmId = (id != nullptr) ? *id : 0;
+   s_keyIndexLock.unlock();
+   return alarmId;
+}
+
+/**
+ * Global alarm manager state
  */
-static AlarmList s_alarmList;
 static Condition s_shutdown(true);
 static THREAD s_watchdogThread = INVALID_THREAD_HANDLE;
 static THREAD s_rootCauseUpdateThread = INVALID_THREAD_HANDLE;
@@ -132,6 +184,54 @@ static VolatileCounter64 s_stateChangeLogRecordId = 0;
 static bool s_rootCauseUpdateNeeded = false;
 static bool s_rootCauseUpdatePossible = false;
 
+/**
+ * Pending alarm update for background writer
+ */
+struct AlarmUpdate
+{
+   shared_ptr<Alarm> alarm;      // Alarm state to publish (nullptr for bulk notification)
+   uint32_t notificationCode;    // Client notification code (0 if clients should not be notified)
+   AlarmDatabaseAction dbAction;
+   NXCPMessage *bulkNotification;
+
+   AlarmUpdate(Alarm *_alarm, uint32_t _notificationCode, AlarmDatabaseAction _dbAction) : alarm(_alarm)
+   {
+      notificationCode = _notificationCode;
+      dbAction = _dbAction;
+      bulkNotification = nullptr;
+   }
+
+   AlarmUpdate(NXCPMessage *msg)
+   {
+      notificationCode = 0;
+      dbAction = AlarmDatabaseAction::NONE;
+      bulkNotification = msg;
+   }
+
+   ~AlarmUpdate()
+   {
+      delete bulkNotification;
+   }
+};
+
+/**
+ * Background writer state. Updates are processed in order they were scheduled. Pending updates
+ * for same alarm are merged, so during database outage queue does not grow beyond number of active alarms.
+ */
+static ObjectArray<AlarmUpdate> *s_pendingUpdates = new ObjectArray<AlarmUpdate>(256, 256, Ownership::True);
+static HashMap<uint32_t, AlarmUpdate> s_pendingUpdateIndex(Ownership::False);
+static Mutex s_writerLock(MutexType::FAST);
+static Condition s_writerWakeup(false);
+static THREAD s_writerThread = INVALID_THREAD_HANDLE;
+static bool s_writerShutdown = false;
+static uint64_t s_coalescedUpdates = 0;
+
+/**
+ * Alarm list snapshot for client list requests. Published alarm map is accessed only by writer thread.
+ */
+static SharedHashMap<uint32_t, Alarm> s_publishedAlarms;
+static shared_ptr_store<SharedObjectArray<Alarm>> s_alarmSnapshot;
+
 /**
  * Callback for client session enumeration
  */
@@ -160,12 +260,284 @@ static void NotifyClients(uint32_t code, const Alarm *alarm)
 }
 
 /**
- * Notify clients in background
+ * Schedule alarm update for background writer. Copy of current alarm state is taken, so this function
+ * should be called while alarm's shard is locked. Clients are notified and database is updated
+ * asynchronously by writer thread.
+ */
+static void ScheduleAlarmUpdate(const Alarm *alarm, uint32_t notificationCode, AlarmDatabaseAction dbAction)
+{
+   Alarm *copy = new Alarm(alarm, false);
+   s_writerLock.lock();
+   AlarmUpdate *update = s_pendingUpdateIndex.get(alarm->getAlarmId());
+   if (update != nullptr)
+   {
+      update->alarm.reset(copy);
+      // Client which was not yet notified about new alarm should receive "new alarm" notification with latest alarm state
+      if ((notificationCode != 0) && ((update->notificationCode != NX_NOTIFY_NEW_ALARM) || (notificationCode != NX_NOTIFY_ALARM_CHANGED)))
+         update->notificationCode = notificationCode;
+      if (dbAction > update->dbAction)
+         update->dbAction = dbAction;
+      s_coalescedUpdates++;
+   }
+   else
+   {
+      update = new AlarmUpdate(copy, notificationCode, dbAction);
+      s_pendingUpdates->add(update);
+      s_pendingUpdateIndex.set(alarm->getAlarmId(), update);
+   }
+   s_writerLock.unlock();
+   s_writerWakeup.set();
+}
+
+/**
+ * Schedule bulk alarm state change notification for background writer
+ */
+static void ScheduleBulkAlarmNotification(NXCPMessage *msg)
+{
+   s_writerLock.lock();
+   s_pendingUpdates->add(new AlarmUpdate(msg));
+   s_pendingUpdateIndex.clear();  // Updates scheduled after bulk notification should not be merged with preceding ones
+   s_writerLock.unlock();
+   s_writerWakeup.set();
+}
+
+/**
+ * Publish new alarm list snapshot
  */
-static void NotifyClientsInBackground(Alarm *alarm)
+static void PublishAlarmSnapshot()
 {
-   NotifyClients(alarm->getNotificationCode(), alarm);
-   delete alarm;
+   auto snapshot = make_shared<SharedObjectArray<Alarm>>(s_publishedAlarms.size(), 256);
+   auto it = s_publishedAlarms.begin();
+   while(it.hasNext())
+      snapshot->add(it.next());
+   s_alarmSnapshot.set(snapshot);
+}
+
+/**
+ * Write single alarm update to database
+ */
+static bool WriteAlarmUpdate(DB_HANDLE hdb, AlarmUpdate *update)
+{
+   switch(update->dbAction)
+   {
+      case AlarmDatabaseAction::CREATE:
+         return update->alarm->createInDatabase(hdb);
+      case AlarmDatabaseAction::UPDATE:
+         return update->alarm->updateInDatabase(hdb);
+      case AlarmDatabaseAction::REMOVE:
+         return ExecuteQueryOnObject(hdb, update->alarm->getAlarmId(), _T("DELETE FROM alarms WHERE alarm_id=?")) &&
+                ExecuteQueryOnObject(hdb, update->alarm->getAlarmId(), _T("DELETE FROM alarm_events WHERE alarm_id=?")) &&
+                ExecuteQueryOnObject(hdb, update->alarm->getAlarmId(), _T("DELETE FROM alarm_notes WHERE alarm_id=?")) &&
+                ExecuteQueryOnObject(hdb, update->alarm->getAlarmId(), _T("DELETE FROM alarm_state_changes WHERE alarm_id=?"));
+      default:
+         return true;
+   }
+}
+
+/**
+ * Process batch of alarm updates. Clients are notified before database is updated,
+ * so notifications are not delayed by slow database.
+ */
+static void ProcessAlarmUpdates(ObjectArray<AlarmUpdate> *updates)
+{
+   bool snapshotChanged = false;
+   bool databaseUpdateNeeded = false;
+   for(int i = 0; i < updates->size(); i++)
+   {
+      AlarmUpdate *update = updates->get(i);
+      if (update->alarm == nullptr)
+         continue;
+
+      if ((update->dbAction == AlarmDatabaseAction::REMOVE) || ((update->alarm->getState() & ALARM_STATE_MASK) == ALARM_STATE_TERMINATED))
+         s_publishedAlarms.remove(update->alarm->getAlarmId());
+      else
+         s_publishedAlarms.set(update->alarm->getAlarmId(), update->alarm);
+      snapshotChanged = true;
+
+      if (update->dbAction != AlarmDatabaseAction::NONE)
+         databaseUpdateNeeded = true;
+   }
+   if (snapshotChanged)
+      PublishAlarmSnapshot();
+
+   for(int i = 0; i < updates->size(); i++)
+   {
+      AlarmUpdate *update = updates->get(i);
+      if (update->bulkNotification != nullptr)
+         EnumerateClientSessions(SendBulkAlarmTerminateNotification, update->bulkNotification);
+      else if (update->notificationCode != 0)
+         NotifyClients(update->notificationCode, update->alarm.get());
+   }
+
+   if (!databaseUpdateNeeded)
+      return;
+
+   DB_HANDLE hdb = DBConnectionPoolAcquireConnection();
+
+   // Whole batch is written in single transaction
+   bool success = false;
+   if (DBBegin(hdb))
+   {
+      success = true;
+      for(int i = 0; (i < updates->size()) && success; i++)
+         success = WriteAlarmUpdate(hdb, updates->get(i));
+      if (success)
+         success = DBCommit(hdb);
+      else
+         DBRollback(hdb);
+   }
+
+   // If batch failed, write updates one by one so single failed update will not cause loss of entire batch
+   if (!success)
+   {
+      nxlog_debug_tag(DEBUG_TAG, 4, _T("Alarm writer: batch database update failed, retrying updates individually"));
+      for(int i = 0; i < updates->size(); i++)
+      {
+         AlarmUpdate *update = updates->get(i);
+         if (update->dbAction == AlarmDatabaseAction::NONE)
+            continue;
+
+         bool txn = DBBegin(hdb);
+         if (WriteAlarmUpdate(hdb, update))
+         {
+            if (txn)
+               DBCommit(hdb);
+         }
+         else
+         {
+            if (txn)
+               DBRollback(hdb);
+            nxlog_debug_tag(DEBUG_TAG, 4, _T("Alarm writer: cannot update database record for alarm %u"), update->alarm->getAlarmId());
+         }
+      }
+   }
+
+   DBConnectionPoolReleaseConnection(hdb);
+}
+
+/**
+ * Alarm writer thread
+ */
+static void AlarmWriterThread()
+{
+   ThreadSetName("AlarmWriter");
+   nxlog_debug_tag(DEBUG_TAG, 3, _T("Alarm writer thread started"));
+
+   bool running = true;
+   while(running)
+   {
+      s_writerWakeup.wait(INFINITE);
+
+      s_writerLock.lock();
+      running = !s_writerShutdown;   // Pending updates are processed once more after shutdown request
+      ObjectArray<AlarmUpdate> *updates = s_pendingUpdates;
+      s_pendingUpdates = new ObjectArray<AlarmUpdate>(256, 256, Ownership::True);
+      s_pendingUpdateIndex.clear();
+      s_writerLock.unlock();
+
+      if (!updates->isEmpty())
+      {
+         nxlog_debug_tag(DEBUG_TAG, 7, _T("Alarm writer: processing %d updates"), updates->size());
+         ProcessAlarmUpdates(updates);
+      }
+      delete updates;
+   }
+
+   nxlog_debug_tag(DEBUG_TAG, 3, _T("Alarm writer thread stopped"));
+}
+
+/**
+ * Add or remove subordinate alarm in parent alarm's list. Must be called without any shard locked.
+ */
+static void UpdateSubordinateLink(uint32_t parentAlarmId, uint32_t alarmId, bool add)
+{
+   AlarmShard *shard = GetShard(parentAlarmId);
+   shard->lock();
+   Alarm *parent = shard->find(parentAlarmId);
+   if (parent != nullptr)
+   {
+      if (add)
+      {
+         parent->addSubordinateAlarm(alarmId);
+         ScheduleAlarmUpdate(parent, NX_NOTIFY_ALARM_CHANGED, AlarmDatabaseAction::NONE);
+      }
+      else
+      {
+         parent->removeSubordinateAlarm(alarmId);
+      }
+   }
+   shard->unlock();
+}
+
+/**
+ * Move subordinate alarm from one parent to another. Must be called without any shard locked.
+ */
+static void MoveSubordinateAlarm(uint32_t alarmId, uint32_t oldParentAlarmId, uint32_t newParentAlarmId)
+{
+   if (oldParentAlarmId == newParentAlarmId)
+      return;
+   if (oldParentAlarmId != 0)
+      UpdateSubordinateLink(oldParentAlarmId, alarmId, false);
+   if (newParentAlarmId != 0)
+      UpdateSubordinateLink(newParentAlarmId, alarmId, true);
+}
+
+/**
+ * Remove alarm from shard (must be called with shard locked)
+ */
+void AlarmShard::remove(int index)
+{
+   Alarm *alarm = m_list.get(index);
+   uint32_t alarmId = alarm->getAlarmId();
+   uint32_t parentAlarmId = alarm->getParentAlarmId();
+   if (parentAlarmId != 0)
+   {
+      if (GetShard(parentAlarmId) == this)
+      {
+         Alarm *parent = find(parentAlarmId);
+         if (parent != nullptr)
+            parent->removeSubordinateAlarm(alarmId);
+      }
+      else
+      {
+         // Parent alarm belongs to another shard which cannot be locked while this one is locked
+         ThreadPoolExecute(g_mainThreadPool, [parentAlarmId, alarmId]() -> void { UpdateSubordinateLink(parentAlarmId, alarmId, false); });
+      }
+   }
+   if (*alarm->getKey() != 0)
+   {
+      s_keyIndexLock.lock();
+      uint32_t *id = s_keyIndex.get(alarm->getKey());
+      if ((id != nullptr) && (*id == alarmId))
+         s_keyIndex.remove(alarm->getKey());
+      s_keyIndexLock.unlock();
+   }
+   m_index.remove(alarmId);
+   m_list.remove(index);
+   InterlockedDecrement(&s_alarmCount);
+}
+
+/**
+ * Find alarm with given helpdesk reference. On success returns alarm's shard in locked state.
+ */
+static AlarmShard *FindAlarmByHDRef(const TCHAR *hdref, Alarm **alarm)
+{
+   for(int i = 0; i < ALARM_SHARDS; i++)
+   {
+      AlarmShard *shard = &s_shards[i];
+      shard->lock();
+      for(int j = 0; j < shard->size(); j++)
+      {
+         Alarm *a = shard->get(j);
+         if (!_tcscmp(a->getHelpDeskRef(), hdref))
+         {
+            *alarm = a;
+            return shard;
+         }
+      }
+      shard->unlock();
+   }
+   return nullptr;
 }
 
 /**
@@ -467,7 +839,7 @@ void Alarm::removeSubordinateAlarm(uint32_t alarmId)
 {
    nxlog_debug_tag(DEBUG_TAG, 6, _T("Removing subordinate alarm %u from alarm %u"), alarmId, m_alarmId);
    m_subordinateAlarms.remove(m_subordinateAlarms.indexOf(alarmId));
-   ThreadPoolExecute(g_mainThreadPool, NotifyClientsInBackground, new Alarm(this, false, NX_NOTIFY_ALARM_CHANGED));
+   ScheduleAlarmUpdate(this, NX_NOTIFY_ALARM_CHANGED, AlarmDatabaseAction::NONE);
 }
 
 /**
@@ -504,10 +876,9 @@ bool Alarm::checkCategoryAccess(ClientSession *session) const
 /**
  * Create alarm record in database
  */
-void Alarm::createInDatabase()
+bool Alarm::createInDatabase(DB_HANDLE hdb)
 {
-   DB_HANDLE hdb = DBConnectionPoolAcquireConnection();
-
+   bool success = false;
    DB_STATEMENT hStmt = DBPrepare(hdb,
               _T("INSERT INTO alarms (alarm_id,parent_alarm_id,creation_time,last_change_time,source_object_id,zone_uin,")
               _T("source_event_code,message,original_severity,current_severity,alarm_key,alarm_state,ack_by,resolved_by,")
@@ -554,20 +925,18 @@ void Alarm::createInDatabase()
       DBBind(hStmt, 29, DB_SQLTYPE_VARCHAR, m_impact, DB_BIND_STATIC, 1000);
       DBBind(hStmt, 30, DB_SQLTYPE_INTEGER, static_cast<uint32_t>(m_lastStateChangeTime));
 
-      DBExecute(hStmt);
+      success = DBExecute(hStmt);
       DBFreeStatement(hStmt);
    }
-
-   DBConnectionPoolReleaseConnection(hdb);
+   return success;
 }
 
 /**
  * Update alarm information in database
  */
-void Alarm::updateInDatabase()
+bool Alarm::updateInDatabase(DB_HANDLE hdb)
 {
-   DB_HANDLE hdb = DBConnectionPoolAcquireConnection();
-
+   bool success = false;
    DB_STATEMENT hStmt = DBPrepare(hdb,
             _T("UPDATE alarms SET alarm_state=?,ack_by=?,term_by=?,last_change_time=?,current_severity=?,repeat_count=?,")
             _T("hd_state=?,hd_ref=?,timeout=?,timeout_event=?,message=?,resolved_by=?,ack_timeout=?,source_object_id=?,")
@@ -606,20 +975,16 @@ void Alarm::updateInDatabase()
       DBBind(hStmt, 22, DB_SQLTYPE_VARCHAR, m_impact, DB_BIND_STATIC, 1000);
       DBBind(hStmt, 23, DB_SQLTYPE_INTEGER, static_cast<uint32_t>(m_lastStateChangeTime));
       DBBind(hStmt, 24, DB_SQLTYPE_INTEGER, m_alarmId);
-      DBExecute(hStmt);
+      success = DBExecute(hStmt);
       DBFreeStatement(hStmt);
    }
 
-	if (m_state == ALARM_STATE_TERMINATED)
-	{
-	   TCHAR query[256];
-		_sntprintf(query, 256, _T("DELETE FROM alarm_events WHERE alarm_id=%u"), m_alarmId);
-		QueueSQLRequest(query);
-
-      _sntprintf(query, 256, _T("DELETE FROM alarm_notes WHERE alarm_id=%u"), m_alarmId);
-      QueueSQLRequest(query);
-	}
-   DBConnectionPoolReleaseConnection(hdb);
+   if (success && (m_state == ALARM_STATE_TERMINATED))
+   {
+      success = ExecuteQueryOnObject(hdb, m_alarmId, _T("DELETE FROM alarm_events WHERE alarm_id=?")) &&
+               ExecuteQueryOnObject(hdb, m_alarmId, _T("DELETE FROM alarm_notes WHERE alarm_id=?"));
+   }
+   return success;
 }
 
 /**
@@ -842,34 +1207,21 @@ void Alarm::updateFromEvent(Event *event, uint32_t parentAlarmId, const TCHAR *r
    m_alarmCategoryList.clear();
    m_alarmCategoryList.addAll(alarmCategoryList);
 
-   NotifyClients(NX_NOTIFY_ALARM_CHANGED, this);
    if (stateChanged)
    {
       executeHookScript();
       updateStateChangeLog(prevState, 0);
    }
-   updateInDatabase();
+   ScheduleAlarmUpdate(this, NX_NOTIFY_ALARM_CHANGED, AlarmDatabaseAction::UPDATE);
 }
 
 /**
- * Update parent alarm ID
+ * Update parent alarm ID. Subordinate lists of old and new parent should be updated by caller.
  */
 void Alarm::updateParentAlarm(uint32_t parentAlarmId)
 {
-   // Update parent's subordinate list if parent is changed
-   if (m_parentAlarmId != parentAlarmId)
-   {
-      Alarm *parent = (m_parentAlarmId != 0) ? s_alarmList.find(m_parentAlarmId) : nullptr;
-      if (parent != nullptr)
-         parent->removeSubordinateAlarm(m_alarmId);
-      parent = (parentAlarmId != 0) ? s_alarmList.find(parentAlarmId) : nullptr;
-      if (parent != nullptr)
-         parent->addSubordinateAlarm(m_alarmId);
-   }
    m_parentAlarmId = parentAlarmId;
-
-   NotifyClients(NX_NOTIFY_ALARM_CHANGED, this);
-   updateInDatabase();
+   ScheduleAlarmUpdate(this, NX_NOTIFY_ALARM_CHANGED, AlarmDatabaseAction::UPDATE);
 }
 
 /**
@@ -884,23 +1236,20 @@ uint32_t NXCORE_EXPORTABLE CreateNewAlarm(const uuid& ruleGuid, const TCHAR *rul
    bool updateRelatedEvent = false;
 
    // Check if we have a duplicate alarm
-   if (key[0] != 0)
-   {
-      s_alarmList.lock();
-
-      Alarm *alarm = s_alarmList.find(key);
-      if (alarm != nullptr)
+   Mutex *keyLock = (key[0] != 0) ? GetKeyLock(key) : nullptr;
+   if (keyLock != nullptr)
+      keyLock->lock();
+   uint32_t existingAlarmId = (keyLock != nullptr) ? FindAlarmIdByKey(key) : 0;
+   if (existingAlarmId != 0)
+   {
+      uint32_t prevParentAlarmId = 0;
+      AlarmShard *shard = GetShard(existingAlarmId);
+      shard->lock();
+
+      Alarm *alarm = shard->find(existingAlarmId);
+      if ((alarm != nullptr) && !_tcscmp(alarm->getKey(), key))  // Alarm could be terminated after key lookup
       {
-         // Update parent's subordinate list if parent is changed
-         if (alarm->getParentAlarmId() != parentAlarmId)
-         {
-            Alarm *parent = (alarm->getParentAlarmId() != 0) ? s_alarmList.find(alarm->getParentAlarmId()) : nullptr;
-            if (parent != nullptr)
-               parent->removeSubordinateAlarm(alarm->getAlarmId());
-            parent = (parentAlarmId != 0) ? s_alarmList.find(parentAlarmId) : nullptr;
-            if (parent != nullptr)
-               parent->addSubordinateAlarm(alarm->getAlarmId());
-         }
+         prevParentAlarmId = alarm->getParentAlarmId();
          alarm->updateFromEvent(event, parentAlarmId, rcaScriptName, ruleGuid, ruleDescription, ALARM_STATE_OUTSTANDING, severity, timeout, timeoutEvent, ackTimeout, message, impact, alarmCategoryList);
          if (!alarm->isEventRelated(event->getId()))
          {
@@ -915,7 +1264,11 @@ uint32_t NXCORE_EXPORTABLE CreateNewAlarm(const uuid& ruleGuid, const TCHAR *rul
          newAlarm = false;
       }
 
-      s_alarmList.unlock();
+      shard->unlock();
+
+      // Update parent's subordinate list if parent is changed
+      if (!newAlarm)
+         MoveSubordinateAlarm(existingAlarmId, prevParentAlarmId, parentAlarmId);
    }
 
    if (newAlarm)
@@ -928,32 +1281,31 @@ uint32_t NXCORE_EXPORTABLE CreateNewAlarm(const uuid& ruleGuid, const TCHAR *rul
       if (openHelpdeskIssue)
          alarm->openHelpdeskIssue(nullptr);
 
-      // Add new alarm to active alarm list if needed
+      // Add new alarm to active alarm list if needed. Connected clients will be notified and
+      // alarm record will be created in database by background writer.
 		if ((alarm->getState() & ALARM_STATE_MASK) != ALARM_STATE_TERMINATED)
       {
-         s_alarmList.lock();
-         nxlog_debug_tag(DEBUG_TAG, 7, _T("AlarmManager: adding new active alarm, current alarm count %d"), s_alarmList.size());
-         s_alarmList.add(alarm);
-         s_alarmList.unlock();
+         nxlog_debug_tag(DEBUG_TAG, 7, _T("AlarmManager: adding new active alarm, current alarm count %d"), static_cast<int>(s_alarmCount));
+         AlarmShard *shard = GetShard(alarmId);
+         shard->lock();
+         shard->add(alarm);
+         ScheduleAlarmUpdate(alarm, NX_NOTIFY_NEW_ALARM, AlarmDatabaseAction::CREATE);
+         shard->unlock();
       }
-
-		alarm->createInDatabase();
-      updateRelatedEvent = true;
-
-      if (parentAlarmId != 0)
+      else
       {
-         Alarm *parent = s_alarmList.find(parentAlarmId);
-         if (parent != nullptr)
-         {
-            parent->addSubordinateAlarm(alarm->getAlarmId());
-            NotifyClients(NX_NOTIFY_ALARM_CHANGED, parent);
-         }
+         ScheduleAlarmUpdate(alarm, NX_NOTIFY_NEW_ALARM, AlarmDatabaseAction::CREATE);
+         delete alarm;
       }
+      updateRelatedEvent = true;
 
-      // Notify connected clients about new alarm
-      NotifyClients(NX_NOTIFY_NEW_ALARM, alarm);
+      if (parentAlarmId != 0)
+         UpdateSubordinateLink(parentAlarmId, alarmId, true);
    }
 
+   if (keyLock != nullptr)
+      keyLock->unlock();
+
    // Update status of related object
    UpdateObjectStatus(event->getSourceId());
 
@@ -1015,9 +1367,8 @@ uint32_t Alarm::acknowledge(ClientSession *session, bool sticky, uint32_t acknow
       m_state |= ALARM_STATE_STICKY;
    m_ackByUser = (session != nullptr) ? session->getUserId() : 0;
    m_lastChangeTime = time(nullptr);
-   NotifyClients(NX_NOTIFY_ALARM_CHANGED, this);
    updateStateChangeLog(prevState, m_ackByUser);
-   updateInDatabase();
+   ScheduleAlarmUpdate(this, NX_NOTIFY_ALARM_CHANGED, AlarmDatabaseAction::UPDATE);
    executeHookScript();
 
    if (includeSubordinates && !m_subordinateAlarms.isEmpty())
@@ -1033,18 +1384,15 @@ uint32_t NXCORE_EXPORTABLE AckAlarmById(uint32_t alarmId, ClientSession *session
 {
    uint32_t objectId, rcc = RCC_INVALID_ALARM_ID;
 
-   s_alarmList.lock();
-   for(int i = 0; i < s_alarmList.size(); i++)
+   AlarmShard *shard = GetShard(alarmId);
+   shard->lock();
+   Alarm *alarm = shard->find(alarmId);
+   if (alarm != nullptr)
    {
-      Alarm *alarm = s_alarmList.get(i);
-      if (alarm->getAlarmId() == alarmId)
-      {
-         rcc = alarm->acknowledge(session, sticky, acknowledgmentActionTime, includeSubordinates);
-         objectId = alarm->getSourceObject();
-         break;
-      }
+      rcc = alarm->acknowledge(session, sticky, acknowledgmentActionTime, includeSubordinates);
+      objectId = alarm->getSourceObject();
    }
-   s_alarmList.unlock();
+   shard->unlock();
 
    if (rcc == RCC_SUCCESS)
       UpdateObjectStatus(objectId);
@@ -1058,18 +1406,14 @@ uint32_t NXCORE_EXPORTABLE AckAlarmByHDRef(const TCHAR *hdref, ClientSession *se
 {
    uint32_t objectId, rcc = RCC_INVALID_ALARM_ID;
 
-   s_alarmList.lock();
-   for(int i = 0; i < s_alarmList.size(); i++)
+   Alarm *alarm;
+   AlarmShard *shard = FindAlarmByHDRef(hdref, &alarm);
+   if (shard != nullptr)
    {
-      Alarm *alarm = s_alarmList.get(i);
-      if (!_tcscmp(alarm->getHelpDeskRef(), hdref))
-      {
-         rcc = alarm->acknowledge(session, sticky, acknowledgmentActionTime, false);
-         objectId = alarm->getSourceObject();
-         break;
-      }
+      rcc = alarm->acknowledge(session, sticky, acknowledgmentActionTime, false);
+      objectId = alarm->getSourceObject();
+      shard->unlock();
    }
-   s_alarmList.unlock();
 
    if (rcc == RCC_SUCCESS)
       UpdateObjectStatus(objectId);
@@ -1097,10 +1441,8 @@ void Alarm::resolve(uint32_t userId, Event *event, bool terminate, bool notify,
    m_ackTimeout = 0;
    if (m_helpDeskState != ALARM_HELPDESK_IGNORED)
       m_helpDeskState = ALARM_HELPDESK_CLOSED;
-   if (notify)
-      NotifyClients(terminate ? NX_NOTIFY_ALARM_TERMINATED : NX_NOTIFY_ALARM_CHANGED, this);
    updateStateChangeLog(prevState, userId);
-   updateInDatabase();
+   ScheduleAlarmUpdate(this, notify ? (terminate ? NX_NOTIFY_ALARM_TERMINATED : NX_NOTIFY_ALARM_CHANGED) : 0, AlarmDatabaseAction::UPDATE);
    executeHookScript();
 
    if (!terminate && (event != nullptr) && !m_relatedEvents.contains(event->getId()))
@@ -1142,78 +1484,72 @@ void NXCORE_EXPORTABLE ResolveAlarmsById(const IntegerArray<uint32_t>& alarmIds,
 {
    IntegerArray<uint32_t> processedAlarms, updatedObjects;
 
-   s_alarmList.lock();
    time_t changeTime = time(nullptr);
    for(int i = 0; i < alarmIds.size(); i++)
    {
       uint32_t currentId = alarmIds.get(i);
 
-      int n;
-      for(n = 0; n < s_alarmList.size(); n++)
+      AlarmShard *shard = GetShard(currentId);
+      shard->lock();
+      Alarm *alarm = shard->find(currentId);
+      if (alarm != nullptr)
       {
-         Alarm *alarm = s_alarmList.get(n);
-         if (alarm->getAlarmId() == currentId)
+         // If alarm is open in helpdesk, it cannot be terminated
+         if ((alarm->getHelpDeskState() != ALARM_HELPDESK_OPEN) || ConfigReadBoolean(_T("Alarms.IgnoreHelpdeskState"), false))
          {
-            // If alarm is open in helpdesk, it cannot be terminated
-            if ((alarm->getHelpDeskState() != ALARM_HELPDESK_OPEN) || ConfigReadBoolean(_T("Alarms.IgnoreHelpdeskState"), false))
+            if (terminate || (alarm->getState() != ALARM_STATE_RESOLVED))
             {
-               if (terminate || (alarm->getState() != ALARM_STATE_RESOLVED))
+               shared_ptr<NetObj> object = GetAlarmSourceObject(currentId, true);
+               if (session != nullptr)
                {
-                  shared_ptr<NetObj> object = GetAlarmSourceObject(currentId, true);
-                  if (session != nullptr)
+                  // If user does not have the required object access rights, the alarm cannot be terminated
+                  if (!object->checkAccessRights(session->getUserId(), terminate ? OBJECT_ACCESS_TERM_ALARMS : OBJECT_ACCESS_UPDATE_ALARMS))
                   {
-                     // If user does not have the required object access rights, the alarm cannot be terminated
-                     if (!object->checkAccessRights(session->getUserId(), terminate ? OBJECT_ACCESS_TERM_ALARMS : OBJECT_ACCESS_UPDATE_ALARMS))
-                     {
-                        failIds->add(currentId);
-                        failCodes->add(RCC_ACCESS_DENIED);
-                        break;
-                     }
-
-                     WriteAuditLog(AUDIT_OBJECTS, true, session->getUserId(), session->getWorkstation(), session->getId(), object->getId(),
-                        _T("%s alarm %d (%s) on object %s"), terminate ? _T("Terminated") : _T("Resolved"),
-                        alarm->getAlarmId(), alarm->getMessage(), object->getName());
+                     failIds->add(currentId);
+                     failCodes->add(RCC_ACCESS_DENIED);
+                     shard->unlock();
+                     continue;
                   }
 
-                  alarm->resolve((session != nullptr) ? session->getUserId() : 0, nullptr, terminate, false, includeSubordinates);
-                  processedAlarms.add(alarm->getAlarmId());
-                  if (!updatedObjects.contains(object->getId()))
-                     updatedObjects.add(object->getId());
-                  if (terminate)
-                  {
-                     s_alarmList.remove(n);
-                     n--;
-                  }
-               }
-               else
-               {
-                  // Alarm is already resolved, just mark it as processed
-                  processedAlarms.add(alarm->getAlarmId());
+                  WriteAuditLog(AUDIT_OBJECTS, true, session->getUserId(), session->getWorkstation(), session->getId(), object->getId(),
+                     _T("%s alarm %d (%s) on object %s"), terminate ? _T("Terminated") : _T("Resolved"),
+                     alarm->getAlarmId(), alarm->getMessage(), object->getName());
                }
+
+               alarm->resolve((session != nullptr) ? session->getUserId() : 0, nullptr, terminate, false, includeSubordinates);
+               processedAlarms.add(alarm->getAlarmId());
+               if (!updatedObjects.contains(object->getId()))
+                  updatedObjects.add(object->getId());
+               if (terminate)
+                  shard->remove(alarm);
             }
             else
             {
-               failIds->add(currentId);
-               failCodes->add(RCC_ALARM_OPEN_IN_HELPDESK);
+               // Alarm is already resolved, just mark it as processed
+               processedAlarms.add(alarm->getAlarmId());
             }
-            break;
+         }
+         else
+         {
+            failIds->add(currentId);
+            failCodes->add(RCC_ALARM_OPEN_IN_HELPDESK);
          }
       }
-      if (n == s_alarmList.size())
+      else
       {
          failIds->add(currentId);
          failCodes->add(RCC_INVALID_ALARM_ID);
       }
+      shard->unlock();
    }
-   s_alarmList.unlock();
 
-   NXCPMessage notification;
-   notification.setCode(CMD_BULK_ALARM_STATE_CHANGE);
-   notification.setField(VID_NOTIFICATION_CODE, terminate ? NX_NOTIFY_MULTIPLE_ALARMS_TERMINATED : NX_NOTIFY_MULTIPLE_ALARMS_RESOLVED);
-   notification.setField(VID_USER_ID, (session != nullptr) ? session->getUserId() : 0);
-   notification.setFieldFromTime(VID_LAST_CHANGE_TIME, changeTime);
-   notification.setFieldFromInt32Array(VID_ALARM_ID_LIST, &processedAlarms);
-   EnumerateClientSessions(SendBulkAlarmTerminateNotification, &notification);
+   // Bulk notification is sent by background writer to keep it ordered with individual alarm notifications
+   NXCPMessage *notification = new NXCPMessage(CMD_BULK_ALARM_STATE_CHANGE, 0);
+   notification->setField(VID_NOTIFICATION_CODE, terminate ? NX_NOTIFY_MULTIPLE_ALARMS_TERMINATED : NX_NOTIFY_MULTIPLE_ALARMS_RESOLVED);
+   notification->setField(VID_USER_ID, (session != nullptr) ? session->getUserId() : 0);
+   notification->setFieldFromTime(VID_LAST_CHANGE_TIME, changeTime);
+   notification->setFieldFromInt32Array(VID_ALARM_ID_LIST, &processedAlarms);
+   ScheduleBulkAlarmNotification(notification);
 
    for(int i = 0; i < updatedObjects.size(); i++)
       UpdateObjectStatus(updatedObjects.get(i));
@@ -1232,29 +1568,34 @@ static void ResolveAlarmByKeyRegexp(const TCHAR *keyPattern, bool terminate, Eve
       IntegerArray<uint32_t> objectList;
       int ovector[60];
 
-      s_alarmList.lock();
-      for(int i = 0; i < s_alarmList.size(); i++)
+      bool ignoreHelpdeskState = ConfigReadBoolean(_T("Alarms.IgnoreHelpdeskState"), false);
+      for(int n = 0; n < ALARM_SHARDS; n++)
       {
-         Alarm *alarm = s_alarmList.get(i);
-         const TCHAR *key = alarm->getKey();
-         if ((_pcre_exec_t(preg, nullptr, reinterpret_cast<const PCRE_TCHAR*>(key), static_cast<int>(_tcslen(key)), 0, 0, ovector, 60) >= 0) &&
-             ((alarm->getHelpDeskState() != ALARM_HELPDESK_OPEN) || ConfigReadBoolean(_T("Alarms.IgnoreHelpdeskState"), false)) &&
-             (terminate || (alarm->getState() != ALARM_STATE_RESOLVED)))
+         AlarmShard *shard = &s_shards[n];
+         shard->lock();
+         for(int i = 0; i < shard->size(); i++)
          {
-            // Add alarm's source object to update list
-            if (!objectList.contains(alarm->getSourceObject()))
-               objectList.add(alarm->getSourceObject());
-
-            // Resolve or terminate alarm
-            alarm->resolve(0, event, terminate, true, false);
-            if (terminate)
+            Alarm *alarm = shard->get(i);
+            const TCHAR *key = alarm->getKey();
+            if ((_pcre_exec_t(preg, nullptr, reinterpret_cast<const PCRE_TCHAR*>(key), static_cast<int>(_tcslen(key)), 0, 0, ovector, 60) >= 0) &&
+                ((alarm->getHelpDeskState() != ALARM_HELPDESK_OPEN) || ignoreHelpdeskState) &&
+                (terminate || (alarm->getState() != ALARM_STATE_RESOLVED)))
             {
-               s_alarmList.remove(i);
-               i--;
+               // Add alarm's source object to update list
+               if (!objectList.contains(alarm->getSourceObject()))
+                  objectList.add(alarm->getSourceObject());
+
+               // Resolve or terminate alarm
+               alarm->resolve(0, event, terminate, true, false);
+               if (terminate)
+               {
+                  shard->remove(i);
+                  i--;
+               }
             }
          }
+         shard->unlock();
       }
-      s_alarmList.unlock();
 
       // Update status of objects
       for(int i = 0; i < objectList.size(); i++)
@@ -1273,10 +1614,15 @@ static void ResolveAlarmByKeyRegexp(const TCHAR *keyPattern, bool terminate, Eve
  */
 static void ResolveAlarmByKeyExact(const TCHAR *key, bool terminate, Event *event)
 {
+   uint32_t alarmId = FindAlarmIdByKey(key);
+   if (alarmId == 0)
+      return;
+
    uint32_t objectId = 0;
-   s_alarmList.lock();
-   Alarm *alarm = s_alarmList.find(key);
-   if ((alarm != nullptr) &&
+   AlarmShard *shard = GetShard(alarmId);
+   shard->lock();
+   Alarm *alarm = shard->find(alarmId);
+   if ((alarm != nullptr) && !_tcscmp(alarm->getKey(), key) &&
        ((alarm->getHelpDeskState() != ALARM_HELPDESK_OPEN) || ConfigReadBoolean(_T("Alarms.IgnoreHelpdeskState"), false)) &&
        (terminate || (alarm->getState() != ALARM_STATE_RESOLVED)))
    {
@@ -1287,10 +1633,10 @@ static void ResolveAlarmByKeyExact(const TCHAR *key, bool terminate, Event *even
       alarm->resolve(0, event, terminate, true, false);
       if (terminate)
       {
-         s_alarmList.remove(alarm);
+         shard->remove(alarm);
       }
    }
-   s_alarmList.unlock();
+   shard->unlock();
 
    if (objectId != 0)
       UpdateObjectStatus(objectId);
@@ -1314,28 +1660,33 @@ void NXCORE_EXPORTABLE ResolveAlarmByDCObjectId(uint32_t dciId, bool terminate)
 {
    IntegerArray<uint32_t> objectList;
 
-   s_alarmList.lock();
-   for(int i = 0; i < s_alarmList.size(); i++)
+   bool ignoreHelpdeskState = ConfigReadBoolean(_T("Alarms.IgnoreHelpdeskState"), false);
+   for(int n = 0; n < ALARM_SHARDS; n++)
    {
-      Alarm *alarm = s_alarmList.get(i);
-      if ((alarm->getDciId() == dciId) &&
-          ((alarm->getHelpDeskState() != ALARM_HELPDESK_OPEN) || ConfigReadBoolean(_T("Alarms.IgnoreHelpdeskState"), false)) &&
-          (terminate || (alarm->getState() != ALARM_STATE_RESOLVED)))
+      AlarmShard *shard = &s_shards[n];
+      shard->lock();
+      for(int i = 0; i < shard->size(); i++)
       {
-         // Add alarm's source object to update list
-         if (!objectList.contains(alarm->getSourceObject()))
-            objectList.add(alarm->getSourceObject());
-
-         // Resolve or terminate alarm
-         alarm->resolve(0, nullptr, terminate, true, false);
-         if (terminate)
+         Alarm *alarm = shard->get(i);
+         if ((alarm->getDciId() == dciId) &&
+             ((alarm->getHelpDeskState() != ALARM_HELPDESK_OPEN) || ignoreHelpdeskState) &&
+             (terminate || (alarm->getState() != ALARM_STATE_RESOLVED)))
          {
-            s_alarmList.remove(i);
-            i--;
+            // Add alarm's source object to update list
+            if (!objectList.contains(alarm->getSourceObject()))
+               objectList.add(alarm->getSourceObject());
+
+            // Resolve or terminate alarm
+            alarm->resolve(0, nullptr, terminate, true, false);
+            if (terminate)
+            {
+               shard->remove(i);
+               i--;
+            }
          }
       }
+      shard->unlock();
    }
-   s_alarmList.unlock();
 
    // Update status of objects
    for (int i = 0; i < objectList.size(); i++)
@@ -1351,38 +1702,34 @@ uint32_t NXCORE_EXPORTABLE ResolveAlarmByHDRef(const TCHAR *hdref, ClientSession
    uint32_t objectId = 0;
    uint32_t rcc = RCC_INVALID_ALARM_ID;
 
-   s_alarmList.lock();
-   for(int i = 0; i < s_alarmList.size(); i++)
+   Alarm *alarm;
+   AlarmShard *shard = FindAlarmByHDRef(hdref, &alarm);
+   if (shard != nullptr)
    {
-      Alarm *alarm = s_alarmList.get(i);
-      if (!_tcscmp(alarm->getHelpDeskRef(), hdref))
+      if (terminate || (alarm->getState() != ALARM_STATE_RESOLVED))
       {
-         if (terminate || (alarm->getState() != ALARM_STATE_RESOLVED))
+         objectId = alarm->getSourceObject();
+         if (session != nullptr)
          {
-            objectId = alarm->getSourceObject();
-            if (session != nullptr)
-            {
-               WriteAuditLog(AUDIT_OBJECTS, TRUE, session->getUserId(), session->getWorkstation(), session->getId(), objectId,
-                  _T("%s alarm %d (%s) on object %s"), terminate ? _T("Terminated") : _T("Resolved"),
-                  alarm->getAlarmId(), alarm->getMessage(), GetObjectName(objectId, _T("")));
-            }
-
-            alarm->resolve((session != nullptr) ? session->getUserId() : 0, nullptr, terminate, true, false);
-            if (terminate)
-            {
-               s_alarmList.remove(i);
-            }
-            nxlog_debug_tag(DEBUG_TAG, 5, _T("Alarm with helpdesk reference \"%s\" %s"), hdref, terminate ? _T("terminated") : _T("resolved"));
+            WriteAuditLog(AUDIT_OBJECTS, TRUE, session->getUserId(), session->getWorkstation(), session->getId(), objectId,
+               _T("%s alarm %d (%s) on object %s"), terminate ? _T("Terminated") : _T("Resolved"),
+               alarm->getAlarmId(), alarm->getMessage(), GetObjectName(objectId, _T("")));
          }
-         else
+
+         alarm->resolve((session != nullptr) ? session->getUserId() : 0, nullptr, terminate, true, false);
+         if (terminate)
          {
-            nxlog_debug_tag(DEBUG_TAG, 5, _T("Alarm with helpdesk reference \"%s\" already resolved"), hdref);
+            shard->remove(alarm);
          }
-         rcc = RCC_SUCCESS;
-         break;
+         nxlog_debug_tag(DEBUG_TAG, 5, _T("Alarm with helpdesk reference \"%s\" %s"), hdref, terminate ? _T("terminated") : _T("resolved"));
+      }
+      else
+      {
+         nxlog_debug_tag(DEBUG_TAG, 5, _T("Alarm with helpdesk reference \"%s\" already resolved"), hdref);
       }
+      rcc = RCC_SUCCESS;
+      shard->unlock();
    }
-   s_alarmList.unlock();
 
    if (objectId != 0)
       UpdateObjectStatus(objectId);
@@ -1423,8 +1770,7 @@ uint32_t Alarm::openHelpdeskIssue(TCHAR *hdref)
       if (rcc == RCC_SUCCESS)
       {
          m_helpDeskState = ALARM_HELPDESK_OPEN;
-         NotifyClients(NX_NOTIFY_ALARM_CHANGED, this);
-         updateInDatabase();
+         ScheduleAlarmUpdate(this, NX_NOTIFY_ALARM_CHANGED, AlarmDatabaseAction::UPDATE);
          if (hdref != nullptr)
             _tcslcpy(hdref, m_helpDeskRef, MAX_HELPDESK_REF_LEN);
          nxlog_debug_tag(DEBUG_TAG, 5, _T("Helpdesk issue created for alarm %d, reference \"%s\""), m_alarmId, m_helpDeskRef);
@@ -1445,20 +1791,17 @@ uint32_t OpenHelpdeskIssue(uint32_t alarmId, ClientSession *session, TCHAR *hdre
    uint32_t rcc = RCC_INVALID_ALARM_ID;
    *hdref = 0;
 
-   s_alarmList.lock();
-   for(int i = 0; i < s_alarmList.size(); i++)
+   AlarmShard *shard = GetShard(alarmId);
+   shard->lock();
+   Alarm *alarm = shard->find(alarmId);
+   if (alarm != nullptr)
    {
-      Alarm *alarm = s_alarmList.get(i);
-      if (alarm->getAlarmId() == alarmId)
-      {
-         if (alarm->checkCategoryAccess(session))
-            rcc = alarm->openHelpdeskIssue(hdref);
-         else
-            rcc = RCC_ACCESS_DENIED;
-         break;
-      }
+      if (alarm->checkCategoryAccess(session))
+         rcc = alarm->openHelpdeskIssue(hdref);
+      else
+         rcc = RCC_ACCESS_DENIED;
    }
-   s_alarmList.unlock();
+   shard->unlock();
    return rcc;
 }
 
@@ -1469,33 +1812,47 @@ uint32_t GetHelpdeskIssueUrlFromAlarm(uint32_t alarmId, uint32_t userId, TCHAR *
 {
    uint32_t rcc = RCC_INVALID_ALARM_ID;
 
-   s_alarmList.lock();
-   for(int i = 0; i < s_alarmList.size(); i++)
+   AlarmShard *shard = GetShard(alarmId);
+   shard->lock();
+   Alarm *alarm = shard->find(alarmId);
+   if (alarm != nullptr)
    {
-      if (s_alarmList.get(i)->getAlarmId() == alarmId)
+      if (alarm->checkCategoryAccess(session))
       {
-         if (s_alarmList.get(i)->checkCategoryAccess(session))
+         if ((alarm->getHelpDeskState() != ALARM_HELPDESK_IGNORED) && (alarm->getHelpDeskRef()[0] != 0))
          {
-            if ((s_alarmList.get(i)->getHelpDeskState() != ALARM_HELPDESK_IGNORED) && (s_alarmList.get(i)->getHelpDeskRef()[0] != 0))
-            {
-               rcc = GetHelpdeskIssueUrl(s_alarmList.get(i)->getHelpDeskRef(), url, size);
-            }
-            else
-            {
-               rcc = RCC_OUT_OF_STATE_REQUEST;
-            }
+            rcc = GetHelpdeskIssueUrl(alarm->getHelpDeskRef(), url, size);
          }
          else
          {
-            rcc = RCC_ACCESS_DENIED;
+            rcc = RCC_OUT_OF_STATE_REQUEST;
          }
-         break;
+      }
+      else
+      {
+         rcc = RCC_ACCESS_DENIED;
       }
    }
-   s_alarmList.unlock();
+   shard->unlock();
    return rcc;
 }
 
+/**
+ * Unlink helpdesk issue from alarm (must be called with alarm's shard locked)
+ */
+static void UnlinkHelpdeskIssue(Alarm *alarm, ClientSession *session)
+{
+   if (session != nullptr)
+   {
+      WriteAuditLog(AUDIT_OBJECTS, TRUE, session->getUserId(), session->getWorkstation(), session->getId(),
+         alarm->getSourceObject(), _T("Helpdesk issue %s unlinked from alarm %d (%s) on object %s"),
+         alarm->getHelpDeskRef(), alarm->getAlarmId(), alarm->getMessage(),
+         GetObjectName(alarm->getSourceObject(), _T("")));
+   }
+   alarm->unlinkFromHelpdesk();
+   ScheduleAlarmUpdate(alarm, NX_NOTIFY_ALARM_CHANGED, AlarmDatabaseAction::UPDATE);
+}
+
 /**
  * Unlink helpdesk issue from alarm
  */
@@ -1503,27 +1860,15 @@ uint32_t UnlinkHelpdeskIssueById(uint32_t alarmId, ClientSession *session)
 {
    uint32_t rcc = RCC_INVALID_ALARM_ID;
 
-   s_alarmList.lock();
-   for(int i = 0; i < s_alarmList.size(); i++)
+   AlarmShard *shard = GetShard(alarmId);
+   shard->lock();
+   Alarm *alarm = shard->find(alarmId);
+   if (alarm != nullptr)
    {
-      Alarm *alarm = s_alarmList.get(i);
-      if (alarm->getAlarmId() == alarmId)
-      {
-         if (session != nullptr)
-         {
-            WriteAuditLog(AUDIT_OBJECTS, TRUE, session->getUserId(), session->getWorkstation(), session->getId(),
-               alarm->getSourceObject(), _T("Helpdesk issue %s unlinked from alarm %d (%s) on object %s"),
-               alarm->getHelpDeskRef(), alarm->getAlarmId(), alarm->getMessage(),
-               GetObjectName(alarm->getSourceObject(), _T("")));
-         }
-         alarm->unlinkFromHelpdesk();
-			NotifyClients(NX_NOTIFY_ALARM_CHANGED, alarm);
-			alarm->updateInDatabase();
-         rcc = RCC_SUCCESS;
-         break;
-      }
+      UnlinkHelpdeskIssue(alarm, session);
+      rcc = RCC_SUCCESS;
    }
-   s_alarmList.unlock();
+   shard->unlock();
 
    return rcc;
 }
@@ -1535,33 +1880,21 @@ uint32_t UnlinkHelpdeskIssueByHDRef(const TCHAR *hdref, ClientSession *session)
 {
    uint32_t rcc = RCC_INVALID_ALARM_ID;
 
-   s_alarmList.lock();
-   for(int i = 0; i < s_alarmList.size(); i++)
+   Alarm *alarm;
+   AlarmShard *shard = FindAlarmByHDRef(hdref, &alarm);
+   if (shard != nullptr)
    {
-      Alarm *alarm = s_alarmList.get(i);
-      if (!_tcscmp(alarm->getHelpDeskRef(), hdref))
-      {
-         if (session != nullptr)
-         {
-            WriteAuditLog(AUDIT_OBJECTS, TRUE, session->getUserId(), session->getWorkstation(), session->getId(),
-               alarm->getSourceObject(), _T("Helpdesk issue %s unlinked from alarm %d (%s) on object %s"),
-               alarm->getHelpDeskRef(), alarm->getAlarmId(), alarm->getMessage(),
-               GetObjectName(alarm->getSourceObject(), _T("")));
-         }
-         alarm->unlinkFromHelpdesk();
-			NotifyClients(NX_NOTIFY_ALARM_CHANGED, alarm);
-			alarm->updateInDatabase();
-         rcc = RCC_SUCCESS;
-         break;
-      }
+      UnlinkHelpdeskIssue(alarm, session);
+      rcc = RCC_SUCCESS;
+      shard->unlock();
    }
-   s_alarmList.unlock();
 
    return rcc;
 }
 
 /**
- * Delete alarm with given ID
+ * Delete alarm with given ID. Alarm records are removed from database by background writer.
+ * If objectCleanup is set to true status of alarm's source object will not be updated.
  */
 void NXCORE_EXPORTABLE DeleteAlarm(uint32_t alarmId, bool objectCleanup)
 {
@@ -1569,39 +1902,20 @@ void NXCORE_EXPORTABLE DeleteAlarm(uint32_t alarmId, bool objectCleanup)
    bool found = false;
 
    // Delete alarm from in-memory list
-   if (!objectCleanup)  // otherwise already locked
-      s_alarmList.lock();
-   for(int i = 0; i < s_alarmList.size(); i++)
+   AlarmShard *shard = GetShard(alarmId);
+   shard->lock();
+   Alarm *alarm = shard->find(alarmId);
+   if (alarm != nullptr)
    {
-      Alarm *alarm = s_alarmList.get(i);
-      if (alarm->getAlarmId() == alarmId)
-      {
-         objectId = alarm->getSourceObject();
-         NotifyClients(NX_NOTIFY_ALARM_DELETED, alarm);
-         s_alarmList.remove(i);
-         found = true;
-         break;
-      }
+      objectId = alarm->getSourceObject();
+      ScheduleAlarmUpdate(alarm, NX_NOTIFY_ALARM_DELETED, AlarmDatabaseAction::REMOVE);
+      shard->remove(alarm);
+      found = true;
    }
-   if (!objectCleanup)
-      s_alarmList.unlock();
+   shard->unlock();
 
-   // Delete from database
    if (found && !objectCleanup)
-   {
-      TCHAR szQuery[256];
-
-      _sntprintf(szQuery, 256, _T("DELETE FROM alarms WHERE alarm_id=%u"), alarmId);
-      QueueSQLRequest(szQuery);
-      _sntprintf(szQuery, 256, _T("DELETE FROM alarm_events WHERE alarm_id=%u"), alarmId);
-      QueueSQLRequest(szQuery);
-      _sntprintf(szQuery, 256, _T("DELETE FROM alarm_notes WHERE alarm_id=%u"), alarmId);
-      QueueSQLRequest(szQuery);
-      _sntprintf(szQuery, 256, _T("DELETE FROM alarm_state_changes WHERE alarm_id=%u"), alarmId);
-      QueueSQLRequest(szQuery);
-
       UpdateObjectStatus(objectId);
-   }
 }
 
 /**
@@ -1610,19 +1924,22 @@ void NXCORE_EXPORTABLE DeleteAlarm(uint32_t alarmId, bool objectCleanup)
  */
 bool DeleteObjectAlarms(uint32_t objectId, DB_HANDLE hdb)
 {
-	s_alarmList.lock();
-
-	// go through from end because s_alarmList.size() is decremented by DeleteAlarm()
-	for(int i = s_alarmList.size() - 1; i >= 0; i--)
+   for(int n = 0; n < ALARM_SHARDS; n++)
    {
-      Alarm *alarm = s_alarmList.get(i);
-		if (alarm->getSourceObject() == objectId)
+      AlarmShard *shard = &s_shards[n];
+      shard->lock();
+      // go through from end because shard size is decremented on each removal
+      for(int i = shard->size() - 1; i >= 0; i--)
       {
-			DeleteAlarm(alarm->getAlarmId(), true);
+         Alarm *alarm = shard->get(i);
+         if (alarm->getSourceObject() == objectId)
+         {
+            ScheduleAlarmUpdate(alarm, NX_NOTIFY_ALARM_DELETED, AlarmDatabaseAction::REMOVE);
+            shard->remove(i);
+         }
       }
-	}
-
-	s_alarmList.unlock();
+      shard->unlock();
+   }
 
    // Delete all object alarms from database
    bool success = false;
@@ -1661,7 +1978,8 @@ bool DeleteObjectAlarms(uint32_t objectId, DB_HANDLE hdb)
 }
 
 /**
- * Send all alarms to client
+ * Send all alarms to client. Alarm list snapshot published by background writer is used,
+ * so alarm shards are not locked while alarms are being sent.
  */
 void SendAlarmsToClient(uint32_t requestId, ClientSession *session)
 {
@@ -1670,21 +1988,23 @@ void SendAlarmsToClient(uint32_t requestId, ClientSession *session)
    // Prepare message
    NXCPMessage msg(CMD_ALARM_DATA, requestId);
 
-   ObjectArray<Alarm> *alarms = GetAlarms();
-   for(int i = 0; i < alarms->size(); i++)
+   shared_ptr<SharedObjectArray<Alarm>> alarms = s_alarmSnapshot.get();
+   if (alarms != nullptr)
    {
-      Alarm *alarm = alarms->get(i);
-      shared_ptr<NetObj> object = FindObjectById(alarm->getSourceObject());
-      if ((object != nullptr) &&
-          object->checkAccessRights(userId, OBJECT_ACCESS_READ_ALARMS) &&
-          alarm->checkCategoryAccess(session))
+      for(int i = 0; i < alarms->size(); i++)
       {
-         alarm->fillMessage(&msg);
-         session->sendMessage(msg);
-         msg.deleteAllFields();
+         Alarm *alarm = alarms->get(i);
+         shared_ptr<NetObj> object = FindObjectById(alarm->getSourceObject());
+         if ((object != nullptr) &&
+             object->checkAccessRights(userId, OBJECT_ACCESS_READ_ALARMS) &&
+             alarm->checkCategoryAccess(session))
+         {
+            alarm->fillMessage(&msg);
+            session->sendMessage(msg);
+            msg.deleteAllFields();
+         }
       }
    }
-   delete alarms;
 
    // Send end-of-list indicator
    msg.setField(VID_ALARM_ID, (uint32_t)0);
@@ -1699,25 +2019,22 @@ uint32_t NXCORE_EXPORTABLE GetAlarm(uint32_t alarmId, uint32_t userId, NXCPMessa
 {
    uint32_t rcc = RCC_INVALID_ALARM_ID;
 
-   s_alarmList.lock();
-   for(int i = 0; i < s_alarmList.size(); i++)
+   AlarmShard *shard = GetShard(alarmId);
+   shard->lock();
+   Alarm *alarm = shard->find(alarmId);
+   if (alarm != nullptr)
    {
-      Alarm *alarm = s_alarmList.get(i);
-      if (alarm->getAlarmId() == alarmId)
+      if (alarm->checkCategoryAccess(session))
       {
-         if (alarm->checkCategoryAccess(session))
-         {
-            alarm->fillMessage(msg);
-            rcc = RCC_SUCCESS;
-         }
-         else
-         {
-            rcc = RCC_ACCESS_DENIED;
-         }
-         break;
+         alarm->fillMessage(msg);
+         rcc = RCC_SUCCESS;
+      }
+      else
+      {
+         rcc = RCC_ACCESS_DENIED;
       }
    }
-   s_alarmList.unlock();
+   shard->unlock();
 
    return rcc;
 }
@@ -1730,26 +2047,14 @@ uint32_t NXCORE_EXPORTABLE GetAlarmEvents(uint32_t alarmId, uint32_t userId, NXC
 {
    uint32_t rcc = RCC_INVALID_ALARM_ID;
 
-   s_alarmList.lock();
-   for(int i = 0; i < s_alarmList.size(); i++)
-   {
-      if (s_alarmList.get(i)->getAlarmId() == alarmId)
-      {
-         if (s_alarmList.get(i)->checkCategoryAccess(session))
-         {
-            rcc = RCC_SUCCESS;
-         }
-         else
-         {
-            rcc = RCC_ACCESS_DENIED;
-         }
-         break;
-      }
-   }
-
-   s_alarmList.unlock();
+   AlarmShard *shard = GetShard(alarmId);
+   shard->lock();
+   Alarm *alarm = shard->find(alarmId);
+   if (alarm != nullptr)
+      rcc = alarm->checkCategoryAccess(session) ? RCC_SUCCESS : RCC_ACCESS_DENIED;
+   shard->unlock();
 
-	// we don't call FillAlarmEventsMessage from within loop
+	// we don't call FillAlarmEventsMessage with shard locked
 	// to prevent alarm list lock for a long time
 	if (rcc == RCC_SUCCESS)
 		FillAlarmEventsMessage(msg, alarmId);
@@ -1758,26 +2063,21 @@ uint32_t NXCORE_EXPORTABLE GetAlarmEvents(uint32_t alarmId, uint32_t userId, NXC
 }
 
 /**
- * Get source object for given alarm id
+ * Get source object for given alarm id. If alreadyLocked is set to true
+ * caller should hold lock on alarm's shard.
  */
 shared_ptr<NetObj> NXCORE_EXPORTABLE GetAlarmSourceObject(uint32_t alarmId, bool alreadyLocked)
 {
    uint32_t objectId = 0;
 
+   AlarmShard *shard = GetShard(alarmId);
    if (!alreadyLocked)
-      s_alarmList.lock();
-   for(int i = 0; i < s_alarmList.size(); i++)
-   {
-      Alarm *alarm = s_alarmList.get(i);
-      if (alarm->getAlarmId() == alarmId)
-      {
-         objectId = alarm->getSourceObject();
-         break;
-      }
-   }
-
+      shard->lock();
+   Alarm *alarm = shard->find(alarmId);
+   if (alarm != nullptr)
+      objectId = alarm->getSourceObject();
    if (!alreadyLocked)
-      s_alarmList.unlock();
+      shard->unlock();
    return (objectId != 0) ? FindObjectById(objectId) : shared_ptr<NetObj>();
 }
 
@@ -1786,19 +2086,15 @@ shared_ptr<NetObj> NXCORE_EXPORTABLE GetAlarmSourceObject(uint32_t alarmId, bool
  */
 shared_ptr<NetObj> NXCORE_EXPORTABLE GetAlarmSourceObject(const TCHAR *hdref)
 {
-   UINT32 objectId = 0;
+   uint32_t objectId = 0;
 
-   s_alarmList.lock();
-   for(int i = 0; i < s_alarmList.size(); i++)
+   Alarm *alarm;
+   AlarmShard *shard = FindAlarmByHDRef(hdref, &alarm);
+   if (shard != nullptr)
    {
-      Alarm *alarm = s_alarmList.get(i);
-      if (!_tcscmp(alarm->getHelpDeskRef(), hdref))
-      {
-         objectId = alarm->getSourceObject();
-         break;
-      }
+      objectId = alarm->getSourceObject();
+      shard->unlock();
    }
-   s_alarmList.unlock();
    return (objectId != 0) ? FindObjectById(objectId) : shared_ptr<NetObj>();
 }
 
@@ -1810,18 +2106,22 @@ int GetMostCriticalStatusForObject(uint32_t objectId)
 {
    int status = STATUS_UNKNOWN;
 
-   s_alarmList.lock();
-   for(int i = 0; (i < s_alarmList.size()) && (status != STATUS_CRITICAL); i++)
+   for(int n = 0; (n < ALARM_SHARDS) && (status != STATUS_CRITICAL); n++)
    {
-      Alarm *alarm = s_alarmList.get(i);
-      if ((alarm->getSourceObject() == objectId) &&
-			 ((alarm->getState() & ALARM_STATE_MASK) < ALARM_STATE_RESOLVED) &&
-          ((alarm->getCurrentSeverity() > status) || (status == STATUS_UNKNOWN)))
+      AlarmShard *shard = &s_shards[n];
+      shard->lock();
+      for(int i = 0; (i < shard->size()) && (status != STATUS_CRITICAL); i++)
       {
-         status = (int)alarm->getCurrentSeverity();
+         Alarm *alarm = shard->get(i);
+         if ((alarm->getSourceObject() == objectId) &&
+             ((alarm->getState() & ALARM_STATE_MASK) < ALARM_STATE_RESOLVED) &&
+             ((alarm->getCurrentSeverity() > status) || (status == STATUS_UNKNOWN)))
+         {
+            status = (int)alarm->getCurrentSeverity();
+         }
       }
+      shard->unlock();
    }
-   s_alarmList.unlock();
    return status;
 }
 
@@ -1830,15 +2130,20 @@ int GetMostCriticalStatusForObject(uint32_t objectId)
  */
 void GetAlarmStats(NXCPMessage *pMsg)
 {
-   UINT32 dwCount[5];
-
-   s_alarmList.lock();
-   pMsg->setField(VID_NUM_ALARMS, s_alarmList.size());
-   memset(dwCount, 0, sizeof(UINT32) * 5);
-   for(int i = 0; i < s_alarmList.size(); i++)
-      dwCount[s_alarmList.get(i)->getCurrentSeverity()]++;
-   s_alarmList.unlock();
-   pMsg->setFieldFromInt32Array(VID_ALARMS_BY_SEVERITY, 5, dwCount);
+   uint32_t count[5];
+   memset(count, 0, sizeof(uint32_t) * 5);
+   int total = 0;
+   for(int n = 0; n < ALARM_SHARDS; n++)
+   {
+      AlarmShard *shard = &s_shards[n];
+      shard->lock();
+      total += shard->size();
+      for(int i = 0; i < shard->size(); i++)
+         count[shard->get(i)->getCurrentSeverity()]++;
+      shard->unlock();
+   }
+   pMsg->setField(VID_NUM_ALARMS, total);
+   pMsg->setFieldFromInt32Array(VID_ALARMS_BY_SEVERITY, 5, count);
 }
 
 /**
@@ -1846,10 +2151,7 @@ void GetAlarmStats(NXCPMessage *pMsg)
  */
 int GetAlarmCount()
 {
-   s_alarmList.lock();
-   int count = s_alarmList.size();
-   s_alarmList.unlock();
-   return count;
+   return static_cast<int>(s_alarmCount);
 }
 
 /**
@@ -1857,7 +2159,65 @@ int GetAlarmCount()
  */
 uint64_t GetAlarmMemoryUsage()
 {
-   return s_alarmList.memoryUsage();
+   uint64_t memUsage = 0;
+   for(int n = 0; n < ALARM_SHARDS; n++)
+      memUsage += s_shards[n].memoryUsage();
+   return memUsage;
+}
+
+/**
+ * Check timeouts for alarms in given shard
+ */
+static void CheckAlarmTimeouts(AlarmShard *shard, time_t now)
+{
+   shard->lock();
+   for(int i = 0; i < shard->size(); i++)
+   {
+      Alarm *alarm = shard->get(i);
+      if ((alarm->getTimeout() > 0) &&
+          ((alarm->getState() & ALARM_STATE_MASK) == ALARM_STATE_OUTSTANDING) &&
+          (((time_t)alarm->getLastChangeTime() + (time_t)alarm->getTimeout()) < now))
+      {
+         nxlog_debug_tag(DEBUG_TAG, 5, _T("Outstanding timeout: alarm_id=%u, last_change=%u, timeout=%u, now=%u"),
+                  alarm->getAlarmId(), alarm->getLastChangeTime(), alarm->getTimeout(), (UINT32)now);
+
+         TCHAR eventName[MAX_EVENT_NAME];
+         if (!EventNameFromCode(alarm->getSourceEventCode(), eventName))
+         {
+            _sntprintf(eventName, MAX_EVENT_NAME, _T("[%u]"), alarm->getSourceEventCode());
+         }
+         PostSystemEvent(alarm->getTimeoutEvent(), alarm->getSourceObject(), "dssds",
+                   alarm->getAlarmId(), alarm->getMessage(), alarm->getKey(), alarm->getSourceEventCode(), eventName);
+         alarm->clearTimeout();	// Disable repeated timeout events
+         ScheduleAlarmUpdate(alarm, 0, AlarmDatabaseAction::UPDATE);
+      }
+
+      if ((alarm->getAckTimeout() != 0) &&
+          ((alarm->getState() & ALARM_STATE_STICKY) != 0) &&
+          (((time_t)alarm->getAckTimeout() <= now)))
+      {
+         nxlog_debug_tag(DEBUG_TAG, 5, _T("Acknowledgment timeout: alarm_id=%u, timeout=%u, now=%u"),
+                  alarm->getAlarmId(), alarm->getAckTimeout(), (UINT32)now);
+
+         PostSystemEvent(alarm->getTimeoutEvent(), alarm->getSourceObject(), "dssd",
+                  alarm->getAlarmId(), alarm->getMessage(), alarm->getKey(), alarm->getSourceEventCode());
+         alarm->onAckTimeoutExpiration();
+         ScheduleAlarmUpdate(alarm, NX_NOTIFY_ALARM_CHANGED, AlarmDatabaseAction::UPDATE);
+      }
+
+      if ((s_resolveExpirationTime > 0) &&
+          ((alarm->getState() & ALARM_STATE_MASK) == ALARM_STATE_RESOLVED) &&
+          (alarm->getLastChangeTime() + s_resolveExpirationTime <= now) &&
+          (alarm->getHelpDeskState() != ALARM_HELPDESK_OPEN))
+      {
+         nxlog_debug_tag(DEBUG_TAG, 5, _T("Resolve timeout: alarm_id=%u, last_change=%u, timeout=%u, now=%u"),
+                  alarm->getAlarmId(), alarm->getLastChangeTime(), s_resolveExpirationTime, (UINT32)now);
+         alarm->resolve(0, nullptr, true, true, false);
+         shard->remove(i);
+         i--;
+      }
+   }
+   shard->unlock();
 }
 
 /**
@@ -1872,56 +2232,9 @@ static void WatchdogThread()
 		if (!(g_flags & AF_SERVER_INITIALIZED))
 		   continue;   // Server not initialized yet
 
-		s_alarmList.lock();
 		time_t now = time(nullptr);
-	   for(int i = 0; i < s_alarmList.size(); i++)
-		{
-         Alarm *alarm = s_alarmList.get(i);
-			if ((alarm->getTimeout() > 0) &&
-				 ((alarm->getState() & ALARM_STATE_MASK) == ALARM_STATE_OUTSTANDING) &&
-				 (((time_t)alarm->getLastChangeTime() + (time_t)alarm->getTimeout()) < now))
-			{
-            nxlog_debug_tag(DEBUG_TAG, 5, _T("Outstanding timeout: alarm_id=%u, last_change=%u, timeout=%u, now=%u"),
-                     alarm->getAlarmId(), alarm->getLastChangeTime(), alarm->getTimeout(), (UINT32)now);
-
-				TCHAR eventName[MAX_EVENT_NAME];
-				if (!EventNameFromCode(alarm->getSourceEventCode(), eventName))
-				{
-				   _sntprintf(eventName, MAX_EVENT_NAME, _T("[%u]"), alarm->getSourceEventCode());
-				}
-				PostSystemEvent(alarm->getTimeoutEvent(), alarm->getSourceObject(), "dssds",
-				          alarm->getAlarmId(), alarm->getMessage(), alarm->getKey(), alarm->getSourceEventCode(), eventName);
-				alarm->clearTimeout();	// Disable repeated timeout events
-				alarm->updateInDatabase();
-			}
-
-			if ((alarm->getAckTimeout() != 0) &&
-				 ((alarm->getState() & ALARM_STATE_STICKY) != 0) &&
-				 (((time_t)alarm->getAckTimeout() <= now)))
-			{
-			   nxlog_debug_tag(DEBUG_TAG, 5, _T("Acknowledgment timeout: alarm_id=%u, timeout=%u, now=%u"),
-			            alarm->getAlarmId(), alarm->getAckTimeout(), (UINT32)now);
-
-				PostSystemEvent(alarm->getTimeoutEvent(), alarm->getSourceObject(), "dssd",
-				         alarm->getAlarmId(), alarm->getMessage(), alarm->getKey(), alarm->getSourceEventCode());
-				alarm->onAckTimeoutExpiration();
-				alarm->updateInDatabase();
-				NotifyClients(NX_NOTIFY_ALARM_CHANGED, alarm);
-			}
-
-			if ((s_resolveExpirationTime > 0) &&
-			    ((alarm->getState() & ALARM_STATE_MASK) == ALARM_STATE_RESOLVED) &&
-			    (alarm->getLastChangeTime() + s_resolveExpirationTime <= now) &&
-			    (alarm->getHelpDeskState() != ALARM_HELPDESK_OPEN))
-			{
-            nxlog_debug_tag(DEBUG_TAG, 5, _T("Resolve timeout: alarm_id=%u, last_change=%u, timeout=%u, now=%u"),
-                     alarm->getAlarmId(), alarm->getLastChangeTime(), s_resolveExpirationTime, (UINT32)now);
-            alarm->resolve(0, nullptr, true, true, false);
-            s_alarmList.remove(i);
-            i--;
-			}
-		}
-		s_alarmList.unlock();
+		for(int n = 0; n < ALARM_SHARDS; n++)
+		   CheckAlarmTimeouts(&s_shards[n], now);
 	}
 }
 
@@ -2011,7 +2324,7 @@ uint32_t Alarm::updateAlarmComment(uint32_t *commentId, const TCHAR *text, uint3
 	{
       if (newNote)
          m_commentCount++;
-		NotifyClients(NX_NOTIFY_ALARM_CHANGED, this);
+		ScheduleAlarmUpdate(this, NX_NOTIFY_ALARM_CHANGED, AlarmDatabaseAction::NONE);
       if (syncWithHelpdesk && (m_helpDeskState == ALARM_HELPDESK_OPEN))
       {
          AddHelpdeskIssueComment(m_helpDeskRef, text);
@@ -2028,18 +2341,14 @@ uint32_t AddAlarmComment(const TCHAR *hdref, const TCHAR *text, uint32_t userId)
 {
    uint32_t rcc = RCC_INVALID_ALARM_ID;
 
-   s_alarmList.lock();
-   for(int i = 0; i < s_alarmList.size(); i++)
+   Alarm *alarm;
+   AlarmShard *shard = FindAlarmByHDRef(hdref, &alarm);
+   if (shard != nullptr)
    {
-      Alarm *alarm = s_alarmList.get(i);
-      if (!_tcscmp(alarm->getHelpDeskRef(), hdref))
-      {
-         uint32_t id = 0;
-         rcc = alarm->updateAlarmComment(&id, text, userId, false);
-         break;
-      }
+      uint32_t id = 0;
+      rcc = alarm->updateAlarmComment(&id, text, userId, false);
+      shard->unlock();
    }
-   s_alarmList.unlock();
 
    return rcc;
 }
@@ -2059,17 +2368,12 @@ uint32_t UpdateAlarmComment(uint32_t alarmId, uint32_t *noteId, const TCHAR *tex
 {
    uint32_t rcc = RCC_INVALID_ALARM_ID;
 
-   s_alarmList.lock();
-   for(int i = 0; i < s_alarmList.size(); i++)
-   {
-      Alarm *alarm = s_alarmList.get(i);
-      if (alarm->getAlarmId() == alarmId)
-      {
-         rcc = alarm->updateAlarmComment(noteId, text, userId, syncWithHelpdesk);
-         break;
-      }
-   }
-   s_alarmList.unlock();
+   AlarmShard *shard = GetShard(alarmId);
+   shard->lock();
+   Alarm *alarm = shard->find(alarmId);
+   if (alarm != nullptr)
+      rcc = alarm->updateAlarmComment(noteId, text, userId, syncWithHelpdesk);
+   shard->unlock();
 
    return rcc;
 }
@@ -2103,7 +2407,7 @@ uint32_t Alarm::deleteComment(uint32_t commentId)
    if (rcc == RCC_SUCCESS)
    {
       m_commentCount--;
-      NotifyClients(NX_NOTIFY_ALARM_CHANGED, this);
+      ScheduleAlarmUpdate(this, NX_NOTIFY_ALARM_CHANGED, AlarmDatabaseAction::NONE);
    }
    return rcc;
 }
@@ -2115,17 +2419,12 @@ uint32_t DeleteAlarmCommentByID(uint32_t alarmId, uint32_t noteId)
 {
    uint32_t rcc = RCC_INVALID_ALARM_ID;
 
-   s_alarmList.lock();
-   for(int i = 0; i < s_alarmList.size(); i++)
-   {
-      Alarm *alarm = s_alarmList.get(i);
-      if (alarm->getAlarmId() == alarmId)
-      {
-         rcc = alarm->deleteComment(noteId);
-         break;
-      }
-   }
-   s_alarmList.unlock();
+   AlarmShard *shard = GetShard(alarmId);
+   shard->lock();
+   Alarm *alarm = shard->find(alarmId);
+   if (alarm != nullptr)
+      rcc = alarm->deleteComment(noteId);
+   shard->unlock();
 
    return rcc;
 }
@@ -2226,18 +2525,22 @@ uint32_t GetAlarmComments(uint32_t alarmId, NXCPMessage *msg)
  */
 ObjectArray<Alarm> NXCORE_EXPORTABLE *GetAlarms(uint32_t objectId, bool recursive)
 {
-   s_alarmList.lock();
-   ObjectArray<Alarm> *result = new ObjectArray<Alarm>(s_alarmList.size(), 16, Ownership::True);
-   for(int i = 0; i < s_alarmList.size(); i++)
+   ObjectArray<Alarm> *result = new ObjectArray<Alarm>((objectId == 0) ? static_cast<int>(s_alarmCount) : 16, 16, Ownership::True);
+   for(int n = 0; n < ALARM_SHARDS; n++)
    {
-      Alarm *alarm = s_alarmList.get(i);
-      if ((objectId == 0) || (alarm->getSourceObject() == objectId) ||
-          (recursive && IsParentObject(objectId, alarm->getSourceObject())))
+      AlarmShard *shard = &s_shards[n];
+      shard->lock();
+      for(int i = 0; i < shard->size(); i++)
       {
-         result->add(new Alarm(alarm, true));
+         Alarm *alarm = shard->get(i);
+         if ((objectId == 0) || (alarm->getSourceObject() == objectId) ||
+             (recursive && IsParentObject(objectId, alarm->getSourceObject())))
+         {
+            result->add(new Alarm(alarm, true));
+         }
       }
+      shard->unlock();
    }
-   s_alarmList.unlock();
    return result;
 }
 
@@ -2265,11 +2568,17 @@ int F_FindAlarmByKey(int argc, NXSL_Value **argv, NXSL_Value **result, NXSL_VM *
 
    const TCHAR *key = argv[0]->getValueAsCString();
 
-   s_alarmList.lock();
-   Alarm *alarm = s_alarmList.find(key);
-   if (alarm != nullptr)
-      alarm = new Alarm(alarm, false);
-   s_alarmList.unlock();
+   Alarm *alarm = nullptr;
+   uint32_t alarmId = FindAlarmIdByKey(key);
+   if (alarmId != 0)
+   {
+      AlarmShard *shard = GetShard(alarmId);
+      shard->lock();
+      Alarm *a = shard->find(alarmId);
+      if ((a != nullptr) && !_tcscmp(a->getKey(), key))
+         alarm = new Alarm(a, false);
+      shard->unlock();
+   }
 
    *result = (alarm != nullptr) ? vm->createValue(vm->createObject(&g_nxslAlarmClass, alarm)) : vm->createValue();
    return 0;
@@ -2286,17 +2595,21 @@ int F_FindAlarmByKeyRegex(int argc, NXSL_Value **argv, NXSL_Value **result, NXSL
    const TCHAR *key = argv[0]->getValueAsCString();
    Alarm *alarm = nullptr;
 
-   s_alarmList.lock();
-   for(int i = 0; i < s_alarmList.size(); i++)
+   for(int n = 0; (n < ALARM_SHARDS) && (alarm == nullptr); n++)
    {
-      Alarm *a = s_alarmList.get(i);
-      if (RegexpMatch(a->getKey(), key, TRUE))
+      AlarmShard *shard = &s_shards[n];
+      shard->lock();
+      for(int i = 0; i < shard->size(); i++)
       {
-         alarm = new Alarm(a, false);
-         break;
+         Alarm *a = shard->get(i);
+         if (RegexpMatch(a->getKey(), key, TRUE))
+         {
+            alarm = new Alarm(a, false);
+            break;
+         }
       }
+      shard->unlock();
    }
-   s_alarmList.unlock();
 
    *result = (alarm != nullptr) ? vm->createValue(vm->createObject(&g_nxslAlarmClass, alarm)) : vm->createValue();
    return 0;
@@ -2310,11 +2623,12 @@ Alarm NXCORE_EXPORTABLE *FindAlarmById(UINT32 alarmId)
    if (alarmId == 0)
       return nullptr;
 
-   s_alarmList.lock();
-   Alarm *alarm = s_alarmList.find(alarmId);
+   AlarmShard *shard = GetShard(alarmId);
+   shard->lock();
+   Alarm *alarm = shard->find(alarmId);
    if (alarm != nullptr)
       alarm = new Alarm(alarm, false);
-   s_alarmList.unlock();
+   shard->unlock();
    return alarm;
 }
 
@@ -2374,16 +2688,20 @@ static void RootCauseUpdateThread()
       s_rootCauseUpdateNeeded = false;
 
       ObjectArray<Alarm> updateList(0, 32, Ownership::True);
-      s_alarmList.lock();
-      for(int i = 0; i < s_alarmList.size(); i++)
+      for(int n = 0; n < ALARM_SHARDS; n++)
       {
-         Alarm *a = s_alarmList.get(i);
-         if ((*a->getRcaScriptName() != 0) && (a->getParentAlarmId() == 0))
+         AlarmShard *shard = &s_shards[n];
+         shard->lock();
+         for(int i = 0; i < shard->size(); i++)
          {
-            updateList.add(new Alarm(a, false));
+            Alarm *a = shard->get(i);
+            if ((*a->getRcaScriptName() != 0) && (a->getParentAlarmId() == 0))
+            {
+               updateList.add(new Alarm(a, false));
+            }
          }
+         shard->unlock();
       }
-      s_alarmList.unlock();
 
       nxlog_debug_tag(DEBUG_TAG, 5, _T("%d alarms for re-evaluation by background root cause analyzer"));
 
@@ -2406,13 +2724,18 @@ static void RootCauseUpdateThread()
                   nxlog_debug_tag(DEBUG_TAG, 5, _T("Background root cause analysis script in has found parent alarm %u (%s)"),
                            parentAlarmId, static_cast<Alarm*>(result->getValueAsObject()->getData())->getMessage());
 
-                  s_alarmList.lock();
-                  Alarm *originalAlarm = s_alarmList.find(alarm->getAlarmId());
+                  uint32_t prevParentAlarmId = 0;
+                  AlarmShard *shard = GetShard(alarm->getAlarmId());
+                  shard->lock();
+                  Alarm *originalAlarm = shard->find(alarm->getAlarmId());
                   if (originalAlarm != nullptr)
                   {
+                     prevParentAlarmId = originalAlarm->getParentAlarmId();
                      originalAlarm->updateParentAlarm(parentAlarmId);
                   }
-                  s_alarmList.unlock();
+                  shard->unlock();
+                  if (originalAlarm != nullptr)
+                     MoveSubordinateAlarm(alarm->getAlarmId(), prevParentAlarmId, parentAlarmId);
                }
             }
             else
@@ -2458,7 +2781,10 @@ bool InitAlarmManager()
 
    int count = DBGetNumRows(hResult);
    for(int i = 0; i < count; i++)
-      s_alarmList.add(new Alarm((cachedb != nullptr) ? cachedb : hdb, hResult, i));
+   {
+      Alarm *alarm = new Alarm((cachedb != nullptr) ? cachedb : hdb, hResult, i);
+      GetShard(alarm->getAlarmId())->add(alarm);
+   }
 
    DBFreeResult(hResult);
 
@@ -2475,18 +2801,36 @@ bool InitAlarmManager()
    if (cachedb != nullptr)
       DBCloseInMemoryDatabase(cachedb);
 
-   // Update subordinate alarm lists
-   for(int i = 0; i < s_alarmList.size(); i++)
+   // Update subordinate alarm lists (no locking needed because other threads are not started yet)
+   for(int n = 0; n < ALARM_SHARDS; n++)
    {
-      Alarm *curr = s_alarmList.get(i);
-      if (curr->getParentAlarmId() != 0)
+      AlarmShard *shard = &s_shards[n];
+      for(int i = 0; i < shard->size(); i++)
       {
-         Alarm *parent = s_alarmList.find(curr->getParentAlarmId());
-         if (parent != nullptr)
-            parent->addSubordinateAlarm(curr->getAlarmId());
+         Alarm *curr = shard->get(i);
+         if (curr->getParentAlarmId() != 0)
+         {
+            Alarm *parent = GetShard(curr->getParentAlarmId())->find(curr->getParentAlarmId());
+            if (parent != nullptr)
+               parent->addSubordinateAlarm(curr->getAlarmId());
+         }
       }
    }
 
+   // Initial alarm list snapshot
+   for(int n = 0; n < ALARM_SHARDS; n++)
+   {
+      AlarmShard *shard = &s_shards[n];
+      for(int i = 0; i < shard->size(); i++)
+      {
+         Alarm *alarm = shard->get(i);
+         s_publishedAlarms.set(alarm->getAlarmId(), new Alarm(alarm, false));
+      }
+   }
+   PublishAlarmSnapshot();
+   nxlog_debug_tag(DEBUG_TAG, 2, _T("%d active alarms loaded (%d shards)"), static_cast<int>(s_alarmCount), ALARM_SHARDS);
+
+   s_writerThread = ThreadCreateEx(AlarmWriterThread);
    s_watchdogThread = ThreadCreateEx(WatchdogThread);
    s_rootCauseUpdateThread = ThreadCreateEx(RootCauseUpdateThread);
    return true;
@@ -2500,4 +2844,11 @@ void ShutdownAlarmManager()
    s_shutdown.set();
    ThreadJoin(s_watchdogThread);
    ThreadJoin(s_rootCauseUpdateThread);
+
+   s_writerLock.lock();
+   s_writerShutdown = true;
+   s_writerLock.unlock();
+   s_writerWakeup.set();
+   ThreadJoin(s_writerThread);
+   nxlog_debug_tag(DEBUG_TAG, 2, _T("Alarm writer stopped (") UINT64_FMT _T(" updates coalesced)"), s_coalescedUpdates);
 }
@@ -317,13 +317,120 @@ void NXCORE_EXPORTABLE WriteAuditLogWithValues2(const TCHAR *subsys, bool isSucc
 }
 
 /**
- * Write audit record with old and new values
+ * Check if JSON array can be compared element by element (all elements are objects with integer "id" attribute)
+ */
+static bool IsIdentifiableArray(json_t *array)
+{
+   size_t index;
+   json_t *element;
+   json_array_foreach(array, index, element)
+   {
+      if (!json_is_object(element) || !json_is_integer(json_object_get(element, "id")))
+         return false;
+   }
+   return true;
+}
+
+/**
+ * Convert array of identifiable objects into JSON object with element IDs as keys
+ */
+static json_t *IndexArrayById(json_t *array)
+{
+   json_t *index = json_object();
+   size_t i;
+   json_t *element;
+   json_array_foreach(array, i, element)
+   {
+      char id[32];
+      snprintf(id, 32, INT64_FMTA, static_cast<int64_t>(json_integer_value(json_object_get(element, "id"))));
+      json_object_set(index, id, element);
+   }
+   return index;
+}
+
+static void DiffJsonObjects(json_t *oldValue, json_t *newValue, json_t *oldDiff, json_t *newDiff);
+
+/**
+ * Compare values of given attribute and add changed value to diff objects
+ */
+static void DiffJsonValues(const char *key, json_t *oldValue, json_t *newValue, json_t *oldDiff, json_t *newDiff)
+{
+   if (json_equal(oldValue, newValue))
+      return;
+
+   if (json_is_object(oldValue) && json_is_object(newValue))
+   {
+      json_t *od = json_object();
+      json_t *nd = json_object();
+      DiffJsonObjects(oldValue, newValue, od, nd);
+      json_object_set_new(oldDiff, key, od);
+      json_object_set_new(newDiff, key, nd);
+   }
+   else if (json_is_array(oldValue) && json_is_array(newValue) && IsIdentifiableArray(oldValue) && IsIdentifiableArray(newValue))
+   {
+      // Arrays like DCI list are compared element by element, changed elements are reported by ID
+      json_t *oi = IndexArrayById(oldValue);
+      json_t *ni = IndexArrayById(newValue);
+      json_t *od = json_object();
+      json_t *nd = json_object();
+      DiffJsonObjects(oi, ni, od, nd);
+      json_object_set_new(oldDiff, key, od);
+      json_object_set_new(newDiff, key, nd);
+      json_decref(oi);
+      json_decref(ni);
+   }
+   else
+   {
+      json_object_set(oldDiff, key, oldValue);
+      json_object_set(newDiff, key, newValue);
+   }
+}
+
+/**
+ * Calculate difference between two JSON objects. Only changed attributes are added to diff objects.
+ */
+static void DiffJsonObjects(json_t *oldValue, json_t *newValue, json_t *oldDiff, json_t *newDiff)
+{
+   const char *key;
+   json_t *value;
+   json_object_foreach(oldValue, key, value)
+   {
+      json_t *newElement = json_object_get(newValue, key);
+      if (newElement != nullptr)
+         DiffJsonValues(key, value, newElement, oldDiff, newDiff);
+      else
+         json_object_set(oldDiff, key, value);
+   }
+   json_object_foreach(newValue, key, value)
+   {
+      if (json_object_get(oldValue, key) == nullptr)
+         json_object_set(newDiff, key, value);
+   }
+}
+
+/**
+ * Write audit record with old and new values. Unless full snapshots are enabled by configuration,
+ * only changed attributes are stored when both old and new values are JSON objects.
  */
 void NXCORE_EXPORTABLE WriteAuditLogWithJsonValues2(const TCHAR *subsys, bool isSuccess, uint32_t userId, const TCHAR *workstation,
          session_id_t sessionId, uint32_t objectId, json_t *oldValue, json_t *newValue, const TCHAR *format, va_list args)
 {
-   char *js1 = (oldValue != nullptr) ? json_dumps(oldValue, JSON_SORT_KEYS | JSON_INDENT(3)) : MemCopyStringA("");
-   char *js2 = (newValue != nullptr) ? json_dumps(newValue, JSON_SORT_KEYS | JSON_INDENT(3)) : MemCopyStringA("");
+   char *js1, *js2;
+   if (json_is_object(oldValue) && json_is_object(newValue) && !ConfigReadBoolean(_T("AuditLog.FullObjectSnapshots"), false))
+   {
+      json_t *oldDiff = json_object();
+      json_t *newDiff = json_object();
+      DiffJsonObjects(oldValue, newValue, oldDiff, newDiff);
+      js1 = json_dumps(oldDiff, JSON_SORT_KEYS | JSON_INDENT(3));
+      js2 = json_dumps(newDiff, JSON_SORT_KEYS | JSON_INDENT(3));
+      json_decref(oldDiff);
+      json_decref(newDiff);
+   }
+   else
+   {
+      js1 = (oldValue != nullptr) ? json_dumps(oldValue, JSON_SORT_KEYS | JSON_INDENT(3)) : MemCopyStringA("");
+      js2 = (newValue != nullptr) ? json_dumps(newValue, JSON_SORT_KEYS | JSON_INDENT(3)) : MemCopyStringA("");
+   }
 #ifdef UNICODE
    WCHAR *js1w = WideStringFromUTF8String(js1);
    WCHAR *js2w = WideStringFromUTF8String(js2);
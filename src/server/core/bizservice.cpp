@@ -406,11 +406,11 @@ void BusinessService::changeState(int newState)
  */
 void BusinessService::onChildStateChange()
 {
-   readLockChildList();
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
    int mostCriticalState = STATUS_NORMAL;
-   for(int i = 0; (i < getChildList().size()) && (mostCriticalState != STATUS_CRITICAL); i++)
+   for(int i = 0; (i < childList->size()) && (mostCriticalState != STATUS_CRITICAL); i++)
    {
-      NetObj *o = getChildList().get(i);
+      NetObj *o = childList->get(i);
       if (o->getObjectClass() != OBJECT_BUSINESS_SERVICE)
          continue;
 
@@ -418,7 +418,6 @@ void BusinessService::onChildStateChange()
       if (state > mostCriticalState)
          mostCriticalState = state;
    }
-   unlockChildList();
 
    changeState(mostCriticalState);
 }
@@ -479,10 +478,10 @@ void BusinessService::statusPoll(PollerInfo *poller, ClientSession *session, uin
    // Include state of child services into calculation
    if (mostCriticalState != STATUS_CRITICAL)
    {
-      readLockChildList();
-      for(int i = 0; (i < getChildList().size()) && (mostCriticalState != STATUS_CRITICAL); i++)
+      shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+      for(int i = 0; (i < childList->size()) && (mostCriticalState != STATUS_CRITICAL); i++)
       {
-         NetObj *o = getChildList().get(i);
+         NetObj *o = childList->get(i);
          if (o->getObjectClass() != OBJECT_BUSINESS_SERVICE)
             continue;
 
@@ -490,7 +489,6 @@ void BusinessService::statusPoll(PollerInfo *poller, ClientSession *session, uin
          if (state > mostCriticalState)
             mostCriticalState = state;
       }
-      unlockChildList();
    }
 
    changeState(mostCriticalState);
@@ -770,14 +768,13 @@ shared_ptr<BusinessService> BusinessService::getParentService() const
 {
    shared_ptr<BusinessService> service;
 
-   readLockParentList();
-   for(int i = 0; i < getParentList().size(); i++)
-      if (getParentList().get(i)->getObjectClass() == OBJECT_BUSINESS_SERVICE)
+   shared_ptr<const SharedObjectArray<NetObj>> parentList = getParentList();
+   for(int i = 0; i < parentList->size(); i++)
+      if (parentList->get(i)->getObjectClass() == OBJECT_BUSINESS_SERVICE)
       {
-         service = static_pointer_cast<BusinessService>(getParentList().getShared(i));
+         service = static_pointer_cast<BusinessService>(parentList->getShared(i));
          break;
       }
-   unlockParentList();
    return service;
 }
 
@@ -0,0 +1,309 @@
+/*
+** NetXMS - Network Management System
+** Copyright (C) 2003-2022 Victor Kirhenshtein
+**
+** This program is free software; you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation; either version 2 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+**
+** File: bulkload.cpp
+**
+**/
+
+#include "nxcore.h"
+
+#define DEBUG_TAG _T("obj.init")
+
+/**
+ * Bulk load table definition. Column list must match column order expected by object loading code.
+ */
+struct BulkLoadTableDefinition
+{
+   const TCHAR *table;
+   const TCHAR *keyColumn;
+   const TCHAR *columns;
+   const TCHAR *order;     // Additional sort order within single object (can be null)
+   bool dciKey;            // true if key column contains DCI ID instead of object ID
+};
+
+/**
+ * Bulk load table definitions (in same order as BulkLoadTable enum)
+ */
+static const BulkLoadTableDefinition s_tableDefinitions[BULK_LOAD_TABLE_COUNT] =
+{
+   { _T("object_properties"), _T("object_id"),
+     _T("name,status,is_deleted,inherit_access_rights,last_modified,status_calc_alg,")
+     _T("status_prop_alg,status_fixed_val,status_shift,status_translation,status_single_threshold,")
+     _T("status_thresholds,comments,is_system,location_type,latitude,longitude,location_accuracy,")
+     _T("location_timestamp,guid,map_image,submap_id,country,region,city,district,street_address,")
+     _T("postcode,maint_event_id,state_before_maint,maint_initiator,state,flags,creation_time,alias,")
+     _T("name_on_map,category,comments_source"), nullptr, false },
+   { _T("object_custom_attributes"), _T("object_id"), _T("attr_name,attr_value,flags"), nullptr, false },
+   { _T("dashboard_associations"), _T("object_id"), _T("dashboard_id"), nullptr, false },
+   { _T("object_urls"), _T("object_id"), _T("url_id,url,description"), nullptr, false },
+   { _T("trusted_nodes"), _T("source_object_id"), _T("target_node_id"), nullptr, false },
+   { _T("responsible_users"), _T("object_id"), _T("user_id,tag"), nullptr, false },
+   { _T("acl"), _T("object_id"), _T("user_id,access_rights"), nullptr, false },
+   { _T("items"), _T("node_id"),
+     _T("item_id,name,source,datatype,polling_interval,retention_time,")
+     _T("status,delta_calculation,transformation,template_id,description,")
+     _T("instance,template_item_id,flags,resource_id,")
+     _T("proxy_node,multiplier,units_name,")
+     _T("perftab_settings,system_tag,snmp_port,snmp_raw_value_type,")
+     _T("instd_method,instd_data,instd_filter,samples,comments,guid,npe_name,")
+     _T("instance_retention_time,grace_period_start,related_object,")
+     _T("polling_schedule_type,retention_type,polling_interval_src,retention_time_src,")
+     _T("snmp_version,state_flags"), nullptr, false },
+   { _T("raw_dci_values"), _T("item_id"), _T("raw_value,last_poll_time"), nullptr, true },
+   { _T("thresholds"), _T("item_id"),
+     _T("threshold_id,fire_value,rearm_value,check_function,")
+     _T("check_operation,sample_count,script,event_code,current_state,")
+     _T("rearm_event_code,repeat_interval,current_severity,")
+     _T("last_event_timestamp,match_count,state_before_maint,")
+     _T("last_checked_value"), _T("sequence_number"), true },
+   { _T("dci_access"), _T("dci_id"), _T("user_id"), nullptr, true },
+   { _T("dci_schedules"), _T("item_id"), _T("schedule"), nullptr, true }
+};
+
+/**
+ * Row range for single key in bulk loaded table
+ */
+struct BulkLoadRowRange
+{
+   uint32_t key;
+   int first;
+   int count;
+};
+
+/**
+ * Bulk loaded table - result of full table scan ordered by key column and index of row ranges for each key
+ */
+struct BulkLoadedTable
+{
+   DB_RESULT hResult;
+   StructArray<BulkLoadRowRange> index;   // Sorted by key
+
+   BulkLoadedTable(DB_RESULT r) : index(0, 1024)
+   {
+      hResult = r;
+      int count = DBGetNumRows(hResult);
+      int keyColumn = DBGetColumnCount(hResult) - 1;
+      BulkLoadRowRange *curr = nullptr;
+      for(int i = 0; i < count; i++)
+      {
+         uint32_t key = DBGetFieldULong(hResult, i, keyColumn);
+         if ((curr == nullptr) || (curr->key != key))
+         {
+            curr = index.addPlaceholder();
+            curr->key = key;
+            curr->first = i;
+            curr->count = 0;
+         }
+         curr->count++;
+      }
+   }
+
+   ~BulkLoadedTable()
+   {
+      DBFreeResult(hResult);
+   }
+
+   const BulkLoadRowRange *find(uint32_t key) const
+   {
+      int l = 0, r = index.size() - 1;
+      while(l <= r)
+      {
+         int m = (l + r) / 2;
+         const BulkLoadRowRange *range = index.get(m);
+         if (range->key == key)
+            return range;
+         if (range->key < key)
+            l = m + 1;
+         else
+            r = m - 1;
+      }
+      return nullptr;
+   }
+};
+
+/**
+ * Bulk loaded tables. Set during server startup before objects of one class are loaded
+ * and cleared after they are loaded, so no locking is required for readers.
+ */
+static BulkLoadedTable *s_bulkLoadedTables[BULK_LOAD_TABLE_COUNT];
+
+/**
+ * Read rows of single table for objects selected by given query (in form "table WHERE condition"
+ * as accepted by "SELECT id FROM"). Key column is added as last column.
+ */
+static BulkLoadedTable *ReadTable(DB_HANDLE hdb, const BulkLoadTableDefinition *d, const TCHAR *objectQuery)
+{
+   int64_t startTime = GetCurrentTimeMs();
+
+   StringBuffer query(_T("SELECT "));
+   query.append(d->columns);
+   query.append(_T(','));
+   query.append(d->keyColumn);
+   query.append(_T(" FROM "));
+   query.append(d->table);
+   query.append(_T(" WHERE "));
+   query.append(d->keyColumn);
+   if (d->dciKey)
+   {
+      query.append(_T(" IN (SELECT item_id FROM items WHERE node_id IN (SELECT id FROM "));
+      query.append(objectQuery);
+      query.append(_T(") UNION ALL SELECT item_id FROM dc_tables WHERE node_id IN (SELECT id FROM "));
+      query.append(objectQuery);
+      query.append(_T("))"));
+   }
+   else
+   {
+      query.append(_T(" IN (SELECT id FROM "));
+      query.append(objectQuery);
+      query.append(_T(')'));
+   }
+   query.append(_T(" ORDER BY "));
+   query.append(d->keyColumn);
+   if (d->order != nullptr)
+   {
+      query.append(_T(','));
+      query.append(d->order);
+   }
+
+   DB_RESULT hResult = DBSelect(hdb, query);
+   if (hResult == nullptr)
+   {
+      nxlog_debug_tag(DEBUG_TAG, 3, _T("Bulk load of table %s failed, objects will be loaded using individual queries"), d->table);
+      return nullptr;
+   }
+
+   auto table = new BulkLoadedTable(hResult);
+   nxlog_debug_tag(DEBUG_TAG, 4, _T("Table %s bulk loaded in %u ms (%d rows for %d objects)"), d->table,
+            static_cast<uint32_t>(GetCurrentTimeMs() - startTime), DBGetNumRows(hResult), table->index.size());
+   return table;
+}
+
+/**
+ * Table reader context
+ */
+struct TableReaderContext
+{
+   const TCHAR *objectQuery;
+   VolatileCounter nextTable;
+};
+
+/**
+ * Table reader thread
+ */
+static void TableReaderThread(TableReaderContext *context)
+{
+   DB_HANDLE hdb = DBConnectionPoolAcquireConnection();
+   int i;
+   while((i = InterlockedIncrement(&context->nextTable) - 1) < BULK_LOAD_TABLE_COUNT)
+      s_bulkLoadedTables[i] = ReadTable(hdb, &s_tableDefinitions[i], context->objectQuery);
+   DBConnectionPoolReleaseConnection(hdb);
+}
+
+/**
+ * Read rows of all bulk load tables for objects selected by given query (in form "table WHERE condition"
+ * as accepted by "SELECT id FROM"). Tables are read separately for each object class and released by
+ * BulkLoadEnd after objects of that class are constructed, so only rows for one class are kept in memory
+ * at a time. Only objects selected by given query can be loaded until BulkLoadEnd is called. If given
+ * database handle is not from connection pool (in-memory cache database) tables are read sequentially
+ * using that handle, otherwise up to given number of threads is used.
+ */
+void BulkLoadStart(DB_HANDLE hdb, bool useConnectionPool, int threads, const TCHAR *objectQuery)
+{
+   nxlog_debug_tag(DEBUG_TAG, 5, _T("Bulk loading object configuration tables for objects from %s"), objectQuery);
+   int64_t startTime = GetCurrentTimeMs();
+
+   if (useConnectionPool && (threads > 1))
+   {
+      TableReaderContext context;
+      context.objectQuery = objectQuery;
+      context.nextTable = 0;
+      THREAD readers[BULK_LOAD_TABLE_COUNT];
+      int count = std::min(threads, BULK_LOAD_TABLE_COUNT);
+      for(int i = 0; i < count; i++)
+         readers[i] = ThreadCreateEx(TableReaderThread, &context);
+      for(int i = 0; i < count; i++)
+         ThreadJoin(readers[i]);
+   }
+   else
+   {
+      for(int i = 0; i < BULK_LOAD_TABLE_COUNT; i++)
+         s_bulkLoadedTables[i] = ReadTable(hdb, &s_tableDefinitions[i], objectQuery);
+   }
+
+   nxlog_debug_tag(DEBUG_TAG, 5, _T("Object configuration tables for objects from %s loaded in %u ms"), objectQuery, static_cast<uint32_t>(GetCurrentTimeMs() - startTime));
+}
+
+/**
+ * Release bulk loaded tables. Subsequent object loads will use individual queries.
+ */
+void BulkLoadEnd()
+{
+   for(int i = 0; i < BULK_LOAD_TABLE_COUNT; i++)
+   {
+      delete s_bulkLoadedTables[i];
+      s_bulkLoadedTables[i] = nullptr;
+   }
+}
+
+/**
+ * Select rows for given object from given table. Bulk loaded table is used if available, otherwise
+ * rows are selected from database. Returns false on database failure.
+ */
+bool ObjectRows::select(DB_HANDLE hdb, BulkLoadTable table, uint32_t id)
+{
+   if (m_owner)
+      DBFreeResult(m_hResult);
+   m_hResult = nullptr;
+   m_owner = false;
+   m_first = 0;
+   m_count = 0;
+
+   BulkLoadedTable *bt = s_bulkLoadedTables[static_cast<int>(table)];
+   if (bt != nullptr)
+   {
+      m_hResult = bt->hResult;
+      const BulkLoadRowRange *range = bt->find(id);
+      if (range != nullptr)
+      {
+         m_first = range->first;
+         m_count = range->count;
+      }
+      return true;
+   }
+
+   const BulkLoadTableDefinition *d = &s_tableDefinitions[static_cast<int>(table)];
+   TCHAR query[1024];
+   if (d->order != nullptr)
+      _sntprintf(query, 1024, _T("SELECT %s FROM %s WHERE %s=? ORDER BY %s"), d->columns, d->table, d->keyColumn, d->order);
+   else
+      _sntprintf(query, 1024, _T("SELECT %s FROM %s WHERE %s=?"), d->columns, d->table, d->keyColumn);
+
+   DB_STATEMENT hStmt = DBPrepare(hdb, query);
+   if (hStmt == nullptr)
+      return false;
+
+   DBBind(hStmt, 1, DB_SQLTYPE_INTEGER, id);
+   m_hResult = DBSelectPrepared(hStmt);
+   DBFreeStatement(hStmt);
+   if (m_hResult == nullptr)
+      return false;
+
+   m_owner = true;
+   m_count = DBGetNumRows(m_hResult);
+   return true;
+}
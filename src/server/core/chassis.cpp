@@ -69,10 +69,10 @@ void Chassis::updateRackBinding()
    bool rackFound = false;
    SharedObjectArray<NetObj> deleteList;
 
-   writeLockParentList();
-   for(int i = 0; i < getParentList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> parentList = getParentList();
+   for(int i = 0; i < parentList->size(); i++)
    {
-      NetObj *object = getParentList().get(i);
+      NetObj *object = parentList->get(i);
       if (object->getObjectClass() != OBJECT_RACK)
          continue;
       if (object->getId() == m_rackId)
@@ -80,9 +80,8 @@ void Chassis::updateRackBinding()
          rackFound = true;
          continue;
       }
-      deleteList.add(getParentList().getShared(i));
+      deleteList.add(parentList->getShared(i));
    }
-   unlockParentList();
 
    for(int n = 0; n < deleteList.size(); n++)
    {
@@ -115,17 +114,16 @@ void Chassis::updateControllerBinding()
 {
    bool controllerFound = false;
 
-   readLockParentList();
-   for(int i = 0; i < getParentList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> parentList = getParentList();
+   for(int i = 0; i < parentList->size(); i++)
    {
-      NetObj *object = getParentList().get(i);
+      NetObj *object = parentList->get(i);
       if (object->getId() == m_controllerId)
       {
          controllerFound = true;
          break;
       }
    }
-   unlockParentList();
 
    if ((m_flags & CHF_BIND_UNDER_CONTROLLER) && !controllerFound)
    {
@@ -228,16 +228,15 @@ bool Cluster::saveToDatabase(DB_HANDLE hdb)
          if (hStmt != nullptr)
          {
             DBBind(hStmt, 1, DB_SQLTYPE_INTEGER, m_id);
-            readLockChildList();
-            for(int i = 0; (i < getChildList().size()) && success; i++)
+            shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+            for(int i = 0; (i < childList->size()) && success; i++)
             {
-               if (getChildList().get(i)->getObjectClass() != OBJECT_NODE)
+               if (childList->get(i)->getObjectClass() != OBJECT_NODE)
                   continue;
 
-               DBBind(hStmt, 2, DB_SQLTYPE_INTEGER, getChildList().get(i)->getId());
+               DBBind(hStmt, 2, DB_SQLTYPE_INTEGER, childList->get(i)->getId());
                success = DBExecute(hStmt);
             }
-            unlockChildList();
             DBFreeStatement(hStmt);
          }
          else
@@ -501,12 +500,12 @@ void Cluster::configurationPoll(PollerInfo *poller, ClientSession *pSession, uin
 
    sendPollerMsg(_T("Bind cluster to subnets\r\n"));
    nxlog_debug_tag(DEBUG_TAG_CONF_POLL, 6, _T("ClusterConfPoll(%s): Bind cluster to subnets"), m_name);
-   readLockChildList();
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
    HashSet<uint32_t> parentIds;
    SharedObjectArray<NetObj> addList;
-   for(int i = 0; i < getChildList().size(); i++)
+   for(int i = 0; i < childList->size(); i++)
    {
-      shared_ptr<NetObj> child = getChildList().getShared(i);
+      shared_ptr<NetObj> child = childList->getShared(i);
       unique_ptr<SharedObjectArray<NetObj>> parents = child->getParents(OBJECT_SUBNET);
       for (shared_ptr<NetObj> parent : *parents)
       {
@@ -517,7 +516,6 @@ void Cluster::configurationPoll(PollerInfo *poller, ClientSession *pSession, uin
          }
       }
    }
-   unlockChildList();
    for (auto parent : addList)
    {
       parent->addChild(self());
@@ -580,19 +578,18 @@ void Cluster::statusPoll(PollerInfo *poller, ClientSession *pSession, uint32_t r
    UINT32 modified = 0;
 
    // Create polling list
-	SharedObjectArray<NetObj> pollList(getChildList().size(), 16);
-   readLockChildList();
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+	SharedObjectArray<NetObj> pollList(childList->size(), 16);
    int i;
-   for(i = 0; i < getChildList().size(); i++)
+   for(i = 0; i < childList->size(); i++)
    {
-      shared_ptr<NetObj> object = getChildList().getShared(i);
+      shared_ptr<NetObj> object = childList->getShared(i);
       if ((object->getStatus() != STATUS_UNMANAGED) && object->isPollable() && object->getAsPollable()->isStatusPollAvailable())
       {
          object->getAsPollable()->lockForStatusPoll();
          pollList.add(object);
       }
    }
-   unlockChildList();
 
 	// Perform status poll on all member nodes
    m_pollRequestor = pSession;
@@ -777,14 +774,14 @@ uint32_t Cluster::getResourceOwnerInternal(uint32_t id, const TCHAR *name)
  */
 uint32_t Cluster::collectAggregatedData(DCItem *item, TCHAR *buffer)
 {
-   readLockChildList();
-   ObjectArray<ItemValue> values(getChildList().size(), 32, Ownership::True);
-   for(int i = 0; i < getChildList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   ObjectArray<ItemValue> values(childList->size(), 32, Ownership::True);
+   for(int i = 0; i < childList->size(); i++)
    {
-      if (getChildList().get(i)->getObjectClass() != OBJECT_NODE)
+      if (childList->get(i)->getObjectClass() != OBJECT_NODE)
          continue;
 
-      Node *node = static_cast<Node*>(getChildList().get(i));
+      Node *node = static_cast<Node*>(childList->get(i));
       shared_ptr<DCObject> dco = node->getDCObjectByTemplateId(item->getId(), 0);
       if ((dco != NULL) &&
           (dco->getType() == DCO_TYPE_ITEM) &&
@@ -804,7 +801,6 @@ uint32_t Cluster::collectAggregatedData(DCItem *item, TCHAR *buffer)
          }
       }
    }
-   unlockChildList();
 
    uint32_t rcc = DCE_SUCCESS;
    if (!values.isEmpty())
@@ -843,14 +839,14 @@ uint32_t Cluster::collectAggregatedData(DCItem *item, TCHAR *buffer)
  */
 uint32_t Cluster::collectAggregatedData(DCTable *table, shared_ptr<Table> *result)
 {
-   readLockChildList();
-   SharedObjectArray<Table> values(getChildList().size());
-   for(int i = 0; i < getChildList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   SharedObjectArray<Table> values(childList->size());
+   for(int i = 0; i < childList->size(); i++)
    {
-      if (getChildList().get(i)->getObjectClass() != OBJECT_NODE)
+      if (childList->get(i)->getObjectClass() != OBJECT_NODE)
          continue;
 
-      Node *node = static_cast<Node*>(getChildList().get(i));
+      Node *node = static_cast<Node*>(childList->get(i));
       shared_ptr<DCObject> dco = node->getDCObjectByTemplateId(table->getId(), 0);
       if ((dco != NULL) &&
           (dco->getType() == DCO_TYPE_TABLE) &&
@@ -863,7 +859,6 @@ uint32_t Cluster::collectAggregatedData(DCTable *table, shared_ptr<Table> *resul
             values.add(v);
       }
    }
-   unlockChildList();
 
    uint32_t rcc = DCE_SUCCESS;
    if (!values.isEmpty())
@@ -913,15 +908,14 @@ NXSL_Value *Cluster::getNodesForNXSL(NXSL_VM *vm)
    NXSL_Array *nodes = new NXSL_Array(vm);
    int index = 0;
 
-   readLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
    {
-      if (getChildList().get(i)->getObjectClass() == OBJECT_NODE)
+      if (childList->get(i)->getObjectClass() == OBJECT_NODE)
       {
-         nodes->set(index++, getChildList().get(i)->createNXSLObject(vm));
+         nodes->set(index++, childList->get(i)->createNXSLObject(vm));
       }
    }
-   unlockChildList();
 
    return vm->createValue(nodes);
 }
@@ -485,12 +485,7 @@ void ConditionObject::check()
 
    // Cause parent object(s) to recalculate it's status
    if (iOldStatus != m_status)
-   {
-      readLockParentList();
-      for(int i = 0; i < getParentList().size(); i++)
-         getParentList().get(i)->calculateCompoundStatus();
-      unlockParentList();
-   }
+      propagateStatusToParents();
 }
 
 /**
@@ -621,6 +621,10 @@ static void OnConfigVariableChange(bool isCLOB, const TCHAR *name, const TCHAR *
    {
       UpdateServerFlag(AF_COLLECT_ICMP_STATISTICS, value);
    }
+   else if (!_tcscmp(name, _T("ICMP.MaxPacketRate")))
+   {
+      IcmpSetBatchPacketRate(ConvertToUint32(value, 1000));
+   }
    else if (!_tcscmp(name, _T("ICMP.PingSize")))
    {
       uint32_t size = ConvertToUint32(value, 46);
@@ -47,6 +47,8 @@ void CheckRange(const InetAddressListElement& range, void(*callback)(const InetA
 void ShowSyncerStats(ServerConsole *console);
 void ShowAuthenticationTokens(ServerConsole *console);
 void RunHouseKeeper(ServerConsole *console);
+void ShowHousekeeperStatus(ServerConsole *console);
+void ShowEventDeduplicationStats(ServerConsole *console);
 
 
 /**
@@ -876,10 +878,28 @@ int ProcessConsoleCommand(const TCHAR *pszCmdLine, CONSOLE_CTX pCtx)
          {
             PoolConnectionInfo *c = list->get(i);
             TCHAR accessTime[64];
-            ConsolePrintf(pCtx, _T("%p %s %hs:%d\n"), c->handle, FormatTimestamp(c->lastAccessTime, accessTime), c->srcFile, c->srcLine);
+            uint64_t requests = c->statementCacheHits + c->statementCacheMisses;
+            ConsolePrintf(pCtx, _T("%p %-12s %s %3d%% %hs:%d\n"), c->handle, DBConnectionPoolGetClassName(c->poolClass),
+                     FormatTimestamp(c->lastAccessTime, accessTime),
+                     (requests > 0) ? static_cast<int>(c->statementCacheHits * 100 / requests) : 0, c->srcFile, c->srcLine);
          }
          ConsolePrintf(pCtx, _T("%d database connections in use\n\n"), list->size());
          delete list;
+
+         ConsolePrintf(pCtx, _T("Class        | Size | Base | Max  | Used | Wait | Avg wait | Max wait | Avg conn | Max conn | Avg hold | Max hold\n"));
+         ConsolePrintf(pCtx, _T("-------------+------+------+------+------+------+----------+----------+----------+----------+----------+----------\n"));
+         for(int i = 0; i < DB_POOL_CLASS_COUNT; i++)
+         {
+            DBConnectionPoolClassStats stats;
+            DBConnectionPoolGetClassStats(static_cast<DBConnectionPoolClass>(i), &stats);
+            ConsolePrintf(pCtx, _T("%-12s | %4d | %4d | %4d | %4d | %4d | %8u | %8u | %8u | %8u | %8u | %8u\n"),
+                     DBConnectionPoolGetClassName(static_cast<DBConnectionPoolClass>(i)), stats.size, stats.baseSize, stats.maxSize,
+                     stats.acquired, stats.waiting,
+                     (stats.acquireCount > 0) ? static_cast<uint32_t>(stats.totalWaitTime / stats.acquireCount) : 0, stats.maxWaitTime,
+                     (stats.connectCount > 0) ? static_cast<uint32_t>(stats.totalConnectTime / stats.connectCount) : 0, stats.maxConnectTime,
+                     (stats.releaseCount > 0) ? static_cast<uint32_t>(stats.totalHoldTime / stats.releaseCount) : 0, stats.maxHoldTime);
+         }
+         ConsoleWrite(pCtx, _T("\n"));
       }
       else if (IsCommand(_T("DBSTATS"), szBuffer, 3))
       {
@@ -929,6 +949,8 @@ int ProcessConsoleCommand(const TCHAR *pszCmdLine, CONSOLE_CTX pCtx)
             ConsoleWrite(pCtx, _T("Parallel event processing is disabled\n"));
          }
          delete stats;
+         ConsoleWrite(pCtx, _T("\n"));
+         ShowEventDeduplicationStats(pCtx);
       }
       else if (IsCommand(_T("FDB"), szBuffer, 3))
       {
@@ -1015,6 +1037,7 @@ int ProcessConsoleCommand(const TCHAR *pszCmdLine, CONSOLE_CTX pCtx)
          ConsolePrintf(pCtx, SHOW_FLAG_VALUE(AF_LOG_ALL_SNMP_TRAPS));
          ConsolePrintf(pCtx, SHOW_FLAG_VALUE(AF_ALLOW_TRAP_VARBIND_CONVERSION));
          ConsolePrintf(pCtx, SHOW_FLAG_VALUE(AF_TSDB_DROP_CHUNKS_V2));
+         ConsolePrintf(pCtx, SHOW_FLAG_VALUE(AF_PARTITIONED_TABLES));
          ConsolePrintf(pCtx, SHOW_FLAG_VALUE(AF_SERVER_INITIALIZED));
          ConsolePrintf(pCtx, SHOW_FLAG_VALUE(AF_SHUTDOWN));
          ConsolePrintf(pCtx, _T("\n"));
@@ -1057,6 +1080,10 @@ int ProcessConsoleCommand(const TCHAR *pszCmdLine, CONSOLE_CTX pCtx)
             ConsoleWrite(pCtx, _T("Invalid subcommand\n"));
          }
       }
+      else if (IsCommand(_T("HOUSEKEEPER"), szBuffer, 2))
+      {
+         ShowHousekeeperStatus(pCtx);
+      }
       else if (IsCommand(_T("INDEX"), szBuffer, 1))
       {
          // Get argument
@@ -1780,11 +1807,12 @@ int ProcessConsoleCommand(const TCHAR *pszCmdLine, CONSOLE_CTX pCtx)
             _T("   show dbcp                         - Show active sessions in database connection pool\n")
             _T("   show dbstats                      - Show DB library statistics\n")
             _T("   show discovery queue              - Show content of network discovery queue\n")
-            _T("   show ep                           - Show event processing threads statistics\n")
+            _T("   show ep                           - Show event processing threads and deduplication statistics\n")
             _T("   show fdb <node>                   - Show forwarding database for node\n")
             _T("   show flags                        - Show internal server flags\n")
             _T("   show heap details                 - Show detailed heap information\n")
             _T("   show heap summary                 - Show heap usage summary\n")
+            _T("   show housekeeper                  - Show housekeeper status and progress\n")
             _T("   show index <index>                - Show internal index\n")
             _T("   show modules                      - Show loaded server modules\n")
             _T("   show msgwq                        - Show message wait queues information\n")
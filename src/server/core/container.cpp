@@ -61,15 +61,17 @@ void AbstractContainer::linkObjects()
    if (m_dwChildIdListSize > 0)
    {
       // Find and link child objects
+      SharedObjectArray<NetObj> children(m_dwChildIdListSize, 64);
       for(UINT32 i = 0; i < m_dwChildIdListSize; i++)
       {
          shared_ptr<NetObj> object = FindObjectById(m_pdwChildIdList[i]);
          if (object != nullptr)
-            linkObject(object);
+            children.add(object);
          else
             nxlog_write(NXLOG_ERROR, _T("Inconsistent database: container object %s [%u] has reference to non-existing child object [%u]"),
                      m_name, m_id, m_pdwChildIdList[i]);
       }
+      linkChildObjects(children);
 
       // Cleanup
       MemFreeAndNull(m_pdwChildIdList);
@@ -182,16 +184,16 @@ bool AbstractContainer::saveToDatabase(DB_HANDLE hdb)
    if (success && (m_modified & MODIFY_RELATIONS))
    {
       success = executeQueryOnObject(hdb, _T("DELETE FROM container_members WHERE container_id=?"));
-      readLockChildList();
-      if (success && !getChildList().isEmpty())
+      shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+      if (success && !childList->isEmpty())
       {
          DB_STATEMENT hStmt = DBPrepare(hdb, _T("INSERT INTO container_members (container_id,object_id) VALUES (?,?)"));
          if (hStmt != nullptr)
          {
             DBBind(hStmt, 1, DB_SQLTYPE_INTEGER, m_id);
-            for(int i = 0; (i < getChildList().size()) && success; i++)
+            for(int i = 0; (i < childList->size()) && success; i++)
             {
-               DBBind(hStmt, 2, DB_SQLTYPE_INTEGER, getChildList().get(i)->getId());
+               DBBind(hStmt, 2, DB_SQLTYPE_INTEGER, childList->get(i)->getId());
                success = DBExecute(hStmt);
             }
             DBFreeStatement(hStmt);
@@ -201,7 +203,6 @@ bool AbstractContainer::saveToDatabase(DB_HANDLE hdb)
             success = false;
          }
       }
-      unlockChildList();
    }
 
    return success;
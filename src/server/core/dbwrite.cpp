@@ -316,7 +316,7 @@ static void DBWriteThread()
       if (rq == INVALID_POINTER_VALUE)   // End-of-job indicator
          break;
 
-      DB_HANDLE hdb = DBConnectionPoolAcquireConnection();
+      DB_HANDLE hdb = DBConnectionPoolAcquireConnectionEx(DBConnectionPoolClass::WRITERS);
 
 		if (rq->bindCount == 0)
 		{
@@ -369,7 +369,7 @@ static void IDataWriteThread(IDataWriter *writer)
          idataLock = false;
       }
 
-      DB_HANDLE hdb = DBConnectionPoolAcquireConnection();
+      DB_HANDLE hdb = DBConnectionPoolAcquireConnectionEx(DBConnectionPoolClass::WRITERS);
 		if (DBBegin(hdb))
 		{
 			int count = 0;
@@ -471,7 +471,7 @@ static void IDataWriteThreadSingleTable_Generic(IDataWriter *writer)
          idataLock = false;
       }
 
-      DB_HANDLE hdb = DBConnectionPoolAcquireConnection();
+      DB_HANDLE hdb = DBConnectionPoolAcquireConnectionEx(DBConnectionPoolClass::WRITERS);
       if (DBBegin(hdb))
       {
          int count = 0;
@@ -670,7 +670,7 @@ static void IDataWriteThreadSingleTable_PostgreSQL(IDataWriter *writer)
          ThreadPoolExecute(writerPool,
             [writer, statement, &memoryPool] ()
             {
-               DB_HANDLE hdb = DBConnectionPoolAcquireConnection();
+               DB_HANDLE hdb = DBConnectionPoolAcquireConnectionEx(DBConnectionPoolClass::WRITERS);
                DBQuery(hdb, statement->statement);
                InterlockedAdd(&writer->pendingRequests, -statement->numRecords);
                MemFree(statement->statement);
@@ -683,7 +683,7 @@ static void IDataWriteThreadSingleTable_PostgreSQL(IDataWriter *writer)
          if (idataLock)
             s_idataWriteLock.readLock();
 
-         DB_HANDLE hdb = DBConnectionPoolAcquireConnection();
+         DB_HANDLE hdb = DBConnectionPoolAcquireConnectionEx(DBConnectionPoolClass::WRITERS);
          if (DBBegin(hdb))
          {
             int count = 0;
@@ -754,7 +754,7 @@ static void IDataWriteThreadSingleTable_Oracle(IDataWriter *writer)
          idataLock = false;
       }
 
-      DB_HANDLE hdb = DBConnectionPoolAcquireConnection();
+      DB_HANDLE hdb = DBConnectionPoolAcquireConnectionEx(DBConnectionPoolClass::WRITERS);
       if (DBBegin(hdb))
       {
          int count = 0;
@@ -803,7 +803,7 @@ static void IDataWriteThreadSingleTable_Oracle(IDataWriter *writer)
 
 static void SaveRawDataBatch(DELAYED_RAW_DATA_UPDATE *batch, int maxRecords)
 {
-   DB_HANDLE hdb = DBConnectionPoolAcquireConnection();
+   DB_HANDLE hdb = DBConnectionPoolAcquireConnectionEx(DBConnectionPoolClass::WRITERS);
    if (DBBegin(hdb))
    {
       DB_STATEMENT hStmt = DBPrepare(hdb, _T("UPDATE raw_dci_values SET raw_value=?,transformed_value=?,last_poll_time=?,cache_timestamp=? WHERE item_id=?"), true);
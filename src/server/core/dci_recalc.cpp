@@ -50,7 +50,7 @@ DCIRecalculationJob::~DCIRecalculationJob()
  */
 ServerJobResult DCIRecalculationJob::run()
 {
-   DB_HANDLE hdb = DBConnectionPoolAcquireConnection();
+   DB_HANDLE hdb = DBConnectionPoolAcquireConnectionEx(DBConnectionPoolClass::BACKGROUND);
 
    TCHAR query[256];
    if (g_flags & AF_SINGLE_TABLE_PERF_DATA)
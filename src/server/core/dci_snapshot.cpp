@@ -0,0 +1,378 @@
+/*
+** NetXMS - Network Management System
+** Copyright (C) 2003-2022 Victor Kirhenshtein
+**
+** This program is free software; you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation; either version 2 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+**
+** File: dci_snapshot.cpp
+**
+**/
+
+#include "nxcore.h"
+#include <nxstat.h>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
+
+#define DEBUG_TAG _T("obj.dc.cache")
+
+/**
+ * Snapshot file name (in data directory)
+ */
+#define SNAPSHOT_FILE_NAME    _T("dci_snapshot.dat")
+
+/**
+ * Snapshot file format version
+ */
+#define SNAPSHOT_VERSION      1
+
+/**
+ * Snapshot file header. All numbers are little endian.
+ */
+struct SnapshotHeader
+{
+   char magic[8];
+   uint32_t version;
+   uint32_t recordCount;
+   uint64_t serverId;
+   int64_t timestamp;
+   uint64_t indexOffset;
+};
+
+/**
+ * Snapshot index entry (index is sorted by DCI ID)
+ */
+struct SnapshotIndexEntry
+{
+   uint32_t dciId;
+   uint32_t size;
+   uint64_t offset;
+};
+
+/**
+ * Snapshot file magic
+ */
+static const char s_magic[8] = { 'N', 'X', 'D', 'C', 'I', 'S', 'N', 'P' };
+
+/**
+ * Memory mapped snapshot
+ */
+static const BYTE *s_mapping = nullptr;
+static size_t s_mappingSize = 0;
+static const SnapshotIndexEntry *s_index = nullptr;
+static uint32_t s_indexSize = 0;
+#ifdef _WIN32
+static HANDLE s_fileHandle = INVALID_HANDLE_VALUE;
+static HANDLE s_mappingHandle = nullptr;
+#endif
+
+/**
+ * Get snapshot file name
+ */
+static StringBuffer GetSnapshotFileName()
+{
+   StringBuffer fileName(g_netxmsdDataDir);
+   fileName.append(FS_PATH_SEPARATOR SNAPSHOT_FILE_NAME);
+   return fileName;
+}
+
+/**
+ * Write string to snapshot (16 bit length followed by UTF-8 encoded string)
+ */
+void NXCORE_EXPORTABLE DCISnapshotWriteString(ByteStream *out, const TCHAR *value)
+{
+   char buffer[MAX_DB_STRING * 3];
+   size_t len = tchar_to_utf8(value, -1, buffer, sizeof(buffer));
+   if (len > 0)
+      len--;   // Do not store terminating zero
+   out->writeL(static_cast<uint16_t>(len));
+   out->write(buffer, len);
+}
+
+/**
+ * Read string written by DCISnapshotWriteString
+ */
+TCHAR *DCISnapshotReader::readString(TCHAR *buffer, size_t size)
+{
+   if (!check(2))
+   {
+      buffer[0] = 0;
+      return buffer;
+   }
+   uint16_t len;
+   memcpy(&len, m_curr, 2);
+   m_curr += 2;
+   len = LittleEndianToHost16(len);
+   if (!check(len))
+   {
+      buffer[0] = 0;
+      return buffer;
+   }
+   size_t chars = utf8_to_tchar(reinterpret_cast<const char*>(m_curr), len, buffer, size - 1);
+   buffer[std::min(chars, size - 1)] = 0;
+   m_curr += len;
+   return buffer;
+}
+
+/**
+ * Compare index entries
+ */
+static int CompareIndexEntries(const void *e1, const void *e2)
+{
+   uint32_t id1 = static_cast<const SnapshotIndexEntry*>(e1)->dciId;
+   uint32_t id2 = static_cast<const SnapshotIndexEntry*>(e2)->dciId;
+   return (id1 < id2) ? -1 : ((id1 > id2) ? 1 : 0);
+}
+
+/**
+ * Save state of all DCIs to snapshot file. Should be called on clean shutdown after data collection is stopped.
+ */
+void SaveDCISnapshot()
+{
+   if (!ConfigReadBoolean(_T("DataCollection.CacheSnapshot.Enable"), true))
+      return;
+
+   int64_t startTime = GetCurrentTimeMs();
+   StringBuffer fileName = GetSnapshotFileName();
+   StringBuffer tempFileName(fileName);
+   tempFileName.append(_T(".tmp"));
+
+   FILE *fp = _tfopen(tempFileName, _T("wb"));
+   if (fp == nullptr)
+   {
+      nxlog_write_tag(NXLOG_WARNING, DEBUG_TAG, _T("Cannot create DCI snapshot file %s (%s)"), tempFileName.cstr(), _tcserror(errno));
+      return;
+   }
+
+   SnapshotHeader header;
+   memset(&header, 0, sizeof(header));
+   bool success = (fwrite(&header, sizeof(header), 1, fp) == 1);
+
+   StructArray<SnapshotIndexEntry> index(0, 65536);
+   uint64_t offset = sizeof(header);
+   ByteStream record(4096);
+   unique_ptr<SharedObjectArray<NetObj>> objects = g_idxObjectById.getObjects([] (NetObj *object, void *context) -> bool { return object->isDataCollectionTarget(); }, nullptr);
+   for(int i = 0; (i < objects->size()) && success; i++)
+   {
+      unique_ptr<SharedObjectArray<DCObject>> dcObjects = static_cast<DataCollectionTarget*>(objects->get(i))->getAllDCObjects();
+      for(int j = 0; (j < dcObjects->size()) && success; j++)
+      {
+         DCObject *dci = dcObjects->get(j);
+         if (dci->getType() != DCO_TYPE_ITEM)
+            continue;
+
+         record.clear();
+         static_cast<DCItem*>(dci)->writeSnapshot(&record);
+         success = (fwrite(record.buffer(), record.size(), 1, fp) == 1);
+
+         SnapshotIndexEntry *e = index.addPlaceholder();
+         e->dciId = dci->getId();
+         e->size = static_cast<uint32_t>(record.size());
+         e->offset = offset;
+         offset += record.size();
+      }
+   }
+
+   if (success)
+   {
+      qsort(index.getBuffer(), index.size(), sizeof(SnapshotIndexEntry), CompareIndexEntries);
+      for(int i = 0; i < index.size(); i++)
+      {
+         SnapshotIndexEntry *e = index.get(i);
+         e->dciId = HostToLittleEndian32(e->dciId);
+         e->size = HostToLittleEndian32(e->size);
+         e->offset = HostToLittleEndian64(e->offset);
+      }
+      success = index.isEmpty() || (fwrite(index.getBuffer(), sizeof(SnapshotIndexEntry), index.size(), fp) == static_cast<size_t>(index.size()));
+   }
+
+   if (success)
+   {
+      memcpy(header.magic, s_magic, 8);
+      header.version = HostToLittleEndian32(SNAPSHOT_VERSION);
+      header.recordCount = HostToLittleEndian32(static_cast<uint32_t>(index.size()));
+      header.serverId = HostToLittleEndian64(g_serverId);
+      header.timestamp = HostToLittleEndian64(static_cast<int64_t>(time(nullptr)));
+      header.indexOffset = HostToLittleEndian64(offset);
+      success = (fseek(fp, 0, SEEK_SET) == 0) && (fwrite(&header, sizeof(header), 1, fp) == 1);
+   }
+
+   if (fclose(fp) != 0)
+      success = false;
+
+   if (success)
+   {
+      _tremove(fileName);
+      success = (_trename(tempFileName, fileName) == 0);
+   }
+
+   if (success)
+   {
+      nxlog_debug_tag(DEBUG_TAG, 2, _T("DCI snapshot with %d records saved in %u ms"), index.size(), static_cast<uint32_t>(GetCurrentTimeMs() - startTime));
+   }
+   else
+   {
+      nxlog_write_tag(NXLOG_WARNING, DEBUG_TAG, _T("Error writing DCI snapshot file %s"), fileName.cstr());
+      _tremove(tempFileName);
+   }
+}
+
+/**
+ * Unmap snapshot file
+ */
+static void UnmapSnapshot()
+{
+#ifdef _WIN32
+   if (s_mapping != nullptr)
+      UnmapViewOfFile(s_mapping);
+   if (s_mappingHandle != nullptr)
+      CloseHandle(s_mappingHandle);
+   if (s_fileHandle != INVALID_HANDLE_VALUE)
+      CloseHandle(s_fileHandle);
+   s_mappingHandle = nullptr;
+   s_fileHandle = INVALID_HANDLE_VALUE;
+#else
+   if (s_mapping != nullptr)
+      munmap(const_cast<BYTE*>(s_mapping), s_mappingSize);
+#endif
+   s_mapping = nullptr;
+   s_mappingSize = 0;
+   s_index = nullptr;
+   s_indexSize = 0;
+}
+
+/**
+ * Open and memory map DCI snapshot file. Snapshot is used only if it was created by same server
+ * instance. Individual records are validated when DCI state is restored.
+ */
+bool OpenDCISnapshot()
+{
+   if (!ConfigReadBoolean(_T("DataCollection.CacheSnapshot.Enable"), true))
+      return false;
+
+   StringBuffer fileName = GetSnapshotFileName();
+
+#ifdef _WIN32
+   s_fileHandle = CreateFile(fileName, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+   if (s_fileHandle == INVALID_HANDLE_VALUE)
+      return false;
+   LARGE_INTEGER fileSize;
+   if (!GetFileSizeEx(s_fileHandle, &fileSize) || (fileSize.QuadPart < static_cast<LONGLONG>(sizeof(SnapshotHeader))))
+   {
+      UnmapSnapshot();
+      return false;
+   }
+   s_mappingSize = static_cast<size_t>(fileSize.QuadPart);
+   s_mappingHandle = CreateFileMapping(s_fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+   if (s_mappingHandle == nullptr)
+   {
+      UnmapSnapshot();
+      return false;
+   }
+   s_mapping = static_cast<const BYTE*>(MapViewOfFile(s_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+   if (s_mapping == nullptr)
+   {
+      UnmapSnapshot();
+      return false;
+   }
+#else
+   int fd = _topen(fileName, O_RDONLY);
+   if (fd == -1)
+      return false;
+
+   NX_STAT_STRUCT st;
+   if ((NX_FSTAT(fd, &st) != 0) || (st.st_size < static_cast<off_t>(sizeof(SnapshotHeader))))
+   {
+      _close(fd);
+      return false;
+   }
+   s_mappingSize = static_cast<size_t>(st.st_size);
+   void *mapping = mmap(nullptr, s_mappingSize, PROT_READ, MAP_SHARED, fd, 0);
+   _close(fd);
+   if (mapping == MAP_FAILED)
+   {
+      s_mappingSize = 0;
+      nxlog_debug_tag(DEBUG_TAG, 3, _T("Cannot map DCI snapshot file %s (%s)"), fileName.cstr(), _tcserror(errno));
+      return false;
+   }
+   s_mapping = static_cast<const BYTE*>(mapping);
+#endif
+
+   SnapshotHeader header;
+   memcpy(&header, s_mapping, sizeof(header));
+   uint32_t recordCount = LittleEndianToHost32(header.recordCount);
+   uint64_t indexOffset = LittleEndianToHost64(header.indexOffset);
+   if (memcmp(header.magic, s_magic, 8) ||
+       (LittleEndianToHost32(header.version) != SNAPSHOT_VERSION) ||
+       (LittleEndianToHost64(header.serverId) != g_serverId) ||
+       (indexOffset > s_mappingSize) ||
+       ((s_mappingSize - indexOffset) / sizeof(SnapshotIndexEntry) < recordCount))
+   {
+      nxlog_debug_tag(DEBUG_TAG, 2, _T("DCI snapshot file %s is invalid or was created by different server"), fileName.cstr());
+      UnmapSnapshot();
+      return false;
+   }
+
+   s_index = reinterpret_cast<const SnapshotIndexEntry*>(s_mapping + indexOffset);
+   s_indexSize = recordCount;
+   nxlog_debug_tag(DEBUG_TAG, 2, _T("Using DCI snapshot created at %s (%u records)"),
+            FormatTimestamp(static_cast<time_t>(LittleEndianToHost64(header.timestamp))).cstr(), recordCount);
+   return true;
+}
+
+/**
+ * Find snapshot record for given DCI. Returns pointer to record data or nullptr if not found.
+ */
+const BYTE *FindDCISnapshotRecord(uint32_t dciId, size_t *size)
+{
+   if (s_index == nullptr)
+      return nullptr;
+
+   int64_t l = 0, r = static_cast<int64_t>(s_indexSize) - 1;
+   while(l <= r)
+   {
+      int64_t m = (l + r) / 2;
+      SnapshotIndexEntry e;
+      memcpy(&e, &s_index[m], sizeof(SnapshotIndexEntry));  // Index may not be aligned
+      uint32_t id = LittleEndianToHost32(e.dciId);
+      if (id == dciId)
+      {
+         uint64_t offset = LittleEndianToHost64(e.offset);
+         *size = LittleEndianToHost32(e.size);
+         if ((offset > s_mappingSize) || (s_mappingSize - offset < *size))
+            return nullptr;
+         return s_mapping + offset;
+      }
+      if (id < dciId)
+         l = m + 1;
+      else
+         r = m - 1;
+   }
+   return nullptr;
+}
+
+/**
+ * Close DCI snapshot and delete snapshot file, so it will not be used again after unclean shutdown
+ */
+void CloseDCISnapshot()
+{
+   if (s_mapping == nullptr)
+      return;
+
+   UnmapSnapshot();
+   _tremove(GetSnapshotFileName());
+   nxlog_debug_tag(DEBUG_TAG, 2, _T("DCI snapshot closed"));
+}
@@ -138,19 +138,13 @@ DCItem::DCItem(DB_HANDLE hdb, DB_RESULT hResult, int row, const shared_ptr<DataC
    m_startTime = (useStartupDelay && (effectivePollingInterval >= 10)) ? time(nullptr) + rand() % (effectivePollingInterval / 2) : 0;
 
    // Load last raw value from database
-	TCHAR szQuery[256];
-   _sntprintf(szQuery, 256, _T("SELECT raw_value,last_poll_time FROM raw_dci_values WHERE item_id=%d"), m_id);
-   DB_RESULT hTempResult = DBSelect(hdb, szQuery);
-   if (hTempResult != nullptr)
+   ObjectRows rawValue;
+   if (rawValue.select(hdb, BulkLoadTable::RAW_DCI_VALUES, m_id) && (rawValue.size() > 0))
    {
-      if (DBGetNumRows(hTempResult) > 0)
-      {
-		   TCHAR szBuffer[MAX_DB_STRING];
-         m_prevRawValue = DBGetField(hTempResult, 0, 0, szBuffer, MAX_DB_STRING);
-         m_tPrevValueTimeStamp = DBGetFieldULong(hTempResult, 0, 1);
-         m_lastPoll = m_lastValueTimestamp = m_tPrevValueTimeStamp;
-      }
-      DBFreeResult(hTempResult);
+      TCHAR szBuffer[MAX_DB_STRING];
+      m_prevRawValue = DBGetField(rawValue.getResult(), rawValue.begin(), 0, szBuffer, MAX_DB_STRING);
+      m_tPrevValueTimeStamp = DBGetFieldULong(rawValue.getResult(), rawValue.begin(), 1);
+      m_lastPoll = m_lastValueTimestamp = m_tPrevValueTimeStamp;
    }
 
    loadAccessList(hdb);
@@ -261,34 +255,17 @@ void DCItem::clearCache()
  */
 bool DCItem::loadThresholdsFromDB(DB_HANDLE hdb)
 {
-   bool result = false;
-
-	DB_STATEMENT hStmt = DBPrepare(hdb,
-	           _T("SELECT threshold_id,fire_value,rearm_value,check_function,")
-              _T("check_operation,sample_count,script,event_code,current_state,")
-              _T("rearm_event_code,repeat_interval,current_severity,")
-				  _T("last_event_timestamp,match_count,state_before_maint,")
-				  _T("last_checked_value FROM thresholds WHERE item_id=? ")
-              _T("ORDER BY sequence_number"));
-	if (hStmt != nullptr)
-	{
-		DBBind(hStmt, 1, DB_SQLTYPE_INTEGER, m_id);
-		DB_RESULT hResult = DBSelectPrepared(hStmt);
-		if (hResult != nullptr)
-		{
-			int count = DBGetNumRows(hResult);
-			if (count > 0)
-			{
-				m_thresholds = new ObjectArray<Threshold>(count, 8, Ownership::True);
-				for(int i = 0; i < count; i++)
-					m_thresholds->add(new Threshold(hResult, i, this));
-			}
-			DBFreeResult(hResult);
-			result = true;
-		}
-		DBFreeStatement(hStmt);
-	}
-   return result;
+   ObjectRows rows;
+   if (!rows.select(hdb, BulkLoadTable::THRESHOLDS, m_id))
+      return false;
+
+   if (rows.size() > 0)
+   {
+      m_thresholds = new ObjectArray<Threshold>(rows.size(), 8, Ownership::True);
+      for(int i = rows.begin(); i < rows.end(); i++)
+         m_thresholds->add(new Threshold(rows.getResult(), i, this));
+   }
+   return true;
 }
 
 /**
@@ -1185,9 +1162,140 @@ void DCItem::updateCacheSizeInternal(bool allowLoad)
  */
 void DCItem::loadCache()
 {
+   size_t size;
+   const BYTE *record = FindDCISnapshotRecord(m_id, &size);
+   if (record != nullptr)
+   {
+      DCISnapshotReader reader(record, size);
+      if (restoreFromSnapshot(&reader))
+         nxlog_debug_tag(_T("obj.dc.cache"), 7, _T("DCItem::loadCache(dci=\"%s\", node=%s [%u]): state restored from snapshot (%u values)"),
+                  m_name.cstr(), getOwnerName(), m_ownerId, m_cacheSize);
+      else
+         nxlog_debug_tag(_T("obj.dc.cache"), 7, _T("DCItem::loadCache(dci=\"%s\", node=%s [%u]): snapshot record is invalid or outdated"),
+                  m_name.cstr(), getOwnerName(), m_ownerId);
+   }
    updateCacheSize();
 }
 
+/**
+ * Write DCI runtime state (value cache, previous raw value, and threshold state) to snapshot
+ */
+void DCItem::writeSnapshot(ByteStream *out)
+{
+   lock();
+
+   out->writeL(m_id);
+   out->writeL(m_ownerId);
+   out->writeL(static_cast<int64_t>(m_tPrevValueTimeStamp));
+   DCISnapshotWriteString(out, m_prevRawValue.getString());
+
+   // Cache is saved only if fully loaded, otherwise it will be loaded from database on next start
+   uint32_t count = m_bCacheLoaded ? m_cacheSize : 0;
+   out->writeL(count);
+   for(uint32_t i = 0; i < count; i++)
+   {
+      out->writeL(static_cast<int64_t>(m_ppValueCache[i]->getTimeStamp()));
+      DCISnapshotWriteString(out, m_ppValueCache[i]->getString());
+   }
+
+   // Each threshold is written as separate block, so thresholds deleted before next start can be skipped
+   uint32_t thresholdCount = (m_thresholds != nullptr) ? m_thresholds->size() : 0;
+   out->writeL(thresholdCount);
+   if (thresholdCount > 0)
+   {
+      ByteStream block(256);
+      for(uint32_t i = 0; i < thresholdCount; i++)
+      {
+         Threshold *t = m_thresholds->get(i);
+         block.clear();
+         t->writeSnapshot(&block);
+         out->writeL(t->getId());
+         out->writeL(static_cast<uint32_t>(block.size()));
+         out->write(block.buffer(), block.size());
+      }
+   }
+
+   unlock();
+}
+
+/**
+ * Restore DCI runtime state from snapshot. Returns false if snapshot record is invalid, belongs
+ * to different object, or is older than state stored in database.
+ */
+bool DCItem::restoreFromSnapshot(DCISnapshotReader *reader)
+{
+   TCHAR prevRawValue[MAX_DB_STRING], buffer[MAX_DB_STRING];
+   uint32_t id = reader->readUInt32();
+   uint32_t ownerId = reader->readUInt32();
+   time_t prevValueTimestamp = static_cast<time_t>(reader->readInt64());
+   reader->readString(prevRawValue, MAX_DB_STRING);
+   if (reader->isError() || (id != m_id) || (ownerId != m_ownerId))
+      return false;
+
+   lock();
+
+   // Database contains newer value - server was running after snapshot was created
+   if (prevValueTimestamp < m_tPrevValueTimeStamp)
+   {
+      unlock();
+      return false;
+   }
+
+   uint32_t count = reader->readUInt32();
+   ItemValue **cache = (count > 0) ? MemAllocArrayNoInit<ItemValue*>(count) : nullptr;
+   uint32_t loaded;
+   for(loaded = 0; loaded < count; loaded++)
+   {
+      time_t timestamp = static_cast<time_t>(reader->readInt64());
+      reader->readString(buffer, MAX_DB_STRING);
+      if (reader->isError())
+         break;
+      cache[loaded] = new ItemValue(buffer, timestamp);
+   }
+   if (reader->isError())
+   {
+      for(uint32_t i = 0; i < loaded; i++)
+         delete cache[i];
+      MemFree(cache);
+      unlock();
+      return false;
+   }
+
+   if (prevValueTimestamp != 0)
+   {
+      m_prevRawValue = prevRawValue;
+      m_tPrevValueTimeStamp = prevValueTimestamp;
+      m_lastPoll = m_lastValueTimestamp = prevValueTimestamp;
+   }
+
+   if (count > 0)
+   {
+      for(uint32_t i = 0; i < m_cacheSize; i++)
+         delete m_ppValueCache[i];
+      MemFree(m_ppValueCache);
+      m_ppValueCache = cache;
+      m_cacheSize = count;
+      m_bCacheLoaded = true;
+   }
+
+   uint32_t thresholdCount = reader->readUInt32();
+   for(uint32_t i = 0; (i < thresholdCount) && !reader->isError(); i++)
+   {
+      uint32_t thresholdId = reader->readUInt32();
+      uint32_t size = reader->readUInt32();
+      const BYTE *block = reader->readBytes(size);
+      Threshold *t = (block != nullptr) ? getThresholdById(thresholdId) : nullptr;
+      if (t != nullptr)
+      {
+         DCISnapshotReader thresholdReader(block, size);
+         t->restoreFromSnapshot(&thresholdReader);
+      }
+   }
+
+   unlock();
+   return true;
+}
+
 /**
  * Reload cache from database
  */
@@ -188,6 +188,42 @@ void Threshold::createId()
    m_id = CreateUniqueId(IDG_THRESHOLD);
 }
 
+/**
+ * Write threshold runtime state to DCI snapshot
+ */
+void Threshold::writeSnapshot(ByteStream *out) const
+{
+   out->write(static_cast<BYTE>(m_isReached ? 1 : 0));
+   out->write(static_cast<BYTE>(m_wasReachedBeforeMaint ? 1 : 0));
+   out->write(m_currentSeverity);
+   out->writeL(static_cast<uint32_t>(m_numMatches));
+   out->writeL(static_cast<int64_t>(m_lastEventTimestamp));
+   DCISnapshotWriteString(out, m_lastCheckValue.getString());
+}
+
+/**
+ * Restore threshold runtime state from DCI snapshot
+ */
+void Threshold::restoreFromSnapshot(DCISnapshotReader *reader)
+{
+   bool isReached = (reader->readByte() != 0);
+   bool wasReachedBeforeMaint = (reader->readByte() != 0);
+   BYTE currentSeverity = reader->readByte();
+   int numMatches = static_cast<int>(reader->readUInt32());
+   time_t lastEventTimestamp = static_cast<time_t>(reader->readInt64());
+   TCHAR lastCheckValue[MAX_DB_STRING];
+   reader->readString(lastCheckValue, MAX_DB_STRING);
+   if (reader->isError())
+      return;
+
+   m_isReached = isReached;
+   m_wasReachedBeforeMaint = wasReachedBeforeMaint;
+   m_currentSeverity = currentSeverity;
+   m_numMatches = numMatches;
+   m_lastEventTimestamp = lastEventTimestamp;
+   m_lastCheckValue = lastCheckValue;
+}
+
 /**
  * Save threshold to database
  */
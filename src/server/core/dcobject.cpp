@@ -335,23 +335,15 @@ bool DCObject::loadAccessList(DB_HANDLE hdb)
 {
    m_accessList.clear();
 
-   DB_STATEMENT hStmt = DBPrepare(hdb, _T("SELECT user_id FROM dci_access WHERE dci_id=?"));
-   if (hStmt == nullptr)
+   ObjectRows rows;
+   if (!rows.select(hdb, BulkLoadTable::DCI_ACCESS, m_id))
       return false;
 
-   DBBind(hStmt, 1, DB_SQLTYPE_INTEGER, m_id);
-   DB_RESULT hResult = DBSelectPrepared(hStmt);
-   if (hResult != nullptr)
+   for(int i = rows.begin(); i < rows.end(); i++)
    {
-      int count = DBGetNumRows(hResult);
-      for(int i = 0; i < count; i++)
-      {
-         m_accessList.add(DBGetFieldULong(hResult, i, 0));
-      }
-      DBFreeResult(hResult);
+      m_accessList.add(DBGetFieldULong(rows.getResult(), i, 0));
    }
-   DBFreeStatement(hStmt);
-   return hResult != nullptr;
+   return true;
 }
 
 /**
@@ -363,27 +355,19 @@ bool DCObject::loadCustomSchedules(DB_HANDLE hdb)
    if (m_pollingScheduleType != DC_POLLING_SCHEDULE_ADVANCED)
 		return true;
 
-   DB_STATEMENT hStmt = DBPrepare(hdb, _T("SELECT schedule FROM dci_schedules WHERE item_id=?"));
-   if (hStmt == nullptr)
+   ObjectRows rows;
+   if (!rows.select(hdb, BulkLoadTable::DCI_SCHEDULES, m_id))
       return false;
 
-   DBBind(hStmt, 1, DB_SQLTYPE_INTEGER, m_id);
-   DB_RESULT hResult = DBSelectPrepared(hStmt);
-   if (hResult != nullptr)
+   if (rows.size() > 0)
    {
-      int count = DBGetNumRows(hResult);
-      if (count > 0)
+      m_schedules = new StringList();
+      for(int i = rows.begin(); i < rows.end(); i++)
       {
-         m_schedules = new StringList();
-         for(int i = 0; i < count; i++)
-         {
-            m_schedules->addPreallocated(DBGetField(hResult, i, 0, nullptr, 0));
-         }
+         m_schedules->addPreallocated(DBGetField(rows.getResult(), i, 0, nullptr, 0));
       }
-      DBFreeResult(hResult);
    }
-   DBFreeStatement(hStmt);
-	return hResult != nullptr;
+	return true;
 }
 
 /**
@@ -279,31 +279,14 @@ void DataCollectionOwner::loadItemsFromDB(DB_HANDLE hdb)
 {
    bool useStartupDelay = ConfigReadBoolean(_T("DataCollection.StartupDelay"), false);
 
-	DB_STATEMENT hStmt = DBPrepare(hdb,
-	           _T("SELECT item_id,name,source,datatype,polling_interval,retention_time,")
-              _T("status,delta_calculation,transformation,template_id,description,")
-              _T("instance,template_item_id,flags,resource_id,")
-              _T("proxy_node,multiplier,units_name,")
-	           _T("perftab_settings,system_tag,snmp_port,snmp_raw_value_type,")
-				  _T("instd_method,instd_data,instd_filter,samples,comments,guid,npe_name,")
-				  _T("instance_retention_time,grace_period_start,related_object,")
-				  _T("polling_schedule_type,retention_type,polling_interval_src,retention_time_src,")
-				  _T("snmp_version,state_flags FROM items WHERE node_id=?"));
-	if (hStmt != NULL)
-	{
-		DBBind(hStmt, 1, DB_SQLTYPE_INTEGER, m_id);
-		DB_RESULT hResult = DBSelectPrepared(hStmt);
-		if (hResult != NULL)
-		{
-			int count = DBGetNumRows(hResult);
-			for(int i = 0; i < count; i++)
-				m_dcObjects.add(make_shared<DCItem>(hdb, hResult, i, self(), useStartupDelay));
-			DBFreeResult(hResult);
-		}
-		DBFreeStatement(hStmt);
-	}
+   ObjectRows rows;
+   if (rows.select(hdb, BulkLoadTable::ITEMS, m_id))
+   {
+      for(int i = rows.begin(); i < rows.end(); i++)
+         m_dcObjects.add(make_shared<DCItem>(hdb, rows.getResult(), i, self(), useStartupDelay));
+   }
 
-	hStmt = DBPrepare(hdb,
+	DB_STATEMENT hStmt = DBPrepare(hdb,
 	           _T("SELECT item_id,template_id,template_item_id,name,")
 				  _T("description,flags,source,snmp_port,polling_interval,retention_time,")
               _T("status,system_tag,resource_id,proxy_node,perftab_settings,")
@@ -891,16 +874,15 @@ bool DataCollectionOwner::applyToTarget(const shared_ptr<DataCollectionTarget>&
  */
 void DataCollectionOwner::queueUpdate()
 {
-   readLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
    {
-      NetObj *object = getChildList().get(i);
+      NetObj *object = childList->get(i);
       if (object->isDataCollectionTarget())
       {
          g_templateUpdateQueue.put(new TemplateUpdateTask(self(), object->getId(), APPLY_TEMPLATE, false));
       }
    }
-   unlockChildList();
 }
 
 /**
@@ -1067,16 +1049,12 @@ void DataCollectionOwner::updateFromImport(ConfigEntry *config)
 }
 
 /**
- * Serialize object to JSON
+ * Serialize object to JSON. Data collection objects are not included (use ObjectToJson to serialize them as well).
  */
 json_t *DataCollectionOwner::toJson()
 {
    json_t *root = super::toJson();
 
-   readLockDciAccess();
-   json_object_set_new(root, "dcObjects", json_object_array(m_dcObjects));
-   unlockDciAccess();
-
    lockProperties();
    json_object_set_new(root, "flags", json_integer(m_flags));
    unlockProperties();
@@ -1182,3 +1160,26 @@ void DataCollectionOwner::getEventReferences(uint32_t eventCode, ObjectArray<Eve
    }
    unlockDciAccess();
 }
+
+/**
+ * Serialize data collection objects to JSON array
+ */
+json_t *DataCollectionOwner::dcObjectsToJson()
+{
+   readLockDciAccess();
+   json_t *dcObjects = json_object_array(m_dcObjects);
+   unlockDciAccess();
+   return dcObjects;
+}
+
+/**
+ * Serialize object to JSON. Data collection objects are included only if includeDataCollection is true,
+ * so operations which cannot change data collection configuration can avoid serializing large templates in full.
+ */
+json_t NXCORE_EXPORTABLE *ObjectToJson(NetObj *object, bool includeDataCollection)
+{
+   json_t *root = object->toJson();
+   if (includeDataCollection && (object->isDataCollectionTarget() || (object->getObjectClass() == OBJECT_TEMPLATE)))
+      json_object_set_new(root, "dcObjects", static_cast<DataCollectionOwner*>(object)->dcObjectsToJson());
+   return root;
+}
@@ -133,6 +133,8 @@ DCTable::DCTable(const DCTable *src, bool shadowCopy) : DCObject(src, shadowCopy
 	{
 	   m_lastValue = make_shared<Table>(*src->m_lastValue);
 	}
+   m_keyframeTimestamp = 0;
+   m_keyframeDistance = 0;
 }
 
 /**
@@ -146,6 +148,8 @@ DCTable::DCTable(UINT32 id, const TCHAR *name, int source, BYTE scheduleType, co
 {
 	m_columns = new ObjectArray<DCTableColumn>(8, 8, Ownership::True);
    m_thresholds = new ObjectArray<DCTableThreshold>(0, 4, Ownership::True);
+   m_keyframeTimestamp = 0;
+   m_keyframeDistance = 0;
 }
 
 /**
@@ -222,6 +226,9 @@ DCTable::DCTable(DB_HANDLE hdb, DB_RESULT hResult, int row, const shared_ptr<Dat
    m_thresholds = new ObjectArray<DCTableThreshold>(0, 4, Ownership::True);
    loadThresholds(hdb);
 
+   m_keyframeTimestamp = 0;
+   m_keyframeDistance = 0;
+
    updateTimeIntervalsInternal();
 }
 
@@ -259,6 +266,9 @@ DCTable::DCTable(ConfigEntry *config, const shared_ptr<DataCollectionOwner>& own
    {
       m_thresholds = new ObjectArray<DCTableThreshold>(0, 4, Ownership::True);
    }
+
+   m_keyframeTimestamp = 0;
+   m_keyframeDistance = 0;
 }
 
 /**
@@ -372,6 +382,26 @@ bool DCTable::processNewValue(time_t timestamp, const shared_ptr<Table>& value,
 	uint32_t nodeId = owner->getId();
    bool save = (m_retentionType != DC_RETENTION_NONE);
 
+   // Select reference sample for delta encoding. Every g_tableValueKeyframeInterval-th
+   // sample (or sample with different number of rows) is stored in full.
+   shared_ptr<Table> keyframe;
+   time_t keyframeTimestamp = 0;
+   if (save && g_tableValueBinaryFormat && (g_tableValueKeyframeInterval > 1))
+   {
+      if ((m_keyframe != nullptr) && (++m_keyframeDistance < g_tableValueKeyframeInterval) &&
+          (m_keyframe->getNumRows() == value->getNumRows()) && (timestamp > m_keyframeTimestamp))
+      {
+         keyframe = m_keyframe;
+         keyframeTimestamp = m_keyframeTimestamp;
+      }
+      else
+      {
+         m_keyframe = value;
+         m_keyframeTimestamp = timestamp;
+         m_keyframeDistance = 0;
+      }
+   }
+
    unlock();
 
 	// Save data to database
@@ -412,7 +442,8 @@ bool DCTable::processNewValue(time_t timestamp, const shared_ptr<Table>& value,
 	   {
 		   DBBind(hStmt, 1, DB_SQLTYPE_INTEGER, tableId);
 		   DBBind(hStmt, 2, DB_SQLTYPE_INTEGER, (INT32)timestamp);
-		   DBBind(hStmt, 3, DB_SQLTYPE_TEXT, DB_CTYPE_UTF8_STRING, value->createPackedXML(), DB_BIND_DYNAMIC);
+		   DBBind(hStmt, 3, DB_SQLTYPE_TEXT, DB_CTYPE_UTF8_STRING,
+		            g_tableValueBinaryFormat ? value->createPackedBinary(keyframe.get(), keyframeTimestamp) : value->createPackedXML(), DB_BIND_DYNAMIC);
 	      success = DBExecute(hStmt);
 		   DBFreeStatement(hStmt);
 	   }
@@ -423,6 +454,15 @@ bool DCTable::processNewValue(time_t timestamp, const shared_ptr<Table>& value,
          DBRollback(hdb);
 
 	   DBConnectionPoolReleaseConnection(hdb);
+
+	   // Do not use sample that was not saved as reference for next samples
+	   if (!success && (keyframe == nullptr))
+	   {
+	      lock();
+	      if (m_keyframe == value)
+	         m_keyframe.reset();
+	      unlock();
+	   }
    }
    if ((g_offlineDataRelevanceTime <= 0) || (timestamp > (time(nullptr) - g_offlineDataRelevanceTime)))
       checkThresholds(value.get());
@@ -1381,12 +1421,90 @@ void DCTable::loadCache()
       DBConnectionPoolReleaseConnection(hdb);
    }
 
+   Table *value = nullptr;
+   if (encodedTable != nullptr)
+   {
+      TableValueDecoder decoder(*this);
+      value = decoder.decode(encodedTable);
+   }
+
    lock();
-   if (encodedTable != nullptr && m_lastValue == nullptr) //m_lastValue can be changed while query is executed
+   if ((value != nullptr) && (m_lastValue == nullptr)) //m_lastValue can be changed while query is executed
    {
-      m_lastValue = shared_ptr<Table>(Table::createFromPackedXML(encodedTable));
+      m_lastValue = shared_ptr<Table>(value);
       m_lastValueTimestamp = timestamp;
+      value = nullptr;
    }
    unlock();
+   delete value;
    MemFree(encodedTable);
 }
+
+/**
+ * Load reference sample with given timestamp from database
+ */
+shared_ptr<Table> TableValueDecoder::loadReference(time_t timestamp)
+{
+   TCHAR query[256];
+   if (g_flags & AF_SINGLE_TABLE_PERF_DATA)
+   {
+      if (g_dbSyntax == DB_SYNTAX_TSDB)
+         _sntprintf(query, 256, _T("SELECT tdata_value FROM tdata_sc_%s WHERE item_id=? AND tdata_timestamp=to_timestamp(?)"), DCObject::getStorageClassName(m_storageClass));
+      else
+         _tcscpy(query, _T("SELECT tdata_value FROM tdata WHERE item_id=? AND tdata_timestamp=?"));
+   }
+   else
+   {
+      _sntprintf(query, 256, _T("SELECT tdata_value FROM tdata_%u WHERE item_id=? AND tdata_timestamp=?"), m_ownerId);
+   }
+
+   shared_ptr<Table> reference;
+   DB_HANDLE hdb = DBConnectionPoolAcquireConnection();
+   DB_STATEMENT hStmt = DBPrepare(hdb, query);
+   if (hStmt != nullptr)
+   {
+      DBBind(hStmt, 1, DB_SQLTYPE_INTEGER, m_dciId);
+      DBBind(hStmt, 2, DB_SQLTYPE_INTEGER, static_cast<int32_t>(timestamp));
+      DB_RESULT hResult = DBSelectPrepared(hStmt);
+      if (hResult != nullptr)
+      {
+         if (DBGetNumRows(hResult) > 0)
+         {
+            char *encodedTable = DBGetFieldUTF8(hResult, 0, 0, nullptr, 0);
+            if (encodedTable != nullptr)
+            {
+               // Reference samples are never delta encoded themselves
+               reference = shared_ptr<Table>(Table::createFromPackedData(encodedTable));
+               MemFree(encodedTable);
+            }
+         }
+         DBFreeResult(hResult);
+      }
+      DBFreeStatement(hStmt);
+   }
+   DBConnectionPoolReleaseConnection(hdb);
+
+   if (reference == nullptr)
+      nxlog_debug_tag(_T("dc"), 5, _T("TableValueDecoder: cannot load reference sample for DCI [%u] at ") INT64_FMT, m_dciId, static_cast<int64_t>(timestamp));
+   return reference;
+}
+
+/**
+ * Decode table value in any supported format. Returns nullptr if value cannot be decoded
+ * (for example, when reference sample for delta encoded value was deleted). If list of
+ * columns is given, only those columns (and instance columns) will be decoded.
+ */
+Table *TableValueDecoder::decode(const char *encodedValue, const StringList *columns)
+{
+   time_t referenceTimestamp = Table::getPackedDataReference(encodedValue);
+   if (referenceTimestamp == 0)
+      return Table::createFromPackedData(encodedValue, nullptr, columns);
+
+   // Consecutive samples usually share same reference, so last one is cached
+   if ((m_reference == nullptr) || (m_referenceTimestamp != referenceTimestamp))
+   {
+      m_reference = loadReference(referenceTimestamp);
+      m_referenceTimestamp = referenceTimestamp;
+   }
+   return (m_reference != nullptr) ? Table::createFromPackedData(encodedValue, m_reference.get(), columns) : nullptr;
+}
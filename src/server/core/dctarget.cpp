@@ -295,37 +295,50 @@ void DataCollectionTarget::calculateDciCutoffTimes(time_t *cutoffTimeIData, time
 }
 
 /**
- * Clean expired DCI data
+ * Calculate oldest DCI cutoff times for dropping expired partitions of collected data tables
  */
-void DataCollectionTarget::cleanDCIData(DB_HANDLE hdb)
+void DataCollectionTarget::calculateOldestDciCutoffTimes(time_t now, time_t *cutoffTimeIData, time_t *cutoffTimeTData)
 {
-   StringBuffer queryItems = _T("DELETE FROM idata");
-   if (g_flags & AF_SINGLE_TABLE_PERF_DATA)
+   readLockDciAccess();
+   for(int i = 0; i < m_dcObjects.size(); i++)
    {
-      queryItems.append(_T(" WHERE node_id="));
-      queryItems.append(m_id);
-      queryItems.append(_T(" AND "));
+      DCObject *o = m_dcObjects.get(i);
+      if (!o->isDataStorageEnabled())
+         continue;
+
+      time_t *cutoffTime = (o->getType() == DCO_TYPE_ITEM) ? cutoffTimeIData : cutoffTimeTData;
+      time_t t = now - o->getEffectiveRetentionTime() * 86400;
+      if ((*cutoffTime == 0) || (*cutoffTime > t))
+         *cutoffTime = t;
    }
-   else
+   unlockDciAccess();
+}
+
+/**
+ * Clean expired DCI data. If collected data tables are partitioned, partition cutoff times should be set to
+ * cutoff times used for dropping expired partitions, and DCIs with same or longer retention time will be skipped
+ * (remaining records will be removed together with partition).
+ */
+void DataCollectionTarget::cleanDCIData(DB_HANDLE hdb, time_t partitionCutoffIData, time_t partitionCutoffTData)
+{
+   // In single table mode retention time shortcut cannot be used because table contains data for all objects
+   bool singleTable = ((g_flags & AF_SINGLE_TABLE_PERF_DATA) != 0);
+
+   StringBuffer queryItems = _T("DELETE FROM idata");
+   if (!singleTable)
    {
       queryItems.append(_T('_'));
       queryItems.append(m_id);
-      queryItems.append(_T(" WHERE "));
    }
+   queryItems.append(_T(" WHERE "));
 
    StringBuffer queryTables = _T("DELETE FROM tdata");
-   if (g_flags & AF_SINGLE_TABLE_PERF_DATA)
-   {
-      queryTables.append(_T(" WHERE node_id="));
-      queryTables.append(m_id);
-      queryTables.append(_T(" AND "));
-   }
-   else
+   if (!singleTable)
    {
       queryTables.append(_T('_'));
       queryTables.append(m_id);
-      queryTables.append(_T(" WHERE "));
    }
+   queryTables.append(_T(" WHERE "));
 
    int itemCount = 0;
    int tableCount = 0;
@@ -334,8 +347,8 @@ void DataCollectionTarget::cleanDCIData(DB_HANDLE hdb)
    readLockDciAccess();
 
    // Check if all DCIs has same retention time
-   bool sameRetentionTimeItems = true;
-   bool sameRetentionTimeTables = true;
+   bool sameRetentionTimeItems = !singleTable;
+   bool sameRetentionTimeTables = !singleTable;
    int retentionTimeItems = -1;
    int retentionTimeTables = -1;
    for(int i = 0; (i < m_dcObjects.size()) && (sameRetentionTimeItems || sameRetentionTimeTables); i++)
@@ -376,25 +389,30 @@ void DataCollectionTarget::cleanDCIData(DB_HANDLE hdb)
          if (!o->isDataStorageEnabled())
             continue;   // Ignore "do not store" objects
 
+         time_t cutoffTime = now - o->getEffectiveRetentionTime() * 86400;
          if ((o->getType() == DCO_TYPE_ITEM) && !sameRetentionTimeItems)
          {
+            if (cutoffTime <= partitionCutoffIData)
+               continue;
             if (itemCount > 0)
                queryItems.append(_T(" OR "));
             queryItems.append(_T("(item_id="));
             queryItems.append(o->getId());
             queryItems.append(_T(" AND idata_timestamp<"));
-            queryItems.append(static_cast<int64_t>(now - o->getEffectiveRetentionTime() * 86400));
+            queryItems.append(static_cast<int64_t>(cutoffTime));
             queryItems.append(_T(')'));
             itemCount++;
          }
          else if ((o->getType() == DCO_TYPE_TABLE) && !sameRetentionTimeTables)
          {
+            if (cutoffTime <= partitionCutoffTData)
+               continue;
             if (tableCount > 0)
                queryTables.append(_T(" OR "));
             queryTables.append(_T("(item_id="));
             queryTables.append(o->getId());
             queryTables.append(_T(" AND tdata_timestamp<"));
-            queryTables.append(static_cast<int64_t>(now - o->getEffectiveRetentionTime() * 86400));
+            queryTables.append(static_cast<int64_t>(cutoffTime));
             queryTables.append(_T(')'));
             tableCount++;
          }
@@ -972,18 +990,17 @@ shared_ptr<NetObj> DataCollectionTarget::objectFromParameter(const TCHAR *param)
 
    // Find child object with requested ID or name
    shared_ptr<NetObj> object;
-   readLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
    {
-      NetObj *curr = getChildList().get(i);
+      NetObj *curr = childList->get(i);
       if (((objectId == 0) && (!_tcsicmp(curr->getName(), arg))) ||
           (objectId == curr->getId()))
       {
-         object = getChildList().getShared(i);
+         object = childList->getShared(i);
          break;
       }
    }
-   unlockChildList();
    return object;
 }
 
@@ -2516,16 +2533,15 @@ NXSL_Array *DataCollectionTarget::getTemplatesForNXSL(NXSL_VM *vm)
    NXSL_Array *parents = new NXSL_Array(vm);
    int index = 0;
 
-   readLockParentList();
-   for(int i = 0; i < getParentList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> parentList = getParentList();
+   for(int i = 0; i < parentList->size(); i++)
    {
-      NetObj *object = getParentList().get(i);
+      NetObj *object = parentList->get(i);
       if ((object->getObjectClass() == OBJECT_TEMPLATE) && object->isTrustedNode(m_id))
       {
          parents->set(index++, object->createNXSLObject(vm));
       }
    }
-   unlockParentList();
 
    return parents;
 }
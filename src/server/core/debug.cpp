@@ -186,6 +186,78 @@ DataCollectionError GetThreadPoolStat(ThreadPoolStat stat, const TCHAR *param, T
    return DCE_SUCCESS;
 }
 
+/**
+ * Get database connection pool stat (for internal DCI)
+ */
+DataCollectionError GetDBConnectionPoolStat(DBConnectionPoolStat stat, const TCHAR *param, TCHAR *value)
+{
+   TCHAR className[64];
+   if (!AgentGetParameterArg(param, 1, className, 64))
+      return DCE_NOT_SUPPORTED;
+
+   DBConnectionPoolClass poolClass;
+   if (!DBConnectionPoolClassFromName(className, &poolClass))
+      return DCE_NOT_SUPPORTED;
+
+   int bucket = 0;
+   if ((stat == DBCP_STAT_WAIT_TIME_HISTOGRAM) || (stat == DBCP_STAT_HOLD_TIME_HISTOGRAM))
+   {
+      TCHAR bucketText[16];
+      if (!AgentGetParameterArg(param, 2, bucketText, 16))
+         return DCE_NOT_SUPPORTED;
+      TCHAR *eptr;
+      bucket = _tcstol(bucketText, &eptr, 10);
+      if ((*eptr != 0) || (bucket < 0) || (bucket >= DB_POOL_HISTOGRAM_SIZE))
+         return DCE_NOT_SUPPORTED;
+   }
+
+   DBConnectionPoolClassStats stats;
+   DBConnectionPoolGetClassStats(poolClass, &stats);
+
+   switch(stat)
+   {
+      case DBCP_STAT_SIZE:
+         ret_int(value, stats.size);
+         break;
+      case DBCP_STAT_ACQUIRED:
+         ret_int(value, stats.acquired);
+         break;
+      case DBCP_STAT_WAITING:
+         ret_int(value, stats.waiting);
+         break;
+      case DBCP_STAT_WAIT_COUNT:
+         ret_uint64(value, stats.waitCount);
+         break;
+      case DBCP_STAT_AVERAGE_WAIT_TIME:
+         ret_uint(value, (stats.acquireCount > 0) ? static_cast<uint32_t>(stats.totalWaitTime / stats.acquireCount) : 0);
+         break;
+      case DBCP_STAT_MAX_WAIT_TIME:
+         ret_uint(value, stats.maxWaitTime);
+         break;
+      case DBCP_STAT_WAIT_TIME_HISTOGRAM:
+         ret_uint64(value, stats.waitTimeHistogram[bucket]);
+         break;
+      case DBCP_STAT_AVERAGE_CONNECT_TIME:
+         ret_uint(value, (stats.connectCount > 0) ? static_cast<uint32_t>(stats.totalConnectTime / stats.connectCount) : 0);
+         break;
+      case DBCP_STAT_MAX_CONNECT_TIME:
+         ret_uint(value, stats.maxConnectTime);
+         break;
+      case DBCP_STAT_AVERAGE_HOLD_TIME:
+         ret_uint(value, (stats.releaseCount > 0) ? static_cast<uint32_t>(stats.totalHoldTime / stats.releaseCount) : 0);
+         break;
+      case DBCP_STAT_MAX_HOLD_TIME:
+         ret_uint(value, stats.maxHoldTime);
+         break;
+      case DBCP_STAT_HOLD_TIME_HISTOGRAM:
+         ret_uint64(value, stats.holdTimeHistogram[bucket]);
+         break;
+      default:
+         return DCE_NOT_SUPPORTED;
+   }
+   return DCE_SUCCESS;
+}
+
 /**
  * Write process coredump
  */
@@ -28,7 +28,8 @@
 /**
  * Default event policy rule constructor
  */
-EPRule::EPRule(uint32_t id) : m_actions(0, 16, Ownership::True)
+EPRule::EPRule(uint32_t id) : m_actions(0, 16, Ownership::True),
+         m_filterScriptVMPool(make_shared<NXSL_VMPool>(GetServerScriptLibrary())), m_actionScriptVMPool(make_shared<NXSL_VMPool>(GetServerScriptLibrary()))
 {
    m_id = id;
    m_guid = uuid::generate();
@@ -50,7 +51,8 @@ EPRule::EPRule(uint32_t id) : m_actions(0, 16, Ownership::True)
 /**
  * Create rule from config entry
  */
-EPRule::EPRule(const ConfigEntry& config) : m_actions(0, 16, Ownership::True)
+EPRule::EPRule(const ConfigEntry& config) : m_actions(0, 16, Ownership::True),
+         m_filterScriptVMPool(make_shared<NXSL_VMPool>(GetServerScriptLibrary())), m_actionScriptVMPool(make_shared<NXSL_VMPool>(GetServerScriptLibrary()))
 {
    m_id = 0;
    m_guid = config.getSubEntryValueAsUUID(_T("guid"));
@@ -220,7 +222,8 @@ EPRule::EPRule(const ConfigEntry& config) : m_actions(0, 16, Ownership::True)
  * rule_id,rule_guid,flags,comments,alarm_message,alarm_severity,alarm_key,script,
  * alarm_timeout,alarm_timeout_event,rca_script_name,alarm_impact
  */
-EPRule::EPRule(DB_RESULT hResult, int row) : m_actions(0, 16, Ownership::True)
+EPRule::EPRule(DB_RESULT hResult, int row) : m_actions(0, 16, Ownership::True),
+         m_filterScriptVMPool(make_shared<NXSL_VMPool>(GetServerScriptLibrary())), m_actionScriptVMPool(make_shared<NXSL_VMPool>(GetServerScriptLibrary()))
 {
    m_id = DBGetFieldULong(hResult, row, 0);
    m_guid = DBGetFieldGUID(hResult, row, 1);
@@ -268,7 +271,8 @@ EPRule::EPRule(DB_RESULT hResult, int row) : m_actions(0, 16, Ownership::True)
 /**
  * Construct event policy rule from NXCP message
  */
-EPRule::EPRule(const NXCPMessage& msg) : m_actions(0, 16, Ownership::True)
+EPRule::EPRule(const NXCPMessage& msg) : m_actions(0, 16, Ownership::True),
+         m_filterScriptVMPool(make_shared<NXSL_VMPool>(GetServerScriptLibrary())), m_actionScriptVMPool(make_shared<NXSL_VMPool>(GetServerScriptLibrary()))
 {
    m_flags = msg.getFieldAsUInt32(VID_FLAGS);
    m_id = msg.getFieldAsUInt32(VID_RULE_ID);
@@ -660,7 +664,7 @@ void EPRule::executeActionScript(Event *event) const
          nxlog_debug_tag(DEBUG_TAG, 6, _T("Event references DCI [%u] but it cannot be found in event source object"), event->getDciId());
    }
 
-   ScriptVMHandle vm = CreateServerScriptVM(m_actionScript, object, dciInfo);
+   ScriptVMHandle vm = CreatePooledServerScriptVM(m_actionScript, m_actionScriptVMPool, object, dciInfo);
    if (!vm.isValid())
    {
       if (vm.failureReason() != ScriptVMFailureReason::SCRIPT_IS_EMPTY)
@@ -708,7 +712,7 @@ bool EPRule::matchScript(Event *event) const
       else
          nxlog_debug_tag(DEBUG_TAG, 6, _T("Event references DCI [%u] but it cannot be found in event source object"), event->getDciId());
    }
-   ScriptVMHandle vm = CreateServerScriptVM(m_filterScript, FindObjectById(event->getSourceId()), dciInfo);
+   ScriptVMHandle vm = CreatePooledServerScriptVM(m_filterScript, m_filterScriptVMPool, FindObjectById(event->getSourceId()), dciInfo);
    if (!vm.isValid())
    {
       if (vm.failureReason() != ScriptVMFailureReason::SCRIPT_IS_EMPTY)
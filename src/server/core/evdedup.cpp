@@ -0,0 +1,307 @@
+/*
+** NetXMS - Network Management System
+** Copyright (C) 2003-2022 Victor Kirhenshtein
+**
+** This program is free software; you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation; either version 2 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+**
+** File: evdedup.cpp
+**
+**/
+
+#include "nxcore.h"
+
+#define DEBUG_TAG _T("event.dedup")
+
+/**
+ * Number of deduplication shards
+ */
+#define DEDUP_SHARDS    32
+
+/**
+ * Deduplication key. Events are considered identical if they have same code, source, DCI, and parameters.
+ */
+struct DeduplicationKey
+{
+   uint64_t parametersHash;
+   uint32_t code;
+   uint32_t sourceId;
+   uint32_t dciId;
+   uint32_t reserved;   // Should be always 0, prevents uninitialized padding in key
+};
+
+/**
+ * Deduplication window. First event in window is passed to processing immediately, identical events
+ * received within window are suppressed, and last of them is posted at the end of window with
+ * parameter "repeatCount" set to number of suppressed events.
+ */
+struct DeduplicationWindow
+{
+   time_t end;
+   uint32_t repeatCount;
+   Event *lastEvent;
+
+   DeduplicationWindow(time_t _end)
+   {
+      end = _end;
+      repeatCount = 0;
+      lastEvent = nullptr;
+   }
+
+   ~DeduplicationWindow()
+   {
+      delete lastEvent;
+   }
+
+   Event *takeSummaryEvent()
+   {
+      Event *event = lastEvent;
+      if (event != nullptr)
+      {
+         TCHAR buffer[32];
+         event->addParameter(_T("repeatCount"), IntegerToString(repeatCount, buffer));
+         lastEvent = nullptr;
+      }
+      repeatCount = 0;
+      return event;
+   }
+};
+
+/**
+ * Deduplication shard
+ */
+struct DeduplicationShard
+{
+   Mutex lock;
+   HashMap<DeduplicationKey, DeduplicationWindow> windows;
+
+   DeduplicationShard() : lock(MutexType::FAST), windows(Ownership::True) {}
+};
+
+/**
+ * Deduplication state
+ */
+static DeduplicationShard *s_shards = nullptr;
+static bool s_enabled = false;
+static uint32_t s_windowSize = 30;
+static int s_maxWindowsPerShard = 2048;
+static StringSet s_ignoredParameters;
+static VolatileCounter64 s_suppressedEvents = 0;
+static VolatileCounter64 s_summaryEvents = 0;
+static VolatileCounter64 s_overflowEvents = 0;
+
+/**
+ * Calculate hash of event parameters (FNV-1a)
+ */
+static uint64_t HashEventParameters(const Event *event)
+{
+   uint64_t hash = _ULL(14695981039346656037);
+   for(int i = 0; i < event->getParametersCount(); i++)
+   {
+      const TCHAR *name = event->getParameterName(i);
+      if ((name != nullptr) && (*name != 0))
+      {
+         if (s_ignoredParameters.contains(name))
+            continue;
+         for(const TCHAR *p = name; *p != 0; p++)
+            hash = (hash ^ static_cast<uint64_t>(*p)) * _ULL(1099511628211);
+      }
+      hash = (hash ^ _ULL(0xFF)) * _ULL(1099511628211);   // Separator between name and value
+      for(const TCHAR *p = event->getParameter(i, _T("")); *p != 0; p++)
+         hash = (hash ^ static_cast<uint64_t>(*p)) * _ULL(1099511628211);
+      hash = (hash ^ _ULL(0xFE)) * _ULL(1099511628211);   // Separator between parameters
+   }
+   return hash;
+}
+
+/**
+ * Check event for duplicates. Returns true if event was consumed by deduplication stage and should not be queued by caller.
+ */
+bool DeduplicateEvent(Event *event)
+{
+   if (!s_enabled)
+      return false;
+
+   DeduplicationKey key;
+   key.parametersHash = HashEventParameters(event);
+   key.code = event->getCode();
+   key.sourceId = event->getSourceId();
+   key.dciId = event->getDciId();
+   key.reserved = 0;
+
+   DeduplicationShard *shard = &s_shards[(key.parametersHash ^ key.code ^ (static_cast<uint64_t>(key.sourceId) << 8) ^ key.dciId) % DEDUP_SHARDS];
+   time_t now = time(nullptr);
+   Event *summary = nullptr;
+
+   shard->lock.lock();
+   DeduplicationWindow *window = shard->windows.get(key);
+   if (window != nullptr)
+   {
+      if (now < window->end)
+      {
+         window->repeatCount++;
+         delete window->lastEvent;
+         window->lastEvent = event;
+         shard->lock.unlock();
+         InterlockedIncrement64(&s_suppressedEvents);
+         return true;
+      }
+
+      // Window expired but not flushed yet - report suppressed events before starting new window
+      summary = window->takeSummaryEvent();
+      window->end = now + s_windowSize;
+   }
+   else if (shard->windows.size() < s_maxWindowsPerShard)
+   {
+      shard->windows.set(key, new DeduplicationWindow(now + s_windowSize));
+   }
+   else
+   {
+      InterlockedIncrement64(&s_overflowEvents);
+   }
+   shard->lock.unlock();
+
+   if (summary != nullptr)
+   {
+      InterlockedIncrement64(&s_summaryEvents);
+      g_eventQueue.put(summary);
+   }
+   return false;
+}
+
+/**
+ * Compare summary events by event ID
+ */
+static int CompareSummaryEvents(const Event **e1, const Event **e2)
+{
+   uint64_t id1 = (*e1)->getId(), id2 = (*e2)->getId();
+   return (id1 < id2) ? -1 : ((id1 > id2) ? 1 : 0);
+}
+
+/**
+ * Flush expired deduplication windows. If force is set to true all windows will be flushed.
+ * Summary events are posted in original order (by event ID), so related events for same
+ * source (like threshold reached and rearmed) are not reordered.
+ */
+static void FlushDeduplicationWindows(bool force)
+{
+   ObjectArray<Event> summaries(0, 64, Ownership::False);
+   time_t now = time(nullptr);
+   for(int i = 0; i < DEDUP_SHARDS; i++)
+   {
+      DeduplicationShard *shard = &s_shards[i];
+      shard->lock.lock();
+      auto it = shard->windows.begin();
+      while(it.hasNext())
+      {
+         DeduplicationWindow *window = it.next();
+         if (force || (window->end <= now))
+         {
+            Event *summary = window->takeSummaryEvent();
+            if (summary != nullptr)
+               summaries.add(summary);
+            it.remove();
+         }
+      }
+      shard->lock.unlock();
+   }
+
+   summaries.sort(CompareSummaryEvents);
+   for(int i = 0; i < summaries.size(); i++)
+      g_eventQueue.put(summaries.get(i));
+   InterlockedAdd64(&s_summaryEvents, summaries.size());
+
+   if (!summaries.isEmpty())
+      nxlog_debug_tag(DEBUG_TAG, 6, _T("%d summary events posted"), summaries.size());
+}
+
+/**
+ * Scheduled task for flushing expired deduplication windows
+ */
+static void ScheduledFlush()
+{
+   if (!s_enabled)
+      return;
+   FlushDeduplicationWindows(false);
+   ThreadPoolScheduleRelative(g_mainThreadPool, 1000, ScheduledFlush);
+}
+
+/**
+ * Initialize event deduplication
+ */
+void InitEventDeduplication()
+{
+   if (!ConfigReadBoolean(_T("Events.Deduplication.Enable"), false))
+   {
+      nxlog_debug_tag(DEBUG_TAG, 2, _T("Event deduplication is disabled"));
+      return;
+   }
+
+   s_windowSize = ConfigReadULong(_T("Events.Deduplication.Window"), 30);
+   if (s_windowSize == 0)
+      s_windowSize = 1;
+   s_maxWindowsPerShard = std::max(ConfigReadInt(_T("Events.Deduplication.MaxEntries"), 65536) / DEDUP_SHARDS, 1);
+
+   TCHAR *ignoredParameters = ConfigReadStr(_T("Events.Deduplication.IgnoredParameters"), _T(""));
+   if (ignoredParameters != nullptr)
+   {
+      s_ignoredParameters.splitAndAdd(ignoredParameters, _T(","));
+      MemFree(ignoredParameters);
+   }
+
+   s_shards = new DeduplicationShard[DEDUP_SHARDS];
+   s_enabled = true;
+   ThreadPoolScheduleRelative(g_mainThreadPool, 1000, ScheduledFlush);
+   nxlog_debug_tag(DEBUG_TAG, 2, _T("Event deduplication enabled (window %u seconds, %d entries per shard)"), s_windowSize, s_maxWindowsPerShard);
+}
+
+/**
+ * Shutdown event deduplication. Summary events for all open windows are posted to event queue,
+ * so this function should be called before event processor shutdown.
+ */
+void ShutdownEventDeduplication()
+{
+   if (!s_enabled)
+      return;
+
+   s_enabled = false;
+   FlushDeduplicationWindows(true);
+   nxlog_debug_tag(DEBUG_TAG, 2, _T("Event deduplication stopped"));
+}
+
+/**
+ * Show event deduplication statistics
+ */
+void ShowEventDeduplicationStats(ServerConsole *console)
+{
+   if (!s_enabled)
+   {
+      console->print(_T("Event deduplication is disabled\n"));
+      return;
+   }
+
+   int activeWindows = 0;
+   for(int i = 0; i < DEDUP_SHARDS; i++)
+   {
+      s_shards[i].lock.lock();
+      activeWindows += s_shards[i].windows.size();
+      s_shards[i].lock.unlock();
+   }
+
+   console->printf(_T("Event deduplication window ...: %u seconds\n"), s_windowSize);
+   console->printf(_T("Active windows ...............: %d\n"), activeWindows);
+   console->printf(_T("Suppressed events ............: ") INT64_FMT _T("\n"), static_cast<int64_t>(s_suppressedEvents));
+   console->printf(_T("Summary events ...............: ") INT64_FMT _T("\n"), static_cast<int64_t>(s_summaryEvents));
+   console->printf(_T("Not deduplicated (overflow) ..: ") INT64_FMT _T("\n"), static_cast<int64_t>(s_overflowEvents));
+}
@@ -29,6 +29,7 @@
 void GetSNMPTrapsEventReferences(uint32_t eventCode, ObjectArray<EventReference>* eventReferences);
 void GetSyslogEventReferences(uint32_t eventCode, ObjectArray<EventReference>* eventReferences);
 void GetWindowsEventLogEventReferences(uint32_t eventCode, ObjectArray<EventReference>* eventReferences);
+bool DeduplicateEvent(Event *event);
 
 /**
  * Event processing queue
@@ -980,8 +981,10 @@ static bool RealPostEvent(ObjectQueue<Event> *queue, uint64_t *eventId, uint32_t
          }
       }
 
-      // Add new event to queue
-      queue->put(event);
+      // Add new event to queue. Events posted to main queue pass deduplication stage first (except events
+      // which ID was requested by caller, because caller may refer to that event later).
+      if ((queue != &g_eventQueue) || (eventId != nullptr) || !DeduplicateEvent(event))
+         queue->put(event);
 
       success = true;
    }
@@ -31,6 +31,7 @@
  * Reset script error counter
  */
 void ResetScriptErrorEventCounter();
+void InitEventDeduplication();
 
 /**
  * Number of processed events since start
@@ -268,7 +269,7 @@ static void ProcessEvent(Event *event, int processorId)
          sourceObject = g_entireNetwork;
    }
 
-   ScriptVMHandle vm = CreateServerScriptVM(_T("Hook::EventProcessor"), sourceObject);
+   ScriptVMHandle vm = CreatePooledServerScriptVM(_T("Hook::EventProcessor"), sourceObject);
    if (vm.isValid())
    {
       nxlog_debug_tag(DEBUG_TAG, 7, _T("Running event processor hook script"));
@@ -593,6 +594,7 @@ THREAD StartEventProcessor()
    memset(s_dbQueryFailedTimestamps, 0, sizeof(s_dbQueryFailedTimestamps));
    s_threadLogger = ThreadCreateEx(EventLogger);
    s_threadStormDetector = ThreadCreateEx(EventStormDetector);
+   InitEventDeduplication();
    ThreadPoolScheduleRelative(g_mainThreadPool, 600000, ResetScriptErrorEventCounter);
    return (ConfigReadInt(_T("Events.Processor.PoolSize"), 1) > 1) ? ThreadCreateEx(ParallelEventProcessor) : ThreadCreateEx(SerialEventProcessor);
 }
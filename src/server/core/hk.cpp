@@ -24,11 +24,23 @@
 
 #define DEBUG_TAG _T("housekeeper")
 
+/**
+ * Externals
+ */
+bool IsPartitionedTable(const TCHAR *table);
+void CreateTablePartitions(DB_HANDLE hdb);
+int DropExpiredPartitions(DB_HANDLE hdb, const TCHAR *table, time_t cutoffTime);
+
 /**
  * Housekeeper wakeup condition
  */
 static Condition s_wakeupCondition(false);
 
+/**
+ * Housekeeper shutdown condition (used for waking up all throttled threads)
+ */
+static Condition s_shutdownCondition(true);
+
 /**
  * Housekeeper run flag
  */
@@ -45,6 +57,49 @@ static bool s_shutdown = false;
 static size_t s_throttlingHighWatermark = 250000;
 static size_t s_throttlingLowWatermark = 50000;
 
+/**
+ * Housekeeper progress
+ */
+static Mutex s_progressLock(MutexType::FAST);
+static const TCHAR *s_stage = _T("idle");
+static int s_stageWorkTotal = 0;
+static int s_stageWorkDone = 0;
+static time_t s_stageStartTime = 0;
+static time_t s_cycleStartTime = 0;
+static time_t s_lastProgressReport = 0;
+
+/**
+ * Set current housekeeper stage
+ */
+static void SetStage(const TCHAR *stage, int workTotal = 0)
+{
+   s_progressLock.lock();
+   s_stage = stage;
+   s_stageWorkTotal = workTotal;
+   s_stageWorkDone = 0;
+   s_stageStartTime = time(nullptr);
+   s_lastProgressReport = s_stageStartTime;
+   s_progressLock.unlock();
+   nxlog_debug_tag(DEBUG_TAG, 3, _T("Stage \"%s\" started"), stage);
+}
+
+/**
+ * Update progress of current housekeeper stage
+ */
+static void UpdateStageProgress()
+{
+   s_progressLock.lock();
+   s_stageWorkDone++;
+   time_t now = time(nullptr);
+   if (now - s_lastProgressReport >= 60)
+   {
+      nxlog_debug_tag(DEBUG_TAG, 3, _T("Stage \"%s\": %d of %d completed (%d%%)"), s_stage, s_stageWorkDone, s_stageWorkTotal,
+               (s_stageWorkTotal > 0) ? s_stageWorkDone * 100 / s_stageWorkTotal : 0);
+      s_lastProgressReport = now;
+   }
+   s_progressLock.unlock();
+}
+
 /**
  * Throttle housekeeper if needed. Returns false if shutdown time has arrived and housekeeper process should be aborted.
  */
@@ -57,7 +112,7 @@ bool ThrottleHousekeeper()
    nxlog_debug_tag(DEBUG_TAG, 1, _T("Housekeeper paused (queue size %d, high watermark %d, low watermark %d)"), qsize, s_throttlingHighWatermark, s_throttlingLowWatermark);
    while((qsize >= s_throttlingLowWatermark) && !s_shutdown)
    {
-      s_wakeupCondition.wait(30000);
+      s_shutdownCondition.wait(30000);
       qsize = g_dbWriterQueue.size() + static_cast<size_t>(GetIDataWriterQueueSize() + GetRawDataWriterQueueSize());
    }
    nxlog_debug_tag(DEBUG_TAG, 1, _T("Housekeeper resumed (queue size %d)"), qsize);
@@ -249,6 +304,14 @@ static bool DeleteExpiredLogRecords(const TCHAR *logName, const TCHAR *logTable,
 
    nxlog_debug_tag(DEBUG_TAG, 2, _T("Clearing %s (retention time %d days)"), logName, retentionTime);
    retentionTime *= 86400; // Convert days to seconds
+   if (IsPartitionedTable(logTable))
+   {
+      // Remaining expired records will be deleted from oldest remaining partition by DELETE statement
+      DropExpiredPartitions(hdb, logTable, cycleStartTime - retentionTime);
+      if (!ThrottleHousekeeper())
+         return false;
+   }
+
    TCHAR query[256];
    if (g_dbSyntax == DB_SYNTAX_TSDB)
       BuildDropChunksQuery(logTable, cycleStartTime - retentionTime, query, sizeof(query) / sizeof(TCHAR));
@@ -259,6 +322,108 @@ static bool DeleteExpiredLogRecords(const TCHAR *logName, const TCHAR *logTable,
    return ThrottleHousekeeper();
 }
 
+/**
+ * Collected data cleanup context
+ */
+struct DataCleanupContext
+{
+   SharedObjectArray<NetObj> *objects;
+   VolatileCounter nextObject;
+   time_t partitionCutoffIData;
+   time_t partitionCutoffTData;
+};
+
+/**
+ * Process objects from cleanup context until all objects are processed
+ */
+static void RunDataCleanup(DataCleanupContext *context, DB_HANDLE hdb)
+{
+   while(!s_shutdown)
+   {
+      int index = InterlockedIncrement(&context->nextObject) - 1;
+      if (index >= context->objects->size())
+         break;
+      static_cast<DataCollectionTarget*>(context->objects->get(index))->cleanDCIData(hdb, context->partitionCutoffIData, context->partitionCutoffTData);
+      UpdateStageProgress();
+      ThrottleHousekeeper();
+   }
+}
+
+/**
+ * Collected data cleanup worker
+ */
+static void DataCleanupWorker(DataCleanupContext *context)
+{
+   DB_HANDLE hdb = DBConnectionPoolAcquireConnectionEx(DBConnectionPoolClass::HOUSEKEEPING);
+   RunDataCleanup(context, hdb);
+   DBConnectionPoolReleaseConnection(hdb);
+}
+
+/**
+ * Clean collected data using DELETE statements. If collected data tables are partitioned, expired partitions
+ * are dropped first, and only DCIs with retention time shorter than longest one are processed by DELETE
+ * statements, which then touch only limited set of remaining partitions.
+ */
+static void CleanCollectedData(DB_HANDLE hdb)
+{
+   SharedObjectArray<NetObj> objects(1024, 1024);
+   g_idxAccessPointById.getObjects(&objects);
+   g_idxChassisById.getObjects(&objects);
+   g_idxClusterById.getObjects(&objects);
+   g_idxMobileDeviceById.getObjects(&objects);
+   g_idxNodeById.getObjects(&objects);
+   g_idxSensorById.getObjects(&objects);
+
+   DataCleanupContext context;
+   context.objects = &objects;
+   context.nextObject = 0;
+   context.partitionCutoffIData = 0;
+   context.partitionCutoffTData = 0;
+
+   if (IsPartitionedTable(_T("idata")))
+   {
+      SetStage(_T("Drop expired partitions"));
+      time_t now = time(nullptr);
+      for(int i = 0; i < objects.size(); i++)
+         static_cast<DataCollectionTarget*>(objects.get(i))->calculateOldestDciCutoffTimes(now, &context.partitionCutoffIData, &context.partitionCutoffTData);
+
+      time_t defaultCutoffTime = now - DCObject::m_defaultRetentionTime * 86400;
+      if (context.partitionCutoffIData == 0)
+         context.partitionCutoffIData = defaultCutoffTime;
+      if (context.partitionCutoffTData == 0)
+         context.partitionCutoffTData = defaultCutoffTime;
+
+      nxlog_debug_tag(DEBUG_TAG, 4, _T("Partition cutoff time: idata=") INT64_FMT _T(", tdata=") INT64_FMT,
+               static_cast<int64_t>(context.partitionCutoffIData), static_cast<int64_t>(context.partitionCutoffTData));
+      DropExpiredPartitions(hdb, _T("idata"), context.partitionCutoffIData);
+      DropExpiredPartitions(hdb, _T("tdata"), context.partitionCutoffTData);
+      if (!ThrottleHousekeeper())
+         return;
+   }
+
+   // Housekeeper thread works as one of cleanup workers using its own connection, so number of
+   // threads is limited by size of housekeeping connection pool to avoid waiting for connection forever
+   DBConnectionPoolClassStats poolStats;
+   DBConnectionPoolGetClassStats(DBConnectionPoolClass::HOUSEKEEPING, &poolStats);
+   int numThreads = std::min(std::min(ConfigReadInt(_T("Housekeeper.DataCleanupThreads"), 3), poolStats.maxSize), objects.size());
+   nxlog_debug_tag(DEBUG_TAG, 4, _T("Using DELETE statements (%d objects, %d threads)"), objects.size(), numThreads);
+   SetStage(_T("Clean collected data"), objects.size());
+   if (numThreads > 1)
+   {
+      THREAD *threads = MemAllocArrayNoInit<THREAD>(numThreads - 1);
+      for(int i = 0; i < numThreads - 1; i++)
+         threads[i] = ThreadCreateEx(DataCleanupWorker, &context);
+      RunDataCleanup(&context, hdb);
+      for(int i = 0; i < numThreads - 1; i++)
+         ThreadJoin(threads[i]);
+      MemFree(threads);
+   }
+   else
+   {
+      RunDataCleanup(&context, hdb);
+   }
+}
+
 /**
  * Housekeeper thread
  */
@@ -296,6 +461,13 @@ static void HouseKeeper()
    }
    nxlog_debug_tag(DEBUG_TAG, 2, _T("Wakeup time is %02d:%02d"), hour, minute);
 
+   if (g_flags & AF_PARTITIONED_TABLES)
+   {
+      DB_HANDLE hdb = DBConnectionPoolAcquireConnectionEx(DBConnectionPoolClass::HOUSEKEEPING);
+      CreateTablePartitions(hdb);
+      DBConnectionPoolReleaseConnection(hdb);
+   }
+
    // Call policy validation for templates
    g_idxObjectById.forEach(
       [] (NetObj *object)
@@ -315,16 +487,25 @@ static void HouseKeeper()
       nxlog_debug_tag(DEBUG_TAG, 2, _T("Wakeup"));
       s_running = true;
       time_t cycleStartTime = time(nullptr);
+      s_cycleStartTime = cycleStartTime;
       PostSystemEvent(EVENT_HOUSEKEEPER_STARTED, g_dwMgmtNode, nullptr);
 
       s_throttlingHighWatermark = ConfigReadInt(_T("Housekeeper.Throttle.HighWatermark"), 250000);
       s_throttlingLowWatermark = ConfigReadInt(_T("Housekeeper.Throttle.LowWatermark"), 50000);
       nxlog_debug_tag(DEBUG_TAG, 5, _T("Throttling high watermark = %d, low watermark= %d"), s_throttlingHighWatermark, s_throttlingLowWatermark);
 
-		DB_HANDLE hdb = DBConnectionPoolAcquireConnection();
+		DB_HANDLE hdb = DBConnectionPoolAcquireConnectionEx(DBConnectionPoolClass::HOUSEKEEPING);
+      if (g_flags & AF_PARTITIONED_TABLES)
+      {
+         SetStage(_T("Create partitions"));
+         CreateTablePartitions(hdb);
+      }
+
+      SetStage(_T("Clean alarm history"));
 		CleanAlarmHistory(hdb);
 
 		// Remove expired log records
+      SetStage(_T("Clean logs"));
 		if (!DeleteExpiredLogRecords(_T("event log"), _T("event_log"), _T("event_timestamp"), _T("Events.LogRetentionTime"), hdb, cycleStartTime))
 		   break;
       if (!DeleteExpiredLogRecords(_T("syslog"), _T("syslog"), _T("msg_timestamp"), _T("Syslog.RetentionTime"), hdb, cycleStartTime))
@@ -396,24 +577,12 @@ static void HouseKeeper()
          if ((g_dbSyntax == DB_SYNTAX_TSDB) && (g_flags & AF_SINGLE_TABLE_PERF_DATA))
          {
             nxlog_debug_tag(DEBUG_TAG, 4, _T("Using drop_chunks()"));
+            SetStage(_T("Clean collected data"));
             CleanTimescaleData(hdb);
          }
          else
          {
-            nxlog_debug_tag(DEBUG_TAG, 4, _T("Using DELETE statements"));
-            SharedObjectArray<NetObj> objects(1024, 1024);
-            g_idxAccessPointById.getObjects(&objects);
-            g_idxChassisById.getObjects(&objects);
-            g_idxClusterById.getObjects(&objects);
-            g_idxMobileDeviceById.getObjects(&objects);
-            g_idxNodeById.getObjects(&objects);
-            g_idxSensorById.getObjects(&objects);
-
-            for(int i = 0; (i < objects.size()) && !s_shutdown; i++)
-            {
-               static_cast<DataCollectionTarget*>(objects.get(i))->cleanDCIData(hdb);
-               ThrottleHousekeeper();
-            }
+            CleanCollectedData(hdb);
          }
       }
       else
@@ -425,6 +594,7 @@ static void HouseKeeper()
       unique_ptr<SharedObjectArray<NetObj>> objects = g_idxObjectById.getObjects();
 
       // Clean geo location data
+      SetStage(_T("Clean geolocation history"), objects->size());
       nxlog_debug_tag(DEBUG_TAG, 2, _T("Clearing geolocation data"));
       retentionTime = ConfigReadULong(_T("Geolocation.History.RetentionTime"), 90);
       retentionTime *= 86400;   // Convert days to seconds
@@ -432,6 +602,7 @@ static void HouseKeeper()
       for(int i = 0; i < objects->size(); i++)
       {
          objects->get(i)->cleanGeoLocationHistoryTable(hdb, latestTimestamp);
+         UpdateStageProgress();
          ThrottleHousekeeper();
       }
 
@@ -444,6 +615,7 @@ static void HouseKeeper()
          });
 
 	   // Save object runtime data
+      SetStage(_T("Save object runtime data"));
       nxlog_debug_tag(DEBUG_TAG, 2, _T("Saving object runtime data"));
 	   for(int i = 0; i < objects->size(); i++)
 	   {
@@ -453,6 +625,7 @@ static void HouseKeeper()
 		DBConnectionPoolReleaseConnection(hdb);
 
 		// Validate template DCIs
+      SetStage(_T("Run post-processing tasks"));
       nxlog_debug_tag(DEBUG_TAG, 2, _T("Queue template updates"));
 		g_idxObjectById.forEach(
 		   [] (NetObj *object)
@@ -487,6 +660,7 @@ static void HouseKeeper()
 
       ThreadSleep(1);   // to prevent multiple executions if processing took less then 1 second
       sleepTime = GetSleepTime(hour, minute, 0);
+      SetStage(_T("idle"));
       s_running = false;
    }
 
@@ -513,6 +687,7 @@ void StopHouseKeeper()
 {
    s_shutdown = true;
    s_wakeupCondition.set();
+   s_shutdownCondition.set();
    ThreadJoin(s_thread);
 }
 
@@ -529,3 +704,25 @@ void RunHouseKeeper(ServerConsole *console)
    console->print(_T("Starting housekeeper\n"));
    s_wakeupCondition.set();
 }
+
+/**
+ * Show housekeeper status
+ */
+void ShowHousekeeperStatus(ServerConsole *console)
+{
+   s_progressLock.lock();
+   if (s_running)
+   {
+      time_t now = time(nullptr);
+      console->printf(_T("Housekeeper running for %d seconds\n"), static_cast<int>(now - s_cycleStartTime));
+      console->printf(_T("Current stage: %s (%d seconds)\n"), s_stage, static_cast<int>(now - s_stageStartTime));
+      if (s_stageWorkTotal > 0)
+         console->printf(_T("Progress: %d of %d (%d%%)\n"), s_stageWorkDone, s_stageWorkTotal, s_stageWorkDone * 100 / s_stageWorkTotal);
+   }
+   else
+   {
+      console->print(_T("Housekeeper is idle\n"));
+   }
+   s_progressLock.unlock();
+   console->printf(_T("Partitioned tables: %s\n"), (g_flags & AF_PARTITIONED_TABLES) ? _T("yes") : _T("no"));
+}
@@ -110,121 +110,55 @@ void ScanAddressRangeICMP(const InetAddress& from, const InetAddress& to, void (
 
 #else /* _WIN32 */
 
-#include <nxnet.h>
-
-/**
- * ICMP echo request structure
- */
-struct ECHOREQUEST
-{
-   ICMPHDR m_icmpHdr;
-   BYTE m_cData[64];
-};
-
 /**
- * ICMP echo reply structure
+ * Scan context
  */
-struct ECHOREPLY
+struct ScanContext
 {
-   IPHDR m_ipHdr;
-   ICMPHDR m_icmpHdr;
-   BYTE m_cData[64];
-};
-
-/**
- * Scan status for each address
- */
-struct ScanStatus
-{
-   int64_t startTime;
-   bool success;
-   uint32_t rtt;
+   void (*callback)(const InetAddress&, int32_t, const Node*, uint32_t, const TCHAR*, ServerConsole*, void*);
+   ServerConsole *console;
+   void *context;
 };
 
 /**
- * Process ICMP response
+ * Batch ping completion callback
  */
-static void ProcessResponse(SOCKET sock, uint32_t baseAddr, uint32_t lastAddr, ScanStatus *status)
+static void ScanCallback(IcmpPingTarget *target, void *context)
 {
-   ECHOREPLY reply;
-   struct sockaddr_in saSrc;
-   socklen_t addrLen = sizeof(struct sockaddr_in);
-   if (recvfrom(sock, reinterpret_cast<char*>(&reply), sizeof(ECHOREPLY), 0, reinterpret_cast<struct sockaddr*>(&saSrc), &addrLen) > 0)
+   if (target->result == ICMP_SUCCESS)
    {
-      uint32_t addr = ntohl(reply.m_ipHdr.m_iaSrc.s_addr);
-      if ((addr >= baseAddr) && (addr <= lastAddr) &&
-          (reply.m_icmpHdr.m_cType == 0) &&
-          !status[addr - baseAddr].success)
-      {
-         status[addr - baseAddr].success = true;
-         status[addr - baseAddr].rtt = static_cast<uint32_t>(GetCurrentTimeMs() - status[addr - baseAddr].startTime);
-      }
+      ScanContext *scanContext = static_cast<ScanContext*>(context);
+      scanContext->callback(target->address, 0, nullptr, target->rtt, _T("ICMP"), scanContext->console, scanContext->context);
    }
 }
 
 /**
-* Scan range of IPv4 addresses
-*/
+ * Scan range of IPv4 addresses
+ */
 void ScanAddressRangeICMP(const InetAddress& from, const InetAddress& to, void (*callback)(const InetAddress&, int32_t, const Node*, uint32_t, const TCHAR*, ServerConsole*, void*), ServerConsole *console, void *context)
 {
-   SOCKET sock = CreateSocket(AF_INET, SOCK_RAW, IPPROTO_ICMP);
-   if (sock == INVALID_SOCKET)
-      return;
-
-   ECHOREQUEST request;
-   memset(&request, 0, sizeof(ECHOREQUEST));
-   request.m_icmpHdr.m_cType = 8;   // ICMP ECHO REQUEST
-   request.m_icmpHdr.m_cCode = 0;
-   request.m_icmpHdr.m_wId = (WORD)GetCurrentThreadId();
-   request.m_icmpHdr.m_wSeq = 0;
-
-   struct sockaddr_in saDest;
-   memset(&saDest, 0, sizeof(sockaddr_in));
-   saDest.sin_family = AF_INET;
-   saDest.sin_port = 0;
-
-   SocketPoller sp;
-   ScanStatus *status = MemAllocArray<ScanStatus>(to.getAddressV4() - from.getAddressV4() + 1);
    uint32_t baseAddr = from.getAddressV4();
-   for(uint32_t a = baseAddr, i = 0; a <= to.getAddressV4(); a++, i++)
-   {
-      request.m_icmpHdr.m_wSeq++;
-      request.m_icmpHdr.m_wChecksum = 0;
-      request.m_icmpHdr.m_wChecksum = CalculateIPChecksum(&request, sizeof(ECHOREQUEST));
-      saDest.sin_addr.s_addr = htonl(a);
-      status[i].startTime = GetCurrentTimeMs();
-      status[i].success = false;
-      sendto(sock, (char *)&request, sizeof(ECHOREQUEST), 0, (struct sockaddr *)&saDest, sizeof(struct sockaddr_in));
-
-      sp.reset();
-      sp.add(sock);
-      if (sp.poll(10) > 0)
-      {
-         ProcessResponse(sock, baseAddr, to.getAddressV4(), status);
-      }
-   }
+   uint32_t lastAddr = to.getAddressV4();
+   if (lastAddr < baseAddr)
+      return;
 
-   uint32_t elapsedTime = 0;
-   while(elapsedTime < g_icmpPingTimeout)
+   size_t count = static_cast<size_t>(lastAddr - baseAddr) + 1;
+   IcmpPingTarget *targets = new IcmpPingTarget[count];
+   for(size_t i = 0; i < count; i++)
    {
-      sp.reset();
-      sp.add(sock);
-      int64_t startTime = GetCurrentTimeMs();
-      if (sp.poll(g_icmpPingTimeout - elapsedTime) <= 0)
-         break;
-
-      ProcessResponse(sock, baseAddr, to.getAddressV4(), status);
-      elapsedTime += static_cast<uint32_t>(GetCurrentTimeMs() - startTime);
+      targets[i].address = InetAddress(baseAddr + static_cast<uint32_t>(i));
+      targets[i].packetSize = g_icmpPingSize;
+      targets[i].dontFragment = false;
+      targets[i].userData = nullptr;
    }
 
-   closesocket(sock);
+   ScanContext scanContext;
+   scanContext.callback = callback;
+   scanContext.console = console;
+   scanContext.context = context;
+   IcmpPingBatch(targets, count, 1, g_icmpPingTimeout, ScanCallback, &scanContext);
 
-   for(uint32_t a = baseAddr, i = 0; a <= to.getAddressV4(); a++, i++)
-   {
-      if (status[i].success)
-         callback(a, 0, nullptr, status[i].rtt, _T("ICMP"), console, context);
-   }
-   MemFree(status);
+   delete[] targets;
 }
 
 #endif   /* _WIN32 */
@@ -164,6 +164,20 @@ static inline void ReleaseIndex(INDEX_HEAD *h)
    InterlockedDecrement(&h->readers);
 }
 
+/**
+ * Sort elements added in startup mode. After this call index can be safely read
+ * by multiple threads until new elements are added.
+ */
+void AbstractIndexBase::sortStartupData()
+{
+   if (m_startupMode && m_dirty)
+   {
+      qsort(m_primary->elements, m_primary->size, sizeof(INDEX_ELEMENT), IndexCompare);
+      m_primary->maxKey = (m_primary->size > 0) ? m_primary->elements[m_primary->size - 1].key : 0;
+      m_dirty = false;
+   }
+}
+
 /**
  * Put element. If element with given key already exist, it will be replaced.
  *
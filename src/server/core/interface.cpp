@@ -1077,14 +1077,13 @@ shared_ptr<Node> Interface::getParentNode() const
 {
    shared_ptr<Node> node;
 
-   readLockParentList();
-   for(int i = 0; i < getParentList().size(); i++)
-      if (getParentList().get(i)->getObjectClass() == OBJECT_NODE)
+   shared_ptr<const SharedObjectArray<NetObj>> parentList = getParentList();
+   for(int i = 0; i < parentList->size(); i++)
+      if (parentList->get(i)->getObjectClass() == OBJECT_NODE)
       {
-         node = static_pointer_cast<Node>(getParentList().getShared(i));
+         node = static_pointer_cast<Node>(parentList->getShared(i));
          break;
       }
-   unlockParentList();
    return node;
 }
 
@@ -1171,6 +1170,7 @@ void Interface::prepareForDeletion()
  */
 void Interface::setPeer(Node *node, Interface *iface, LinkLayerProtocol protocol, bool reflection)
 {
+   bool changed = false;
    lockProperties();
 
    if ((m_peerNodeId == node->getId()) && (m_peerInterfaceId == iface->getId()) && (m_peerDiscoveryProtocol == protocol))
@@ -1203,9 +1203,35 @@ void Interface::setPeer(Node *node, Interface *iface, LinkLayerProtocol protocol
             node->getId(), node->getName(), iface->getId(), iface->getIfIndex(), iface->getName(),
             &iface->getIpAddressList()->getFirstUnicastAddress(), &iface->getMacAddr(), protocol);
       }
+      changed = true;
    }
 
    unlockProperties();
+
+   if (changed)
+   {
+      NotifyNetworkMapsOnTopologyChange(getParentNodeId());
+      NotifyNetworkMapsOnTopologyChange(node->getId());
+   }
+}
+
+/**
+ * Clear peer information
+ */
+void Interface::clearPeer()
+{
+   lockProperties();
+   uint32_t peerNodeId = m_peerNodeId;
+   m_peerNodeId = 0;
+   m_peerInterfaceId = 0;
+   m_peerDiscoveryProtocol = LL_PROTO_UNKNOWN;
+   m_flags &= ~IF_PEER_REFLECTION;
+   setModified(MODIFY_INTERFACE_PROPERTIES | MODIFY_COMMON_PROPERTIES);
+   unlockProperties();
+
+   NotifyNetworkMapsOnTopologyChange(getParentNodeId());
+   if (peerNodeId != 0)
+      NotifyNetworkMapsOnTopologyChange(peerNodeId);
 }
 
 /**
@@ -66,6 +66,35 @@ void LinkLayerNeighbors::addConnection(LL_NEIGHBOR_INFO *info)
 	m_connections.add(info);
 }
 
+/**
+ * Check if this neighbor list contains same connections as given one (order of connections
+ * and cached information flag are ignored).
+ */
+bool LinkLayerNeighbors::equals(const LinkLayerNeighbors *other) const
+{
+   if ((other == nullptr) || (m_connections.size() != other->m_connections.size()))
+      return false;
+
+   // Local interface index is unique within neighbor list
+   for(int i = 0; i < m_connections.size(); i++)
+   {
+      LL_NEIGHBOR_INFO *n = m_connections.get(i);
+      bool found = false;
+      for(int j = 0; j < other->m_connections.size(); j++)
+      {
+         LL_NEIGHBOR_INFO *o = other->m_connections.get(j);
+         if (o->ifLocal == n->ifLocal)
+         {
+            found = (o->ifRemote == n->ifRemote) && (o->objectId == n->objectId) && (o->isPtToPt == n->isPtToPt) && (o->protocol == n->protocol);
+            break;
+         }
+      }
+      if (!found)
+         return false;
+   }
+   return true;
+}
+
 /**
  * Gather link layer connectivity information from node
  */
@@ -85,6 +85,7 @@ void StopObjectMaintenanceThreads();
 bool LoadPhysicalLinks();
 void LoadObjectQueries();
 THREAD StartEventProcessor();
+void ShutdownEventDeduplication();
 void StartHouseKeeper();
 void StopHouseKeeper();
 
@@ -162,6 +163,8 @@ uint32_t g_icmpPingSize;
 uint32_t g_icmpPingTimeout = 1500;    // ICMP ping timeout (milliseconds)
 uint32_t g_auditFlags;
 uint32_t g_offlineDataRelevanceTime = 86400;
+bool g_tableValueBinaryFormat = true;
+uint32_t g_tableValueKeyframeInterval = 0;
 uint32_t g_pollsBetweenPrimaryIpUpdate = 1;
 PrimaryIPUpdateMode g_primaryIpUpdateMode = PrimaryIPUpdateMode::NEVER;
 NXCORE_EXPORTABLE_VAR(TCHAR g_netxmsdDataDir[MAX_PATH]) = _T("");
@@ -398,6 +401,19 @@ static void LoadGlobalConfig()
       g_flags |= AF_SINGLE_TABLE_PERF_DATA;
    }
 
+   if (MetaDataReadInt32(_T("PartitionedTables"), 0))
+   {
+      if ((g_dbSyntax == DB_SYNTAX_PGSQL) || (g_dbSyntax == DB_SYNTAX_MYSQL) || (g_dbSyntax == DB_SYNTAX_ORACLE))
+      {
+         nxlog_debug_tag(_T("db"), 1, _T("Using time partitioned tables for collected data and logs"));
+         g_flags |= AF_PARTITIONED_TABLES;
+      }
+      else
+      {
+         nxlog_write_tag(NXLOG_WARNING, _T("db"), _T("Table partitioning is enabled in database metadata but not supported for current database type"));
+      }
+   }
+
    g_conditionPollingInterval = ConfigReadInt(_T("Objects.Conditions.PollingInterval"), 60);
    g_configurationPollingInterval = ConfigReadInt(_T("Objects.ConfigurationPollingInterval"), 3600);
    g_discoveryPollingInterval = ConfigReadInt(_T("NetworkDiscovery.PassiveDiscovery.Interval"), 900);
@@ -519,11 +535,14 @@ static void LoadGlobalConfig()
       g_icmpPingSize = MAX_PING_SIZE;
 
    g_icmpPingTimeout = ConfigReadInt(_T("ICMP.PingTimeout"), 1500);
+   IcmpSetBatchPacketRate(ConfigReadULong(_T("ICMP.MaxPacketRate"), 1000));
    g_agentCommandTimeout = ConfigReadInt(_T("Agent.CommandTimeout"), 4000);
    g_agentRestartWaitTime = ConfigReadInt(_T("Agent.RestartWaitTime"), 0);
    g_thresholdRepeatInterval = ConfigReadInt(_T("DataCollection.ThresholdRepeatInterval"), 0);
    g_requiredPolls = ConfigReadInt(_T("Objects.PollCountForStatusChange"), 1);
    g_offlineDataRelevanceTime = ConfigReadInt(_T("DataCollection.OfflineDataRelevanceTime"), 86400);
+   g_tableValueBinaryFormat = ConfigReadBoolean(_T("DataCollection.TableStorage.BinaryFormat"), true);
+   g_tableValueKeyframeInterval = ConfigReadULong(_T("DataCollection.TableStorage.KeyframeInterval"), 0);
    g_instanceRetentionTime = ConfigReadInt(_T("DataCollection.InstanceRetentionTime"), 7); // Config values are in days
    g_snmpTrapStormCountThreshold = ConfigReadInt(_T("SNMP.Traps.RateLimit.Threshold"), 0);
    g_snmpTrapStormDurationThreshold = ConfigReadInt(_T("SNMP.Traps.RateLimit.Duration"), 15);
@@ -1013,6 +1032,29 @@ BOOL NXCORE_EXPORTABLE Initialize()
 	int cooldownTime = ConfigReadIntEx(hdbBootstrap, _T("DBConnectionPool.CooldownTime"), 300);
 	int ttl = ConfigReadIntEx(hdbBootstrap, _T("DBConnectionPool.MaxLifetime"), 14400);
 
+	// Limits for other connection pool classes (interactive class uses base and max pool size)
+	static const struct
+	{
+	   DBConnectionPoolClass poolClass;
+	   const TCHAR *baseSizeParam;
+	   const TCHAR *maxSizeParam;
+	   int defaultBaseSize;
+	   int defaultMaxSize;
+	} poolClassLimits[] =
+	{
+	   { DBConnectionPoolClass::WRITERS, _T("DBConnectionPool.Writers.BaseSize"), _T("DBConnectionPool.Writers.MaxSize"), 2, 20 },
+	   { DBConnectionPoolClass::HOUSEKEEPING, _T("DBConnectionPool.Housekeeping.BaseSize"), _T("DBConnectionPool.Housekeeping.MaxSize"), 0, 4 },
+	   { DBConnectionPoolClass::BACKGROUND, _T("DBConnectionPool.Background.BaseSize"), _T("DBConnectionPool.Background.MaxSize"), 0, 10 }
+	};
+	for(size_t i = 0; i < sizeof(poolClassLimits) / sizeof(poolClassLimits[0]); i++)
+	{
+	   DBConnectionPoolSetClassLimits(poolClassLimits[i].poolClass,
+	            ConfigReadIntEx(hdbBootstrap, poolClassLimits[i].baseSizeParam, poolClassLimits[i].defaultBaseSize),
+	            ConfigReadIntEx(hdbBootstrap, poolClassLimits[i].maxSizeParam, poolClassLimits[i].defaultMaxSize));
+	}
+
+	DBConnectionPoolSetStatementCacheSize(ConfigReadIntEx(hdbBootstrap, _T("DBConnectionPool.StatementCacheSize"), 32));
+
    DBDisconnect(hdbBootstrap);
 
 	if (!DBConnectionPoolStartup(g_dbDriver, g_szDbServer, g_szDbName, g_szDbLogin, g_szDbPassword, g_szDbSchema, baseSize, maxSize, cooldownTime, ttl))
@@ -1405,6 +1447,7 @@ void NXCORE_EXPORTABLE Shutdown()
    StopWindowsEventProcessing();
 
    nxlog_debug_tag(DEBUG_TAG_SHUTDOWN, 2, _T("Waiting for event processor to stop"));
+   ShutdownEventDeduplication();
    g_eventQueue.put(INVALID_POINTER_VALUE);
    ThreadJoin(s_eventProcessorThread);
 
@@ -1414,6 +1457,7 @@ void NXCORE_EXPORTABLE Shutdown()
    DB_HANDLE hdb = DBConnectionPoolAcquireConnection();
    SaveObjects(hdb, INVALID_INDEX, true);
    nxlog_debug_tag(DEBUG_TAG_SHUTDOWN, 2, _T("All objects saved to database"));
+   SaveDCISnapshot();
    SaveUsers(hdb, INVALID_INDEX);
    nxlog_debug_tag(DEBUG_TAG_SHUTDOWN, 2, _T("All users saved to database"));
    UpdatePStorageDatabase(hdb, INVALID_INDEX);
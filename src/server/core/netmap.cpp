@@ -25,6 +25,78 @@
 #define DEBUG_TAG_NETMAP   _T("obj.netmap")
 #define MAX_DELETED_OBJECT_COUNT 1000
 
+/**
+ * Objects with changed topology since last map update cycle
+ */
+static HashSet<uint32_t> *s_topologyChanges = new HashSet<uint32_t>();
+static Mutex s_topologyChangesLock(MutexType::FAST);
+
+/**
+ * Register topology change for given object. Maps containing this object will rebuild their content on next update cycle.
+ */
+void NotifyNetworkMapsOnTopologyChange(uint32_t objectId)
+{
+   s_topologyChangesLock.lock();
+   s_topologyChanges->put(objectId);
+   s_topologyChangesLock.unlock();
+}
+
+/**
+ * Get set of objects with changed topology since last call. Returned set should be destroyed by caller.
+ */
+HashSet<uint32_t> *CollectNetworkMapTopologyChanges()
+{
+   auto changes = new HashSet<uint32_t>();
+   s_topologyChangesLock.lock();
+   std::swap(changes, s_topologyChanges);
+   s_topologyChangesLock.unlock();
+   return changes;
+}
+
+/**
+ * Key for link lookup by connected objects and link type
+ */
+struct NetworkMapLinkKey
+{
+   uint32_t objectId1;
+   uint32_t objectId2;
+   int32_t type;
+
+   NetworkMapLinkKey(uint32_t id1, uint32_t id2, int t)
+   {
+      objectId1 = id1;
+      objectId2 = id2;
+      type = t;
+   }
+};
+
+/**
+ * Build indexes of map elements by element ID and by object ID
+ */
+static void BuildElementIndexes(const ObjectArray<NetworkMapElement>& elements, HashMap<uint32_t, NetworkMapElement> *elementIndex, HashMap<uint32_t, NetworkMapObject> *objectIndex)
+{
+   for(int i = 0; i < elements.size(); i++)
+   {
+      NetworkMapElement *e = elements.get(i);
+      elementIndex->set(e->getId(), e);
+      if ((objectIndex != nullptr) && (e->getType() == MAP_ELEMENT_OBJECT))
+      {
+         uint32_t objectId = static_cast<NetworkMapObject*>(e)->getObjectId();
+         if (objectIndex->get(objectId) == nullptr)
+            objectIndex->set(objectId, static_cast<NetworkMapObject*>(e));
+      }
+   }
+}
+
+/**
+ * Get object ID from map element ID using element index
+ */
+static inline uint32_t ObjectIdFromElementId(const HashMap<uint32_t, NetworkMapElement>& elementIndex, uint32_t eid)
+{
+   NetworkMapElement *e = elementIndex.get(eid);
+   return ((e != nullptr) && (e->getType() == MAP_ELEMENT_OBJECT)) ? static_cast<NetworkMapObject*>(e)->getObjectId() : 0;
+}
+
 /**
  * Redefined status calculation for network maps group
  */
@@ -64,6 +136,7 @@ NetworkMap::NetworkMap() : super(), m_elements(0, 64, Ownership::True), m_links(
 	m_nextLinkId = 1;
    m_filterSource = nullptr;
    m_filter = nullptr;
+   m_contentUpdateRequired = true;
 }
 
 /**
@@ -87,6 +160,7 @@ NetworkMap::NetworkMap(const NetworkMap &src) : super(), m_seedObjects(src.m_see
    m_nextLinkId = src.m_nextLinkId;
    m_filterSource = nullptr;
    m_filter = nullptr;
+   m_contentUpdateRequired = true;
    setFilter(src.m_filterSource);
    for(int i = 0; i < src.m_elements.size(); i++)
    {
@@ -125,6 +199,7 @@ NetworkMap::NetworkMap(int type, const IntegerArray<uint32_t>& seeds) : super(),
    m_nextLinkId = 1;
    m_filterSource = nullptr;
    m_filter = nullptr;
+   m_contentUpdateRequired = true;
 	m_isHidden = true;
    setCreationTime();
 }
@@ -240,10 +315,7 @@ void NetworkMap::calculateCompoundStatus(bool forcedRecalc)
          // Cause parent object(s) to recalculate it's status
          if ((iOldStatus != m_status) || forcedRecalc)
          {
-            readLockParentList();
-            for(int i = 0; i < getParentList().size(); i++)
-               getParentList().get(i)->calculateCompoundStatus();
-            unlockParentList();
+            propagateStatusToParents();
             setModified(MODIFY_RUNTIME);
          }
       }
@@ -251,10 +323,7 @@ void NetworkMap::calculateCompoundStatus(bool forcedRecalc)
    else if ((m_status != STATUS_NORMAL) && (m_status != STATUS_UNMANAGED))
    {
       m_status = STATUS_NORMAL;
-      readLockParentList();
-      for(int i = 0; i < getParentList().size(); i++)
-         getParentList().get(i)->calculateCompoundStatus();
-      unlockParentList();
+      propagateStatusToParents();
       setModified(MODIFY_RUNTIME);
    }
 }
@@ -674,6 +743,9 @@ void NetworkMap::fillMessageInternal(NXCPMessage *msg, uint32_t userId)
  */
 uint32_t NetworkMap::modifyFromMessageInternal(const NXCPMessage& msg)
 {
+   // Seed objects, flags or filter may change, so rebuild content on next update cycle
+   m_contentUpdateRequired = true;
+
 	if (msg.isFieldExist(VID_MAP_TYPE))
 		m_mapType = msg.getFieldAsInt16(VID_MAP_TYPE);
 
@@ -851,6 +923,10 @@ void NetworkMap::updateContent()
    nxlog_debug_tag(DEBUG_TAG_NETMAP, 6, _T("NetworkMap::updateContent(%s [%u]): map type %d"), m_name, m_id, m_mapType);
    if ((m_mapType != MAP_TYPE_CUSTOM) && (m_status != STATUS_UNMANAGED))
    {
+      lockProperties();
+      m_contentUpdateRequired = false;
+      unlockProperties();
+
       NetworkMapObjectList objects;
       bool topologyRecieved = true;
       for(int i = 0; i < m_seedObjects.size(); i++)
@@ -897,6 +973,13 @@ void NetworkMap::updateContent()
       {
          updateObjects(&objects);
       }
+      else
+      {
+         // Retry on next update cycle
+         lockProperties();
+         m_contentUpdateRequired = true;
+         unlockProperties();
+      }
    }
    if (m_status != STATUS_UNMANAGED)
    {
@@ -930,8 +1013,21 @@ void NetworkMap::updateObjects(NetworkMapObjectList *objects)
       objects->filterObjects(NetworkMap::objectFilter, this);
    }
 
+   // Index links from topology by endpoints
+   HashSet<NetworkMapLinkKey> topologyLinks;
+   const ObjectArray<ObjLink>& links = objects->getLinks();
+   for(int i = 0; i < links.size(); i++)
+   {
+      ObjLink *l = links.get(i);
+      topologyLinks.put(NetworkMapLinkKey(l->id1, l->id2, l->type));
+   }
+
    lockProperties();
 
+   HashMap<uint32_t, NetworkMapElement> elementIndex;
+   HashMap<uint32_t, NetworkMapObject> objectIndex;
+   BuildElementIndexes(m_elements, &elementIndex, &objectIndex);
+
    // remove non-existing links
    for(int i = 0; i < m_links.size(); i++)
    {
@@ -939,14 +1035,14 @@ void NetworkMap::updateObjects(NetworkMapObjectList *objects)
       if (!link->checkFlagSet(AUTO_GENERATED))
          continue;
 
-      uint32_t objID1 = objectIdFromElementId(link->getElement1());
-      uint32_t objID2 = objectIdFromElementId(link->getElement2());
+      uint32_t objID1 = ObjectIdFromElementId(elementIndex, link->getElement1());
+      uint32_t objID2 = ObjectIdFromElementId(elementIndex, link->getElement2());
       bool linkExists = false;
-      if (objects->isLinkExist(objID1, objID2, link->getType()))
+      if (topologyLinks.contains(NetworkMapLinkKey(objID1, objID2, link->getType())))
       {
          linkExists = true;
       }
-      else if (objects->isLinkExist(objID2, objID1, link->getType()))
+      else if (topologyLinks.contains(NetworkMapLinkKey(objID2, objID1, link->getType())))
       {
          link->swap();
          linkExists = true;
@@ -980,6 +1076,9 @@ void NetworkMap::updateObjects(NetworkMapObjectList *objects)
          m_deletedObjects.insert(0, &loc);
          if (m_deletedObjects.size() > MAX_DELETED_OBJECT_COUNT)
             m_deletedObjects.remove(MAX_DELETED_OBJECT_COUNT);
+         elementIndex.remove(e->getId());
+         if (objectIndex.get(objectId) == netMapObject)
+            objectIndex.remove(objectId);
          m_elements.remove(i);
          i--;
          modified = true;
@@ -989,71 +1088,59 @@ void NetworkMap::updateObjects(NetworkMapObjectList *objects)
    // add new objects
    for(int i = 0; i < objects->getNumObjects(); i++)
    {
-      bool found = false;
-      NetworkMapElement *e = nullptr;
-      for(int j = 0; j < m_elements.size(); j++)
+      uint32_t objectId = objects->getObjects().get(i);
+      if (objectIndex.get(objectId) != nullptr)
+         continue;
+
+      NetworkMapObject *e = new NetworkMapObject(m_nextElementId++, objectId, 1);
+      for (int i = 0; i < m_deletedObjects.size(); i++)
       {
-         e = m_elements.get(j);
-         if (e->getType() != MAP_ELEMENT_OBJECT)
-            continue;
-         if (static_cast<NetworkMapObject*>(e)->getObjectId() == objects->getObjects().get(i))
+         NetworkMapObjectLocation *l = m_deletedObjects.get(i);
+         if (l->objectId == objectId)
          {
-            found = true;
+            e->setPosition(l->posX, l->posY);
+            m_deletedObjects.remove(i);
             break;
          }
       }
-      if (!found)
-      {
-         uint32_t objectId = objects->getObjects().get(i);
-         NetworkMapObject *e = new NetworkMapObject(m_nextElementId++, objectId, 1);
-         for (int i = 0; i < m_deletedObjects.size(); i++)
-         {
-            NetworkMapObjectLocation *l = m_deletedObjects.get(i);
-            if (l->objectId == objectId)
-            {
-               e->setPosition(l->posX, l->posY);
-               m_deletedObjects.remove(i);
-               break;
-            }
-         }
-         m_elements.add(e);
-         modified = true;
-         nxlog_debug_tag(DEBUG_TAG_NETMAP, 5, _T("NetworkMap(%s [%u])/updateObjects: new object %u (element ID %u) added"), m_name, m_id, objectId, e->getId());
-      }
+      m_elements.add(e);
+      elementIndex.set(e->getId(), e);
+      objectIndex.set(objectId, e);
+      modified = true;
+      nxlog_debug_tag(DEBUG_TAG_NETMAP, 5, _T("NetworkMap(%s [%u])/updateObjects: new object %u (element ID %u) added"), m_name, m_id, objectId, e->getId());
+   }
+
+   // Index existing links by connected objects (first matching link wins)
+   HashMap<NetworkMapLinkKey, NetworkMapLink> linkIndex;
+   for(int i = 0; i < m_links.size(); i++)
+   {
+      NetworkMapLink *link = m_links.get(i);
+      NetworkMapLinkKey key(ObjectIdFromElementId(elementIndex, link->getElement1()), ObjectIdFromElementId(elementIndex, link->getElement2()), link->getType());
+      if (linkIndex.get(key) == nullptr)
+         linkIndex.set(key, link);
    }
 
    // add new links and update existing
-   const ObjectArray<ObjLink>& links = objects->getLinks();
    for(int i = 0; i < links.size(); i++)
    {
       ObjLink *newLink = links.get(i);
-      NetworkMapLink *link = nullptr;
-      bool isNew = true;
-      for(int j = 0; j < m_links.size(); j++)
-      {
-         NetworkMapLink *currLink = m_links.get(j);
-         uint32_t obj1 = objectIdFromElementId(currLink->getElement1());
-         uint32_t obj2 = objectIdFromElementId(currLink->getElement2());
-         if ((newLink->id1 == obj1) && (newLink->id2 == obj2) && (newLink->type == currLink->getType()))
-         {
-            link = currLink;
-            isNew = false;
-            break;
-         }
-      }
+      NetworkMapLinkKey key(newLink->id1, newLink->id2, newLink->type);
+      NetworkMapLink *link = linkIndex.get(key);
+      bool isNew = (link == nullptr);
 
       // Add new link if needed
       if (link == nullptr)
       {
-         uint32_t e1 = elementIdFromObjectId(newLink->id1);
-         uint32_t e2 = elementIdFromObjectId(newLink->id2);
-         // Element ID can be 0 if link points to object removed by filter
-         if ((e1 != 0) && (e2 != 0))
+         NetworkMapObject *e1 = objectIndex.get(newLink->id1);
+         NetworkMapObject *e2 = objectIndex.get(newLink->id2);
+         // Element can be missing if link points to object removed by filter
+         if ((e1 != nullptr) && (e2 != nullptr))
          {
-            link = new NetworkMapLink(m_nextLinkId++, e1, e2, newLink->type);
+            link = new NetworkMapLink(m_nextLinkId++, e1->getId(), e2->getId(), newLink->type);
             link->setColorSource(MAP_LINK_COLOR_SOURCE_OBJECT_STATUS);
             link->setFlags(AUTO_GENERATED);
             m_links.add(link);
+            linkIndex.set(key, link);
          }
          else
          {
@@ -1075,6 +1162,8 @@ void NetworkMap::updateObjects(NetworkMapObjectList *objects)
       }
    }
 
+   updateDependencies();
+
    if (modified)
       setModified(MODIFY_MAP_CONTENT);
 
@@ -1082,6 +1171,63 @@ void NetworkMap::updateObjects(NetworkMapObjectList *objects)
    nxlog_debug_tag(DEBUG_TAG_NETMAP, 5, _T("NetworkMap(%s): updateObjects completed"), m_name);
 }
 
+/**
+ * Update list of objects this map depends on (seed objects and all objects placed on map).
+ * Object properties must be already locked.
+ */
+void NetworkMap::updateDependencies()
+{
+   m_dependencies.clear();
+   for(int i = 0; i < m_seedObjects.size(); i++)
+      m_dependencies.put(m_seedObjects.get(i));
+   for(int i = 0; i < m_elements.size(); i++)
+   {
+      NetworkMapElement *e = m_elements.get(i);
+      if (e->getType() == MAP_ELEMENT_OBJECT)
+         m_dependencies.put(static_cast<NetworkMapObject*>(e)->getObjectId());
+   }
+}
+
+/**
+ * Check if map content should be rebuilt because of topology change of any object on the map
+ */
+bool NetworkMap::isContentUpdateRequired(const HashSet<uint32_t>& changedObjects)
+{
+   if (m_mapType == MAP_TYPE_CUSTOM)
+      return false;
+
+   lockProperties();
+   bool required = m_contentUpdateRequired;
+   if (!required && !changedObjects.isEmpty())
+   {
+      // Iterate over smaller set
+      if (changedObjects.size() <= m_dependencies.size())
+      {
+         for(const uint32_t *id : changedObjects)
+         {
+            if (m_dependencies.contains(*id))
+            {
+               required = true;
+               break;
+            }
+         }
+      }
+      else
+      {
+         for(const uint32_t *id : m_dependencies)
+         {
+            if (changedObjects.contains(*id))
+            {
+               required = true;
+               break;
+            }
+         }
+      }
+   }
+   unlockProperties();
+   return required;
+}
+
 /**
  * Update links that have computed attributes (color, text, etc.)
  */
@@ -1090,14 +1236,18 @@ void NetworkMap::updateLinks()
    ObjectArray<NetworkMapLink> updateList(0, 64, Ownership::True);
 
    lockProperties();
+   HashMap<uint32_t, NetworkMapElement> elementIndex;
    for(int i = 0; i < m_links.size(); i++)
    {
       NetworkMapLink *link = m_links.get(i);
       if (link->getColorSource() == MAP_LINK_COLOR_SOURCE_SCRIPT)
       {
+         if (elementIndex.size() == 0)
+            BuildElementIndexes(m_elements, &elementIndex, nullptr);
+
          // Replace element IDs with actual object IDs in temporary link object
          auto temp = new NetworkMapLink(*link);
-         temp->setConnectedElements(objectIdFromElementId(link->getElement1()), objectIdFromElementId(link->getElement2()));
+         temp->setConnectedElements(ObjectIdFromElementId(elementIndex, link->getElement1()), ObjectIdFromElementId(elementIndex, link->getElement2()));
          updateList.add(temp);
       }
    }
@@ -1149,17 +1299,20 @@ void NetworkMap::updateLinks()
 
    bool modified = false;
    lockProperties();
+   HashMap<uint32_t, NetworkMapLink> linkIndex;
+   for(int i = 0; i < m_links.size(); i++)
+   {
+      NetworkMapLink *link = m_links.get(i);
+      linkIndex.set(link->getId(), link);
+   }
    for(int i = 0; i < updateList.size(); i++)
    {
       NetworkMapLink *linkUpdate = updateList.get(i);
-      for(int j = 0; j < m_links.size(); j++)
+      NetworkMapLink *link = linkIndex.get(linkUpdate->getId());
+      if ((link != nullptr) && (link->getColorSource() == MAP_LINK_COLOR_SOURCE_SCRIPT) && (link->getColor() != linkUpdate->getColor()))
       {
-         NetworkMapLink *link = m_links.get(j);
-         if ((link->getId() == linkUpdate->getId()) && (link->getColorSource() == MAP_LINK_COLOR_SOURCE_SCRIPT) && (link->getColor() != linkUpdate->getColor()))
-         {
-            link->setColor(linkUpdate->getColor());
-            modified = true;
-         }
+         link->setColor(linkUpdate->getColor());
+         modified = true;
       }
    }
    if (modified)
@@ -1315,9 +1468,9 @@ void NetworkMap::clone(const TCHAR *name, const TCHAR *alias)
    object->setAlias(alias);
    NetObjInsert(object, true, false);
    auto parentList = getParentList();
-   parentList.get(0)->addChild(object);
-   object->addParent(parentList.getShared(0));
-   parentList.get(0)->calculateCompoundStatus();
+   parentList->get(0)->addChild(object);
+   object->addParent(parentList->getShared(0));
+   parentList->get(0)->calculateCompoundStatus();
    object->unhide();
 }
 
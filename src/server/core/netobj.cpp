@@ -545,161 +545,101 @@ bool NetObj::loadCommonProperties(DB_HANDLE hdb)
    bool success = false;
 
    // Load access options
-   DB_STATEMENT hStmt = DBPrepare(hdb,
-                                  _T("SELECT name,status,is_deleted,inherit_access_rights,last_modified,status_calc_alg,")
-                                  _T("status_prop_alg,status_fixed_val,status_shift,status_translation,status_single_threshold,")
-                                  _T("status_thresholds,comments,is_system,location_type,latitude,longitude,location_accuracy,")
-                                  _T("location_timestamp,guid,map_image,submap_id,country,region,city,district,street_address,")
-                                  _T("postcode,maint_event_id,state_before_maint,maint_initiator,state,flags,creation_time,alias,")
-                                  _T("name_on_map,category,comments_source FROM object_properties WHERE object_id=?"));
-   if (hStmt != nullptr)
+   ObjectRows rows;
+   if (rows.select(hdb, BulkLoadTable::OBJECT_PROPERTIES, m_id))
    {
-      DBBind(hStmt, 1, DB_SQLTYPE_INTEGER, m_id);
-      DB_RESULT hResult = DBSelectPrepared(hStmt);
-      if (hResult != nullptr)
+      if (rows.size() > 0)
       {
-			if (DBGetNumRows(hResult) > 0)
-			{
-				DBGetField(hResult, 0, 0, m_name, MAX_OBJECT_NAME);
-				m_status = m_savedStatus = DBGetFieldLong(hResult, 0, 1);
-				m_isDeleted = DBGetFieldLong(hResult, 0, 2) ? true : false;
-				m_inheritAccessRights = DBGetFieldLong(hResult, 0, 3) ? true : false;
-				m_timestamp = (time_t)DBGetFieldULong(hResult, 0, 4);
-				m_statusCalcAlg = DBGetFieldLong(hResult, 0, 5);
-				m_statusPropAlg = DBGetFieldLong(hResult, 0, 6);
-				m_fixedStatus = DBGetFieldLong(hResult, 0, 7);
-				m_statusShift = DBGetFieldLong(hResult, 0, 8);
-				DBGetFieldByteArray(hResult, 0, 9, m_statusTranslation, 4, STATUS_WARNING);
-				m_statusSingleThreshold = DBGetFieldLong(hResult, 0, 10);
-            DBGetFieldByteArray(hResult, 0, 11, m_statusThresholds, 4, 50);
-            m_comments = DBGetFieldAsSharedString(hResult, 0, 12);
-            m_isSystem = DBGetFieldLong(hResult, 0, 13) ? true : false;
-
-            int locType = DBGetFieldLong(hResult, 0, 14);
-            if (locType != GL_UNSET)
-				{
-					TCHAR lat[32], lon[32];
-
-					DBGetField(hResult, 0, 15, lat, 32);
-					DBGetField(hResult, 0, 16, lon, 32);
-					m_geoLocation = GeoLocation(locType, lat, lon, DBGetFieldLong(hResult, 0, 17), DBGetFieldULong(hResult, 0, 18));
-				}
-				else
-				{
-					m_geoLocation = GeoLocation();
-				}
-
-				m_guid = DBGetFieldGUID(hResult, 0, 19);
-				m_mapImage = DBGetFieldGUID(hResult, 0, 20);
-				m_submapId = DBGetFieldULong(hResult, 0, 21);
-
-            TCHAR buffer[256];
-            m_postalAddress.setCountry(DBGetField(hResult, 0, 22, buffer, 64));
-            m_postalAddress.setRegion(DBGetField(hResult, 0, 23, buffer, 64));
-            m_postalAddress.setCity(DBGetField(hResult, 0, 24, buffer, 64));
-            m_postalAddress.setDistrict(DBGetField(hResult, 0, 25, buffer, 64));
-            m_postalAddress.setStreetAddress(DBGetField(hResult, 0, 26, buffer, 256));
-            m_postalAddress.setPostCode(DBGetField(hResult, 0, 27, buffer, 32));
-
-            m_maintenanceEventId = DBGetFieldUInt64(hResult, 0, 28);
-            m_stateBeforeMaintenance = DBGetFieldULong(hResult, 0, 29);
-            m_maintenanceInitiator = DBGetFieldULong(hResult, 0, 30);
-
-            m_state = m_savedState = DBGetFieldULong(hResult, 0, 31);
-            m_runtimeFlags = 0;
-            m_flags = DBGetFieldULong(hResult, 0, 32);
-            m_creationTime = static_cast<time_t>(DBGetFieldULong(hResult, 0, 33));
-            m_alias = DBGetFieldAsSharedString(hResult, 0, 34);
-            m_nameOnMap = DBGetFieldAsSharedString(hResult, 0, 35);
-            m_categoryId = DBGetFieldULong(hResult, 0, 36);
-            m_commentsSource = DBGetFieldAsSharedString(hResult, 0, 37);
-            success = true;
+         DB_RESULT hResult = rows.getResult();
+         int row = rows.begin();
+         DBGetField(hResult, row, 0, m_name, MAX_OBJECT_NAME);
+         m_status = m_savedStatus = DBGetFieldLong(hResult, row, 1);
+         m_isDeleted = DBGetFieldLong(hResult, row, 2) ? true : false;
+         m_inheritAccessRights = DBGetFieldLong(hResult, row, 3) ? true : false;
+         m_timestamp = (time_t)DBGetFieldULong(hResult, row, 4);
+         m_statusCalcAlg = DBGetFieldLong(hResult, row, 5);
+         m_statusPropAlg = DBGetFieldLong(hResult, row, 6);
+         m_fixedStatus = DBGetFieldLong(hResult, row, 7);
+         m_statusShift = DBGetFieldLong(hResult, row, 8);
+         DBGetFieldByteArray(hResult, row, 9, m_statusTranslation, 4, STATUS_WARNING);
+         m_statusSingleThreshold = DBGetFieldLong(hResult, row, 10);
+         DBGetFieldByteArray(hResult, row, 11, m_statusThresholds, 4, 50);
+         m_comments = DBGetFieldAsSharedString(hResult, row, 12);
+         m_isSystem = DBGetFieldLong(hResult, row, 13) ? true : false;
+
+         int locType = DBGetFieldLong(hResult, row, 14);
+         if (locType != GL_UNSET)
+         {
+            TCHAR lat[32], lon[32];
+
+            DBGetField(hResult, row, 15, lat, 32);
+            DBGetField(hResult, row, 16, lon, 32);
+            m_geoLocation = GeoLocation(locType, lat, lon, DBGetFieldLong(hResult, row, 17), DBGetFieldULong(hResult, row, 18));
          }
-         DBFreeResult(hResult);
+         else
+         {
+            m_geoLocation = GeoLocation();
+         }
+
+         m_guid = DBGetFieldGUID(hResult, row, 19);
+         m_mapImage = DBGetFieldGUID(hResult, row, 20);
+         m_submapId = DBGetFieldULong(hResult, row, 21);
+
+         TCHAR buffer[256];
+         m_postalAddress.setCountry(DBGetField(hResult, row, 22, buffer, 64));
+         m_postalAddress.setRegion(DBGetField(hResult, row, 23, buffer, 64));
+         m_postalAddress.setCity(DBGetField(hResult, row, 24, buffer, 64));
+         m_postalAddress.setDistrict(DBGetField(hResult, row, 25, buffer, 64));
+         m_postalAddress.setStreetAddress(DBGetField(hResult, row, 26, buffer, 256));
+         m_postalAddress.setPostCode(DBGetField(hResult, row, 27, buffer, 32));
+
+         m_maintenanceEventId = DBGetFieldUInt64(hResult, row, 28);
+         m_stateBeforeMaintenance = DBGetFieldULong(hResult, row, 29);
+         m_maintenanceInitiator = DBGetFieldULong(hResult, row, 30);
+
+         m_state = m_savedState = DBGetFieldULong(hResult, row, 31);
+         m_runtimeFlags = 0;
+         m_flags = DBGetFieldULong(hResult, row, 32);
+         m_creationTime = static_cast<time_t>(DBGetFieldULong(hResult, row, 33));
+         m_alias = DBGetFieldAsSharedString(hResult, row, 34);
+         m_nameOnMap = DBGetFieldAsSharedString(hResult, row, 35);
+         m_categoryId = DBGetFieldULong(hResult, row, 36);
+         m_commentsSource = DBGetFieldAsSharedString(hResult, row, 37);
+         success = true;
       }
-      DBFreeStatement(hStmt);
    }
 
    // Load custom attributes
    if (success)
    {
-      hStmt = DBPrepare(hdb, _T("SELECT attr_name,attr_value,flags FROM object_custom_attributes WHERE object_id=?"));
-		if (hStmt != nullptr)
-		{
-			DBBind(hStmt, 1, DB_SQLTYPE_INTEGER, m_id);
-			DB_RESULT hResult = DBSelectPrepared(hStmt);
-			if (hResult != nullptr)
-			{
-			   setCustomAttributesFromDatabase(hResult);
-				DBFreeResult(hResult);
-			}
-			else
-			{
-				success = false;
-			}
-			DBFreeStatement(hStmt);
-		}
-		else
-		{
-			success = false;
-		}
+      success = rows.select(hdb, BulkLoadTable::CUSTOM_ATTRIBUTES, m_id);
+      if (success)
+         setCustomAttributesFromDatabase(rows.getResult(), rows.begin(), rows.end());
    }
 
    // Load associated dashboards
    if (success)
    {
-      hStmt = DBPrepare(hdb, _T("SELECT dashboard_id FROM dashboard_associations WHERE object_id=?"));
-      if (hStmt != nullptr)
+      success = rows.select(hdb, BulkLoadTable::DASHBOARD_ASSOCIATIONS, m_id);
+      if (success)
       {
-         DBBind(hStmt, 1, DB_SQLTYPE_INTEGER, m_id);
-         DB_RESULT hResult = DBSelectPrepared(hStmt);
-         if (hResult != nullptr)
+         for(int i = rows.begin(); i < rows.end(); i++)
          {
-            int count = DBGetNumRows(hResult);
-            for(int i = 0; i < count; i++)
-            {
-               m_dashboards.add(DBGetFieldULong(hResult, i, 0));
-            }
-            DBFreeResult(hResult);
+            m_dashboards.add(DBGetFieldULong(rows.getResult(), i, 0));
          }
-         else
-         {
-            success = false;
-         }
-         DBFreeStatement(hStmt);
-      }
-      else
-      {
-         success = false;
       }
    }
 
    // Load associated URLs
    if (success)
    {
-      hStmt = DBPrepare(hdb, _T("SELECT url_id,url,description FROM object_urls WHERE object_id=?"));
-      if (hStmt != nullptr)
+      success = rows.select(hdb, BulkLoadTable::OBJECT_URLS, m_id);
+      if (success)
       {
-         DBBind(hStmt, 1, DB_SQLTYPE_INTEGER, m_id);
-         DB_RESULT hResult = DBSelectPrepared(hStmt);
-         if (hResult != nullptr)
+         for(int i = rows.begin(); i < rows.end(); i++)
          {
-            int count = DBGetNumRows(hResult);
-            for(int i = 0; i < count; i++)
-            {
-               m_urls.add(new ObjectUrl(hResult, i));
-            }
-            DBFreeResult(hResult);
+            m_urls.add(new ObjectUrl(rows.getResult(), i));
          }
-         else
-         {
-            success = false;
-         }
-         DBFreeStatement(hStmt);
-      }
-      else
-      {
-         success = false;
       }
    }
 
@@ -708,29 +648,16 @@ bool NetObj::loadCommonProperties(DB_HANDLE hdb)
 
 	if (success)
 	{
-      success = false;
-	   hStmt = DBPrepare(hdb, _T("SELECT user_id,tag FROM responsible_users WHERE object_id=?"));
-	   if (hStmt != nullptr)
+	   success = rows.select(hdb, BulkLoadTable::RESPONSIBLE_USERS, m_id);
+	   if (success && (rows.size() > 0))
 	   {
-	      DBBind(hStmt, 1, DB_SQLTYPE_INTEGER, m_id);
-	      DB_RESULT hResult = DBSelectPrepared(hStmt);
-	      if (hResult != nullptr)
+	      m_responsibleUsers = new StructArray<ResponsibleUser>(rows.size(), 16);
+	      for(int i = rows.begin(); i < rows.end(); i++)
 	      {
-	         success = true;
-	         int numRows = DBGetNumRows(hResult);
-	         if (numRows > 0)
-	         {
-	            m_responsibleUsers = new StructArray<ResponsibleUser>(numRows, 16);
-               for(int i = 0; i < numRows; i++)
-               {
-                  ResponsibleUser *r = m_responsibleUsers->addPlaceholder();
-                  r->userId = DBGetFieldULong(hResult, i, 0);
-                  DBGetField(hResult, i, 1, r->tag, MAX_RESPONSIBLE_USER_TAG_LEN);
-               }
-	         }
-	         DBFreeResult(hResult);
+	         ResponsibleUser *r = m_responsibleUsers->addPlaceholder();
+	         r->userId = DBGetFieldULong(rows.getResult(), i, 0);
+	         DBGetField(rows.getResult(), i, 1, r->tag, MAX_RESPONSIBLE_USER_TAG_LEN);
 	      }
-	      DBFreeStatement(hStmt);
 	   }
 	}
 
@@ -748,6 +675,14 @@ void NetObj::onCustomAttributeChange()
    markAsModified(MODIFY_CUSTOM_ATTRIBUTES);
 }
 
+/**
+ * Find object by ID (used for ancestor index lookup)
+ */
+shared_ptr<NObject> NetObj::lookupObject(uint32_t id) const
+{
+   return FindObjectById(id);
+}
+
 /**
  * Add reference to the new child object
  */
@@ -768,6 +703,27 @@ void NetObj::addParent(const shared_ptr<NetObj>& object)
 	nxlog_debug_tag(DEBUG_TAG_OBJECT_RELATIONS, 7, _T("NetObj::addParent: this=%s [%d]; object=%s [%d]"), m_name, m_id, object->m_name, object->m_id);
 }
 
+/**
+ * Link multiple child objects to this object. Child list is updated once for all objects,
+ * so linking large number of objects does not cause repeated copying of child list.
+ */
+void NetObj::linkChildObjects(const SharedObjectArray<NetObj>& objects)
+{
+   if (objects.isEmpty())
+      return;
+
+   SharedObjectArray<NObject> children(objects.size(), 64);
+   for(int i = 0; i < objects.size(); i++)
+      children.add(objects.getShared(i));
+   super::addChildren(children);
+   markAsModified(MODIFY_RELATIONS);
+   nxlog_debug_tag(DEBUG_TAG_OBJECT_RELATIONS, 7, _T("NetObj::linkChildObjects: this=%s [%d]; %d objects"), m_name, m_id, objects.size());
+
+   shared_ptr<NetObj> parent = self();
+   for(int i = 0; i < objects.size(); i++)
+      objects.get(i)->addParent(parent);
+}
+
 /**
  * Delete reference to child object
  */
@@ -832,9 +788,10 @@ void NetObj::deleteObject(NetObj *initiator)
    SharedObjectArray<NetObj> *deleteList = nullptr;
    SharedObjectArray<NetObj> *detachList = nullptr;
    writeLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
    {
-      shared_ptr<NetObj> o = getChildList().getShared(i);
+      shared_ptr<NetObj> o = childList->getShared(i);
       if (o->getParentCount() == 1)
       {
          // last parent, delete object
@@ -867,11 +824,12 @@ void NetObj::deleteObject(NetObj *initiator)
    nxlog_debug_tag(DEBUG_TAG_OBJECT_RELATIONS, 5, _T("NetObj::deleteObject(): clearing parent list for object %d"), m_id);
    SharedObjectArray<NetObj> *recalcList = nullptr;
    writeLockParentList();
-   for(int i = 0; i < getParentList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> parentList = getParentList();
+   for(int i = 0; i < parentList->size(); i++)
    {
       // If parent is deletion initiator then this object already
       // removed from parent's child list
-      shared_ptr<NetObj> o = getParentList().getShared(i);
+      shared_ptr<NetObj> o = parentList->getShared(i);
       if (o.get() != initiator)
       {
          o->deleteChild(*this);
@@ -952,9 +910,10 @@ void NetObj::onObjectDelete(const NetObj& object)
 void NetObj::destroy()
 {
    // Delete references to this object from child objects
-   for(int i = 0; i < getChildList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
    {
-      NetObj *o = getChildList().get(i);
+      NetObj *o = childList->get(i);
       o->deleteParent(*this);
       if (o->getParentCount() == 0)
       {
@@ -964,9 +923,10 @@ void NetObj::destroy()
    }
 
    // Remove references to this object from parent objects
-   for(int i = 0; i < getParentList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> parentList = getParentList();
+   for(int i = 0; i < parentList->size(); i++)
    {
-      getParentList().get(i)->deleteChild(*this);
+      parentList->get(i)->deleteChild(*this);
    }
 }
 
@@ -1011,13 +971,13 @@ void NetObj::calculateCompoundStatus(bool forcedRecalc)
    unlockProperties();
 
    int newStatus;
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
    switch(iStatusAlg)
    {
       case SA_CALCULATE_MOST_CRITICAL:
-         readLockChildList();
-         for(i = 0, count = 0, mostCriticalStatus = -1; i < getChildList().size(); i++)
+         for(i = 0, count = 0, mostCriticalStatus = -1; i < childList->size(); i++)
          {
-            iChildStatus = getChildList().get(i)->getPropagatedStatus();
+            iChildStatus = childList->get(i)->getPropagatedStatus();
             if ((iChildStatus < STATUS_UNKNOWN) &&
                 (iChildStatus > mostCriticalStatus))
             {
@@ -1026,16 +986,14 @@ void NetObj::calculateCompoundStatus(bool forcedRecalc)
             }
          }
          newStatus = (count > 0) ? mostCriticalStatus : STATUS_UNKNOWN;
-         unlockChildList();
          break;
       case SA_CALCULATE_SINGLE_THRESHOLD:
       case SA_CALCULATE_MULTIPLE_THRESHOLDS:
          // Step 1: calculate severity raitings
          memset(nRating, 0, sizeof(int) * 5);
-         readLockChildList();
-         for(i = 0, count = 0; i < getChildList().size(); i++)
+         for(i = 0, count = 0; i < childList->size(); i++)
          {
-            iChildStatus = getChildList().get(i)->getPropagatedStatus();
+            iChildStatus = childList->get(i)->getPropagatedStatus();
             if (iChildStatus < STATUS_UNKNOWN)
             {
                while(iChildStatus >= 0)
@@ -1043,7 +1001,6 @@ void NetObj::calculateCompoundStatus(bool forcedRecalc)
                count++;
             }
          }
-         unlockChildList();
 
          // Step 2: check what severity rating is above threshold
          if (count > 0)
@@ -1119,11 +1076,131 @@ void NetObj::calculateCompoundStatus(bool forcedRecalc)
 
    // Cause parent object(s) to recalculate it's status
    if (updateParents)
+      propagateStatusToParents();
+}
+
+/**
+ * Delay (in milliseconds) before processing pending status recalculations. Allows to collect
+ * status changes of many child objects and recalculate status of each parent only once.
+ */
+#define STATUS_PROPAGATION_DELAY    100
+
+/**
+ * Object waiting for status recalculation
+ */
+struct PendingStatusRecalculation
+{
+   uint32_t objectId;
+   int depth;   // Depth in object tree
+};
+
+/**
+ * Objects waiting for status recalculation
+ */
+static HashMap<uint32_t, PendingStatusRecalculation> s_pendingStatusRecalculations(Ownership::True);
+static Mutex s_pendingStatusRecalculationsLock(MutexType::FAST);
+static bool s_statusRecalculationScheduled = false;
+
+/**
+ * Get object depth in object tree (longest path to top level object)
+ */
+int NetObj::getHierarchyDepth() const
+{
+   int depth = 0;
+   shared_ptr<const SharedObjectArray<NetObj>> parentList = getParentList();
+   for(int i = 0; i < parentList->size(); i++)
    {
-      readLockParentList();
-      for(i = 0; i < getParentList().size(); i++)
-         getParentList().get(i)->calculateCompoundStatus();
-      unlockParentList();
+      int d = parentList->get(i)->getHierarchyDepth() + 1;
+      if (d > depth)
+         depth = d;
+   }
+   return depth;
+}
+
+/**
+ * Process pending status recalculations. Objects are processed from deepest to top level, so
+ * parent objects marked for recalculation by processed objects are handled within same pass
+ * and status of each object is recalculated only once.
+ */
+static void ProcessPendingStatusRecalculations()
+{
+   IntegerArray<uint32_t> batch(256, 256);
+   int count = 0;
+   while(true)
+   {
+      s_pendingStatusRecalculationsLock.lock();
+      if (s_pendingStatusRecalculations.size() == 0)
+      {
+         s_statusRecalculationScheduled = false;
+         s_pendingStatusRecalculationsLock.unlock();
+         break;
+      }
+
+      int maxDepth = -1;
+      auto it = s_pendingStatusRecalculations.begin();
+      while(it.hasNext())
+      {
+         int depth = it.next()->depth;
+         if (depth > maxDepth)
+            maxDepth = depth;
+      }
+
+      batch.clear();
+      auto it2 = s_pendingStatusRecalculations.begin();
+      while(it2.hasNext())
+      {
+         PendingStatusRecalculation *entry = it2.next();
+         if (entry->depth == maxDepth)
+         {
+            batch.add(entry->objectId);
+            it2.remove();
+         }
+      }
+      s_pendingStatusRecalculationsLock.unlock();
+
+      for(int i = 0; i < batch.size(); i++)
+      {
+         shared_ptr<NetObj> object = FindObjectById(batch.get(i));
+         if ((object != nullptr) && !object->isDeleted())
+            object->calculateCompoundStatus();
+      }
+      count += batch.size();
+   }
+   nxlog_debug_tag(_T("obj.status"), 7, _T("ProcessPendingStatusRecalculations: %d objects processed"), count);
+}
+
+/**
+ * Schedule status recalculation for all parent objects
+ */
+void NetObj::propagateStatusToParents()
+{
+   unique_ptr<SharedObjectArray<NetObj>> parents = getParents();
+   for(int i = 0; i < parents->size(); i++)
+   {
+      NetObj *parent = parents->get(i);
+
+      s_pendingStatusRecalculationsLock.lock();
+      bool pending = s_pendingStatusRecalculations.contains(parent->getId());
+      s_pendingStatusRecalculationsLock.unlock();
+      if (pending)
+         continue;
+
+      int depth = parent->getHierarchyDepth();
+
+      s_pendingStatusRecalculationsLock.lock();
+      if (!s_pendingStatusRecalculations.contains(parent->getId()))
+      {
+         auto entry = new PendingStatusRecalculation;
+         entry->objectId = parent->getId();
+         entry->depth = depth;
+         s_pendingStatusRecalculations.set(parent->getId(), entry);
+      }
+      if (!s_statusRecalculationScheduled)
+      {
+         s_statusRecalculationScheduled = true;
+         ThreadPoolScheduleRelative(g_mainThreadPool, STATUS_PROPAGATION_DELAY, ProcessPendingStatusRecalculations);
+      }
+      s_pendingStatusRecalculationsLock.unlock();
    }
 }
 
@@ -1132,24 +1209,13 @@ void NetObj::calculateCompoundStatus(bool forcedRecalc)
  */
 bool NetObj::loadACLFromDB(DB_HANDLE hdb)
 {
-   bool success = false;
+   ObjectRows rows;
+   if (!rows.select(hdb, BulkLoadTable::ACL, m_id))
+      return false;
 
-	DB_STATEMENT hStmt = DBPrepare(hdb, _T("SELECT user_id,access_rights FROM acl WHERE object_id=?"));
-	if (hStmt != NULL)
-	{
-		DBBind(hStmt, 1, DB_SQLTYPE_INTEGER, m_id);
-		DB_RESULT hResult = DBSelectPrepared(hStmt);
-		if (hResult != NULL)
-		{
-			int count = DBGetNumRows(hResult);
-			for(int i = 0; i < count; i++)
-				m_accessList.addElement(DBGetFieldULong(hResult, i, 0), DBGetFieldULong(hResult, i, 1));
-			DBFreeResult(hResult);
-			success = true;
-		}
-		DBFreeStatement(hStmt);
-	}
-   return success;
+   for(int i = rows.begin(); i < rows.end(); i++)
+      m_accessList.addElement(DBGetFieldULong(rows.getResult(), i, 0), DBGetFieldULong(rows.getResult(), i, 1));
+   return true;
 }
 
 /**
@@ -1322,17 +1388,15 @@ void NetObj::fillMessage(NXCPMessage *msg, uint32_t userId)
    UINT32 dwId;
    int i;
 
-   readLockParentList();
-   msg->setField(VID_PARENT_CNT, getParentList().size());
-   for(i = 0, dwId = VID_PARENT_ID_BASE; i < getParentList().size(); i++, dwId++)
-      msg->setField(dwId, getParentList().get(i)->getId());
-   unlockParentList();
+   shared_ptr<const SharedObjectArray<NetObj>> parentList = getParentList();
+   msg->setField(VID_PARENT_CNT, parentList->size());
+   for(i = 0, dwId = VID_PARENT_ID_BASE; i < parentList->size(); i++, dwId++)
+      msg->setField(dwId, parentList->get(i)->getId());
 
-   readLockChildList();
-   msg->setField(VID_CHILD_CNT, getChildList().size());
-   for(i = 0, dwId = VID_CHILD_ID_BASE; i < getChildList().size(); i++, dwId++)
-      msg->setField(dwId, getChildList().get(i)->getId());
-   unlockChildList();
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   msg->setField(VID_CHILD_CNT, childList->size());
+   for(i = 0, dwId = VID_CHILD_ID_BASE; i < childList->size(); i++, dwId++)
+      msg->setField(dwId, childList->get(i)->getId());
 
    lockResponsibleUsersList();
    if (m_responsibleUsers != nullptr)
@@ -1372,6 +1436,7 @@ void NetObj::setModified(uint32_t flags, bool notify)
 
    InterlockedOr(&m_modified, flags);
    m_timestamp = time(nullptr);
+   InvalidateSharedObjectUpdates(m_id);
 
    // Send event to all connected clients
    if (notify && !m_isHidden && !m_isSystem)
@@ -1633,10 +1698,9 @@ uint32_t NetObj::getUserRights(uint32_t userId) const
       if (m_inheritAccessRights)
       {
          rights = 0;
-         readLockParentList();
-         for(int i = 0; i < getParentList().size(); i++)
-            rights |= getParentList().get(i)->getUserRights(userId);
-         unlockParentList();
+         shared_ptr<const SharedObjectArray<NetObj>> parentList = getParentList();
+         for(int i = 0; i < parentList->size(); i++)
+            rights |= parentList->get(i)->getUserRights(userId);
       }
    }
 
@@ -1699,16 +1763,12 @@ bool NetObj::setMgmtStatus(bool isManaged)
       PostSystemEvent(isManaged ? EVENT_NODE_UNKNOWN : EVENT_NODE_UNMANAGED, m_id, "d", oldStatus);
 
    // Change status for child objects also
-   readLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
-      getChildList().get(i)->setMgmtStatus(isManaged);
-   unlockChildList();
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
+      childList->get(i)->setMgmtStatus(isManaged);
 
    // Cause parent object(s) to recalculate it's status
-   readLockParentList();
-   for(int i = 0; i < getParentList().size(); i++)
-      getParentList().get(i)->calculateCompoundStatus();
-   unlockParentList();
+   propagateStatusToParents();
    return true;
 }
 
@@ -1734,12 +1794,12 @@ void NetObj::sendPollerMsg(const TCHAR *format, ...)
  */
 void NetObj::addChildNodesToList(SharedObjectArray<Node> *nodeList, uint32_t userId)
 {
-   readLockChildList();
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
 
    // Walk through our own child list
-   for(int i = 0; i < getChildList().size(); i++)
+   for(int i = 0; i < childList->size(); i++)
    {
-      NetObj *object = getChildList().get(i);
+      NetObj *object = childList->get(i);
       if (!object->checkAccessRights(userId, OBJECT_ACCESS_READ))
          continue;
 
@@ -1751,7 +1811,7 @@ void NetObj::addChildNodesToList(SharedObjectArray<Node> *nodeList, uint32_t use
 				if (nodeList->get(j)->getId() == object->getId())
                break;
          if (j == nodeList->size())
-				nodeList->add(static_pointer_cast<Node>(getChildList().getShared(i)));
+				nodeList->add(static_pointer_cast<Node>(childList->getShared(i)));
       }
       else
       {
@@ -1759,7 +1819,6 @@ void NetObj::addChildNodesToList(SharedObjectArray<Node> *nodeList, uint32_t use
       }
    }
 
-   unlockChildList();
 }
 
 /**
@@ -1767,12 +1826,12 @@ void NetObj::addChildNodesToList(SharedObjectArray<Node> *nodeList, uint32_t use
  */
 void NetObj::addChildDCTargetsToList(SharedObjectArray<DataCollectionTarget> *dctList, uint32_t userId)
 {
-   readLockChildList();
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
 
    // Walk through our own child list
-   for(int i = 0; i < getChildList().size(); i++)
+   for(int i = 0; i < childList->size(); i++)
    {
-      NetObj *object = getChildList().get(i);
+      NetObj *object = childList->get(i);
       if (!object->checkAccessRights(userId, OBJECT_ACCESS_READ))
          continue;
 
@@ -1784,12 +1843,11 @@ void NetObj::addChildDCTargetsToList(SharedObjectArray<DataCollectionTarget> *dc
 				if (dctList->get(j)->getId() == object->getId())
                break;
          if (j == dctList->size())
-				dctList->add(static_pointer_cast<DataCollectionTarget>(getChildList().getShared(i)));
+				dctList->add(static_pointer_cast<DataCollectionTarget>(childList->getShared(i)));
       }
       object->addChildDCTargetsToList(dctList, userId);
    }
 
-   unlockChildList();
 }
 
 /**
@@ -1797,10 +1855,9 @@ void NetObj::addChildDCTargetsToList(SharedObjectArray<DataCollectionTarget> *dc
  */
 void NetObj::hide()
 {
-   readLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
-      getChildList().get(i)->hide();
-   unlockChildList();
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
+      childList->get(i)->hide();
 
 	lockProperties();
    m_isHidden = true;
@@ -1814,14 +1871,14 @@ void NetObj::unhide()
 {
    lockProperties();
    m_isHidden = false;
+   InvalidateSharedObjectUpdates(m_id);
    if (!m_isSystem)
       EnumerateClientSessions(BroadcastObjectChange, this);
    unlockProperties();
 
-   readLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
-      getChildList().get(i)->unhide();
-   unlockChildList();
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
+      childList->get(i)->unhide();
 }
 
 /**
@@ -1960,23 +2017,19 @@ void NetObj::commentsToMessage(NXCPMessage *pMsg)
  */
 bool NetObj::loadTrustedNodes(DB_HANDLE hdb)
 {
-	TCHAR query[256];
-	_sntprintf(query, 256, _T("SELECT target_node_id FROM trusted_nodes WHERE source_object_id=%d"), m_id);
-	DB_RESULT hResult = DBSelect(hdb, query);
-	if (hResult != NULL)
-	{
-		int count = DBGetNumRows(hResult);
-		if (count > 0)
-		{
-		   m_trustedNodes = new IntegerArray<uint32_t>(count);
-			for(int i = 0; i < count; i++)
-			{
-				m_trustedNodes->add(DBGetFieldULong(hResult, i, 0));
-			}
-		}
-		DBFreeResult(hResult);
-	}
-	return (hResult != nullptr);
+   ObjectRows rows;
+   if (!rows.select(hdb, BulkLoadTable::TRUSTED_NODES, m_id))
+      return false;
+
+   if (rows.size() > 0)
+   {
+      m_trustedNodes = new IntegerArray<uint32_t>(rows.size());
+      for(int i = rows.begin(); i < rows.end(); i++)
+      {
+         m_trustedNodes->add(DBGetFieldULong(rows.getResult(), i, 0));
+      }
+   }
+   return true;
 }
 
 /**
@@ -2031,16 +2084,15 @@ NXSL_Value *NetObj::getParentsForNXSL(NXSL_VM *vm)
 	NXSL_Array *parents = new NXSL_Array(vm);
 	int index = 0;
 
-	readLockParentList();
-	for(int i = 0; i < getParentList().size(); i++)
+	shared_ptr<const SharedObjectArray<NetObj>> parentList = getParentList();
+	for(int i = 0; i < parentList->size(); i++)
 	{
-	   NetObj *obj = getParentList().get(i);
+	   NetObj *obj = parentList->get(i);
 		if (obj->getObjectClass() != OBJECT_TEMPLATE)
 		{
 			parents->set(index++, obj->createNXSLObject(vm));
 		}
 	}
-	unlockParentList();
 
 	return vm->createValue(parents);
 }
@@ -2053,12 +2105,11 @@ NXSL_Value *NetObj::getChildrenForNXSL(NXSL_VM *vm)
 	NXSL_Array *children = new NXSL_Array(vm);
 	int index = 0;
 
-	readLockChildList();
-	for(int i = 0; i < getChildList().size(); i++)
+	shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+	for(int i = 0; i < childList->size(); i++)
 	{
-      children->set(index++, getChildList().get(i)->createNXSLObject(vm));
+      children->set(index++, childList->get(i)->createNXSLObject(vm));
 	}
-	unlockChildList();
 
 	return vm->createValue(children);
 }
@@ -2068,17 +2119,16 @@ NXSL_Value *NetObj::getChildrenForNXSL(NXSL_VM *vm)
  */
 void NetObj::getFullChildListInternal(ObjectIndex *list, bool eventSourceOnly) const
 {
-	readLockChildList();
-	for(int i = 0; i < getChildList().size(); i++)
+	shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+	for(int i = 0; i < childList->size(); i++)
 	{
-	   NetObj *object = getChildList().get(i);
+	   NetObj *object = childList->get(i);
 		if (!eventSourceOnly || IsEventSource(object->getObjectClass()))
 		{
 			list->put(object->getId(), object->self());
 		}
 		object->getFullChildListInternal(list, eventSourceOnly);
 	}
-	unlockChildList();
 }
 
 /**
@@ -2103,14 +2153,13 @@ unique_ptr<SharedObjectArray<NetObj>> NetObj::getAllChildren(bool eventSourceOnl
  */
 unique_ptr<SharedObjectArray<NetObj>> NetObj::getChildren(int typeFilter) const
 {
-	readLockChildList();
-	auto list = new SharedObjectArray<NetObj>(getChildList().size());
-	for(int i = 0; i < getChildList().size(); i++)
+	shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+	auto list = new SharedObjectArray<NetObj>(childList->size());
+	for(int i = 0; i < childList->size(); i++)
 	{
-		if ((typeFilter == -1) || (typeFilter == getChildList().get(i)->getObjectClass()))
-			list->add(getChildList().getShared(i));
+		if ((typeFilter == -1) || (typeFilter == childList->get(i)->getObjectClass()))
+			list->add(childList->getShared(i));
 	}
-	unlockChildList();
 	return unique_ptr<SharedObjectArray<NetObj>>(list);
 }
 
@@ -2120,21 +2169,20 @@ unique_ptr<SharedObjectArray<NetObj>> NetObj::getChildren(int typeFilter) const
 int NetObj::getChildrenCount(int typeFilter) const
 {
    int count;
-   readLockChildList();
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
    if (typeFilter == -1)
    {
-      count = getChildList().size();
+      count = childList->size();
    }
    else
    {
       count = 0;
-      for(int i = 0; i < getChildList().size(); i++)
+      for(int i = 0; i < childList->size(); i++)
       {
-          if (typeFilter == getChildList().get(i)->getObjectClass())
+          if (typeFilter == childList->get(i)->getObjectClass())
              count++;
       }
    }
-   unlockChildList();
    return count;
 }
 
@@ -2147,14 +2195,13 @@ int NetObj::getChildrenCount(int typeFilter) const
  */
 unique_ptr<SharedObjectArray<NetObj>> NetObj::getParents(int typeFilter) const
 {
-    readLockParentList();
-    auto list = new SharedObjectArray<NetObj>(getParentList().size(), 16);
-    for(int i = 0; i < getParentList().size(); i++)
+    shared_ptr<const SharedObjectArray<NetObj>> parentList = getParentList();
+    auto list = new SharedObjectArray<NetObj>(parentList->size(), 16);
+    for(int i = 0; i < parentList->size(); i++)
     {
-        if ((typeFilter == -1) || (typeFilter == getParentList().get(i)->getObjectClass()))
-           list->add(getParentList().getShared(i));
+        if ((typeFilter == -1) || (typeFilter == parentList->get(i)->getObjectClass()))
+           list->add(parentList->getShared(i));
     }
-    unlockParentList();
     return unique_ptr<SharedObjectArray<NetObj>>(list);
 }
 
@@ -2164,21 +2211,20 @@ unique_ptr<SharedObjectArray<NetObj>> NetObj::getParents(int typeFilter) const
 int NetObj::getParentsCount(int typeFilter) const
 {
    int count;
-   readLockParentList();
+   shared_ptr<const SharedObjectArray<NetObj>> parentList = getParentList();
    if (typeFilter == -1)
    {
-      count = getParentList().size();
+      count = parentList->size();
    }
    else
    {
       count = 0;
-      for(int i = 0; i < getParentList().size(); i++)
+      for(int i = 0; i < parentList->size(); i++)
       {
-          if (typeFilter == getParentList().get(i)->getObjectClass())
+          if (typeFilter == parentList->get(i)->getObjectClass())
              count++;
       }
    }
-   unlockParentList();
    return count;
 }
 
@@ -2188,17 +2234,16 @@ int NetObj::getParentsCount(int typeFilter) const
 shared_ptr<NetObj> NetObj::findChildObject(const TCHAR *name, int typeFilter) const
 {
    shared_ptr<NetObj> object;
-	readLockChildList();
-	for(int i = 0; i < getChildList().size(); i++)
+	shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+	for(int i = 0; i < childList->size(); i++)
 	{
-	   NetObj *o = getChildList().get(i);
+	   NetObj *o = childList->get(i);
       if (((typeFilter == -1) || (typeFilter == o->getObjectClass())) && !_tcsicmp(name, o->getName()))
       {
          object = o->self();
          break;
       }
 	}
-	unlockChildList();
 	return object;
 }
 
@@ -2208,17 +2253,16 @@ shared_ptr<NetObj> NetObj::findChildObject(const TCHAR *name, int typeFilter) co
 shared_ptr<Node> NetObj::findChildNode(const InetAddress& addr) const
 {
    shared_ptr<Node> node;
-   readLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
    {
-      NetObj *curr = getChildList().get(i);
+      NetObj *curr = childList->get(i);
       if ((curr->getObjectClass() == OBJECT_NODE) && addr.equals(static_cast<Node*>(curr)->getIpAddress()))
       {
          node = static_cast<Node*>(curr)->self();
          break;
       }
    }
-   unlockChildList();
    return node;
 }
 
@@ -2228,12 +2272,11 @@ shared_ptr<Node> NetObj::findChildNode(const InetAddress& addr) const
 void NetObj::updateObjectIndexes()
 {
    NetObjInsert(self(), false, false);
-   readLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
    {
-      NetObjInsert(getChildList().getShared(i), false, false);
+      NetObjInsert(childList->getShared(i), false, false);
    }
-   unlockChildList();
 }
 
 /**
@@ -2520,14 +2563,13 @@ void NetObj::enterMaintenanceMode(uint32_t userId, const TCHAR *comments)
 {
    DbgPrintf(4, _T("Entering maintenance mode for object %s [%d] (%s)"), m_name, m_id, getObjectClassName());
 
-   readLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
    {
-      NetObj *object = getChildList().get(i);
+      NetObj *object = childList->get(i);
       if (object->getStatus() != STATUS_UNMANAGED)
          object->enterMaintenanceMode(userId, comments);
    }
-   unlockChildList();
 }
 
 /**
@@ -2537,14 +2579,13 @@ void NetObj::leaveMaintenanceMode(uint32_t userId)
 {
    DbgPrintf(4, _T("Leaving maintenance mode for object %s [%d] (%s)"), m_name, m_id, getObjectClassName());
 
-   readLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
    {
-      NetObj *object = getChildList().get(i);
+      NetObj *object = childList->get(i);
       if (object->getStatus() != STATUS_UNMANAGED)
          object->leaveMaintenanceMode(userId);
    }
-   unlockChildList();
 }
 
 /**
@@ -2642,17 +2683,15 @@ json_t *NetObj::toJson()
    unlockProperties();
 
    json_t *children = json_array();
-   readLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
-      json_array_append_new(children, json_integer(getChildList().get(i)->getId()));
-   unlockChildList();
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
+      json_array_append_new(children, json_integer(childList->get(i)->getId()));
    json_object_set_new(root, "children", children);
 
    json_t *parents = json_array();
-   readLockParentList();
-   for(int i = 0; i < getParentList().size(); i++)
-      json_array_append_new(parents, json_integer(getParentList().get(i)->getId()));
-   unlockParentList();
+   shared_ptr<const SharedObjectArray<NetObj>> parentList = getParentList();
+   for(int i = 0; i < parentList->size(); i++)
+      json_array_append_new(parents, json_integer(parentList->get(i)->getId()));
    json_object_set_new(root, "parents", parents);
 
    json_t *responsibleUsers = json_array();
@@ -3088,10 +3127,10 @@ StringBuffer NetObj::expandText(const TCHAR *textTemplate, const Alarm *alarm, c
  */
 void NetObj::getAllResponsibleUsersInternal(StructArray<ResponsibleUser> *list, const TCHAR *tag) const
 {
-   readLockParentList();
-   for(int i = 0; i < getParentList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> parentList = getParentList();
+   for(int i = 0; i < parentList->size(); i++)
    {
-      NetObj *obj = getParentList().get(i);
+      NetObj *obj = parentList->get(i);
       obj->lockResponsibleUsersList();
       if (obj->m_responsibleUsers != nullptr)
       {
@@ -3115,9 +3154,8 @@ void NetObj::getAllResponsibleUsersInternal(StructArray<ResponsibleUser> *list,
          }
       }
       obj->unlockResponsibleUsersList();
-      getParentList().get(i)->getAllResponsibleUsersInternal(list, tag);
+      parentList->get(i)->getAllResponsibleUsersInternal(list, tag);
    }
-   unlockParentList();
 }
 
 /**
@@ -1564,18 +1564,16 @@ void Node::addVrrpInterfaces(InterfaceList *ifList)
  */
 shared_ptr<Interface> Node::findInterfaceByIndex(UINT32 ifIndex) const
 {
-   readLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
-      if (getChildList().get(i)->getObjectClass() == OBJECT_INTERFACE)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
+      if (childList->get(i)->getObjectClass() == OBJECT_INTERFACE)
       {
-         auto iface = static_pointer_cast<Interface>(getChildList().getShared(i));
+         auto iface = static_pointer_cast<Interface>(childList->getShared(i));
          if (iface->getIfIndex() == ifIndex)
          {
-            unlockChildList();
             return iface;
          }
       }
-   unlockChildList();
    return shared_ptr<Interface>();
 }
 
@@ -1588,18 +1586,16 @@ shared_ptr<Interface> Node::findInterfaceByName(const TCHAR *name) const
    if ((name == nullptr) || (name[0] == 0))
       return shared_ptr<Interface>();
 
-   readLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
-      if (getChildList().get(i)->getObjectClass() == OBJECT_INTERFACE)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
+      if (childList->get(i)->getObjectClass() == OBJECT_INTERFACE)
       {
-         auto iface = static_pointer_cast<Interface>(getChildList().getShared(i));
+         auto iface = static_pointer_cast<Interface>(childList->getShared(i));
          if (!_tcsicmp(iface->getName(), name) || !_tcsicmp(iface->getDescription(), name))
          {
-            unlockChildList();
             return iface;
          }
       }
-   unlockChildList();
    return shared_ptr<Interface>();
 }
 
@@ -1612,18 +1608,16 @@ shared_ptr<Interface> Node::findInterfaceByAlias(const TCHAR *alias) const
    if ((alias == nullptr) || (alias[0] == 0))
       return shared_ptr<Interface>();
 
-   readLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
-      if (getChildList().get(i)->getObjectClass() == OBJECT_INTERFACE)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
+      if (childList->get(i)->getObjectClass() == OBJECT_INTERFACE)
       {
-         auto iface = static_pointer_cast<Interface>(getChildList().getShared(i));
+         auto iface = static_pointer_cast<Interface>(childList->getShared(i));
          if (!_tcsicmp(iface->getAlias(), alias))
          {
-            unlockChildList();
             return iface;
          }
       }
-   unlockChildList();
    return shared_ptr<Interface>();
 }
 
@@ -1633,18 +1627,16 @@ shared_ptr<Interface> Node::findInterfaceByAlias(const TCHAR *alias) const
  */
 shared_ptr<Interface> Node::findInterfaceByLocation(const InterfacePhysicalLocation& location) const
 {
-   readLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
-      if (getChildList().get(i)->getObjectClass() == OBJECT_INTERFACE)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
+      if (childList->get(i)->getObjectClass() == OBJECT_INTERFACE)
       {
-         auto iface = static_pointer_cast<Interface>(getChildList().getShared(i));
+         auto iface = static_pointer_cast<Interface>(childList->getShared(i));
          if (iface->isPhysicalPort() && iface->getPhysicalLocation().equals(location))
          {
-            unlockChildList();
             return iface;
          }
       }
-   unlockChildList();
    return shared_ptr<Interface>();
 }
 
@@ -1655,18 +1647,17 @@ shared_ptr<Interface> Node::findInterfaceByLocation(const InterfacePhysicalLocat
 shared_ptr<Interface> Node::findInterfaceByMAC(const MacAddress& macAddr) const
 {
    shared_ptr<Interface> iface;
-   readLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
    {
-      NetObj *curr = getChildList().get(i);
+      NetObj *curr = childList->get(i);
       if ((curr->getObjectClass() == OBJECT_INTERFACE) &&
           static_cast<Interface*>(curr)->getMacAddr().equals(macAddr))
       {
-         iface = static_pointer_cast<Interface>(getChildList().getShared(i));
+         iface = static_pointer_cast<Interface>(childList->getShared(i));
          break;
       }
    }
-   unlockChildList();
    return iface;
 }
 
@@ -1681,18 +1672,17 @@ shared_ptr<Interface> Node::findInterfaceByIP(const InetAddress& addr) const
    if (!addr.isValid())
       return iface;
 
-   readLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
    {
-      NetObj *curr = getChildList().get(i);
+      NetObj *curr = childList->get(i);
       if ((curr->getObjectClass() == OBJECT_INTERFACE) &&
           static_cast<Interface*>(curr)->getIpAddressList()->hasAddress(addr))
       {
-         iface = static_pointer_cast<Interface>(getChildList().getShared(i));
+         iface = static_pointer_cast<Interface>(childList->getShared(i));
          break;
       }
    }
-   unlockChildList();
    return iface;
 }
 
@@ -1703,10 +1693,10 @@ shared_ptr<Interface> Node::findInterfaceByIP(const InetAddress& addr) const
 shared_ptr<Interface> Node::findInterfaceBySubnet(const InetAddress& subnet) const
 {
    shared_ptr<Interface> iface;
-   readLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
    {
-      NetObj *curr = getChildList().get(i);
+      NetObj *curr = childList->get(i);
       if (curr->getObjectClass() != OBJECT_INTERFACE)
          continue;
 
@@ -1715,13 +1705,12 @@ shared_ptr<Interface> Node::findInterfaceBySubnet(const InetAddress& subnet) con
       {
          if (subnet.contain(addrList->get(j)))
          {
-            iface = static_pointer_cast<Interface>(getChildList().getShared(i));
+            iface = static_pointer_cast<Interface>(childList->getShared(i));
             goto stop_search;
          }
       }
    }
 stop_search:
-   unlockChildList();
    return iface;
 }
 
@@ -1732,10 +1721,10 @@ shared_ptr<Interface> Node::findInterfaceBySubnet(const InetAddress& subnet) con
 shared_ptr<Interface> Node::findInterfaceInSameSubnet(const InetAddress& addr) const
 {
    shared_ptr<Interface> iface;
-   readLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
    {
-      NetObj *curr = getChildList().get(i);
+      NetObj *curr = childList->get(i);
       if (curr->getObjectClass() != OBJECT_INTERFACE)
          continue;
 
@@ -1744,13 +1733,12 @@ shared_ptr<Interface> Node::findInterfaceInSameSubnet(const InetAddress& addr) c
       {
          if (addrList->get(j).sameSubnet(addr))
          {
-            iface = static_pointer_cast<Interface>(getChildList().getShared(i));
+            iface = static_pointer_cast<Interface>(childList->getShared(i));
             goto stop_search;
          }
       }
    }
 stop_search:
-   unlockChildList();
    return iface;
 }
 
@@ -1760,17 +1748,16 @@ shared_ptr<Interface> Node::findInterfaceInSameSubnet(const InetAddress& addr) c
 shared_ptr<Interface> Node::findBridgePort(UINT32 bridgePortNumber) const
 {
    shared_ptr<Interface> iface;
-   readLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
    {
-      NetObj *curr = getChildList().get(i);
+      NetObj *curr = childList->get(i);
       if ((curr->getObjectClass() == OBJECT_INTERFACE) && (static_cast<Interface*>(curr)->getBridgePortNumber() == bridgePortNumber))
       {
-         iface = static_pointer_cast<Interface>(getChildList().getShared(i));
+         iface = static_pointer_cast<Interface>(childList->getShared(i));
          break;
       }
    }
-   unlockChildList();
    return iface;
 }
 
@@ -1780,12 +1767,12 @@ shared_ptr<Interface> Node::findBridgePort(UINT32 bridgePortNumber) const
 shared_ptr<NetObj> Node::findConnectionPoint(UINT32 *localIfId, BYTE *localMacAddr, int *type)
 {
    shared_ptr<NetObj> cp;
-   readLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
    {
-      if (getChildList().get(i)->getObjectClass() == OBJECT_INTERFACE)
+      if (childList->get(i)->getObjectClass() == OBJECT_INTERFACE)
       {
-         auto iface = static_cast<Interface*>(getChildList().get(i));
+         auto iface = static_cast<Interface*>(childList->get(i));
          cp = FindInterfaceConnectionPoint(iface->getMacAddr(), type);
          if (cp != nullptr)
          {
@@ -1795,7 +1782,6 @@ shared_ptr<NetObj> Node::findConnectionPoint(UINT32 *localIfId, BYTE *localMacAd
          }
       }
    }
-   unlockChildList();
    return cp;
 }
 
@@ -1805,18 +1791,17 @@ shared_ptr<NetObj> Node::findConnectionPoint(UINT32 *localIfId, BYTE *localMacAd
 shared_ptr<AccessPoint> Node::findAccessPointByMAC(const MacAddress& macAddr) const
 {
    shared_ptr<AccessPoint> ap;
-   readLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
    {
-      NetObj *curr = getChildList().get(i);
+      NetObj *curr = childList->get(i);
       if ((curr->getObjectClass() == OBJECT_ACCESSPOINT) &&
           static_cast<AccessPoint*>(curr)->getMacAddr().equals(macAddr))
       {
-         ap = static_pointer_cast<AccessPoint>(getChildList().getShared(i));
+         ap = static_pointer_cast<AccessPoint>(childList->getShared(i));
          break;
       }
    }
-   unlockChildList();
    return ap;
 }
 
@@ -1826,18 +1811,17 @@ shared_ptr<AccessPoint> Node::findAccessPointByMAC(const MacAddress& macAddr) co
 shared_ptr<AccessPoint> Node::findAccessPointByRadioId(int rfIndex) const
 {
    shared_ptr<AccessPoint> ap;
-   readLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
    {
-      NetObj *curr = getChildList().get(i);
+      NetObj *curr = childList->get(i);
       if ((curr->getObjectClass() == OBJECT_ACCESSPOINT) &&
           static_cast<AccessPoint*>(curr)->isMyRadio(rfIndex))
       {
-         ap = static_pointer_cast<AccessPoint>(getChildList().getShared(i));
+         ap = static_pointer_cast<AccessPoint>(childList->getShared(i));
          break;
       }
    }
-   unlockChildList();
    return ap;
 }
 
@@ -1847,18 +1831,17 @@ shared_ptr<AccessPoint> Node::findAccessPointByRadioId(int rfIndex) const
 shared_ptr<AccessPoint> Node::findAccessPointByBSSID(const BYTE *bssid) const
 {
    shared_ptr<AccessPoint> ap;
-   readLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
    {
-      NetObj *curr = getChildList().get(i);
+      NetObj *curr = childList->get(i);
       if ((curr->getObjectClass() == OBJECT_ACCESSPOINT) &&
           (static_cast<AccessPoint*>(curr)->getMacAddr().equals(bssid) || static_cast<AccessPoint*>(curr)->isMyRadio(bssid)))
       {
-         ap = static_pointer_cast<AccessPoint>(getChildList().getShared(i));
+         ap = static_pointer_cast<AccessPoint>(childList->getShared(i));
          break;
       }
    }
-   unlockChildList();
    return ap;
 }
 
@@ -1867,18 +1850,16 @@ shared_ptr<AccessPoint> Node::findAccessPointByBSSID(const BYTE *bssid) const
  */
 bool Node::isMyIP(const InetAddress& addr) const
 {
-   readLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
    {
-      NetObj *curr = getChildList().get(i);
+      NetObj *curr = childList->get(i);
       if ((curr->getObjectClass() == OBJECT_INTERFACE) &&
           static_cast<Interface*>(curr)->getIpAddressList()->hasAddress(addr))
       {
-         unlockChildList();
          return true;
       }
    }
-   unlockChildList();
    return false;
 }
 
@@ -2072,8 +2053,12 @@ shared_ptr<Interface> Node::createNewInterface(InterfaceInfo *info, bool manuall
 
    if (!iface->isExcludedFromTopology())
    {
+      NotifyNetworkMapsOnTopologyChange(m_id);
       for(int i = 0; i < bindList.size(); i++)
+      {
          bindList.get(i)->addNode(self());
+         NotifyNetworkMapsOnTopologyChange(bindList.get(i)->getId());
+      }
 
       for(int i = 0; i < createList.size(); i++)
       {
@@ -2100,10 +2085,10 @@ void Node::deleteInterface(Interface *iface)
          bool doUnlink = true;
          const InetAddress *addr = list.get(i);
 
-         readLockChildList();
-         for(int j = 0; j < getChildList().size(); j++)
+         shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+         for(int j = 0; j < childList->size(); j++)
          {
-            NetObj *curr = getChildList().get(j);
+            NetObj *curr = childList->get(j);
             if ((curr->getObjectClass() == OBJECT_INTERFACE) && (curr != iface) &&
                 static_cast<Interface*>(curr)->getIpAddressList()->findSameSubnetAddress(*addr).isValid())
             {
@@ -2111,7 +2096,6 @@ void Node::deleteInterface(Interface *iface)
                break;
             }
          }
-         unlockChildList();
 
          if (doUnlink)
          {
@@ -2121,6 +2105,7 @@ void Node::deleteInterface(Interface *iface)
             {
                deleteParent(*subnet);
                subnet->deleteChild(*this);
+               NotifyNetworkMapsOnTopologyChange(subnet->getId());
             }
             nxlog_debug_tag(DEBUG_TAG_NODE_INTERFACES, 5, _T("Node::deleteInterface(node=%s [%d], interface=%s [%d]): unlinked from subnet %s [%d]"),
                       m_name, m_id, iface->getName(), iface->getId(),
@@ -2130,6 +2115,7 @@ void Node::deleteInterface(Interface *iface)
       }
    }
    iface->deleteObject();
+   NotifyNetworkMapsOnTopologyChange(m_id);
 }
 
 /**
@@ -2782,14 +2768,13 @@ void Node::statusPoll(PollerInfo *poller, ClientSession *pSession, uint32_t rqId
 
    // Create polling list
    SharedObjectArray<NetObj> pollList(32, 32);
-   readLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
    {
-      shared_ptr<NetObj> curr = getChildList().getShared(i);
+      shared_ptr<NetObj> curr = childList->getShared(i);
       if (curr->getStatus() != STATUS_UNMANAGED)
          pollList.add(curr);
    }
-   unlockChildList();
 
    // Poll interfaces and services
    poller->setStatus(_T("child poll"));
@@ -2832,10 +2817,10 @@ void Node::statusPoll(PollerInfo *poller, ClientSession *pSession, uint32_t rqId
    if (m_ipAddress.isValidUnicast() || agentConnected)
    {
       bool allDown = true;
-      readLockChildList();
-      for(int i = 0; i < getChildList().size(); i++)
+      shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+      for(int i = 0; i < childList->size(); i++)
       {
-         NetObj *curr = getChildList().get(i);
+         NetObj *curr = childList->get(i);
          if ((curr->getObjectClass() == OBJECT_INTERFACE) &&
              (((Interface *)curr)->getAdminState() != IF_ADMIN_STATE_DOWN) &&
              (((Interface *)curr)->getConfirmedOperState() == IF_OPER_STATE_UP) &&
@@ -2845,7 +2830,6 @@ void Node::statusPoll(PollerInfo *poller, ClientSession *pSession, uint32_t rqId
             break;
          }
       }
-      unlockChildList();
       if (allDown && (m_capabilities & NC_IS_NATIVE_AGENT) && !(m_flags & NF_DISABLE_NXCP))
       {
          if (m_state & NSF_AGENT_UNREACHABLE)
@@ -2943,16 +2927,15 @@ void Node::statusPoll(PollerInfo *poller, ClientSession *pSession, uint32_t rqId
                m_state |= DCSF_NETWORK_PATH_PROBLEM;
 
                // Set interfaces and network services to UNKNOWN state
-               readLockChildList();
-               for(int i = 0; i < getChildList().size(); i++)
+               shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+               for(int i = 0; i < childList->size(); i++)
                {
-                  NetObj *curr = getChildList().get(i);
+                  NetObj *curr = childList->get(i);
                   if ((curr->getObjectClass() == OBJECT_INTERFACE) || (curr->getObjectClass() == OBJECT_NETWORKSERVICE))
                   {
                      curr->resetStatus();
                   }
                }
-               unlockChildList();
 
                // Clear delayed event queue
                delete_and_null(eventQueue);
@@ -3588,12 +3571,12 @@ void Node::checkAgentPolicyBinding(const shared_ptr<AgentConnectionEx>& conn)
       {
          uuid guid = ap->getGuid(i);
          bool found = false;
-         readLockParentList();
-         for(int i = 0; i < getParentList().size(); i++)
+         shared_ptr<const SharedObjectArray<NetObj>> parentList = getParentList();
+         for(int i = 0; i < parentList->size(); i++)
          {
-            if (getParentList().get(i)->getObjectClass() == OBJECT_TEMPLATE)
+            if (parentList->get(i)->getObjectClass() == OBJECT_TEMPLATE)
             {
-                if (static_cast<Template*>(getParentList().get(i))->hasPolicy(guid))
+                if (static_cast<Template*>(parentList->get(i))->hasPolicy(guid))
                 {
                    found = true;
                    break;
@@ -3612,19 +3595,17 @@ void Node::checkAgentPolicyBinding(const shared_ptr<AgentConnectionEx>& conn)
             ThreadPoolExecuteSerialized(g_pollerThreadPool, key, RemoveAgentPolicy, data);
          }
 
-         unlockParentList();
       }
 
       // Check for bound but not installed policies and schedule it's installation again
-      readLockParentList();
-      for(int i = 0; i < getParentList().size(); i++)
+      shared_ptr<const SharedObjectArray<NetObj>> parentList = getParentList();
+      for(int i = 0; i < parentList->size(); i++)
       {
-         if (getParentList().get(i)->getObjectClass() == OBJECT_TEMPLATE)
+         if (parentList->get(i)->getObjectClass() == OBJECT_TEMPLATE)
          {
-            static_cast<Template*>(getParentList().get(i))->checkPolicyDeployment(self(), ap);
+            static_cast<Template*>(parentList->get(i))->checkPolicyDeployment(self(), ap);
          }
       }
-      unlockParentList();
 
       m_capabilities |= ap->isNewTypeFormat() ? NC_IS_NEW_POLICY_TYPES : 0;
       delete ap;
@@ -4589,10 +4570,10 @@ void Node::reconcileWithDuplicateNode(Node *node)
    node->unlockDciAccess();
 
    // Apply all manual templates from duplicate node
-   node->readLockParentList();
-   for(int i = 0; i < node->getParentList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> parentList = node->getParentList();
+   for(int i = 0; i < parentList->size(); i++)
    {
-      NetObj *object = node->getParentList().get(i);
+      NetObj *object = parentList->get(i);
       if (object->getObjectClass() != OBJECT_TEMPLATE)
          continue;
 
@@ -4604,7 +4585,6 @@ void Node::reconcileWithDuplicateNode(Node *node)
          g_templateUpdateQueue.put(new TemplateUpdateTask(static_pointer_cast<DataCollectionOwner>(object->self()), m_id, APPLY_TEMPLATE, false));
       }
    }
-   node->unlockParentList();
 }
 
 /**
@@ -5791,17 +5771,17 @@ bool Node::deleteDuplicateInterfaces(uint32_t requestId)
 {
    ObjectArray<Interface> deleteList;
 
-   readLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
    {
-      NetObj *curr = getChildList().get(i);
+      NetObj *curr = childList->get(i);
       if ((curr->getObjectClass() != OBJECT_INTERFACE) || static_cast<Interface*>(curr)->isManuallyCreated())
          continue;
 
       Interface *iface = static_cast<Interface*>(curr);
-      for(int j = i + 1; j < getChildList().size(); j++)
+      for(int j = i + 1; j < childList->size(); j++)
       {
-         NetObj *next = getChildList().get(j);
+         NetObj *next = childList->get(j);
          if ((next->getObjectClass() != OBJECT_INTERFACE) ||
              static_cast<Interface*>(next)->isManuallyCreated() ||
              deleteList.contains(static_cast<Interface*>(next)))
@@ -5815,7 +5795,6 @@ bool Node::deleteDuplicateInterfaces(uint32_t requestId)
          }
       }
    }
-   unlockChildList();
 
    for(int i = 0; i < deleteList.size(); i++)
    {
@@ -5842,13 +5821,13 @@ bool Node::updateInterfaceConfiguration(uint32_t requestId)
       nxlog_debug_tag(DEBUG_TAG_CONF_POLL, 6, _T("Node::updateInterfaceConfiguration(%s [%u]): got %d interfaces"), m_name, m_id, ifList->size());
 
       // Find non-existing interfaces
-      readLockChildList();
-      ObjectArray<Interface> deleteList(getChildList().size());
-      for(int i = 0; i < getChildList().size(); i++)
+      shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+      ObjectArray<Interface> deleteList(childList->size());
+      for(int i = 0; i < childList->size(); i++)
       {
-         if (getChildList().get(i)->getObjectClass() == OBJECT_INTERFACE)
+         if (childList->get(i)->getObjectClass() == OBJECT_INTERFACE)
          {
-            auto iface = static_cast<Interface*>(getChildList().get(i));
+            auto iface = static_cast<Interface*>(childList->get(i));
             if (iface->isFake())
             {
                // always delete fake interfaces if we got actual interface list
@@ -5873,7 +5852,6 @@ bool Node::updateInterfaceConfiguration(uint32_t requestId)
             }
          }
       }
-      unlockChildList();
 
       // Delete non-existent interfaces
       if (deleteList.size() > 0)
@@ -5897,12 +5875,12 @@ bool Node::updateInterfaceConfiguration(uint32_t requestId)
          bool isNewInterface = true;
          bool interfaceUpdated = false;
 
-         readLockChildList();
-         for(int i = 0; i < getChildList().size(); i++)
+         shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+         for(int i = 0; i < childList->size(); i++)
          {
-            if (getChildList().get(i)->getObjectClass() == OBJECT_INTERFACE)
+            if (childList->get(i)->getObjectClass() == OBJECT_INTERFACE)
             {
-               pInterface = static_pointer_cast<Interface>(getChildList().getShared(i));
+               pInterface = static_pointer_cast<Interface>(childList->getShared(i));
                if (ifInfo->index == pInterface->getIfIndex())
                {
                   // Existing interface, check configuration
@@ -6024,7 +6002,6 @@ bool Node::updateInterfaceConfiguration(uint32_t requestId)
                }
             }
          }
-         unlockChildList();
 
          if (isNewInterface)
          {
@@ -6080,14 +6057,13 @@ bool Node::updateInterfaceConfiguration(uint32_t requestId)
       if (m_runtimeFlags & NDF_RECHECK_CAPABILITIES)
       {
          SharedObjectArray<Interface> deleteList;
-         readLockChildList();
-         for(int i = 0; i < getChildList().size(); i++)
+         shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+         for(int i = 0; i < childList->size(); i++)
          {
-            NetObj *curr = getChildList().get(i);
+            NetObj *curr = childList->get(i);
             if ((curr->getObjectClass() == OBJECT_INTERFACE) && !static_cast<Interface*>(curr)->isManuallyCreated())
-               deleteList.add(static_pointer_cast<Interface>(getChildList().getShared(i)));
+               deleteList.add(static_pointer_cast<Interface>(childList->getShared(i)));
          }
-         unlockChildList();
          for(int j = 0; j < deleteList.size(); j++)
          {
             auto iface = deleteList.get(j);
@@ -7578,6 +7554,54 @@ DataCollectionError Node::getInternalMetric(const TCHAR *name, TCHAR *buffer, si
          });
          ret_int(buffer, dciCount);
       }
+      else if (MatchString(_T("Server.DB.ConnectionPool.Acquired(*)"), name, false))
+      {
+         rc = GetDBConnectionPoolStat(DBCP_STAT_ACQUIRED, name, buffer);
+      }
+      else if (MatchString(_T("Server.DB.ConnectionPool.AcquireWaitTime.Average(*)"), name, false))
+      {
+         rc = GetDBConnectionPoolStat(DBCP_STAT_AVERAGE_WAIT_TIME, name, buffer);
+      }
+      else if (MatchString(_T("Server.DB.ConnectionPool.AcquireWaitTime.Histogram(*)"), name, false))
+      {
+         rc = GetDBConnectionPoolStat(DBCP_STAT_WAIT_TIME_HISTOGRAM, name, buffer);
+      }
+      else if (MatchString(_T("Server.DB.ConnectionPool.AcquireWaitTime.Max(*)"), name, false))
+      {
+         rc = GetDBConnectionPoolStat(DBCP_STAT_MAX_WAIT_TIME, name, buffer);
+      }
+      else if (MatchString(_T("Server.DB.ConnectionPool.ConnectTime.Average(*)"), name, false))
+      {
+         rc = GetDBConnectionPoolStat(DBCP_STAT_AVERAGE_CONNECT_TIME, name, buffer);
+      }
+      else if (MatchString(_T("Server.DB.ConnectionPool.ConnectTime.Max(*)"), name, false))
+      {
+         rc = GetDBConnectionPoolStat(DBCP_STAT_MAX_CONNECT_TIME, name, buffer);
+      }
+      else if (MatchString(_T("Server.DB.ConnectionPool.HoldTime.Average(*)"), name, false))
+      {
+         rc = GetDBConnectionPoolStat(DBCP_STAT_AVERAGE_HOLD_TIME, name, buffer);
+      }
+      else if (MatchString(_T("Server.DB.ConnectionPool.HoldTime.Histogram(*)"), name, false))
+      {
+         rc = GetDBConnectionPoolStat(DBCP_STAT_HOLD_TIME_HISTOGRAM, name, buffer);
+      }
+      else if (MatchString(_T("Server.DB.ConnectionPool.HoldTime.Max(*)"), name, false))
+      {
+         rc = GetDBConnectionPoolStat(DBCP_STAT_MAX_HOLD_TIME, name, buffer);
+      }
+      else if (MatchString(_T("Server.DB.ConnectionPool.Size(*)"), name, false))
+      {
+         rc = GetDBConnectionPoolStat(DBCP_STAT_SIZE, name, buffer);
+      }
+      else if (MatchString(_T("Server.DB.ConnectionPool.Waiting(*)"), name, false))
+      {
+         rc = GetDBConnectionPoolStat(DBCP_STAT_WAITING, name, buffer);
+      }
+      else if (MatchString(_T("Server.DB.ConnectionPool.Waits(*)"), name, false))
+      {
+         rc = GetDBConnectionPoolStat(DBCP_STAT_WAIT_COUNT, name, buffer);
+      }
       else if (!_tcsicmp(name, _T("Server.DB.Queries.Failed")))
       {
          LIBNXDB_PERF_COUNTERS counters;
@@ -8081,16 +8105,15 @@ uint32_t Node::modifyFromMessageInternal(const NXCPMessage& msg)
       {
          // Check if received IP address is one of node's interface addresses
          unlockProperties(); //removing possible deadlock
-         readLockChildList();
-         int i, count = getChildList().size();
+         shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+         int i, count = childList->size();
          for (i = 0; i < count; i++)
          {
-            NetObj *curr = getChildList().get(i);
+            NetObj *curr = childList->get(i);
             if ((curr->getObjectClass() == OBJECT_INTERFACE) &&
                 static_cast<Interface*>(curr)->getIpAddressList()->hasAddress(ipAddr))
                break;
          }
-         unlockChildList();
          lockProperties();
          if (i == count)
          {
@@ -8128,16 +8151,15 @@ uint32_t Node::modifyFromMessageInternal(const NXCPMessage& msg)
          if (ipAddr.isValid() && !(m_flags & NF_EXTERNAL_GATEWAY))
          {
             // Check if received IP address is one of node's interface addresses
-            readLockChildList();
-            int i, count = getChildList().size();
+            shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+            int i, count = childList->size();
             for(i = 0; i < count; i++)
             {
-               NetObj *curr = getChildList().get(i);
+               NetObj *curr = childList->get(i);
                if ((curr->getObjectClass() == OBJECT_INTERFACE) &&
                    static_cast<Interface*>(curr)->getIpAddressList()->hasAddress(ipAddr))
                   break;
             }
-            unlockChildList();
             if (i == count)
             {
                // Check that there is no node with same IP as we try to change
@@ -8393,11 +8415,11 @@ uint32_t Node::wakeUp()
 {
    uint32_t rcc = RCC_NO_WOL_INTERFACES;
 
-   readLockChildList();
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
 
-   for(int i = 0; i < getChildList().size(); i++)
+   for(int i = 0; i < childList->size(); i++)
    {
-      NetObj *object = getChildList().get(i);
+      NetObj *object = childList->get(i);
       if ((object->getObjectClass() == OBJECT_INTERFACE) &&
           (object->getStatus() != STATUS_UNMANAGED) &&
           static_cast<Interface*>(object)->getIpAddressList()->getFirstUnicastAddressV4().isValid())
@@ -8411,9 +8433,9 @@ uint32_t Node::wakeUp()
    // If no interface found try to find interface in unmanaged state
    if (rcc != RCC_SUCCESS)
    {
-      for(int i = 0; i < getChildList().size(); i++)
+      for(int i = 0; i < childList->size(); i++)
       {
-         NetObj *object = getChildList().get(i);
+         NetObj *object = childList->get(i);
          if ((object->getObjectClass() == OBJECT_INTERFACE) &&
              (object->getStatus() == STATUS_UNMANAGED) &&
              static_cast<Interface*>(object)->getIpAddressList()->getFirstUnicastAddressV4().isValid())
@@ -8425,7 +8447,6 @@ uint32_t Node::wakeUp()
       }
    }
 
-   unlockChildList();
    return rcc;
 }
 
@@ -8869,16 +8890,15 @@ void Node::setPrimaryIPAddress(const InetAddress& addr)
       if (!(m_capabilities & (NC_IS_NATIVE_AGENT | NC_IS_SNMP | NC_IS_ETHERNET_IP)))
       {
          unlockProperties(); //removing possible deadlock
-         readLockChildList();
-         for (int i = 0; i < getChildList().size(); i++)
+         shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+         for (int i = 0; i < childList->size(); i++)
          {
-            NetObj *iface = getChildList().get(i);
+            NetObj *iface = childList->get(i);
             if (iface->getObjectClass() == OBJECT_INTERFACE && static_cast<Interface*>(iface)->isFake())
             {
                static_cast<Interface*>(iface)->setIpAddress(m_ipAddress);
             }
          }
-         unlockChildList();
          lockProperties();
       }
    }
@@ -8910,10 +8930,10 @@ void Node::changeIPAddress(const InetAddress& ipAddr)
 
       // Change status of node and all it's children to UNKNOWN
       m_status = STATUS_UNKNOWN;
-      readLockChildList();
-      for(int i = 0; i < getChildList().size(); i++)
+      shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+      for(int i = 0; i < childList->size(); i++)
       {
-         NetObj *object = getChildList().get(i);
+         NetObj *object = childList->get(i);
          object->resetStatus();
          if (object->getObjectClass() == OBJECT_INTERFACE)
          {
@@ -8923,7 +8943,6 @@ void Node::changeIPAddress(const InetAddress& ipAddr)
             }
          }
       }
-      unlockChildList();
 
       setModified(MODIFY_NODE_PROPERTIES);
    }
@@ -8956,16 +8975,15 @@ void Node::changeZone(UINT32 newZoneUIN)
    unlockProperties();
 
    // Remove from subnets
-   readLockParentList();
-   NetObj **subnets = MemAllocArray<NetObj*>(getParentList().size());
+   shared_ptr<const SharedObjectArray<NetObj>> parentList = getParentList();
+   NetObj **subnets = MemAllocArray<NetObj*>(parentList->size());
    int count = 0;
-   for(i = 0; i < getParentList().size(); i++)
+   for(i = 0; i < parentList->size(); i++)
    {
-      NetObj *curr = getParentList().get(i);
+      NetObj *curr = parentList->get(i);
       if (curr->getObjectClass() == OBJECT_SUBNET)
          subnets[count++] = curr;
    }
-   unlockParentList();
 
    for(i = 0; i < count; i++)
    {
@@ -8980,14 +8998,13 @@ void Node::changeZone(UINT32 newZoneUIN)
       zone->addToIndex(self());
 
    // Change zone UIN on interfaces
-   readLockChildList();
-   for(i = 0; i < getChildList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(i = 0; i < childList->size(); i++)
    {
-      NetObj *curr = getChildList().get(i);
+      NetObj *curr = childList->get(i);
       if (curr->getObjectClass() == OBJECT_INTERFACE)
          static_cast<Interface*>(curr)->updateZoneUIN();
    }
-   unlockChildList();
 
    lockProperties();
    setModified(MODIFY_RELATIONS | MODIFY_NODE_PROPERTIES);
@@ -9038,18 +9055,17 @@ void Node::clearFileUpdateConnection()
  */
 uint32_t Node::getInterfaceCount(Interface **lastInterface)
 {
-   readLockChildList();
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
    uint32_t count = 0;
-   for(int i = 0; i < getChildList().size(); i++)
+   for(int i = 0; i < childList->size(); i++)
    {
-      NetObj *curr = getChildList().get(i);
+      NetObj *curr = childList->get(i);
       if (curr->getObjectClass() == OBJECT_INTERFACE)
       {
          count++;
          *lastInterface = static_cast<Interface*>(curr);
       }
    }
-   unlockChildList();
    return count;
 }
 
@@ -9132,10 +9148,10 @@ bool Node::getNextHop(const InetAddress& srcAddr, const InetAddress& destAddr, I
 
    // Check directly connected networks and VPN connectors
    bool nonFunctionalInterfaceFound = false;
-   readLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
    {
-      NetObj *object = getChildList().get(i);
+      NetObj *object = childList->get(i);
       if (object->getObjectClass() == OBJECT_VPNCONNECTOR)
       {
          if (((VPNConnector *)object)->isRemoteAddr(destAddr) &&
@@ -9170,7 +9186,6 @@ bool Node::getNextHop(const InetAddress& srcAddr, const InetAddress& destAddr, I
          nonFunctionalInterfaceFound = true;
       }
    }
-   unlockChildList();
 
    // Check routing table
    // If directly connected subnet found, only check host routes
@@ -9365,14 +9380,13 @@ shared_ptr<Cluster> Node::getMyCluster()
 {
    shared_ptr<Cluster> cluster;
 
-   readLockParentList();
-   for(int i = 0; i < getParentList().size(); i++)
-      if (getParentList().get(i)->getObjectClass() == OBJECT_CLUSTER)
+   shared_ptr<const SharedObjectArray<NetObj>> parentList = getParentList();
+   for(int i = 0; i < parentList->size(); i++)
+      if (parentList->get(i)->getObjectClass() == OBJECT_CLUSTER)
       {
-         cluster = static_pointer_cast<Cluster>(getParentList().getShared(i));
+         cluster = static_pointer_cast<Cluster>(parentList->getShared(i));
          break;
       }
-   unlockParentList();
    return cluster;
 }
 
@@ -9613,10 +9627,10 @@ bool Node::resolveName(bool useOnlyDNS)
    else
    {
       // Try to resolve each interface's IP address
-      readLockChildList();
-      for(int i = 0; i < getChildList().size(); i++)
+      shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+      for(int i = 0; i < childList->size(); i++)
       {
-         NetObj *curr = getChildList().get(i);
+         NetObj *curr = childList->get(i);
          if ((curr->getObjectClass() == OBJECT_INTERFACE) && !static_cast<Interface*>(curr)->isLoopback())
          {
             const InetAddressList *list = static_cast<Interface*>(curr)->getIpAddressList();
@@ -9632,7 +9646,6 @@ bool Node::resolveName(bool useOnlyDNS)
             }
          }
       }
-      unlockChildList();
 
       // Try to get hostname from agent if address resolution fails
       if (!(resolved || useOnlyDNS))
@@ -9818,8 +9831,11 @@ void Node::topologyPoll(PollerInfo *poller, ClientSession *pSession, uint32_t rq
       nxlog_debug_tag(DEBUG_TAG_TOPOLOGY_POLL, 4, _T("Link layer topology retrieved for node %s [%d] (%d connections found)"), m_name, (int)m_id, nbs->size());
 
       m_topologyMutex.lock();
+      bool changed = !nbs->equals(m_linkLayerNeighbors.get());
       m_linkLayerNeighbors = nbs;
       m_topologyMutex.unlock();
+      if (changed)
+         NotifyNetworkMapsOnTopologyChange(m_id);
 
       // Walk through interfaces and update peers
       sendPollerMsg(_T("Updating peer information on interfaces\r\n"));
@@ -9869,13 +9885,13 @@ void Node::topologyPoll(PollerInfo *poller, ClientSession *pSession, uint32_t rq
          }
       }
 
-      readLockChildList();
-      for(int i = 0; i < getChildList().size(); i++)
+      shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+      for(int i = 0; i < childList->size(); i++)
       {
-         if (getChildList().get(i)->getObjectClass() != OBJECT_INTERFACE)
+         if (childList->get(i)->getObjectClass() != OBJECT_INTERFACE)
             continue;
 
-         Interface *iface = (Interface *)getChildList().get(i);
+         Interface *iface = (Interface *)childList->get(i);
 
          // Clear self-linked interfaces caused by bug in previous release
          if ((iface->getPeerNodeId() == m_id) && (iface->getPeerInterfaceId() == iface->getId()))
@@ -9908,7 +9924,6 @@ void Node::topologyPoll(PollerInfo *poller, ClientSession *pSession, uint32_t rq
             }
          }
       }
-      unlockChildList();
 
       sendPollerMsg(_T("Link layer topology processed\r\n"));
       nxlog_debug_tag(DEBUG_TAG_TOPOLOGY_POLL, 4, _T("Link layer topology processed for node %s [%d]"), m_name, m_id);
@@ -10049,6 +10064,9 @@ void Node::topologyPoll(PollerInfo *poller, ClientSession *pSession, uint32_t rq
          }
 
          unlockProperties();
+
+         if (changed)
+            NotifyNetworkMapsOnTopologyChange(m_id);
       }
       else
       {
@@ -10059,10 +10077,10 @@ void Node::topologyPoll(PollerInfo *poller, ClientSession *pSession, uint32_t rq
       }
 
       // Update OSPF information on interfaces
-      readLockChildList();
-      for(int i = 0; i < getChildList().size(); i++)
+      shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+      for(int i = 0; i < childList->size(); i++)
       {
-         NetObj *curr = getChildList().get(i);
+         NetObj *curr = childList->get(i);
          if (curr->getObjectClass() != OBJECT_INTERFACE)
             continue;
 
@@ -10083,7 +10101,6 @@ void Node::topologyPoll(PollerInfo *poller, ClientSession *pSession, uint32_t rq
             iface->clearOSPFInformation();
          }
       }
-      unlockChildList();
    }
 
    if (m_ipAddress.isValidUnicast())
@@ -10138,13 +10155,13 @@ void Node::addHostConnections(LinkLayerNeighbors *nbs)
 
    nxlog_debug_tag(DEBUG_TAG_TOPOLOGY_POLL, 5, _T("Node::addHostConnections(%s [%u]): FDB retrieved"), m_name, m_id);
 
-   readLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
    {
-      if (getChildList().get(i)->getObjectClass() != OBJECT_INTERFACE)
+      if (childList->get(i)->getObjectClass() != OBJECT_INTERFACE)
          continue;
 
-      Interface *ifLocal = static_cast<Interface*>(getChildList().get(i));
+      Interface *ifLocal = static_cast<Interface*>(childList->get(i));
       MacAddress macAddr;
       if (fdb->isSingleMacOnPort(ifLocal->getIfIndex(), &macAddr))
       {
@@ -10175,7 +10192,6 @@ void Node::addHostConnections(LinkLayerNeighbors *nbs)
          nbs->markMultipointInterface(ifLocal->getIfIndex());
       }
    }
-   unlockChildList();
 }
 
 /**
@@ -10183,13 +10199,13 @@ void Node::addHostConnections(LinkLayerNeighbors *nbs)
  */
 void Node::addExistingConnections(LinkLayerNeighbors *nbs)
 {
-   readLockChildList();
-   for(int i = 0; i < (int)getChildList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < (int)childList->size(); i++)
    {
-      if (getChildList().get(i)->getObjectClass() != OBJECT_INTERFACE)
+      if (childList->get(i)->getObjectClass() != OBJECT_INTERFACE)
          continue;
 
-      Interface *ifLocal = (Interface *)getChildList().get(i);
+      Interface *ifLocal = (Interface *)childList->get(i);
       if ((ifLocal->getPeerNodeId() != 0) && (ifLocal->getPeerInterfaceId() != 0))
       {
          shared_ptr<Interface> ifRemote = static_pointer_cast<Interface>(FindObjectById(ifLocal->getPeerInterfaceId(), OBJECT_INTERFACE));
@@ -10207,7 +10223,6 @@ void Node::addExistingConnections(LinkLayerNeighbors *nbs)
          }
       }
    }
-   unlockChildList();
 }
 
 /**
@@ -10249,10 +10264,10 @@ void Node::resolveVlanPorts(VlanList *vlanList)
       }
    }
 
-   readLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
    {
-      NetObj *o = getChildList().get(i);
+      NetObj *o = childList->get(i);
       if (o->getObjectClass() == OBJECT_INTERFACE)
       {
          IntegerArray<uint32_t> *vlans = vlansByIface.get(o->getId());
@@ -10261,7 +10276,6 @@ void Node::resolveVlanPorts(VlanList *vlanList)
          static_cast<Interface*>(o)->updateVlans(vlans);
       }
    }
-   unlockChildList();
 }
 
 /**
@@ -10367,10 +10381,10 @@ void Node::checkSubnetBinding()
 
    // Build consolidated IP address list
    InetAddressList addrList;
-   readLockChildList();
-   for(int n = 0; n < getChildList().size(); n++)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int n = 0; n < childList->size(); n++)
    {
-      NetObj *curr = getChildList().get(n);
+      NetObj *curr = childList->get(n);
       if (curr->getObjectClass() != OBJECT_INTERFACE)
          continue;
 
@@ -10387,7 +10401,6 @@ void Node::checkSubnetBinding()
          }
       }
    }
-   unlockChildList();
 
    // Check if we have subnet bindings for all interfaces
    nxlog_debug_tag(DEBUG_TAG_CONF_POLL, 5, _T("Checking subnet bindings for node %s [%d]"), m_name, m_id);
@@ -10504,14 +10517,13 @@ void Node::checkSubnetBinding()
    }
 
    // Check for incorrect parent subnets
-   readLockParentList();
-   readLockChildList();
-   ObjectArray<NetObj> unlinkList(getParentList().size());
-   for(int i = 0; i < getParentList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> parentList = getParentList();
+   ObjectArray<NetObj> unlinkList(parentList->size());
+   for(int i = 0; i < parentList->size(); i++)
    {
-      if (getParentList().get(i)->getObjectClass() == OBJECT_SUBNET)
+      if (parentList->get(i)->getObjectClass() == OBJECT_SUBNET)
       {
-         Subnet *pSubnet = (Subnet *)getParentList().get(i);
+         Subnet *pSubnet = (Subnet *)parentList->get(i);
          if (pSubnet->getIpAddress().contain(m_ipAddress) && !(m_flags & NF_EXTERNAL_GATEWAY))
             continue;   // primary IP is in given subnet
 
@@ -10536,8 +10548,6 @@ void Node::checkSubnetBinding()
          }
       }
    }
-   unlockChildList();
-   unlockParentList();
 
    // Unlink for incorrect subnet objects
    for(int n = 0; n < unlinkList.size(); n++)
@@ -10584,12 +10594,12 @@ void Node::updateInterfaceNames(ClientSession *pSession, UINT32 rqId)
       {
          InterfaceInfo *ifInfo = pIfList->get(j);
 
-         readLockChildList();
-         for(int i = 0; i < getChildList().size(); i++)
+         shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+         for(int i = 0; i < childList->size(); i++)
          {
-            if (getChildList().get(i)->getObjectClass() == OBJECT_INTERFACE)
+            if (childList->get(i)->getObjectClass() == OBJECT_INTERFACE)
             {
-               Interface *pInterface = (Interface *)getChildList().get(i);
+               Interface *pInterface = (Interface *)childList->get(i);
 
                if (ifInfo->index == pInterface->getIfIndex())
                {
@@ -10618,7 +10628,6 @@ void Node::updateInterfaceNames(ClientSession *pSession, UINT32 rqId)
                }
             }
          }
-         unlockChildList();
       }
 
       delete pIfList;
@@ -10642,16 +10651,15 @@ NXSL_Value *Node::getParentsForNXSL(NXSL_VM *vm)
    NXSL_Array *parents = new NXSL_Array(vm);
    int index = 0;
 
-   readLockParentList();
-   for(int i = 0; i < getParentList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> parentList = getParentList();
+   for(int i = 0; i < parentList->size(); i++)
    {
-      NetObj *object = getParentList().get(i);
+      NetObj *object = parentList->get(i);
       if ((object->getObjectClass() != OBJECT_TEMPLATE) && object->isTrustedNode(m_id))
       {
          parents->set(index++, object->createNXSLObject(vm));
       }
    }
-   unlockParentList();
 
    return vm->createValue(parents);
 }
@@ -10664,16 +10672,15 @@ NXSL_Value *Node::getInterfacesForNXSL(NXSL_VM *vm)
    NXSL_Array *ifaces = new NXSL_Array(vm);
    int index = 0;
 
-   readLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
    {
-      NetObj *curr = getChildList().get(i);
+      NetObj *curr = childList->get(i);
       if (curr->getObjectClass() == OBJECT_INTERFACE)
       {
          ifaces->set(index++, curr->createNXSLObject(vm));
       }
    }
-   unlockChildList();
 
    return vm->createValue(ifaces);
 }
@@ -11270,10 +11277,10 @@ void Node::updatePhysicalContainerBinding(uint32_t containerId)
    bool containerFound = false;
    SharedObjectArray<NetObj> deleteList;
 
-   readLockParentList();
-   for(int i = 0; i < getParentList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> parentList = getParentList();
+   for(int i = 0; i < parentList->size(); i++)
    {
-      NetObj *object = getParentList().get(i);
+      NetObj *object = parentList->get(i);
       if ((object->getObjectClass() != OBJECT_RACK) && (object->getObjectClass() != OBJECT_CHASSIS))
          continue;
       if (object->getId() == containerId)
@@ -11281,9 +11288,8 @@ void Node::updatePhysicalContainerBinding(uint32_t containerId)
          containerFound = true;
          continue;
       }
-      deleteList.add(getParentList().getShared(i));
+      deleteList.add(parentList->getShared(i));
    }
-   unlockParentList();
 
    for(int n = 0; n < deleteList.size(); n++)
    {
@@ -11728,10 +11734,10 @@ void Node::icmpPoll(PollerInfo *poller)
       targets.add(IcmpPollTarget(_T("A"), nullptr, m_icmpTargets.get(i)));
    unlockProperties();
 
-   readLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
    {
-      NetObj *curr = getChildList().get(i);
+      NetObj *curr = childList->get(i);
       if (curr->getStatus() == STATUS_UNMANAGED)
          continue;
 
@@ -11743,7 +11749,6 @@ void Node::icmpPoll(PollerInfo *poller)
             targets.add(IcmpPollTarget(_T("N"), curr->getName(), addr));
       }
    }
-   unlockChildList();
 
    shared_ptr<Node> proxyNode;
    shared_ptr<AgentConnection> conn;
@@ -11767,10 +11772,34 @@ void Node::icmpPoll(PollerInfo *poller)
       }
    }
 
-   for(int i = 0; i < targets.size(); i++)
+   if (conn != nullptr)
    {
-      const IcmpPollTarget *t = targets.get(i);
-      icmpPollAddress(conn.get(), t->name, t->address);
+      for(int i = 0; i < targets.size(); i++)
+      {
+         const IcmpPollTarget *t = targets.get(i);
+         icmpPollAddress(conn.get(), t->name, t->address);
+      }
+   }
+   else if (!targets.isEmpty())
+   {
+      // Ping all targets at once
+      IcmpPingTarget *pingTargets = new IcmpPingTarget[targets.size()];
+      for(int i = 0; i < targets.size(); i++)
+      {
+         pingTargets[i].address = targets.get(i)->address;
+         pingTargets[i].packetSize = g_icmpPingSize;
+         pingTargets[i].dontFragment = false;
+         pingTargets[i].userData = nullptr;
+      }
+      nxlog_debug_tag(DEBUG_TAG_ICMP_POLL, 7, _T("Node::icmpPoll(%s [%u]): calling IcmpPingBatch for %d targets (timeout=%u, size=%u)"),
+               m_name, m_id, targets.size(), g_icmpPingTimeout, g_icmpPingSize);
+      IcmpPingBatch(pingTargets, targets.size(), 1, g_icmpPingTimeout);
+      for(int i = 0; i < targets.size(); i++)
+      {
+         const IcmpPollTarget *t = targets.get(i);
+         processIcmpPollResult(t->name, t->address, pingTargets[i].result, pingTargets[i].rtt);
+      }
+      delete[] pingTargets;
    }
 
 end_poll:
@@ -11778,43 +11807,41 @@ void Node::icmpPoll(PollerInfo *poller)
 }
 
 /**
- * Poll specific address with ICMP
+ * Poll specific address with ICMP via proxy agent
  */
 void Node::icmpPollAddress(AgentConnection *conn, const TCHAR *target, const InetAddress& addr)
 {
-   TCHAR debugPrefix[256], buffer[64];
-   _sntprintf(debugPrefix, 256, _T("Node::icmpPollAddress(%s [%u], %s, %s):"), m_name, m_id, target, addr.toString(buffer));
-
+   TCHAR buffer[64];
    uint32_t status = ICMP_SEND_FAILED, rtt = 0;
-   if (conn != nullptr)
+   TCHAR parameter[128];
+   _sntprintf(parameter, 128, _T("Icmp.Ping(%s)"), addr.toString(buffer));
+   uint32_t rcc = conn->getParameter(parameter, buffer, 64);
+   if (rcc == ERR_SUCCESS)
    {
-      TCHAR parameter[128];
-      _sntprintf(parameter, 128, _T("Icmp.Ping(%s)"), addr.toString(buffer));
-      uint32_t rcc = conn->getParameter(parameter, buffer, 64);
-      if (rcc == ERR_SUCCESS)
-      {
-         nxlog_debug_tag(DEBUG_TAG_ICMP_POLL, 7, _T("%s: proxy response: \"%s\""), debugPrefix, buffer);
-         TCHAR *eptr;
-         rtt = _tcstol(buffer, &eptr, 10);
-         if (*eptr == 0)
-         {
-            status = ICMP_SUCCESS;
-         }
-      }
-      else if (rcc == ERR_REQUEST_TIMEOUT)
+      nxlog_debug_tag(DEBUG_TAG_ICMP_POLL, 7, _T("Node::icmpPollAddress(%s [%u], %s): proxy response: \"%s\""), m_name, m_id, target, buffer);
+      TCHAR *eptr;
+      rtt = _tcstol(buffer, &eptr, 10);
+      if (*eptr == 0)
       {
-         status = ICMP_TIMEOUT;
-         rtt = 10000;
+         status = ICMP_SUCCESS;
       }
-      nxlog_debug_tag(DEBUG_TAG_ICMP_POLL, 7, _T("%s: response time %u"), debugPrefix, rtt);
    }
-   else  // not using ICMP proxy
+   else if (rcc == ERR_REQUEST_TIMEOUT)
    {
-      nxlog_debug_tag(DEBUG_TAG_ICMP_POLL, 7, _T("%s: calling IcmpPing(%s,3,%d,%d)"),
-               debugPrefix, addr.toString(buffer), g_icmpPingTimeout, g_icmpPingSize);
-      status = IcmpPing(addr, 1, g_icmpPingTimeout, &rtt, g_icmpPingSize, false);
-      nxlog_debug_tag(DEBUG_TAG_ICMP_POLL, 7, _T("%s: ping status=%u RTT=%u"), debugPrefix, status, rtt);
+      status = ICMP_TIMEOUT;
+      rtt = 10000;
    }
+   processIcmpPollResult(target, addr, status, rtt);
+}
+
+/**
+ * Process result of ICMP poll for specific address
+ */
+void Node::processIcmpPollResult(const TCHAR *target, const InetAddress& addr, uint32_t status, uint32_t rtt)
+{
+   TCHAR debugPrefix[256], buffer[64];
+   _sntprintf(debugPrefix, 256, _T("Node::processIcmpPollResult(%s [%u], %s, %s):"), m_name, m_id, target, addr.toString(buffer));
+   nxlog_debug_tag(DEBUG_TAG_ICMP_POLL, 7, _T("%s: ping status=%u RTT=%u"), debugPrefix, status, rtt);
 
    if ((status == ICMP_SUCCESS) || (status == ICMP_TIMEOUT) || (status == ICMP_UNREACHABLE))
    {
@@ -663,1654 +663,2344 @@ NXSL_METHOD_DEFINITION(NetObj, writeMaintenanceJournal)
 }
 
 /**
- * NXSL class NetObj: constructor
+ * NetObj::alarms attribute
  */
-NXSL_NetObjClass::NXSL_NetObjClass() : NXSL_Class()
+NXSL_ATTRIBUTE_DEFINITION(NetObj, alarms)
 {
-   setName(_T("NetObj"));
-
-   NXSL_REGISTER_METHOD(NetObj, bind, 1);
-   NXSL_REGISTER_METHOD(NetObj, bindTo, 1);
-   NXSL_REGISTER_METHOD(NetObj, clearGeoLocation, 0);
-   NXSL_REGISTER_METHOD(NetObj, delete, 0);
-   NXSL_REGISTER_METHOD(NetObj, deleteCustomAttribute, 1);
-   NXSL_REGISTER_METHOD(NetObj, isDirectChild, 1);
-   NXSL_REGISTER_METHOD(NetObj, isDirectParent, 1);
-   NXSL_REGISTER_METHOD(NetObj, enterMaintenance, -1);
-   NXSL_REGISTER_METHOD(NetObj, expandString, 1);
-   NXSL_REGISTER_METHOD(NetObj, getCustomAttribute, 1);
-   NXSL_REGISTER_METHOD(NetObj, getResponsibleUsers, 1);
-   NXSL_REGISTER_METHOD(NetObj, isChild, 1);
-   NXSL_REGISTER_METHOD(NetObj, isParent, 1);
-   NXSL_REGISTER_METHOD(NetObj, leaveMaintenance, 0);
-   NXSL_REGISTER_METHOD(NetObj, manage, 0);
-   NXSL_REGISTER_METHOD(NetObj, readMaintenanceJournal, -1);
-   NXSL_REGISTER_METHOD(NetObj, rename, 1);
-   NXSL_REGISTER_METHOD(NetObj, setAlias, 1);
-   NXSL_REGISTER_METHOD(NetObj, setCategory, 1);
-   NXSL_REGISTER_METHOD(NetObj, setComments, 1);
-   NXSL_REGISTER_METHOD(NetObj, setCustomAttribute, -1);
-   NXSL_REGISTER_METHOD(NetObj, setGeoLocation, 1);
-   NXSL_REGISTER_METHOD(NetObj, setMapImage, 1);
-   NXSL_REGISTER_METHOD(NetObj, setNameOnMap, 1);
-   NXSL_REGISTER_METHOD(NetObj, setStatusCalculation, -1);
-   NXSL_REGISTER_METHOD(NetObj, setStatusPropagation, -1);
-   NXSL_REGISTER_METHOD(NetObj, unbind, 1);
-   NXSL_REGISTER_METHOD(NetObj, unbindFrom, 1);
-   NXSL_REGISTER_METHOD(NetObj, unmanage, 0);
-   NXSL_REGISTER_METHOD(NetObj, writeMaintenanceJournal, 1);
+   ObjectArray<Alarm> *alarms = GetAlarms(SharedObjectFromData<NetObj>(object)->getId(), true);
+   alarms->setOwner(Ownership::False);
+   NXSL_Array *array = new NXSL_Array(vm);
+   for(int i = 0; i < alarms->size(); i++)
+      array->append(vm->createValue(vm->createObject(&g_nxslAlarmClass, alarms->get(i))));
+   delete alarms;
+   return vm->createValue(array);
 }
 
 /**
- * Object destruction handler
+ * NetObj::alias attribute
  */
-void NXSL_NetObjClass::onObjectDelete(NXSL_Object *object)
+NXSL_ATTRIBUTE_DEFINITION(NetObj, alias)
 {
-   delete static_cast<shared_ptr<NetObj>*>(object->getData());
+   return vm->createValue(SharedObjectFromData<NetObj>(object)->getAlias());
 }
 
 /**
- * NXSL class NetObj: get attribute
+ * NetObj::backupZoneProxy attribute
  */
-NXSL_Value *NXSL_NetObjClass::getAttr(NXSL_Object *_object, const NXSL_Identifier& attr)
+NXSL_ATTRIBUTE_DEFINITION(NetObj, backupZoneProxy)
 {
-   NXSL_Value *value = NXSL_Class::getAttr(_object, attr);
-   if (value != nullptr)
-      return value;
-
-   NXSL_VM *vm = _object->vm();
-   auto object = SharedObjectFromData<NetObj>(_object);
-   if (NXSL_COMPARE_ATTRIBUTE_NAME("alarms"))
-   {
-      ObjectArray<Alarm> *alarms = GetAlarms(object->getId(), true);
-      alarms->setOwner(Ownership::False);
-      NXSL_Array *array = new NXSL_Array(vm);
-      for(int i = 0; i < alarms->size(); i++)
-         array->append(vm->createValue(vm->createObject(&g_nxslAlarmClass, alarms->get(i))));
-      value = vm->createValue(array);
-      delete alarms;
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("alias"))
-   {
-      value = vm->createValue(object->getAlias());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("backupZoneProxy"))
-   {
-      uint32_t id = object->getAssignedZoneProxyId(true);
-      if (id != 0)
-      {
-         shared_ptr<NetObj> proxy = FindObjectById(id, OBJECT_NODE);
-         value = (proxy != nullptr) ? proxy->createNXSLObject(vm) : vm->createValue();
-      }
-      else
-      {
-         value = vm->createValue();
-      }
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("backupZoneProxyId"))
-   {
-      value = vm->createValue(object->getAssignedZoneProxyId(true));
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("category"))
-   {
-      if (object->getCategoryId() != 0)
-      {
-         shared_ptr<ObjectCategory> category = GetObjectCategory(object->getCategoryId());
-         value = (category != nullptr) ? vm->createValue(category->getName()) : vm->createValue();
-      }
-      else
-      {
-         value = vm->createValue();
-      }
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("categoryId"))
-   {
-      value = vm->createValue(object->getCategoryId());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("children"))
-   {
-      value = object->getChildrenForNXSL(vm);
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("city"))
-   {
-      value = vm->createValue(object->getPostalAddress().getCity());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("comments"))
-   {
-      value = vm->createValue(object->getComments());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("country"))
-   {
-      value = vm->createValue(object->getPostalAddress().getCountry());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("creationTime"))
-   {
-      value = vm->createValue(static_cast<INT64>(object->getCreationTime()));
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("customAttributes"))
-   {
-      value = object->getCustomAttributesForNXSL(vm);
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("district"))
-   {
-      value = vm->createValue(object->getPostalAddress().getDistrict());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("geolocation"))
-   {
-      value = NXSL_GeoLocationClass::createObject(vm, object->getGeoLocation());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("guid"))
-   {
-      TCHAR buffer[64];
-      value = vm->createValue(object->getGuid().toString(buffer));
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("id"))
-   {
-      value = vm->createValue(object->getId());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("ipAddr"))
-   {
-      TCHAR buffer[64];
-      value = vm->createValue(object->getPrimaryIpAddress().toString(buffer));
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("isInMaintenanceMode"))
-   {
-      value = vm->createValue(object->isInMaintenanceMode());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("maintenanceInitiator"))
-   {
-      value = vm->createValue(object->getMaintenanceInitiator());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("mapImage"))
-   {
-      TCHAR buffer[64];
-      value = vm->createValue(object->getMapImage().toString(buffer));
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("name"))
-   {
-      value = vm->createValue(object->getName());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("nameOnMap"))
-   {
-      value = vm->createValue(object->getNameOnMap());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("parents"))
-   {
-      value = object->getParentsForNXSL(vm);
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("postcode"))
-   {
-      value = vm->createValue(object->getPostalAddress().getPostCode());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("primaryZoneProxy"))
-   {
-      UINT32 id = object->getAssignedZoneProxyId(false);
-      if (id != 0)
-      {
-         shared_ptr<NetObj> proxy = FindObjectById(id, OBJECT_NODE);
-         value = (proxy != nullptr) ? proxy->createNXSLObject(vm) : vm->createValue();
-      }
-      else
-      {
-         value = vm->createValue();
-      }
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("primaryZoneProxyId"))
-   {
-      value = vm->createValue(object->getAssignedZoneProxyId(false));
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("region"))
-   {
-      value = vm->createValue(object->getPostalAddress().getRegion());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("responsibleUsers"))
-   {
-      NXSL_Array *array = new NXSL_Array(vm);
-      unique_ptr<StructArray<ResponsibleUser>> responsibleUsers = object->getAllResponsibleUsers();
-      unique_ptr<ObjectArray<UserDatabaseObject>> userDB = FindUserDBObjects(*responsibleUsers);
-      userDB->setOwner(Ownership::False);
-      for(int i = 0; i < userDB->size(); i++)
-      {
-         array->append(userDB->get(i)->createNXSLObject(vm));
-      }
-      value = vm->createValue(array);
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("state"))
-   {
-      value = vm->createValue(object->getState());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("status"))
-   {
-      value = vm->createValue((LONG)object->getStatus());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("streetAddress"))
-   {
-      value = vm->createValue(object->getPostalAddress().getStreetAddress());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("type"))
+   NetObj *netobj = SharedObjectFromData<NetObj>(object);
+   NXSL_Value *value;
+   uint32_t id = netobj->getAssignedZoneProxyId(true);
+   if (id != 0)
    {
-      value = vm->createValue((LONG)object->getObjectClass());
+      shared_ptr<NetObj> proxy = FindObjectById(id, OBJECT_NODE);
+      value = (proxy != nullptr) ? proxy->createNXSLObject(vm) : vm->createValue();
    }
-   else if (object != nullptr)   // Object can be null if attribute scan is running
+   else
    {
-#ifdef UNICODE
-      WCHAR wattr[MAX_IDENTIFIER_LENGTH];
-      utf8_to_wchar(attr.value, -1, wattr, MAX_IDENTIFIER_LENGTH);
-      wattr[MAX_IDENTIFIER_LENGTH - 1] = 0;
-      value = object->getCustomAttributeForNXSL(vm, wattr);
-#else
-      value = object->getCustomAttributeForNXSL(vm, attr.value);
-#endif
+      value = vm->createValue();
    }
    return value;
 }
 
 /**
- * NXSL class Zone: constructor
+ * NetObj::backupZoneProxyId attribute
  */
-NXSL_SubnetClass::NXSL_SubnetClass() : NXSL_NetObjClass()
+NXSL_ATTRIBUTE_DEFINITION(NetObj, backupZoneProxyId)
 {
-   setName(_T("Subnet"));
+   return vm->createValue(SharedObjectFromData<NetObj>(object)->getAssignedZoneProxyId(true));
 }
 
 /**
- * NXSL class Zone: get attribute
+ * NetObj::category attribute
  */
-NXSL_Value *NXSL_SubnetClass::getAttr(NXSL_Object *object, const NXSL_Identifier& attr)
+NXSL_ATTRIBUTE_DEFINITION(NetObj, category)
 {
-   NXSL_Value *value = NXSL_NetObjClass::getAttr(object, attr);
-   if (value != nullptr)
-      return value;
-
-   NXSL_VM *vm = object->vm();
-   auto subnet = SharedObjectFromData<Subnet>(object);
-   if (NXSL_COMPARE_ATTRIBUTE_NAME("ipNetMask"))
-   {
-      value = vm->createValue(subnet->getIpAddress().getMaskBits());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("isSyntheticMask"))
-   {
-      value = vm->createValue(subnet->isSyntheticMask());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("zone"))
+   NetObj *netobj = SharedObjectFromData<NetObj>(object);
+   NXSL_Value *value;
+   if (netobj->getCategoryId() != 0)
    {
-      if (g_flags & AF_ENABLE_ZONING)
-      {
-         shared_ptr<Zone> zone = FindZoneByUIN(subnet->getZoneUIN());
-         if (zone != nullptr)
-         {
-            value = zone->createNXSLObject(vm);
-         }
-         else
-         {
-            value = vm->createValue();
-         }
-      }
-      else
-      {
-         value = vm->createValue();
-      }
+      shared_ptr<ObjectCategory> category = GetObjectCategory(netobj->getCategoryId());
+      value = (category != nullptr) ? vm->createValue(category->getName()) : vm->createValue();
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("zoneUIN"))
+   else
    {
-      value = vm->createValue(subnet->getZoneUIN());
+      value = vm->createValue();
    }
    return value;
 }
 
 /**
- * DataCollectionTarget::applyTemplate(object)
+ * NetObj::categoryId attribute
  */
-NXSL_METHOD_DEFINITION(DataCollectionTarget, applyTemplate)
+NXSL_ATTRIBUTE_DEFINITION(NetObj, categoryId)
 {
-   shared_ptr<DataCollectionTarget> thisObject = *static_cast<shared_ptr<DataCollectionTarget>*>(object->getData());
-
-   if (!argv[0]->isObject())
-      return NXSL_ERR_NOT_OBJECT;
-
-   NXSL_Object *nxslTemplate = argv[0]->getValueAsObject();
-   if (!nxslTemplate->getClass()->instanceOf(g_nxslTemplateClass.getName()))
-      return NXSL_ERR_BAD_CLASS;
-
-   static_cast<shared_ptr<Template>*>(nxslTemplate->getData())->get()->applyToTarget(thisObject);
-
-   *result = vm->createValue();
-   return 0;
+   return vm->createValue(SharedObjectFromData<NetObj>(object)->getCategoryId());
 }
 
 /**
- * enableConfigurationPolling(enabled) method
+ * NetObj::children attribute
  */
-NXSL_METHOD_DEFINITION(DataCollectionTarget, enableConfigurationPolling)
+NXSL_ATTRIBUTE_DEFINITION(NetObj, children)
 {
-   return ChangeFlagMethod(object, argv[0], result, DCF_DISABLE_CONF_POLL, true);
+   return SharedObjectFromData<NetObj>(object)->getChildrenForNXSL(vm);
 }
 
 /**
- * enableDataCollection(enabled) method
+ * NetObj::city attribute
  */
-NXSL_METHOD_DEFINITION(DataCollectionTarget, enableDataCollection)
+NXSL_ATTRIBUTE_DEFINITION(NetObj, city)
 {
-   return ChangeFlagMethod(object, argv[0], result, DCF_DISABLE_DATA_COLLECT, true);
+   return vm->createValue(SharedObjectFromData<NetObj>(object)->getPostalAddress().getCity());
 }
 
 /**
- * enableStatusPolling(enabled) method
+ * NetObj::comments attribute
  */
-NXSL_METHOD_DEFINITION(DataCollectionTarget, enableStatusPolling)
+NXSL_ATTRIBUTE_DEFINITION(NetObj, comments)
 {
-   return ChangeFlagMethod(object, argv[0], result, DCF_DISABLE_STATUS_POLL, true);
+   return vm->createValue(SharedObjectFromData<NetObj>(object)->getComments());
 }
 
 /**
- * readInternalParameter(name) method
+ * NetObj::country attribute
  */
-NXSL_METHOD_DEFINITION(DataCollectionTarget, readInternalParameter)
+NXSL_ATTRIBUTE_DEFINITION(NetObj, country)
 {
-   if (!argv[0]->isString())
-      return NXSL_ERR_NOT_STRING;
-
-   DataCollectionTarget *dct = static_cast<shared_ptr<DataCollectionTarget>*>(object->getData())->get();
-
-   TCHAR value[MAX_RESULT_LENGTH];
-   DataCollectionError rc = dct->getInternalMetric(argv[0]->getValueAsCString(), value, MAX_RESULT_LENGTH);
-   *result = (rc == DCE_SUCCESS) ? object->vm()->createValue(value) : object->vm()->createValue();
-   return 0;
+   return vm->createValue(SharedObjectFromData<NetObj>(object)->getPostalAddress().getCountry());
 }
 
 /**
- * DataCollectionTarget::removeTemplate(object)
+ * NetObj::creationTime attribute
  */
-NXSL_METHOD_DEFINITION(DataCollectionTarget, removeTemplate)
+NXSL_ATTRIBUTE_DEFINITION(NetObj, creationTime)
 {
-   shared_ptr<DataCollectionTarget> thisObject = *static_cast<shared_ptr<DataCollectionTarget>*>(object->getData());
-
-   if (!argv[0]->isObject())
-      return NXSL_ERR_NOT_OBJECT;
-
-   NXSL_Object *nxslTemplate = argv[0]->getValueAsObject();
-   if (!nxslTemplate->getClass()->instanceOf(g_nxslTemplateClass.getName()))
-      return NXSL_ERR_BAD_CLASS;
-
-   auto tmpl = *static_cast<shared_ptr<Template>*>(nxslTemplate->getData());
-   tmpl->deleteChild(*thisObject);
-   thisObject->deleteParent(*tmpl);
-   tmpl->queueRemoveFromTarget(thisObject->getId(), true);
-
-   *result = vm->createValue();
-   return 0;
+   return vm->createValue(static_cast<INT64>(SharedObjectFromData<NetObj>(object)->getCreationTime()));
 }
 
 /**
- * NXSL class DataCollectionTarget: constructor
+ * NetObj::customAttributes attribute
  */
-NXSL_DCTargetClass::NXSL_DCTargetClass() : NXSL_NetObjClass()
+NXSL_ATTRIBUTE_DEFINITION(NetObj, customAttributes)
 {
-   setName(_T("DataCollectionTarget"));
-
-   NXSL_REGISTER_METHOD(DataCollectionTarget, applyTemplate, 1);
-   NXSL_REGISTER_METHOD(DataCollectionTarget, enableConfigurationPolling, 1);
-   NXSL_REGISTER_METHOD(DataCollectionTarget, enableDataCollection, 1);
-   NXSL_REGISTER_METHOD(DataCollectionTarget, enableStatusPolling, 1);
-   NXSL_REGISTER_METHOD(DataCollectionTarget, readInternalParameter, 1);
-   NXSL_REGISTER_METHOD(DataCollectionTarget, removeTemplate, 1);
+   return SharedObjectFromData<NetObj>(object)->getCustomAttributesForNXSL(vm);
 }
 
 /**
- * NXSL class Zone: get attribute
+ * NetObj::district attribute
  */
-NXSL_Value *NXSL_DCTargetClass::getAttr(NXSL_Object *object, const NXSL_Identifier& attr)
+NXSL_ATTRIBUTE_DEFINITION(NetObj, district)
 {
-   NXSL_Value *value = NXSL_NetObjClass::getAttr(object, attr);
-   if (value != nullptr)
-      return value;
-
-   NXSL_VM *vm = object->vm();
-   auto dcTarget = SharedObjectFromData<DataCollectionTarget>(object);
-   if (NXSL_COMPARE_ATTRIBUTE_NAME("templates"))
-   {
-      value = vm->createValue(dcTarget->getTemplatesForNXSL(vm));
-   }
-   return value;
+   return vm->createValue(SharedObjectFromData<NetObj>(object)->getPostalAddress().getDistrict());
 }
 
 /**
- * NXSL class Zone: constructor
+ * NetObj::geolocation attribute
  */
-NXSL_ZoneClass::NXSL_ZoneClass() : NXSL_NetObjClass()
+NXSL_ATTRIBUTE_DEFINITION(NetObj, geolocation)
 {
-   setName(_T("Zone"));
+   return NXSL_GeoLocationClass::createObject(vm, SharedObjectFromData<NetObj>(object)->getGeoLocation());
 }
 
 /**
- * NXSL class Zone: get attribute
+ * NetObj::guid attribute
  */
-NXSL_Value *NXSL_ZoneClass::getAttr(NXSL_Object *object, const NXSL_Identifier& attr)
+NXSL_ATTRIBUTE_DEFINITION(NetObj, guid)
 {
-   NXSL_Value *value = NXSL_NetObjClass::getAttr(object, attr);
-   if (value != nullptr)
-      return value;
-
-   NXSL_VM *vm = object->vm();
-   auto zone = SharedObjectFromData<Zone>(object);
-   if (NXSL_COMPARE_ATTRIBUTE_NAME("proxyNodes"))
-   {
-      NXSL_Array *array = new NXSL_Array(vm);
-      IntegerArray<uint32_t> proxies = zone->getAllProxyNodes();
-      for(int i = 0; i < proxies.size(); i++)
-      {
-         shared_ptr<NetObj> node = FindObjectById(proxies.get(i), OBJECT_NODE);
-         if (node != nullptr)
-            array->append(node->createNXSLObject(vm));
-      }
-      value = vm->createValue(array);
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("proxyNodeIds"))
-   {
-      NXSL_Array *array = new NXSL_Array(vm);
-      IntegerArray<uint32_t> proxies = zone->getAllProxyNodes();
-      for(int i = 0; i < proxies.size(); i++)
-         array->append(vm->createValue(proxies.get(i)));
-      value = vm->createValue(array);
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("uin"))
-   {
-      value = vm->createValue(zone->getUIN());
-   }
-   return value;
+   NetObj *netobj = SharedObjectFromData<NetObj>(object);
+   TCHAR buffer[64];
+   return vm->createValue(netobj->getGuid().toString(buffer));
 }
 
 /**
- * Node::createSNMPTransport(port, community, context) method
+ * NetObj::id attribute
  */
-NXSL_METHOD_DEFINITION(Node, createSNMPTransport)
+NXSL_ATTRIBUTE_DEFINITION(NetObj, id)
 {
-   if (argc > 3)
-      return NXSL_ERR_INVALID_ARGUMENT_COUNT;
-
-   if ((argc > 0) && !argv[0]->isNull() && !argv[0]->isInteger())
-      return NXSL_ERR_NOT_INTEGER;
-
-   if ((argc > 1) && !argv[1]->isNull() && !argv[1]->isString())
-      return NXSL_ERR_NOT_STRING;
-
-   if ((argc > 2) && !argv[2]->isNull() && !argv[2]->isString())
-      return NXSL_ERR_NOT_STRING;
-
-   uint16_t port = ((argc > 0) && argv[0]->isInteger()) ? static_cast<uint16_t>(argv[0]->getValueAsInt32()) : 0;
-   const char *community = ((argc > 1) && argv[1]->isString()) ? argv[1]->getValueAsMBString() : nullptr;
-   const char *context = ((argc > 2) && argv[2]->isString()) ? argv[2]->getValueAsMBString() : nullptr;
-   SNMP_Transport *t = static_cast<shared_ptr<Node> *>(object->getData())->get()->createSnmpTransport(port, SNMP_VERSION_DEFAULT, context, community);
-   *result = (t != nullptr) ? vm->createValue(vm->createObject(&g_nxslSnmpTransportClass, t)) : vm->createValue();
-   return 0;
+   return vm->createValue(SharedObjectFromData<NetObj>(object)->getId());
 }
 
 /**
- * Web service handle (combination of web service definition and node used for executing request)
+ * NetObj::ipAddr attribute
  */
-typedef std::pair<shared_ptr<WebServiceDefinition>, shared_ptr<Node>> WebServiceHandle;
+NXSL_ATTRIBUTE_DEFINITION(NetObj, ipAddr)
+{
+   NetObj *netobj = SharedObjectFromData<NetObj>(object);
+   TCHAR buffer[64];
+   return vm->createValue(netobj->getPrimaryIpAddress().toString(buffer));
+}
 
 /**
- * Web service custom request with data
+ * NetObj::isInMaintenanceMode attribute
  */
-static int BaseWebServiceRequestWithData(WebServiceHandle *websvc, int argc, NXSL_Value **argv,
-      NXSL_Value **result, NXSL_VM *vm, const HttpRequestMethod requestMethod)
+NXSL_ATTRIBUTE_DEFINITION(NetObj, isInMaintenanceMode)
 {
-   if (argc < 1)
-      return NXSL_ERR_INVALID_ARGUMENT_COUNT;
-
-   const TCHAR *contentType = _T("application/json");
-   if (argc > 1)
-   {
-      if (!argv[1]->isString())
-      {
-         return NXSL_ERR_NOT_STRING;
-      }
-      else
-      {
-         contentType = argv[1]->getValueAsCString();
-      }
-   }
-
-   TCHAR *data = nullptr;
-   if (argv[0]->isObject(_T("JsonObject")) || argv[0]->isObject(_T("JsonArray")))
-   {
-      json_t *json = static_cast<json_t*>(argv[0]->getValueAsObject()->getData());
-      char *tmp = json_dumps(json, JSON_INDENT(3));
-#ifdef UNICODE
-      data = WideStringFromUTF8String(tmp);
-      MemFree(tmp);
-#else
-      data = tmp;
-#endif
-   }
-   else if (argv[0]->isString())
-   {
-      data = MemCopyString(argv[0]->getValueAsCString());
-   }
-   else
-   {
-      return NXSL_ERR_NOT_STRING;
-   }
-
-   StringList parameters;
-   for (int i = 2; i < argc; i++)
-      parameters.add(argv[i]->getValueAsCString());
-
-   WebServiceCallResult *response = websvc->first->makeCustomRequest(websvc->second, requestMethod, parameters, data, contentType);
-   *result = vm->createValue(vm->createObject(&g_nxslWebServiceResponseClass, response));
-   MemFree(data);
-
-   return 0;
+   return vm->createValue(SharedObjectFromData<NetObj>(object)->isInMaintenanceMode());
 }
 
 /**
- * Web service custom request with data
+ * NetObj::maintenanceInitiator attribute
  */
-static int BaseWebServiceRequestWithoutData(WebServiceHandle *websvc, int argc, NXSL_Value **argv,
-      NXSL_Value **result, NXSL_VM *vm, const HttpRequestMethod requestMethod)
+NXSL_ATTRIBUTE_DEFINITION(NetObj, maintenanceInitiator)
 {
-   StringList parameters;
-   for (int i = 0 ; i < argc; i++)
-      parameters.add(argv[i]->getValueAsCString());
-
-   WebServiceCallResult *response = websvc->first->makeCustomRequest(websvc->second, requestMethod, parameters, nullptr, nullptr);
-   *result = vm->createValue(vm->createObject(&g_nxslWebServiceResponseClass, response));
-
-   return 0;
+   return vm->createValue(SharedObjectFromData<NetObj>(object)->getMaintenanceInitiator());
 }
 
 /**
- * Node::callWebService(webSwcName, requestMethod, [postData], parameters...) method
+ * NetObj::mapImage attribute
  */
-NXSL_METHOD_DEFINITION(Node, callWebService)
+NXSL_ATTRIBUTE_DEFINITION(NetObj, mapImage)
 {
-   if (argc < 2)
-      return NXSL_ERR_INVALID_ARGUMENT_COUNT;
-
-   if ((argc > 0) && !argv[0]->isString())
-      return NXSL_ERR_NOT_STRING;
-
-   if ((argc > 1) && !argv[1]->isString())
-      return NXSL_ERR_NOT_STRING;
-
-   shared_ptr<WebServiceDefinition> d = FindWebServiceDefinition(argv[0]->getValueAsCString());
-   shared_ptr<Node> *node = static_cast<shared_ptr<Node>*>(object->getData());
-
-   if (d == nullptr)
-   {
-      WebServiceCallResult *webSwcResult = new WebServiceCallResult();
-      _tcsncpy(webSwcResult->errorMessage, _T("Web service definition not found"), WEBSVC_ERROR_TEXT_MAX_SIZE);
-      *result = vm->createValue(vm->createObject(&g_nxslWebServiceResponseClass, webSwcResult));
-      return 0;
-   }
-
-   WebServiceHandle websvc = WebServiceHandle(d, *node);
-   const TCHAR *requestMethod = argv[1]->getValueAsCString();
-   if (!_tcsicmp(_T("GET"), requestMethod))
-   {
-      return BaseWebServiceRequestWithoutData(&websvc, argc - 2, argv  + 2, result, vm, HttpRequestMethod::_GET);
-   }
-   else if (!_tcsicmp(_T("DELETE"), requestMethod))
-   {
-      return BaseWebServiceRequestWithoutData(&websvc, argc - 2, argv  + 2, result, vm, HttpRequestMethod::_DELETE);
-   }
-   else if (!_tcsicmp(_T("POST"), requestMethod))
-   {
-      return BaseWebServiceRequestWithData(&websvc, argc - 2, argv  + 2, result, vm, HttpRequestMethod::_POST);
-   }
-   else if (!_tcsicmp(_T("PUT"), requestMethod))
-   {
-      return BaseWebServiceRequestWithData(&websvc, argc - 2, argv  + 2, result, vm, HttpRequestMethod::_PUT);
-   }
-   else if (!_tcsicmp(_T("PATCH"), requestMethod))
-   {
-      return BaseWebServiceRequestWithData(&websvc, argc - 2, argv  + 2, result, vm, HttpRequestMethod::_PATCH);
-   }
-
-   WebServiceCallResult *webSwcResult = new WebServiceCallResult();
-   _tcslcpy(webSwcResult->errorMessage, _T("Invalid web service request method"), WEBSVC_ERROR_TEXT_MAX_SIZE);
-   *result = vm->createValue(vm->createObject(&g_nxslWebServiceResponseClass, webSwcResult));
-   return 0;
+   NetObj *netobj = SharedObjectFromData<NetObj>(object);
+   TCHAR buffer[64];
+   return vm->createValue(netobj->getMapImage().toString(buffer));
 }
 
 /**
- * enable8021x(enabled) method
+ * NetObj::name attribute
  */
-NXSL_METHOD_DEFINITION(Node, enable8021xStatusPolling)
+NXSL_ATTRIBUTE_DEFINITION(NetObj, name)
 {
-   return ChangeFlagMethod(object, argv[0], result, NF_DISABLE_8021X_STATUS_POLL, true);
+   return vm->createValue(SharedObjectFromData<NetObj>(object)->getName());
 }
 
 /**
- * enableAgent(enabled) method
+ * NetObj::nameOnMap attribute
  */
-NXSL_METHOD_DEFINITION(Node, enableAgent)
+NXSL_ATTRIBUTE_DEFINITION(NetObj, nameOnMap)
 {
-   return ChangeFlagMethod(object, argv[0], result, NF_DISABLE_NXCP, true);
+   return vm->createValue(SharedObjectFromData<NetObj>(object)->getNameOnMap());
 }
 
 /**
- * enableDiscoveryPolling(enabled) method
+ * NetObj::parents attribute
  */
-NXSL_METHOD_DEFINITION(Node, enableDiscoveryPolling)
+NXSL_ATTRIBUTE_DEFINITION(NetObj, parents)
 {
-   return ChangeFlagMethod(object, argv[0], result, NF_DISABLE_DISCOVERY_POLL, true);
+   return SharedObjectFromData<NetObj>(object)->getParentsForNXSL(vm);
 }
 
 /**
- * enableEtherNetIP(enabled) method
+ * NetObj::postcode attribute
  */
-NXSL_METHOD_DEFINITION(Node, enableEtherNetIP)
+NXSL_ATTRIBUTE_DEFINITION(NetObj, postcode)
 {
-   return ChangeFlagMethod(object, argv[0], result, NF_DISABLE_ETHERNET_IP, true);
+   return vm->createValue(SharedObjectFromData<NetObj>(object)->getPostalAddress().getPostCode());
 }
 
 /**
- * enableIcmp(enabled) method
+ * NetObj::primaryZoneProxy attribute
  */
-NXSL_METHOD_DEFINITION(Node, enableIcmp)
+NXSL_ATTRIBUTE_DEFINITION(NetObj, primaryZoneProxy)
 {
-   return ChangeFlagMethod(object, argv[0], result, NF_DISABLE_ICMP, true);
+   NetObj *netobj = SharedObjectFromData<NetObj>(object);
+   NXSL_Value *value;
+   UINT32 id = netobj->getAssignedZoneProxyId(false);
+   if (id != 0)
+   {
+      shared_ptr<NetObj> proxy = FindObjectById(id, OBJECT_NODE);
+      value = (proxy != nullptr) ? proxy->createNXSLObject(vm) : vm->createValue();
+   }
+   else
+   {
+      value = vm->createValue();
+   }
+   return value;
 }
 
 /**
- * enablePrimaryIPPing(enabled) method
+ * NetObj::primaryZoneProxyId attribute
  */
-NXSL_METHOD_DEFINITION(Node, enablePrimaryIPPing)
+NXSL_ATTRIBUTE_DEFINITION(NetObj, primaryZoneProxyId)
 {
-   return ChangeFlagMethod(object, argv[0], result, NF_PING_PRIMARY_IP, false);
+   return vm->createValue(SharedObjectFromData<NetObj>(object)->getAssignedZoneProxyId(false));
 }
 
 /**
- * enableRoutingTablePolling(enabled) method
+ * NetObj::region attribute
  */
-NXSL_METHOD_DEFINITION(Node, enableRoutingTablePolling)
+NXSL_ATTRIBUTE_DEFINITION(NetObj, region)
 {
-   return ChangeFlagMethod(object, argv[0], result, NF_DISABLE_ROUTE_POLL, true);
+   return vm->createValue(SharedObjectFromData<NetObj>(object)->getPostalAddress().getRegion());
 }
 
 /**
- * enableSnmp(enabled) method
+ * NetObj::responsibleUsers attribute
  */
-NXSL_METHOD_DEFINITION(Node, enableSnmp)
+NXSL_ATTRIBUTE_DEFINITION(NetObj, responsibleUsers)
 {
-   return ChangeFlagMethod(object, argv[0], result, NF_DISABLE_SNMP, true);
+   NetObj *netobj = SharedObjectFromData<NetObj>(object);
+   NXSL_Array *array = new NXSL_Array(vm);
+   unique_ptr<StructArray<ResponsibleUser>> responsibleUsers = netobj->getAllResponsibleUsers();
+   unique_ptr<ObjectArray<UserDatabaseObject>> userDB = FindUserDBObjects(*responsibleUsers);
+   userDB->setOwner(Ownership::False);
+   for(int i = 0; i < userDB->size(); i++)
+   {
+      array->append(userDB->get(i)->createNXSLObject(vm));
+   }
+   return vm->createValue(array);
 }
 
 /**
- * enableSsh(enabled) method
+ * NetObj::state attribute
  */
-NXSL_METHOD_DEFINITION(Node, enableSsh) // TODO DIMA add to docks
+NXSL_ATTRIBUTE_DEFINITION(NetObj, state)
 {
-   return ChangeFlagMethod(object, argv[0], result, NF_DISABLE_SSH, true);
+   return vm->createValue(SharedObjectFromData<NetObj>(object)->getState());
 }
 
 /**
- * enableTopologyPolling(enabled) method
+ * NetObj::status attribute
  */
-NXSL_METHOD_DEFINITION(Node, enableTopologyPolling)
+NXSL_ATTRIBUTE_DEFINITION(NetObj, status)
 {
-   return ChangeFlagMethod(object, argv[0], result, NF_DISABLE_TOPOLOGY_POLL, true);
+   return vm->createValue((LONG)SharedObjectFromData<NetObj>(object)->getStatus());
 }
 
 /**
- * Node::executeAgentCommand(command, ...) method
+ * NetObj::streetAddress attribute
  */
-NXSL_METHOD_DEFINITION(Node, executeAgentCommand)
+NXSL_ATTRIBUTE_DEFINITION(NetObj, streetAddress)
 {
-   if (argc < 1)
-      return NXSL_ERR_INVALID_ARGUMENT_COUNT;
-
-   for(int i = 0; i < argc; i++)
-      if (!argv[i]->isString())
-         return NXSL_ERR_NOT_STRING;
-
-   Node *node = static_cast<shared_ptr<Node>*>(object->getData())->get();
-   shared_ptr<AgentConnectionEx> conn = node->createAgentConnection();
-   if (conn != nullptr)
-   {
-      StringList list;
-      for(int i = 1; (i < argc) && (i < 128); i++)
-         list.add(argv[i]->getValueAsCString());
-      uint32_t rcc = conn->executeCommand(argv[0]->getValueAsCString(), list);
-      *result = vm->createValue(rcc == ERR_SUCCESS);
-      nxlog_debug(5, _T("NXSL: Node::executeAgentCommand: command \"%s\" on node %s [%u]: RCC=%u"), argv[0]->getValueAsCString(), node->getName(), node->getId(), rcc);
-   }
-   else
-   {
-      *result = vm->createValue(false);
-   }
-   return 0;
+   return vm->createValue(SharedObjectFromData<NetObj>(object)->getPostalAddress().getStreetAddress());
 }
 
 /**
- * Node::executeAgentCommandWithOutput(command, ...) method
+ * NetObj::type attribute
  */
-NXSL_METHOD_DEFINITION(Node, executeAgentCommandWithOutput)
+NXSL_ATTRIBUTE_DEFINITION(NetObj, type)
 {
-   if (argc < 1)
-      return NXSL_ERR_INVALID_ARGUMENT_COUNT;
+   return vm->createValue((LONG)SharedObjectFromData<NetObj>(object)->getObjectClass());
+}
 
-   for(int i = 0; i < argc; i++)
-      if (!argv[i]->isString())
-         return NXSL_ERR_NOT_STRING;
+/**
+ * NXSL class NetObj: constructor
+ */
+NXSL_NetObjClass::NXSL_NetObjClass() : NXSL_Class()
+{
+   setName(_T("NetObj"));
 
-   Node *node = static_cast<shared_ptr<Node>*>(object->getData())->get();
-   shared_ptr<AgentConnectionEx> conn = node->createAgentConnection();
-   if (conn != nullptr)
-   {
-      StringList list;
-      for(int i = 1; (i < argc) && (i < 128); i++)
-         list.add(argv[i]->getValueAsCString());
-      StringBuffer output;
-      uint32_t rcc = conn->executeCommand(argv[0]->getValueAsCString(), list, true, [](ActionCallbackEvent event, const TCHAR *text, void *context) {
-         if (event == ACE_DATA)
-            static_cast<StringBuffer*>(context)->append(text);
-      }, &output);
-      *result = (rcc == ERR_SUCCESS) ? vm->createValue(output) : vm->createValue();
-      nxlog_debug(5, _T("NXSL: Node::executeAgentCommandWithOutput: command \"%s\" on node %s [%u]: RCC=%u"), argv[0]->getValueAsCString(), node->getName(), node->getId(), rcc);
-   }
-   else
-   {
-      *result = vm->createValue();
-   }
-   return 0;
+   NXSL_REGISTER_METHOD(NetObj, bind, 1);
+   NXSL_REGISTER_METHOD(NetObj, bindTo, 1);
+   NXSL_REGISTER_METHOD(NetObj, clearGeoLocation, 0);
+   NXSL_REGISTER_METHOD(NetObj, delete, 0);
+   NXSL_REGISTER_METHOD(NetObj, deleteCustomAttribute, 1);
+   NXSL_REGISTER_METHOD(NetObj, isDirectChild, 1);
+   NXSL_REGISTER_METHOD(NetObj, isDirectParent, 1);
+   NXSL_REGISTER_METHOD(NetObj, enterMaintenance, -1);
+   NXSL_REGISTER_METHOD(NetObj, expandString, 1);
+   NXSL_REGISTER_METHOD(NetObj, getCustomAttribute, 1);
+   NXSL_REGISTER_METHOD(NetObj, getResponsibleUsers, 1);
+   NXSL_REGISTER_METHOD(NetObj, isChild, 1);
+   NXSL_REGISTER_METHOD(NetObj, isParent, 1);
+   NXSL_REGISTER_METHOD(NetObj, leaveMaintenance, 0);
+   NXSL_REGISTER_METHOD(NetObj, manage, 0);
+   NXSL_REGISTER_METHOD(NetObj, readMaintenanceJournal, -1);
+   NXSL_REGISTER_METHOD(NetObj, rename, 1);
+   NXSL_REGISTER_METHOD(NetObj, setAlias, 1);
+   NXSL_REGISTER_METHOD(NetObj, setCategory, 1);
+   NXSL_REGISTER_METHOD(NetObj, setComments, 1);
+   NXSL_REGISTER_METHOD(NetObj, setCustomAttribute, -1);
+   NXSL_REGISTER_METHOD(NetObj, setGeoLocation, 1);
+   NXSL_REGISTER_METHOD(NetObj, setMapImage, 1);
+   NXSL_REGISTER_METHOD(NetObj, setNameOnMap, 1);
+   NXSL_REGISTER_METHOD(NetObj, setStatusCalculation, -1);
+   NXSL_REGISTER_METHOD(NetObj, setStatusPropagation, -1);
+   NXSL_REGISTER_METHOD(NetObj, unbind, 1);
+   NXSL_REGISTER_METHOD(NetObj, unbindFrom, 1);
+   NXSL_REGISTER_METHOD(NetObj, unmanage, 0);
+   NXSL_REGISTER_METHOD(NetObj, writeMaintenanceJournal, 1);
+
+   NXSL_REGISTER_ATTRIBUTE(NetObj, alarms);
+   NXSL_REGISTER_ATTRIBUTE(NetObj, alias);
+   NXSL_REGISTER_ATTRIBUTE(NetObj, backupZoneProxy);
+   NXSL_REGISTER_ATTRIBUTE(NetObj, backupZoneProxyId);
+   NXSL_REGISTER_ATTRIBUTE(NetObj, category);
+   NXSL_REGISTER_ATTRIBUTE(NetObj, categoryId);
+   NXSL_REGISTER_ATTRIBUTE(NetObj, children);
+   NXSL_REGISTER_ATTRIBUTE(NetObj, city);
+   NXSL_REGISTER_ATTRIBUTE(NetObj, comments);
+   NXSL_REGISTER_ATTRIBUTE(NetObj, country);
+   NXSL_REGISTER_ATTRIBUTE(NetObj, creationTime);
+   NXSL_REGISTER_ATTRIBUTE(NetObj, customAttributes);
+   NXSL_REGISTER_ATTRIBUTE(NetObj, district);
+   NXSL_REGISTER_ATTRIBUTE(NetObj, geolocation);
+   NXSL_REGISTER_ATTRIBUTE(NetObj, guid);
+   NXSL_REGISTER_ATTRIBUTE(NetObj, id);
+   NXSL_REGISTER_ATTRIBUTE(NetObj, ipAddr);
+   NXSL_REGISTER_ATTRIBUTE(NetObj, isInMaintenanceMode);
+   NXSL_REGISTER_ATTRIBUTE(NetObj, maintenanceInitiator);
+   NXSL_REGISTER_ATTRIBUTE(NetObj, mapImage);
+   NXSL_REGISTER_ATTRIBUTE(NetObj, name);
+   NXSL_REGISTER_ATTRIBUTE(NetObj, nameOnMap);
+   NXSL_REGISTER_ATTRIBUTE(NetObj, parents);
+   NXSL_REGISTER_ATTRIBUTE(NetObj, postcode);
+   NXSL_REGISTER_ATTRIBUTE(NetObj, primaryZoneProxy);
+   NXSL_REGISTER_ATTRIBUTE(NetObj, primaryZoneProxyId);
+   NXSL_REGISTER_ATTRIBUTE(NetObj, region);
+   NXSL_REGISTER_ATTRIBUTE(NetObj, responsibleUsers);
+   NXSL_REGISTER_ATTRIBUTE(NetObj, state);
+   NXSL_REGISTER_ATTRIBUTE(NetObj, status);
+   NXSL_REGISTER_ATTRIBUTE(NetObj, streetAddress);
+   NXSL_REGISTER_ATTRIBUTE(NetObj, type);
 }
 
 /**
- * Node::executeSSHCommand(command) method
+ * Object destruction handler
  */
-NXSL_METHOD_DEFINITION(Node, executeSSHCommand)
+void NXSL_NetObjClass::onObjectDelete(NXSL_Object *object)
 {
-   if (!argv[0]->isString())
-      return NXSL_ERR_NOT_STRING;
+   delete static_cast<shared_ptr<NetObj>*>(object->getData());
+}
 
-   Node *node = static_cast<shared_ptr<Node>*>(object->getData())->get();
-   uint32_t proxyId = node->getEffectiveSshProxy();
-   if (proxyId != 0)
-   {
-      shared_ptr<Node> proxyNode = static_pointer_cast<Node>(FindObjectById(proxyId, OBJECT_NODE));
-      if (proxyNode != nullptr)
-      {
-         TCHAR ipAddr[64];
-         StringBuffer request(_T("SSH.Command("));
-         request.append(node->getIpAddress().toString(ipAddr));
-         request.append(_T(':'));
-         request.append(node->getSshPort());
-         request.append(_T(",\""));
-         request.append(EscapeStringForAgent(node->getSshLogin()).cstr());
-         request.append(_T("\",\""));
-         request.append(EscapeStringForAgent(node->getSshPassword()).cstr());
-         request.append(_T("\",\""));
-         request.append(EscapeStringForAgent(argv[0]->getValueAsCString()).cstr());
-         request.append(_T("\",,"));
-         request.append(node->getSshKeyId());
-         request.append(_T(')'));
+/**
+ * NXSL class NetObj: get attribute. Built-in attributes are resolved by registered attribute handlers,
+ * this method only provides fallback to custom attributes.
+ */
+NXSL_Value *NXSL_NetObjClass::getAttr(NXSL_Object *object, const NXSL_Identifier& attr)
+{
+   NXSL_Value *value = NXSL_Class::getAttr(object, attr);
+   if (value != nullptr)
+      return value;
 
-         StringList *list;
-         uint32_t rcc = proxyNode->getListFromAgent(request, &list);
-         *result = (rcc == DCE_SUCCESS) ? vm->createValue(new NXSL_Array(vm, list)) : vm->createValue();
-         delete list;
-      }
-      else
-      {
-         *result = vm->createValue();
-      }
-   }
-   else
+   NetObj *netobj = SharedObjectFromData<NetObj>(object);
+   if (netobj != nullptr)   // Object can be null if attribute scan is running
    {
-      *result = vm->createValue();
+#ifdef UNICODE
+      WCHAR wattr[MAX_IDENTIFIER_LENGTH];
+      utf8_to_wchar(attr.value, -1, wattr, MAX_IDENTIFIER_LENGTH);
+      wattr[MAX_IDENTIFIER_LENGTH - 1] = 0;
+      value = netobj->getCustomAttributeForNXSL(object->vm(), wattr);
+#else
+      value = netobj->getCustomAttributeForNXSL(object->vm(), attr.value);
+#endif
    }
-   return 0;
+   return value;
 }
 
 /**
- * Node::getInterface(interfaceId) method
- * Interface ID could be ifIndex, name, or MAC address
+ * NXSL class Zone: constructor
  */
-NXSL_METHOD_DEFINITION(Node, getInterface)
+NXSL_SubnetClass::NXSL_SubnetClass() : NXSL_NetObjClass()
 {
-   if (!argv[0]->isString())
-      return NXSL_ERR_NOT_STRING;
+   setName(_T("Subnet"));
+}
 
-   shared_ptr<Interface> iface;
-   if (argv[0]->isInteger())  // Assume interface index
+/**
+ * NXSL class Zone: get attribute
+ */
+NXSL_Value *NXSL_SubnetClass::getAttr(NXSL_Object *object, const NXSL_Identifier& attr)
+{
+   NXSL_Value *value = NXSL_NetObjClass::getAttr(object, attr);
+   if (value != nullptr)
+      return value;
+
+   NXSL_VM *vm = object->vm();
+   auto subnet = SharedObjectFromData<Subnet>(object);
+   if (NXSL_COMPARE_ATTRIBUTE_NAME("ipNetMask"))
    {
-      iface = static_cast<shared_ptr<Node>*>(object->getData())->get()->findInterfaceByIndex(argv[0]->getValueAsUInt32());
+      value = vm->createValue(subnet->getIpAddress().getMaskBits());
    }
-   else
+   else if (NXSL_COMPARE_ATTRIBUTE_NAME("isSyntheticMask"))
    {
-      MacAddress macAddr = MacAddress::parse(argv[0]->getValueAsCString());
-      if (macAddr.isValid() && macAddr.length() >= 6)
-         iface = static_cast<shared_ptr<Node>*>(object->getData())->get()->findInterfaceByMAC(macAddr);
+      value = vm->createValue(subnet->isSyntheticMask());
+   }
+   else if (NXSL_COMPARE_ATTRIBUTE_NAME("zone"))
+   {
+      if (g_flags & AF_ENABLE_ZONING)
+      {
+         shared_ptr<Zone> zone = FindZoneByUIN(subnet->getZoneUIN());
+         if (zone != nullptr)
+         {
+            value = zone->createNXSLObject(vm);
+         }
+         else
+         {
+            value = vm->createValue();
+         }
+      }
       else
-         iface = static_cast<shared_ptr<Node>*>(object->getData())->get()->findInterfaceByName(argv[0]->getValueAsCString());
+      {
+         value = vm->createValue();
+      }
    }
-   *result = (iface != nullptr) ? iface->createNXSLObject(vm) : vm->createValue();
-   return 0;
+   else if (NXSL_COMPARE_ATTRIBUTE_NAME("zoneUIN"))
+   {
+      value = vm->createValue(subnet->getZoneUIN());
+   }
+   return value;
 }
 
 /**
- * Node::getInterfaceByIndex(ifIndex) method
+ * DataCollectionTarget::applyTemplate(object)
  */
-NXSL_METHOD_DEFINITION(Node, getInterfaceByIndex)
+NXSL_METHOD_DEFINITION(DataCollectionTarget, applyTemplate)
 {
-   if (!argv[0]->isInteger())
-      return NXSL_ERR_NOT_INTEGER;
+   shared_ptr<DataCollectionTarget> thisObject = *static_cast<shared_ptr<DataCollectionTarget>*>(object->getData());
 
-   shared_ptr<Interface> iface = static_cast<shared_ptr<Node>*>(object->getData())->get()->findInterfaceByIndex(argv[0]->getValueAsUInt32());
-   *result = (iface != nullptr) ? iface->createNXSLObject(vm) : vm->createValue();
-   return 0;
-}
+   if (!argv[0]->isObject())
+      return NXSL_ERR_NOT_OBJECT;
 
-/**
- * Node::getInterfaceByMACAddress(macAddress) method
- */
-NXSL_METHOD_DEFINITION(Node, getInterfaceByMACAddress)
-{
-   if (!argv[0]->isString())
-      return NXSL_ERR_NOT_STRING;
+   NXSL_Object *nxslTemplate = argv[0]->getValueAsObject();
+   if (!nxslTemplate->getClass()->instanceOf(g_nxslTemplateClass.getName()))
+      return NXSL_ERR_BAD_CLASS;
 
-   MacAddress macAddr = MacAddress::parse(argv[0]->getValueAsCString());
-   shared_ptr<Interface> iface = macAddr.isValid() ? static_cast<shared_ptr<Node>*>(object->getData())->get()->findInterfaceByMAC(macAddr) : shared_ptr<Interface>();
-   *result = (iface != nullptr) ? iface->createNXSLObject(vm) : vm->createValue();
+   static_cast<shared_ptr<Template>*>(nxslTemplate->getData())->get()->applyToTarget(thisObject);
+
+   *result = vm->createValue();
    return 0;
 }
 
 /**
- * Node::getInterfaceByName(name) method
+ * enableConfigurationPolling(enabled) method
  */
-NXSL_METHOD_DEFINITION(Node, getInterfaceByName)
+NXSL_METHOD_DEFINITION(DataCollectionTarget, enableConfigurationPolling)
 {
-   if (!argv[0]->isString())
-      return NXSL_ERR_NOT_STRING;
-
-   shared_ptr<Interface> iface = static_cast<shared_ptr<Node>*>(object->getData())->get()->findInterfaceByName(argv[0]->getValueAsCString());
-   *result = (iface != nullptr) ? iface->createNXSLObject(vm) : vm->createValue();
-   return 0;
+   return ChangeFlagMethod(object, argv[0], result, DCF_DISABLE_CONF_POLL, true);
 }
 
 /**
- * Node::getInterfaceName(ifIndex) method
+ * enableDataCollection(enabled) method
  */
-NXSL_METHOD_DEFINITION(Node, getInterfaceName)
+NXSL_METHOD_DEFINITION(DataCollectionTarget, enableDataCollection)
 {
-   if (!argv[0]->isInteger())
-      return NXSL_ERR_NOT_INTEGER;
-
-   shared_ptr<Interface> iface = static_cast<shared_ptr<Node>*>(object->getData())->get()->findInterfaceByIndex(argv[0]->getValueAsUInt32());
-   *result = (iface != nullptr) ? vm->createValue(iface->getName()) : vm->createValue();
-   return 0;
+   return ChangeFlagMethod(object, argv[0], result, DCF_DISABLE_DATA_COLLECT, true);
 }
 
 /**
- * Node::getWebService(name) method
+ * enableStatusPolling(enabled) method
  */
-NXSL_METHOD_DEFINITION(Node, getWebService)
+NXSL_METHOD_DEFINITION(DataCollectionTarget, enableStatusPolling)
 {
-   if (!argv[0]->isString())
-      return NXSL_ERR_NOT_INTEGER;
-
-   shared_ptr<Node> *node = static_cast<shared_ptr<Node>*>(object->getData());
-
-   shared_ptr<WebServiceDefinition> d = FindWebServiceDefinition(argv[0]->getValueAsCString());
-   if (d == nullptr)
-   {
-      *result = vm->createValue();
-   }
-   else
-   {
-      *result = vm->createValue(vm->createObject(&g_nxslWebServiceClass, new WebServiceHandle(d, *node)));
-   }
-   return 0;
+   return ChangeFlagMethod(object, argv[0], result, DCF_DISABLE_STATUS_POLL, true);
 }
 
 /**
- * Node::readAgentParameter(name) method
+ * readInternalParameter(name) method
  */
-NXSL_METHOD_DEFINITION(Node, readAgentParameter)
+NXSL_METHOD_DEFINITION(DataCollectionTarget, readInternalParameter)
 {
    if (!argv[0]->isString())
       return NXSL_ERR_NOT_STRING;
 
-   TCHAR buffer[MAX_RESULT_LENGTH];
-   uint32_t rcc = static_cast<shared_ptr<Node>*>(object->getData())->get()->getMetricFromAgent(argv[0]->getValueAsCString(), buffer, MAX_RESULT_LENGTH);
-   *result = (rcc == DCE_SUCCESS) ? vm->createValue(buffer) : vm->createValue();
+   DataCollectionTarget *dct = static_cast<shared_ptr<DataCollectionTarget>*>(object->getData())->get();
+
+   TCHAR value[MAX_RESULT_LENGTH];
+   DataCollectionError rc = dct->getInternalMetric(argv[0]->getValueAsCString(), value, MAX_RESULT_LENGTH);
+   *result = (rc == DCE_SUCCESS) ? object->vm()->createValue(value) : object->vm()->createValue();
    return 0;
 }
 
 /**
- * Node::readAgentList(name) method
+ * DataCollectionTarget::removeTemplate(object)
  */
-NXSL_METHOD_DEFINITION(Node, readAgentList)
+NXSL_METHOD_DEFINITION(DataCollectionTarget, removeTemplate)
 {
-   if (!argv[0]->isString())
-      return NXSL_ERR_NOT_STRING;
-
-   StringList *list;
-   uint32_t rcc = static_cast<shared_ptr<Node>*>(object->getData())->get()->getListFromAgent(argv[0]->getValueAsCString(), &list);
-   *result = (rcc == DCE_SUCCESS) ? vm->createValue(new NXSL_Array(vm, list)) : vm->createValue();
-   delete list;
-   return 0;
-}
+   shared_ptr<DataCollectionTarget> thisObject = *static_cast<shared_ptr<DataCollectionTarget>*>(object->getData());
 
-/**
- * Node::readAgentTable(name) method
- */
-NXSL_METHOD_DEFINITION(Node, readAgentTable)
-{
-   if (!argv[0]->isString())
-      return NXSL_ERR_NOT_STRING;
+   if (!argv[0]->isObject())
+      return NXSL_ERR_NOT_OBJECT;
 
-   shared_ptr<Table> table;
-   uint32_t rcc = static_cast<shared_ptr<Node>*>(object->getData())->get()->getTableFromAgent(argv[0]->getValueAsCString(), &table);
-   *result = (rcc == DCE_SUCCESS) ? vm->createValue(vm->createObject(&g_nxslTableClass, new shared_ptr<Table>(table))) : vm->createValue();
-   return 0;
-}
+   NXSL_Object *nxslTemplate = argv[0]->getValueAsObject();
+   if (!nxslTemplate->getClass()->instanceOf(g_nxslTemplateClass.getName()))
+      return NXSL_ERR_BAD_CLASS;
 
-/**
- * Node::readDriverParameter(name) method
- */
-NXSL_METHOD_DEFINITION(Node, readDriverParameter)
-{
-   if (!argv[0]->isString())
-      return NXSL_ERR_NOT_STRING;
+   auto tmpl = *static_cast<shared_ptr<Template>*>(nxslTemplate->getData());
+   tmpl->deleteChild(*thisObject);
+   thisObject->deleteParent(*tmpl);
+   tmpl->queueRemoveFromTarget(thisObject->getId(), true);
 
-   TCHAR buffer[MAX_RESULT_LENGTH];
-   uint32_t rcc = static_cast<shared_ptr<Node>*>(object->getData())->get()->getMetricFromDeviceDriver(argv[0]->getValueAsCString(), buffer, MAX_RESULT_LENGTH);
-   *result = (rcc == DCE_SUCCESS) ? vm->createValue(buffer) : vm->createValue();
+   *result = vm->createValue();
    return 0;
 }
 
 /**
- * Node::readInternalParameter(name) method
+ * DataCollectionTarget::templates attribute
  */
-NXSL_METHOD_DEFINITION(Node, readInternalParameter)
+NXSL_ATTRIBUTE_DEFINITION(DataCollectionTarget, templates)
 {
-   if (!argv[0]->isString())
-      return NXSL_ERR_NOT_STRING;
-
-   TCHAR buffer[MAX_RESULT_LENGTH];
-   uint32_t rcc = static_cast<shared_ptr<Node>*>(object->getData())->get()->getInternalMetric(argv[0]->getValueAsCString(), buffer, MAX_RESULT_LENGTH);
-   *result = (rcc == DCE_SUCCESS) ? vm->createValue(buffer) : vm->createValue();
-   return 0;
+   return vm->createValue(SharedObjectFromData<DataCollectionTarget>(object)->getTemplatesForNXSL(vm));
 }
 
 /**
- * Node::readInternalTable(name) method
+ * NXSL class DataCollectionTarget: constructor
  */
-NXSL_METHOD_DEFINITION(Node, readInternalTable)
+NXSL_DCTargetClass::NXSL_DCTargetClass() : NXSL_NetObjClass()
 {
-   if (!argv[0]->isString())
-      return NXSL_ERR_NOT_STRING;
+   setName(_T("DataCollectionTarget"));
 
-   shared_ptr<Table> table;
-   uint32_t rcc = static_cast<shared_ptr<Node>*>(object->getData())->get()->getInternalTable(argv[0]->getValueAsCString(), &table);
-   *result = (rcc == DCE_SUCCESS) ? vm->createValue(vm->createObject(&g_nxslTableClass, new shared_ptr<Table>(table))) : vm->createValue();
-   return 0;
+   NXSL_REGISTER_METHOD(DataCollectionTarget, applyTemplate, 1);
+   NXSL_REGISTER_METHOD(DataCollectionTarget, enableConfigurationPolling, 1);
+   NXSL_REGISTER_METHOD(DataCollectionTarget, enableDataCollection, 1);
+   NXSL_REGISTER_METHOD(DataCollectionTarget, enableStatusPolling, 1);
+   NXSL_REGISTER_METHOD(DataCollectionTarget, readInternalParameter, 1);
+   NXSL_REGISTER_METHOD(DataCollectionTarget, removeTemplate, 1);
+
+   NXSL_REGISTER_ATTRIBUTE(DataCollectionTarget, templates);
 }
 
 /**
- * Node::readWebServiceParameter(name) method
+ * NXSL class Zone: constructor
  */
-NXSL_METHOD_DEFINITION(Node, readWebServiceParameter)
+NXSL_ZoneClass::NXSL_ZoneClass() : NXSL_NetObjClass()
 {
-   if (!argv[0]->isString())
-      return NXSL_ERR_NOT_STRING;
-
-   TCHAR buffer[MAX_RESULT_LENGTH];
-   uint32_t rcc = static_cast<shared_ptr<Node>*>(object->getData())->get()->getMetricFromWebService(argv[0]->getValueAsCString(), buffer, MAX_RESULT_LENGTH);
-   *result = (rcc == DCE_SUCCESS) ? vm->createValue(buffer) : vm->createValue();
-   return 0;
+   setName(_T("Zone"));
 }
 
 /**
- * Node::readWebServiceList(name) method
+ * NXSL class Zone: get attribute
  */
-NXSL_METHOD_DEFINITION(Node, readWebServiceList)
+NXSL_Value *NXSL_ZoneClass::getAttr(NXSL_Object *object, const NXSL_Identifier& attr)
 {
-   if (!argv[0]->isString())
-      return NXSL_ERR_NOT_STRING;
+   NXSL_Value *value = NXSL_NetObjClass::getAttr(object, attr);
+   if (value != nullptr)
+      return value;
 
-   StringList *list;
-   uint32_t rcc = static_cast<shared_ptr<Node>*>(object->getData())->get()->getListFromWebService(argv[0]->getValueAsCString(), &list);
-   *result = (rcc == DCE_SUCCESS) ? vm->createValue(new NXSL_Array(vm, list)) : vm->createValue();
-   delete list;
-   return 0;
+   NXSL_VM *vm = object->vm();
+   auto zone = SharedObjectFromData<Zone>(object);
+   if (NXSL_COMPARE_ATTRIBUTE_NAME("proxyNodes"))
+   {
+      NXSL_Array *array = new NXSL_Array(vm);
+      IntegerArray<uint32_t> proxies = zone->getAllProxyNodes();
+      for(int i = 0; i < proxies.size(); i++)
+      {
+         shared_ptr<NetObj> node = FindObjectById(proxies.get(i), OBJECT_NODE);
+         if (node != nullptr)
+            array->append(node->createNXSLObject(vm));
+      }
+      value = vm->createValue(array);
+   }
+   else if (NXSL_COMPARE_ATTRIBUTE_NAME("proxyNodeIds"))
+   {
+      NXSL_Array *array = new NXSL_Array(vm);
+      IntegerArray<uint32_t> proxies = zone->getAllProxyNodes();
+      for(int i = 0; i < proxies.size(); i++)
+         array->append(vm->createValue(proxies.get(i)));
+      value = vm->createValue(array);
+   }
+   else if (NXSL_COMPARE_ATTRIBUTE_NAME("uin"))
+   {
+      value = vm->createValue(zone->getUIN());
+   }
+   return value;
 }
 
 /**
- * Node::setIfXTableUsageMode(mode) method
+ * Node::createSNMPTransport(port, community, context) method
  */
-NXSL_METHOD_DEFINITION(Node, setIfXTableUsageMode)
+NXSL_METHOD_DEFINITION(Node, createSNMPTransport)
 {
-   if (!argv[0]->isInteger())
-      return NXSL_ERR_NOT_INTEGER;
+   if (argc > 3)
+      return NXSL_ERR_INVALID_ARGUMENT_COUNT;
 
-   int mode = argv[0]->getValueAsInt32();
-   if ((mode != IFXTABLE_DISABLED) && (mode != IFXTABLE_ENABLED))
-      mode = IFXTABLE_DEFAULT;
+   if ((argc > 0) && !argv[0]->isNull() && !argv[0]->isInteger())
+      return NXSL_ERR_NOT_INTEGER;
 
-   static_cast<shared_ptr<Node>*>(object->getData())->get()->setIfXtableUsageMode(mode);
-   *result = vm->createValue();
-   return 0;
-}
+   if ((argc > 1) && !argv[1]->isNull() && !argv[1]->isString())
+      return NXSL_ERR_NOT_STRING;
 
-/**
- * NXSL class Node: constructor
- */
-NXSL_NodeClass::NXSL_NodeClass() : NXSL_DCTargetClass()
-{
-   setName(_T("Node"));
+   if ((argc > 2) && !argv[2]->isNull() && !argv[2]->isString())
+      return NXSL_ERR_NOT_STRING;
 
-   NXSL_REGISTER_METHOD(Node, callWebService, -1);
-   NXSL_REGISTER_METHOD(Node, createSNMPTransport, -1);
-   NXSL_REGISTER_METHOD(Node, enable8021xStatusPolling, 1);
-   NXSL_REGISTER_METHOD(Node, enableAgent, 1);
-   NXSL_REGISTER_METHOD(Node, enableDiscoveryPolling, 1);
-   NXSL_REGISTER_METHOD(Node, enableEtherNetIP, 1);
-   NXSL_REGISTER_METHOD(Node, enableIcmp, 1);
-   NXSL_REGISTER_METHOD(Node, enablePrimaryIPPing, 1);
-   NXSL_REGISTER_METHOD(Node, enableRoutingTablePolling, 1);
-   NXSL_REGISTER_METHOD(Node, enableSnmp, 1);
-   NXSL_REGISTER_METHOD(Node, enableSsh, 1);
-   NXSL_REGISTER_METHOD(Node, enableTopologyPolling, 1);
-   NXSL_REGISTER_METHOD(Node, executeAgentCommand, -1);
-   NXSL_REGISTER_METHOD(Node, executeAgentCommandWithOutput, -1);
-   NXSL_REGISTER_METHOD(Node, executeSSHCommand, 1);
-   NXSL_REGISTER_METHOD(Node, getInterface, 1);
-   NXSL_REGISTER_METHOD(Node, getInterfaceByIndex, 1);
-   NXSL_REGISTER_METHOD(Node, getInterfaceByMACAddress, 1);
-   NXSL_REGISTER_METHOD(Node, getInterfaceByName, 1);
-   NXSL_REGISTER_METHOD(Node, getInterfaceName, 1);
-   NXSL_REGISTER_METHOD(Node, getWebService, 1);
-   NXSL_REGISTER_METHOD(Node, readAgentList, 1);
-   NXSL_REGISTER_METHOD(Node, readAgentParameter, 1);
-   NXSL_REGISTER_METHOD(Node, readAgentTable, 1);
-   NXSL_REGISTER_METHOD(Node, readDriverParameter, 1);
-   NXSL_REGISTER_METHOD(Node, readInternalParameter, 1);
-   NXSL_REGISTER_METHOD(Node, readInternalTable, 1);
-   NXSL_REGISTER_METHOD(Node, readWebServiceList, 1);
-   NXSL_REGISTER_METHOD(Node, readWebServiceParameter, 1);
-   NXSL_REGISTER_METHOD(Node, setIfXTableUsageMode, 1);
+   uint16_t port = ((argc > 0) && argv[0]->isInteger()) ? static_cast<uint16_t>(argv[0]->getValueAsInt32()) : 0;
+   const char *community = ((argc > 1) && argv[1]->isString()) ? argv[1]->getValueAsMBString() : nullptr;
+   const char *context = ((argc > 2) && argv[2]->isString()) ? argv[2]->getValueAsMBString() : nullptr;
+   SNMP_Transport *t = static_cast<shared_ptr<Node> *>(object->getData())->get()->createSnmpTransport(port, SNMP_VERSION_DEFAULT, context, community);
+   *result = (t != nullptr) ? vm->createValue(vm->createObject(&g_nxslSnmpTransportClass, t)) : vm->createValue();
+   return 0;
 }
 
 /**
- * Get ICMP statistic for object
+ * Web service handle (combination of web service definition and node used for executing request)
  */
-static NXSL_Value *GetNodeIcmpStatistic(Node *node, IcmpStatFunction function, NXSL_VM *vm)
-{
-   NXSL_Value *value;
-   TCHAR buffer[MAX_RESULT_LENGTH];
-   if (node->getIcmpStatistic(nullptr, function, buffer) == DCE_SUCCESS)
-   {
-      value = vm->createValue(buffer);
-   }
-   else
-   {
-      value = vm->createValue();
-   }
-   return value;
-}
+typedef std::pair<shared_ptr<WebServiceDefinition>, shared_ptr<Node>> WebServiceHandle;
 
 /**
- * NXSL class Node: get attribute
+ * Web service custom request with data
  */
-NXSL_Value *NXSL_NodeClass::getAttr(NXSL_Object *object, const NXSL_Identifier& attr)
+static int BaseWebServiceRequestWithData(WebServiceHandle *websvc, int argc, NXSL_Value **argv,
+      NXSL_Value **result, NXSL_VM *vm, const HttpRequestMethod requestMethod)
 {
-   NXSL_Value *value = NXSL_DCTargetClass::getAttr(object, attr);
-   if (value != nullptr)
-      return value;
+   if (argc < 1)
+      return NXSL_ERR_INVALID_ARGUMENT_COUNT;
 
-   NXSL_VM *vm = object->vm();
-   auto node = SharedObjectFromData<Node>(object);
-   if (NXSL_COMPARE_ATTRIBUTE_NAME("agentCertificateMappingData"))
-   {
-      value = vm->createValue(node->getAgentCertificateMappingData());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("agentCertificateMappingMethod"))
-   {
-      value = vm->createValue(static_cast<int32_t>(node->getAgentCertificateMappingMethod()));
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("agentCertificateSubject"))
-   {
-      value = vm->createValue(node->getAgentCertificateSubject());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("agentId"))
-   {
-      TCHAR buffer[64];
-      value = vm->createValue(node->getAgentId().toString(buffer));
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("agentProxy"))
+   const TCHAR *contentType = _T("application/json");
+   if (argc > 1)
    {
-      shared_ptr<NetObj> object = FindObjectById(node->getAgentProxy());
-      if (object != nullptr)
+      if (!argv[1]->isString())
       {
-         value = object->createNXSLObject(vm);
+         return NXSL_ERR_NOT_STRING;
       }
       else
       {
-         value = vm->createValue();
+         contentType = argv[1]->getValueAsCString();
       }
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("agentVersion"))
-   {
-      value = vm->createValue(node->getAgentVersion());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("bootTime"))
-   {
-      value = vm->createValue(static_cast<INT64>(node->getBootTime()));
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("bridgeBaseAddress"))
-   {
-      TCHAR buffer[64];
-      value = vm->createValue(BinToStr(node->getBridgeId(), MAC_ADDR_LENGTH, buffer));
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("capabilities"))
-   {
-      value = vm->createValue(node->getCapabilities());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("cipDeviceType"))
-   {
-      value = vm->createValue(node->getCipDeviceType());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("cipDeviceTypeAsText"))
-   {
-      value = vm->createValue(CIP_DeviceTypeNameFromCode(node->getCipDeviceType()));
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("cipExtendedStatus"))
+
+   TCHAR *data = nullptr;
+   if (argv[0]->isObject(_T("JsonObject")) || argv[0]->isObject(_T("JsonArray")))
    {
-      value = vm->createValue((node->getCipStatus() & CIP_DEVICE_STATUS_EXTENDED_STATUS_MASK) >> 4);
+      json_t *json = static_cast<json_t*>(argv[0]->getValueAsObject()->getData());
+      char *tmp = json_dumps(json, JSON_INDENT(3));
+#ifdef UNICODE
+      data = WideStringFromUTF8String(tmp);
+      MemFree(tmp);
+#else
+      data = tmp;
+#endif
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("cipExtendedStatusAsText"))
+   else if (argv[0]->isString())
    {
-      value = vm->createValue(CIP_DecodeExtendedDeviceStatus(node->getCipStatus()));
+      data = MemCopyString(argv[0]->getValueAsCString());
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("cipStatus"))
+   else
    {
-      value = vm->createValue(node->getCipStatus());
+      return NXSL_ERR_NOT_STRING;
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("cipStatusAsText"))
+
+   StringList parameters;
+   for (int i = 2; i < argc; i++)
+      parameters.add(argv[i]->getValueAsCString());
+
+   WebServiceCallResult *response = websvc->first->makeCustomRequest(websvc->second, requestMethod, parameters, data, contentType);
+   *result = vm->createValue(vm->createObject(&g_nxslWebServiceResponseClass, response));
+   MemFree(data);
+
+   return 0;
+}
+
+/**
+ * Web service custom request with data
+ */
+static int BaseWebServiceRequestWithoutData(WebServiceHandle *websvc, int argc, NXSL_Value **argv,
+      NXSL_Value **result, NXSL_VM *vm, const HttpRequestMethod requestMethod)
+{
+   StringList parameters;
+   for (int i = 0 ; i < argc; i++)
+      parameters.add(argv[i]->getValueAsCString());
+
+   WebServiceCallResult *response = websvc->first->makeCustomRequest(websvc->second, requestMethod, parameters, nullptr, nullptr);
+   *result = vm->createValue(vm->createObject(&g_nxslWebServiceResponseClass, response));
+
+   return 0;
+}
+
+/**
+ * Node::callWebService(webSwcName, requestMethod, [postData], parameters...) method
+ */
+NXSL_METHOD_DEFINITION(Node, callWebService)
+{
+   if (argc < 2)
+      return NXSL_ERR_INVALID_ARGUMENT_COUNT;
+
+   if ((argc > 0) && !argv[0]->isString())
+      return NXSL_ERR_NOT_STRING;
+
+   if ((argc > 1) && !argv[1]->isString())
+      return NXSL_ERR_NOT_STRING;
+
+   shared_ptr<WebServiceDefinition> d = FindWebServiceDefinition(argv[0]->getValueAsCString());
+   shared_ptr<Node> *node = static_cast<shared_ptr<Node>*>(object->getData());
+
+   if (d == nullptr)
    {
-      value = vm->createValue(CIP_DecodeDeviceStatus(node->getCipStatus()));
+      WebServiceCallResult *webSwcResult = new WebServiceCallResult();
+      _tcsncpy(webSwcResult->errorMessage, _T("Web service definition not found"), WEBSVC_ERROR_TEXT_MAX_SIZE);
+      *result = vm->createValue(vm->createObject(&g_nxslWebServiceResponseClass, webSwcResult));
+      return 0;
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("cipState"))
+
+   WebServiceHandle websvc = WebServiceHandle(d, *node);
+   const TCHAR *requestMethod = argv[1]->getValueAsCString();
+   if (!_tcsicmp(_T("GET"), requestMethod))
    {
-      value = vm->createValue(node->getCipState());
+      return BaseWebServiceRequestWithoutData(&websvc, argc - 2, argv  + 2, result, vm, HttpRequestMethod::_GET);
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("cipStateAsText"))
+   else if (!_tcsicmp(_T("DELETE"), requestMethod))
    {
-      value = vm->createValue(CIP_DeviceStateTextFromCode(node->getCipState()));
+      return BaseWebServiceRequestWithoutData(&websvc, argc - 2, argv  + 2, result, vm, HttpRequestMethod::_DELETE);
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("cipVendorCode"))
+   else if (!_tcsicmp(_T("POST"), requestMethod))
    {
-      value = vm->createValue(node->getCipVendorCode());
+      return BaseWebServiceRequestWithData(&websvc, argc - 2, argv  + 2, result, vm, HttpRequestMethod::_POST);
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("components"))
+   else if (!_tcsicmp(_T("PUT"), requestMethod))
    {
-      shared_ptr<ComponentTree> components = node->getComponents();
-      if (components != nullptr)
-      {
-         value = ComponentTree::getRootForNXSL(vm, components);
-      }
-      else
-      {
-         value = vm->createValue();
-      }
+      return BaseWebServiceRequestWithData(&websvc, argc - 2, argv  + 2, result, vm, HttpRequestMethod::_PUT);
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("dependentNodes"))
+   else if (!_tcsicmp(_T("PATCH"), requestMethod))
    {
-      unique_ptr<StructArray<DependentNode>> dependencies = GetNodeDependencies(node->getId());
-      NXSL_Array *a = new NXSL_Array(vm);
-      for(int i = 0; i < dependencies->size(); i++)
-      {
-         a->append(vm->createValue(vm->createObject(&g_nxslNodeDependencyClass, new DependentNode(*dependencies->get(i)))));
-      }
-      value = vm->createValue(a);
+      return BaseWebServiceRequestWithData(&websvc, argc - 2, argv  + 2, result, vm, HttpRequestMethod::_PATCH);
+   }
+
+   WebServiceCallResult *webSwcResult = new WebServiceCallResult();
+   _tcslcpy(webSwcResult->errorMessage, _T("Invalid web service request method"), WEBSVC_ERROR_TEXT_MAX_SIZE);
+   *result = vm->createValue(vm->createObject(&g_nxslWebServiceResponseClass, webSwcResult));
+   return 0;
+}
+
+/**
+ * enable8021x(enabled) method
+ */
+NXSL_METHOD_DEFINITION(Node, enable8021xStatusPolling)
+{
+   return ChangeFlagMethod(object, argv[0], result, NF_DISABLE_8021X_STATUS_POLL, true);
+}
+
+/**
+ * enableAgent(enabled) method
+ */
+NXSL_METHOD_DEFINITION(Node, enableAgent)
+{
+   return ChangeFlagMethod(object, argv[0], result, NF_DISABLE_NXCP, true);
+}
+
+/**
+ * enableDiscoveryPolling(enabled) method
+ */
+NXSL_METHOD_DEFINITION(Node, enableDiscoveryPolling)
+{
+   return ChangeFlagMethod(object, argv[0], result, NF_DISABLE_DISCOVERY_POLL, true);
+}
+
+/**
+ * enableEtherNetIP(enabled) method
+ */
+NXSL_METHOD_DEFINITION(Node, enableEtherNetIP)
+{
+   return ChangeFlagMethod(object, argv[0], result, NF_DISABLE_ETHERNET_IP, true);
+}
+
+/**
+ * enableIcmp(enabled) method
+ */
+NXSL_METHOD_DEFINITION(Node, enableIcmp)
+{
+   return ChangeFlagMethod(object, argv[0], result, NF_DISABLE_ICMP, true);
+}
+
+/**
+ * enablePrimaryIPPing(enabled) method
+ */
+NXSL_METHOD_DEFINITION(Node, enablePrimaryIPPing)
+{
+   return ChangeFlagMethod(object, argv[0], result, NF_PING_PRIMARY_IP, false);
+}
+
+/**
+ * enableRoutingTablePolling(enabled) method
+ */
+NXSL_METHOD_DEFINITION(Node, enableRoutingTablePolling)
+{
+   return ChangeFlagMethod(object, argv[0], result, NF_DISABLE_ROUTE_POLL, true);
+}
+
+/**
+ * enableSnmp(enabled) method
+ */
+NXSL_METHOD_DEFINITION(Node, enableSnmp)
+{
+   return ChangeFlagMethod(object, argv[0], result, NF_DISABLE_SNMP, true);
+}
+
+/**
+ * enableSsh(enabled) method
+ */
+NXSL_METHOD_DEFINITION(Node, enableSsh) // TODO DIMA add to docks
+{
+   return ChangeFlagMethod(object, argv[0], result, NF_DISABLE_SSH, true);
+}
+
+/**
+ * enableTopologyPolling(enabled) method
+ */
+NXSL_METHOD_DEFINITION(Node, enableTopologyPolling)
+{
+   return ChangeFlagMethod(object, argv[0], result, NF_DISABLE_TOPOLOGY_POLL, true);
+}
+
+/**
+ * Node::executeAgentCommand(command, ...) method
+ */
+NXSL_METHOD_DEFINITION(Node, executeAgentCommand)
+{
+   if (argc < 1)
+      return NXSL_ERR_INVALID_ARGUMENT_COUNT;
+
+   for(int i = 0; i < argc; i++)
+      if (!argv[i]->isString())
+         return NXSL_ERR_NOT_STRING;
+
+   Node *node = static_cast<shared_ptr<Node>*>(object->getData())->get();
+   shared_ptr<AgentConnectionEx> conn = node->createAgentConnection();
+   if (conn != nullptr)
+   {
+      StringList list;
+      for(int i = 1; (i < argc) && (i < 128); i++)
+         list.add(argv[i]->getValueAsCString());
+      uint32_t rcc = conn->executeCommand(argv[0]->getValueAsCString(), list);
+      *result = vm->createValue(rcc == ERR_SUCCESS);
+      nxlog_debug(5, _T("NXSL: Node::executeAgentCommand: command \"%s\" on node %s [%u]: RCC=%u"), argv[0]->getValueAsCString(), node->getName(), node->getId(), rcc);
+   }
+   else
+   {
+      *result = vm->createValue(false);
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("driver"))
+   return 0;
+}
+
+/**
+ * Node::executeAgentCommandWithOutput(command, ...) method
+ */
+NXSL_METHOD_DEFINITION(Node, executeAgentCommandWithOutput)
+{
+   if (argc < 1)
+      return NXSL_ERR_INVALID_ARGUMENT_COUNT;
+
+   for(int i = 0; i < argc; i++)
+      if (!argv[i]->isString())
+         return NXSL_ERR_NOT_STRING;
+
+   Node *node = static_cast<shared_ptr<Node>*>(object->getData())->get();
+   shared_ptr<AgentConnectionEx> conn = node->createAgentConnection();
+   if (conn != nullptr)
    {
-      value = vm->createValue(node->getDriverName());
+      StringList list;
+      for(int i = 1; (i < argc) && (i < 128); i++)
+         list.add(argv[i]->getValueAsCString());
+      StringBuffer output;
+      uint32_t rcc = conn->executeCommand(argv[0]->getValueAsCString(), list, true, [](ActionCallbackEvent event, const TCHAR *text, void *context) {
+         if (event == ACE_DATA)
+            static_cast<StringBuffer*>(context)->append(text);
+      }, &output);
+      *result = (rcc == ERR_SUCCESS) ? vm->createValue(output) : vm->createValue();
+      nxlog_debug(5, _T("NXSL: Node::executeAgentCommandWithOutput: command \"%s\" on node %s [%u]: RCC=%u"), argv[0]->getValueAsCString(), node->getName(), node->getId(), rcc);
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("downSince"))
+   else
    {
-      value = vm->createValue(static_cast<INT64>(node->getDownSince()));
+      *result = vm->createValue();
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("effectiveAgentProxy"))
+   return 0;
+}
+
+/**
+ * Node::executeSSHCommand(command) method
+ */
+NXSL_METHOD_DEFINITION(Node, executeSSHCommand)
+{
+   if (!argv[0]->isString())
+      return NXSL_ERR_NOT_STRING;
+
+   Node *node = static_cast<shared_ptr<Node>*>(object->getData())->get();
+   uint32_t proxyId = node->getEffectiveSshProxy();
+   if (proxyId != 0)
    {
-      shared_ptr<NetObj> object = FindObjectById(node->getEffectiveAgentProxy());
-      if (object != nullptr)
+      shared_ptr<Node> proxyNode = static_pointer_cast<Node>(FindObjectById(proxyId, OBJECT_NODE));
+      if (proxyNode != nullptr)
       {
-         value = object->createNXSLObject(vm);
+         TCHAR ipAddr[64];
+         StringBuffer request(_T("SSH.Command("));
+         request.append(node->getIpAddress().toString(ipAddr));
+         request.append(_T(':'));
+         request.append(node->getSshPort());
+         request.append(_T(",\""));
+         request.append(EscapeStringForAgent(node->getSshLogin()).cstr());
+         request.append(_T("\",\""));
+         request.append(EscapeStringForAgent(node->getSshPassword()).cstr());
+         request.append(_T("\",\""));
+         request.append(EscapeStringForAgent(argv[0]->getValueAsCString()).cstr());
+         request.append(_T("\",,"));
+         request.append(node->getSshKeyId());
+         request.append(_T(')'));
+
+         StringList *list;
+         uint32_t rcc = proxyNode->getListFromAgent(request, &list);
+         *result = (rcc == DCE_SUCCESS) ? vm->createValue(new NXSL_Array(vm, list)) : vm->createValue();
+         delete list;
       }
       else
       {
-         value = vm->createValue();
+         *result = vm->createValue();
       }
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("effectiveIcmpProxy"))
+   else
    {
-      shared_ptr<NetObj> object = FindObjectById(node->getEffectiveIcmpProxy());
-      if (object != nullptr)
-      {
-         value = object->createNXSLObject(vm);
-      }
-      else
-      {
-         value = vm->createValue();
-      }
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("effectiveSnmpProxy"))
-   {
-      shared_ptr<NetObj> object = FindObjectById(node->getEffectiveSnmpProxy());
-      if (object != nullptr)
-      {
-         value = object->createNXSLObject(vm);
-      }
-      else
-      {
-         value = vm->createValue();
-      }
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("flags"))
-   {
-		value = vm->createValue(node->getFlags());
+      *result = vm->createValue();
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("hasAgentIfXCounters"))
+   return 0;
+}
+
+/**
+ * Node::getInterface(interfaceId) method
+ * Interface ID could be ifIndex, name, or MAC address
+ */
+NXSL_METHOD_DEFINITION(Node, getInterface)
+{
+   if (!argv[0]->isString())
+      return NXSL_ERR_NOT_STRING;
+
+   shared_ptr<Interface> iface;
+   if (argv[0]->isInteger())  // Assume interface index
    {
-      value = vm->createValue((node->getCapabilities() & NC_HAS_AGENT_IFXCOUNTERS) ? 1 : 0);
+      iface = static_cast<shared_ptr<Node>*>(object->getData())->get()->findInterfaceByIndex(argv[0]->getValueAsUInt32());
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("hasEntityMIB"))
+   else
    {
-      value = vm->createValue((node->getCapabilities() & NC_HAS_ENTITY_MIB) ? 1 : 0);
+      MacAddress macAddr = MacAddress::parse(argv[0]->getValueAsCString());
+      if (macAddr.isValid() && macAddr.length() >= 6)
+         iface = static_cast<shared_ptr<Node>*>(object->getData())->get()->findInterfaceByMAC(macAddr);
+      else
+         iface = static_cast<shared_ptr<Node>*>(object->getData())->get()->findInterfaceByName(argv[0]->getValueAsCString());
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("hasIfXTable"))
+   *result = (iface != nullptr) ? iface->createNXSLObject(vm) : vm->createValue();
+   return 0;
+}
+
+/**
+ * Node::getInterfaceByIndex(ifIndex) method
+ */
+NXSL_METHOD_DEFINITION(Node, getInterfaceByIndex)
+{
+   if (!argv[0]->isInteger())
+      return NXSL_ERR_NOT_INTEGER;
+
+   shared_ptr<Interface> iface = static_cast<shared_ptr<Node>*>(object->getData())->get()->findInterfaceByIndex(argv[0]->getValueAsUInt32());
+   *result = (iface != nullptr) ? iface->createNXSLObject(vm) : vm->createValue();
+   return 0;
+}
+
+/**
+ * Node::getInterfaceByMACAddress(macAddress) method
+ */
+NXSL_METHOD_DEFINITION(Node, getInterfaceByMACAddress)
+{
+   if (!argv[0]->isString())
+      return NXSL_ERR_NOT_STRING;
+
+   MacAddress macAddr = MacAddress::parse(argv[0]->getValueAsCString());
+   shared_ptr<Interface> iface = macAddr.isValid() ? static_cast<shared_ptr<Node>*>(object->getData())->get()->findInterfaceByMAC(macAddr) : shared_ptr<Interface>();
+   *result = (iface != nullptr) ? iface->createNXSLObject(vm) : vm->createValue();
+   return 0;
+}
+
+/**
+ * Node::getInterfaceByName(name) method
+ */
+NXSL_METHOD_DEFINITION(Node, getInterfaceByName)
+{
+   if (!argv[0]->isString())
+      return NXSL_ERR_NOT_STRING;
+
+   shared_ptr<Interface> iface = static_cast<shared_ptr<Node>*>(object->getData())->get()->findInterfaceByName(argv[0]->getValueAsCString());
+   *result = (iface != nullptr) ? iface->createNXSLObject(vm) : vm->createValue();
+   return 0;
+}
+
+/**
+ * Node::getInterfaceName(ifIndex) method
+ */
+NXSL_METHOD_DEFINITION(Node, getInterfaceName)
+{
+   if (!argv[0]->isInteger())
+      return NXSL_ERR_NOT_INTEGER;
+
+   shared_ptr<Interface> iface = static_cast<shared_ptr<Node>*>(object->getData())->get()->findInterfaceByIndex(argv[0]->getValueAsUInt32());
+   *result = (iface != nullptr) ? vm->createValue(iface->getName()) : vm->createValue();
+   return 0;
+}
+
+/**
+ * Node::getWebService(name) method
+ */
+NXSL_METHOD_DEFINITION(Node, getWebService)
+{
+   if (!argv[0]->isString())
+      return NXSL_ERR_NOT_INTEGER;
+
+   shared_ptr<Node> *node = static_cast<shared_ptr<Node>*>(object->getData());
+
+   shared_ptr<WebServiceDefinition> d = FindWebServiceDefinition(argv[0]->getValueAsCString());
+   if (d == nullptr)
    {
-      value = vm->createValue((node->getCapabilities() & NC_HAS_IFXTABLE) ? 1 : 0);
+      *result = vm->createValue();
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("hasUserAgent"))
+   else
    {
-      value = vm->createValue((LONG)((node->getCapabilities() & NC_HAS_USER_AGENT) ? 1 : 0));
+      *result = vm->createValue(vm->createObject(&g_nxslWebServiceClass, new WebServiceHandle(d, *node)));
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("hasVLANs"))
+   return 0;
+}
+
+/**
+ * Node::readAgentParameter(name) method
+ */
+NXSL_METHOD_DEFINITION(Node, readAgentParameter)
+{
+   if (!argv[0]->isString())
+      return NXSL_ERR_NOT_STRING;
+
+   TCHAR buffer[MAX_RESULT_LENGTH];
+   uint32_t rcc = static_cast<shared_ptr<Node>*>(object->getData())->get()->getMetricFromAgent(argv[0]->getValueAsCString(), buffer, MAX_RESULT_LENGTH);
+   *result = (rcc == DCE_SUCCESS) ? vm->createValue(buffer) : vm->createValue();
+   return 0;
+}
+
+/**
+ * Node::readAgentList(name) method
+ */
+NXSL_METHOD_DEFINITION(Node, readAgentList)
+{
+   if (!argv[0]->isString())
+      return NXSL_ERR_NOT_STRING;
+
+   StringList *list;
+   uint32_t rcc = static_cast<shared_ptr<Node>*>(object->getData())->get()->getListFromAgent(argv[0]->getValueAsCString(), &list);
+   *result = (rcc == DCE_SUCCESS) ? vm->createValue(new NXSL_Array(vm, list)) : vm->createValue();
+   delete list;
+   return 0;
+}
+
+/**
+ * Node::readAgentTable(name) method
+ */
+NXSL_METHOD_DEFINITION(Node, readAgentTable)
+{
+   if (!argv[0]->isString())
+      return NXSL_ERR_NOT_STRING;
+
+   shared_ptr<Table> table;
+   uint32_t rcc = static_cast<shared_ptr<Node>*>(object->getData())->get()->getTableFromAgent(argv[0]->getValueAsCString(), &table);
+   *result = (rcc == DCE_SUCCESS) ? vm->createValue(vm->createObject(&g_nxslTableClass, new shared_ptr<Table>(table))) : vm->createValue();
+   return 0;
+}
+
+/**
+ * Node::readDriverParameter(name) method
+ */
+NXSL_METHOD_DEFINITION(Node, readDriverParameter)
+{
+   if (!argv[0]->isString())
+      return NXSL_ERR_NOT_STRING;
+
+   TCHAR buffer[MAX_RESULT_LENGTH];
+   uint32_t rcc = static_cast<shared_ptr<Node>*>(object->getData())->get()->getMetricFromDeviceDriver(argv[0]->getValueAsCString(), buffer, MAX_RESULT_LENGTH);
+   *result = (rcc == DCE_SUCCESS) ? vm->createValue(buffer) : vm->createValue();
+   return 0;
+}
+
+/**
+ * Node::readInternalParameter(name) method
+ */
+NXSL_METHOD_DEFINITION(Node, readInternalParameter)
+{
+   if (!argv[0]->isString())
+      return NXSL_ERR_NOT_STRING;
+
+   TCHAR buffer[MAX_RESULT_LENGTH];
+   uint32_t rcc = static_cast<shared_ptr<Node>*>(object->getData())->get()->getInternalMetric(argv[0]->getValueAsCString(), buffer, MAX_RESULT_LENGTH);
+   *result = (rcc == DCE_SUCCESS) ? vm->createValue(buffer) : vm->createValue();
+   return 0;
+}
+
+/**
+ * Node::readInternalTable(name) method
+ */
+NXSL_METHOD_DEFINITION(Node, readInternalTable)
+{
+   if (!argv[0]->isString())
+      return NXSL_ERR_NOT_STRING;
+
+   shared_ptr<Table> table;
+   uint32_t rcc = static_cast<shared_ptr<Node>*>(object->getData())->get()->getInternalTable(argv[0]->getValueAsCString(), &table);
+   *result = (rcc == DCE_SUCCESS) ? vm->createValue(vm->createObject(&g_nxslTableClass, new shared_ptr<Table>(table))) : vm->createValue();
+   return 0;
+}
+
+/**
+ * Node::readWebServiceParameter(name) method
+ */
+NXSL_METHOD_DEFINITION(Node, readWebServiceParameter)
+{
+   if (!argv[0]->isString())
+      return NXSL_ERR_NOT_STRING;
+
+   TCHAR buffer[MAX_RESULT_LENGTH];
+   uint32_t rcc = static_cast<shared_ptr<Node>*>(object->getData())->get()->getMetricFromWebService(argv[0]->getValueAsCString(), buffer, MAX_RESULT_LENGTH);
+   *result = (rcc == DCE_SUCCESS) ? vm->createValue(buffer) : vm->createValue();
+   return 0;
+}
+
+/**
+ * Node::readWebServiceList(name) method
+ */
+NXSL_METHOD_DEFINITION(Node, readWebServiceList)
+{
+   if (!argv[0]->isString())
+      return NXSL_ERR_NOT_STRING;
+
+   StringList *list;
+   uint32_t rcc = static_cast<shared_ptr<Node>*>(object->getData())->get()->getListFromWebService(argv[0]->getValueAsCString(), &list);
+   *result = (rcc == DCE_SUCCESS) ? vm->createValue(new NXSL_Array(vm, list)) : vm->createValue();
+   delete list;
+   return 0;
+}
+
+/**
+ * Node::setIfXTableUsageMode(mode) method
+ */
+NXSL_METHOD_DEFINITION(Node, setIfXTableUsageMode)
+{
+   if (!argv[0]->isInteger())
+      return NXSL_ERR_NOT_INTEGER;
+
+   int mode = argv[0]->getValueAsInt32();
+   if ((mode != IFXTABLE_DISABLED) && (mode != IFXTABLE_ENABLED))
+      mode = IFXTABLE_DEFAULT;
+
+   static_cast<shared_ptr<Node>*>(object->getData())->get()->setIfXtableUsageMode(mode);
+   *result = vm->createValue();
+   return 0;
+}
+
+/**
+ * Get ICMP statistic for object
+ */
+static NXSL_Value *GetNodeIcmpStatistic(Node *node, IcmpStatFunction function, NXSL_VM *vm)
+{
+   NXSL_Value *value;
+   TCHAR buffer[MAX_RESULT_LENGTH];
+   if (node->getIcmpStatistic(nullptr, function, buffer) == DCE_SUCCESS)
    {
-      value = vm->createValue((node->getCapabilities() & NC_HAS_VLANS) ? 1 : 0);
+      value = vm->createValue(buffer);
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("hardwareId"))
+   else
    {
-      TCHAR buffer[HARDWARE_ID_LENGTH * 2 + 1];
-      value = vm->createValue(BinToStr(node->getHardwareId().value(), HARDWARE_ID_LENGTH, buffer));
+      value = vm->createValue();
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("hardwareComponents"))
-   {
-      value = node->getHardwareComponentsForNXSL(vm);
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("hasWinPDH"))
-   {
-      value = vm->createValue((node->getCapabilities() & NC_HAS_WINPDH) ? 1 : 0);
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("hypervisorInfo"))
-   {
-      value = vm->createValue(node->getHypervisorInfo());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("hypervisorType"))
-   {
-      value = vm->createValue(node->getHypervisorType());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("icmpAverageRTT"))
-   {
-      value = GetNodeIcmpStatistic(node, IcmpStatFunction::AVERAGE, vm);
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("icmpLastRTT"))
-   {
-      value = GetNodeIcmpStatistic(node, IcmpStatFunction::LAST, vm);
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("icmpMaxRTT"))
-   {
-      value = GetNodeIcmpStatistic(node, IcmpStatFunction::MAX, vm);
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("icmpMinRTT"))
-   {
-      value = GetNodeIcmpStatistic(node, IcmpStatFunction::MIN, vm);
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("icmpPacketLoss"))
-   {
-      value = GetNodeIcmpStatistic(node, IcmpStatFunction::LOSS, vm);
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("icmpProxy"))
-   {
-      shared_ptr<NetObj> object = FindObjectById(node->getIcmpProxy());
-      if (object != nullptr)
-      {
-         value = object->createNXSLObject(vm);
-      }
-      else
-      {
-         value = vm->createValue();
-      }
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("interfaces"))
-   {
-      value = node->getInterfacesForNXSL(vm);
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("isAgent"))
-   {
-      value = vm->createValue(node->isNativeAgent());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("isBridge"))
-   {
-      value = vm->createValue(node->isBridge());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("isCDP"))
-   {
-      value = vm->createValue((node->getCapabilities() & NC_IS_CDP) != 0);
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("isEtherNetIP"))
-   {
-      value = vm->createValue(node->isEthernetIPSupported());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("isInMaintenanceMode"))
-   {
-      value = vm->createValue(node->isInMaintenanceMode());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("isLLDP"))
-   {
-      value = vm->createValue((node->getCapabilities() & NC_IS_LLDP) != 0);
-   }
-	else if (NXSL_COMPARE_ATTRIBUTE_NAME("isLocalMgmt") || NXSL_COMPARE_ATTRIBUTE_NAME("isLocalManagement"))
-	{
-		value = vm->createValue(node->isLocalManagement());
-	}
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("isModbusTCP"))
-   {
-      value = vm->createValue(node->isModbusTCPSupported());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("isOSPF"))
-   {
-      value = vm->createValue(node->isOSPFSupported());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("isPAE") || NXSL_COMPARE_ATTRIBUTE_NAME("is802_1x"))
-   {
-      value = vm->createValue((node->getCapabilities() & NC_IS_8021X) != 0);
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("isPrinter"))
-   {
-      value = vm->createValue((node->getCapabilities() & NC_IS_PRINTER) != 0);
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("isProfiNet"))
-   {
-      value = vm->createValue(node->isProfiNetSupported());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("isRemotelyManaged") || NXSL_COMPARE_ATTRIBUTE_NAME("isExternalGateway"))
-   {
-      value = vm->createValue((node->getFlags() & NF_EXTERNAL_GATEWAY) != 0);
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("isRouter"))
-   {
-      value = vm->createValue(node->isRouter());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("isSMCLP"))
+   return value;
+}
+
+/**
+ * Node::agentCertificateMappingData attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, agentCertificateMappingData)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->getAgentCertificateMappingData());
+}
+
+/**
+ * Node::agentCertificateMappingMethod attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, agentCertificateMappingMethod)
+{
+   return vm->createValue(static_cast<int32_t>(SharedObjectFromData<Node>(object)->getAgentCertificateMappingMethod()));
+}
+
+/**
+ * Node::agentCertificateSubject attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, agentCertificateSubject)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->getAgentCertificateSubject());
+}
+
+/**
+ * Node::agentId attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, agentId)
+{
+   Node *node = SharedObjectFromData<Node>(object);
+   TCHAR buffer[64];
+   return vm->createValue(node->getAgentId().toString(buffer));
+}
+
+/**
+ * Node::agentProxy attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, agentProxy)
+{
+   Node *node = SharedObjectFromData<Node>(object);
+   NXSL_Value *value;
+   shared_ptr<NetObj> proxy = FindObjectById(node->getAgentProxy());
+   if (proxy != nullptr)
    {
-      value = vm->createValue((node->getCapabilities() & NC_IS_SMCLP) != 0);
+      value = proxy->createNXSLObject(vm);
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("isSNMP"))
+   else
    {
-      value = vm->createValue(node->isSNMPSupported());
+      value = vm->createValue();
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("isSSH"))
+   return value;
+}
+
+/**
+ * Node::agentVersion attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, agentVersion)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->getAgentVersion());
+}
+
+/**
+ * Node::bootTime attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, bootTime)
+{
+   return vm->createValue(static_cast<INT64>(SharedObjectFromData<Node>(object)->getBootTime()));
+}
+
+/**
+ * Node::bridgeBaseAddress attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, bridgeBaseAddress)
+{
+   Node *node = SharedObjectFromData<Node>(object);
+   TCHAR buffer[64];
+   return vm->createValue(BinToStr(node->getBridgeId(), MAC_ADDR_LENGTH, buffer));
+}
+
+/**
+ * Node::capabilities attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, capabilities)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->getCapabilities());
+}
+
+/**
+ * Node::cipDeviceType attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, cipDeviceType)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->getCipDeviceType());
+}
+
+/**
+ * Node::cipDeviceTypeAsText attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, cipDeviceTypeAsText)
+{
+   return vm->createValue(CIP_DeviceTypeNameFromCode(SharedObjectFromData<Node>(object)->getCipDeviceType()));
+}
+
+/**
+ * Node::cipExtendedStatus attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, cipExtendedStatus)
+{
+   return vm->createValue((SharedObjectFromData<Node>(object)->getCipStatus() & CIP_DEVICE_STATUS_EXTENDED_STATUS_MASK) >> 4);
+}
+
+/**
+ * Node::cipExtendedStatusAsText attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, cipExtendedStatusAsText)
+{
+   return vm->createValue(CIP_DecodeExtendedDeviceStatus(SharedObjectFromData<Node>(object)->getCipStatus()));
+}
+
+/**
+ * Node::cipStatus attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, cipStatus)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->getCipStatus());
+}
+
+/**
+ * Node::cipStatusAsText attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, cipStatusAsText)
+{
+   return vm->createValue(CIP_DecodeDeviceStatus(SharedObjectFromData<Node>(object)->getCipStatus()));
+}
+
+/**
+ * Node::cipState attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, cipState)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->getCipState());
+}
+
+/**
+ * Node::cipStateAsText attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, cipStateAsText)
+{
+   return vm->createValue(CIP_DeviceStateTextFromCode(SharedObjectFromData<Node>(object)->getCipState()));
+}
+
+/**
+ * Node::cipVendorCode attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, cipVendorCode)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->getCipVendorCode());
+}
+
+/**
+ * Node::components attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, components)
+{
+   Node *node = SharedObjectFromData<Node>(object);
+   NXSL_Value *value;
+   shared_ptr<ComponentTree> components = node->getComponents();
+   if (components != nullptr)
    {
-      value = vm->createValue(node->isSSHSupported());
+      value = ComponentTree::getRootForNXSL(vm, components);
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("isSONMP") || NXSL_COMPARE_ATTRIBUTE_NAME("isNDP"))
+   else
    {
-      value = vm->createValue((node->getCapabilities() & NC_IS_NDP) != 0);
+      value = vm->createValue();
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("isSTP"))
+   return value;
+}
+
+/**
+ * Node::dependentNodes attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, dependentNodes)
+{
+   Node *node = SharedObjectFromData<Node>(object);
+   unique_ptr<StructArray<DependentNode>> dependencies = GetNodeDependencies(node->getId());
+   NXSL_Array *a = new NXSL_Array(vm);
+   for(int i = 0; i < dependencies->size(); i++)
    {
-      value = vm->createValue((node->getCapabilities() & NC_IS_STP) != 0);
+      a->append(vm->createValue(vm->createObject(&g_nxslNodeDependencyClass, new DependentNode(*dependencies->get(i)))));
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("isVirtual"))
+   return vm->createValue(a);
+}
+
+/**
+ * Node::driver attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, driver)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->getDriverName());
+}
+
+/**
+ * Node::downSince attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, downSince)
+{
+   return vm->createValue(static_cast<INT64>(SharedObjectFromData<Node>(object)->getDownSince()));
+}
+
+/**
+ * Node::effectiveAgentProxy attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, effectiveAgentProxy)
+{
+   Node *node = SharedObjectFromData<Node>(object);
+   NXSL_Value *value;
+   shared_ptr<NetObj> proxy = FindObjectById(node->getEffectiveAgentProxy());
+   if (proxy != nullptr)
    {
-      value = vm->createValue(node->isVirtual());
+      value = proxy->createNXSLObject(vm);
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("isVRRP"))
+   else
    {
-      value = vm->createValue((node->getCapabilities() & NC_IS_VRRP) != 0);
+      value = vm->createValue();
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("lastAgentCommTime"))
+   return value;
+}
+
+/**
+ * Node::effectiveIcmpProxy attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, effectiveIcmpProxy)
+{
+   Node *node = SharedObjectFromData<Node>(object);
+   NXSL_Value *value;
+   shared_ptr<NetObj> proxy = FindObjectById(node->getEffectiveIcmpProxy());
+   if (proxy != nullptr)
    {
-      value = vm->createValue(static_cast<int64_t>(node->getLastAgentCommTime()));
+      value = proxy->createNXSLObject(vm);
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("nodeSubType"))
+   else
    {
-      value = vm->createValue(node->getSubType());
+      value = vm->createValue();
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("nodeType"))
+   return value;
+}
+
+/**
+ * Node::effectiveSnmpProxy attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, effectiveSnmpProxy)
+{
+   Node *node = SharedObjectFromData<Node>(object);
+   NXSL_Value *value;
+   shared_ptr<NetObj> proxy = FindObjectById(node->getEffectiveSnmpProxy());
+   if (proxy != nullptr)
    {
-      value = vm->createValue(static_cast<int32_t>(node->getType()));
+      value = proxy->createNXSLObject(vm);
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("ospfAreas"))
+   else
    {
-      value = node->isOSPFSupported() ? node->getOSPFAreasForNXSL(vm) : vm->createValue();
+      value = vm->createValue();
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("ospfNeighbors"))
+   return value;
+}
+
+/**
+ * Node::flags attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, flags)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->getFlags());
+}
+
+/**
+ * Node::hasAgentIfXCounters attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, hasAgentIfXCounters)
+{
+   return vm->createValue((SharedObjectFromData<Node>(object)->getCapabilities() & NC_HAS_AGENT_IFXCOUNTERS) ? 1 : 0);
+}
+
+/**
+ * Node::hasEntityMIB attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, hasEntityMIB)
+{
+   return vm->createValue((SharedObjectFromData<Node>(object)->getCapabilities() & NC_HAS_ENTITY_MIB) ? 1 : 0);
+}
+
+/**
+ * Node::hasIfXTable attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, hasIfXTable)
+{
+   return vm->createValue((SharedObjectFromData<Node>(object)->getCapabilities() & NC_HAS_IFXTABLE) ? 1 : 0);
+}
+
+/**
+ * Node::hasUserAgent attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, hasUserAgent)
+{
+   return vm->createValue((LONG)((SharedObjectFromData<Node>(object)->getCapabilities() & NC_HAS_USER_AGENT) ? 1 : 0));
+}
+
+/**
+ * Node::hasVLANs attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, hasVLANs)
+{
+   return vm->createValue((SharedObjectFromData<Node>(object)->getCapabilities() & NC_HAS_VLANS) ? 1 : 0);
+}
+
+/**
+ * Node::hardwareId attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, hardwareId)
+{
+   Node *node = SharedObjectFromData<Node>(object);
+   TCHAR buffer[HARDWARE_ID_LENGTH * 2 + 1];
+   return vm->createValue(BinToStr(node->getHardwareId().value(), HARDWARE_ID_LENGTH, buffer));
+}
+
+/**
+ * Node::hardwareComponents attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, hardwareComponents)
+{
+   return SharedObjectFromData<Node>(object)->getHardwareComponentsForNXSL(vm);
+}
+
+/**
+ * Node::hasWinPDH attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, hasWinPDH)
+{
+   return vm->createValue((SharedObjectFromData<Node>(object)->getCapabilities() & NC_HAS_WINPDH) ? 1 : 0);
+}
+
+/**
+ * Node::hypervisorInfo attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, hypervisorInfo)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->getHypervisorInfo());
+}
+
+/**
+ * Node::hypervisorType attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, hypervisorType)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->getHypervisorType());
+}
+
+/**
+ * Node::icmpAverageRTT attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, icmpAverageRTT)
+{
+   return GetNodeIcmpStatistic(SharedObjectFromData<Node>(object), IcmpStatFunction::AVERAGE, vm);
+}
+
+/**
+ * Node::icmpLastRTT attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, icmpLastRTT)
+{
+   return GetNodeIcmpStatistic(SharedObjectFromData<Node>(object), IcmpStatFunction::LAST, vm);
+}
+
+/**
+ * Node::icmpMaxRTT attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, icmpMaxRTT)
+{
+   return GetNodeIcmpStatistic(SharedObjectFromData<Node>(object), IcmpStatFunction::MAX, vm);
+}
+
+/**
+ * Node::icmpMinRTT attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, icmpMinRTT)
+{
+   return GetNodeIcmpStatistic(SharedObjectFromData<Node>(object), IcmpStatFunction::MIN, vm);
+}
+
+/**
+ * Node::icmpPacketLoss attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, icmpPacketLoss)
+{
+   return GetNodeIcmpStatistic(SharedObjectFromData<Node>(object), IcmpStatFunction::LOSS, vm);
+}
+
+/**
+ * Node::icmpProxy attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, icmpProxy)
+{
+   Node *node = SharedObjectFromData<Node>(object);
+   NXSL_Value *value;
+   shared_ptr<NetObj> proxy = FindObjectById(node->getIcmpProxy());
+   if (proxy != nullptr)
    {
-      value = node->isOSPFSupported() ? node->getOSPFNeighborsForNXSL(vm) : vm->createValue();
+      value = proxy->createNXSLObject(vm);
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("ospfRouterId"))
+   else
    {
-      TCHAR buffer[16];
-      value = node->isOSPFSupported() ? vm->createValue(IpToStr(node->getOSPFRouterId(), buffer)) : vm->createValue();
+      value = vm->createValue();
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("physicalContainer"))
+   return value;
+}
+
+/**
+ * Node::interfaces attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, interfaces)
+{
+   return SharedObjectFromData<Node>(object)->getInterfacesForNXSL(vm);
+}
+
+/**
+ * Node::isAgent attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, isAgent)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->isNativeAgent());
+}
+
+/**
+ * Node::isBridge attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, isBridge)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->isBridge());
+}
+
+/**
+ * Node::isCDP attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, isCDP)
+{
+   return vm->createValue((SharedObjectFromData<Node>(object)->getCapabilities() & NC_IS_CDP) != 0);
+}
+
+/**
+ * Node::isEtherNetIP attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, isEtherNetIP)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->isEthernetIPSupported());
+}
+
+/**
+ * Node::isLLDP attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, isLLDP)
+{
+   return vm->createValue((SharedObjectFromData<Node>(object)->getCapabilities() & NC_IS_LLDP) != 0);
+}
+
+/**
+ * Node::isLocalMgmt attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, isLocalMgmt)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->isLocalManagement());
+}
+
+/**
+ * Node::isModbusTCP attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, isModbusTCP)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->isModbusTCPSupported());
+}
+
+/**
+ * Node::isOSPF attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, isOSPF)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->isOSPFSupported());
+}
+
+/**
+ * Node::isPAE attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, isPAE)
+{
+   return vm->createValue((SharedObjectFromData<Node>(object)->getCapabilities() & NC_IS_8021X) != 0);
+}
+
+/**
+ * Node::isPrinter attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, isPrinter)
+{
+   return vm->createValue((SharedObjectFromData<Node>(object)->getCapabilities() & NC_IS_PRINTER) != 0);
+}
+
+/**
+ * Node::isProfiNet attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, isProfiNet)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->isProfiNetSupported());
+}
+
+/**
+ * Node::isRemotelyManaged attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, isRemotelyManaged)
+{
+   return vm->createValue((SharedObjectFromData<Node>(object)->getFlags() & NF_EXTERNAL_GATEWAY) != 0);
+}
+
+/**
+ * Node::isRouter attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, isRouter)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->isRouter());
+}
+
+/**
+ * Node::isSMCLP attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, isSMCLP)
+{
+   return vm->createValue((SharedObjectFromData<Node>(object)->getCapabilities() & NC_IS_SMCLP) != 0);
+}
+
+/**
+ * Node::isSNMP attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, isSNMP)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->isSNMPSupported());
+}
+
+/**
+ * Node::isSSH attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, isSSH)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->isSSHSupported());
+}
+
+/**
+ * Node::isSONMP attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, isSONMP)
+{
+   return vm->createValue((SharedObjectFromData<Node>(object)->getCapabilities() & NC_IS_NDP) != 0);
+}
+
+/**
+ * Node::isSTP attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, isSTP)
+{
+   return vm->createValue((SharedObjectFromData<Node>(object)->getCapabilities() & NC_IS_STP) != 0);
+}
+
+/**
+ * Node::isVirtual attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, isVirtual)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->isVirtual());
+}
+
+/**
+ * Node::isVRRP attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, isVRRP)
+{
+   return vm->createValue((SharedObjectFromData<Node>(object)->getCapabilities() & NC_IS_VRRP) != 0);
+}
+
+/**
+ * Node::lastAgentCommTime attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, lastAgentCommTime)
+{
+   return vm->createValue(static_cast<int64_t>(SharedObjectFromData<Node>(object)->getLastAgentCommTime()));
+}
+
+/**
+ * Node::nodeSubType attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, nodeSubType)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->getSubType());
+}
+
+/**
+ * Node::nodeType attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, nodeType)
+{
+   return vm->createValue(static_cast<int32_t>(SharedObjectFromData<Node>(object)->getType()));
+}
+
+/**
+ * Node::ospfAreas attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, ospfAreas)
+{
+   Node *node = SharedObjectFromData<Node>(object);
+   return node->isOSPFSupported() ? node->getOSPFAreasForNXSL(vm) : vm->createValue();
+}
+
+/**
+ * Node::ospfNeighbors attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, ospfNeighbors)
+{
+   Node *node = SharedObjectFromData<Node>(object);
+   return node->isOSPFSupported() ? node->getOSPFNeighborsForNXSL(vm) : vm->createValue();
+}
+
+/**
+ * Node::ospfRouterId attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, ospfRouterId)
+{
+   Node *node = SharedObjectFromData<Node>(object);
+   TCHAR buffer[16];
+   return node->isOSPFSupported() ? vm->createValue(IpToStr(node->getOSPFRouterId(), buffer)) : vm->createValue();
+}
+
+/**
+ * Node::physicalContainer attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, physicalContainer)
+{
+   Node *node = SharedObjectFromData<Node>(object);
+   NXSL_Value *value;
+   shared_ptr<NetObj> container = FindObjectById(node->getPhysicalContainerId());
+   if (container != nullptr)
    {
-      shared_ptr<NetObj> object = FindObjectById(node->getPhysicalContainerId());
-      if (object != nullptr)
-      {
-         value = object->createNXSLObject(vm);
-      }
-      else
-      {
-         value = vm->createValue();
-      }
+      value = container->createNXSLObject(vm);
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("physicalContainerId"))
+   else
    {
-      value = vm->createValue(node->getPhysicalContainerId());
+      value = vm->createValue();
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("platformName"))
+   return value;
+}
+
+/**
+ * Node::physicalContainerId attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, physicalContainerId)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->getPhysicalContainerId());
+}
+
+/**
+ * Node::platformName attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, platformName)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->getPlatformName());
+}
+
+/**
+ * Node::primaryHostName attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, primaryHostName)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->getPrimaryHostName());
+}
+
+/**
+ * Node::productCode attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, productCode)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->getProductCode());
+}
+
+/**
+ * Node::productName attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, productName)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->getProductName());
+}
+
+/**
+ * Node::productVersion attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, productVersion)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->getProductVersion());
+}
+
+/**
+ * Node::rack attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, rack)
+{
+   Node *node = SharedObjectFromData<Node>(object);
+   NXSL_Value *value;
+   shared_ptr<NetObj> rack = FindObjectById(node->getPhysicalContainerId(), OBJECT_RACK);
+   if (rack != nullptr)
    {
-      value = vm->createValue(node->getPlatformName());
+      value = rack->createNXSLObject(vm);
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("primaryHostName"))
+   else
    {
-      value = vm->createValue(node->getPrimaryHostName());
+      value = vm->createValue();
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("productCode"))
+   return value;
+}
+
+/**
+ * Node::rackId attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, rackId)
+{
+   Node *node = SharedObjectFromData<Node>(object);
+   NXSL_Value *value;
+   if (FindObjectById(node->getPhysicalContainerId(), OBJECT_RACK) != nullptr)
    {
-      value = vm->createValue(node->getProductCode());
+      value = vm->createValue(node->getPhysicalContainerId());
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("productName"))
+   else
    {
-      value = vm->createValue(node->getProductName());
+      value = vm->createValue(0);
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("productVersion"))
+   return value;
+}
+
+/**
+ * Node::rackHeight attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, rackHeight)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->getRackHeight());
+}
+
+/**
+ * Node::rackPosition attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, rackPosition)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->getRackPosition());
+}
+
+/**
+ * Node::runtimeFlags attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, runtimeFlags)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->getRuntimeFlags());
+}
+
+/**
+ * Node::serialNumber attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, serialNumber)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->getSerialNumber());
+}
+
+/**
+ * Node::snmpOID attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, snmpOID)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->getSNMPObjectId());
+}
+
+/**
+ * Node::snmpProxy attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, snmpProxy)
+{
+   Node *node = SharedObjectFromData<Node>(object);
+   NXSL_Value *value;
+   shared_ptr<NetObj> proxy = FindObjectById(node->getSNMPProxy());
+   if (proxy != nullptr)
    {
-      value = vm->createValue(node->getProductVersion());
+      value = proxy->createNXSLObject(vm);
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("rack"))
+   else
    {
-      shared_ptr<NetObj> rack = FindObjectById(node->getPhysicalContainerId(), OBJECT_RACK);
-      if (rack != nullptr)
-      {
-         value = rack->createNXSLObject(vm);
-      }
-      else
-      {
-         value = vm->createValue();
-      }
+      value = vm->createValue();
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("rackId"))
+   return value;
+}
+
+/**
+ * Node::snmpSysContact attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, snmpSysContact)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->getSysContact());
+}
+
+/**
+ * Node::snmpSysLocation attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, snmpSysLocation)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->getSysLocation());
+}
+
+/**
+ * Node::snmpSysName attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, snmpSysName)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->getSysName());
+}
+
+/**
+ * Node::snmpVersion attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, snmpVersion)
+{
+   return vm->createValue((LONG)SharedObjectFromData<Node>(object)->getSNMPVersion());
+}
+
+/**
+ * Node::softwarePackages attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, softwarePackages)
+{
+   return SharedObjectFromData<Node>(object)->getSoftwarePackagesForNXSL(vm);
+}
+
+/**
+ * Node::sysDescription attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, sysDescription)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->getSysDescription());
+}
+
+/**
+ * Node::tunnel attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, tunnel)
+{
+   Node *node = SharedObjectFromData<Node>(object);
+   NXSL_Value *value;
+   shared_ptr<AgentTunnel> tunnel = GetTunnelForNode(node->getId());
+   if (tunnel != nullptr)
+      value = vm->createValue(vm->createObject(&g_nxslTunnelClass, new shared_ptr<AgentTunnel>(tunnel)));
+   else
+      value = vm->createValue();
+   return value;
+}
+
+/**
+ * Node::vendor attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, vendor)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->getVendor());
+}
+
+/**
+ * Node::vlans attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, vlans)
+{
+   Node *node = SharedObjectFromData<Node>(object);
+   NXSL_Value *value;
+   shared_ptr<VlanList> vlans = node->getVlans();
+   if (vlans != nullptr)
    {
-      if (FindObjectById(node->getPhysicalContainerId(), OBJECT_RACK) != nullptr)
-      {
-         value = vm->createValue(node->getPhysicalContainerId());
-      }
-      else
+      NXSL_Array *a = new NXSL_Array(vm);
+      for(int i = 0; i < vlans->size(); i++)
       {
-         value = vm->createValue(0);
+         a->append(vm->createValue(vm->createObject(&g_nxslVlanClass, new VlanInfo(vlans->get(i), node->getId()))));
       }
+      value = vm->createValue(a);
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("rackHeight"))
-   {
-      value = vm->createValue(node->getRackHeight());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("rackPosition"))
-   {
-      value = vm->createValue(node->getRackPosition());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("runtimeFlags"))
-   {
-      value = vm->createValue(node->getRuntimeFlags());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("serialNumber"))
-   {
-      value = vm->createValue(node->getSerialNumber());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("snmpOID"))
+   else
    {
-      value = vm->createValue(node->getSNMPObjectId());
+      value = vm->createValue();
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("snmpProxy"))
+   return value;
+}
+
+/**
+ * Node::zone attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, zone)
+{
+   Node *node = SharedObjectFromData<Node>(object);
+   NXSL_Value *value;
+   if (IsZoningEnabled())
    {
-      shared_ptr<NetObj> object = FindObjectById(node->getSNMPProxy());
-      if (object != nullptr)
+      shared_ptr<Zone> zone = FindZoneByUIN(node->getZoneUIN());
+      if (zone != nullptr)
       {
-         value = object->createNXSLObject(vm);
+         value = zone->createNXSLObject(vm);
       }
       else
       {
          value = vm->createValue();
       }
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("snmpSysContact"))
-   {
-      value = vm->createValue(node->getSysContact());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("snmpSysLocation"))
-   {
-      value = vm->createValue(node->getSysLocation());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("snmpSysName"))
-   {
-      value = vm->createValue(node->getSysName());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("snmpVersion"))
-   {
-      value = vm->createValue((LONG)node->getSNMPVersion());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("softwarePackages"))
-   {
-      value = node->getSoftwarePackagesForNXSL(vm);
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("sysDescription"))
-   {
-      value = vm->createValue(node->getSysDescription());
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("tunnel"))
-   {
-      shared_ptr<AgentTunnel> tunnel = GetTunnelForNode(node->getId());
-      if (tunnel != nullptr)
-         value = vm->createValue(vm->createObject(&g_nxslTunnelClass, new shared_ptr<AgentTunnel>(tunnel)));
-      else
-         value = vm->createValue();
-   }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("vendor"))
+   else
    {
-      value = vm->createValue(node->getVendor());
+      value = vm->createValue();
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("vlans"))
+   return value;
+}
+
+/**
+ * Node::zoneProxyAssignments attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, zoneProxyAssignments)
+{
+   Node *node = SharedObjectFromData<Node>(object);
+   NXSL_Value *value;
+   if (IsZoningEnabled())
    {
-      shared_ptr<VlanList> vlans = node->getVlans();
-      if (vlans != nullptr)
+      shared_ptr<Zone> zone = FindZoneByProxyId(node->getId());
+      if (zone != nullptr)
       {
-         NXSL_Array *a = new NXSL_Array(vm);
-         for(int i = 0; i < vlans->size(); i++)
-         {
-            a->append(vm->createValue(vm->createObject(&g_nxslVlanClass, new VlanInfo(vlans->get(i), node->getId()))));
-         }
-         value = vm->createValue(a);
+         value = vm->createValue(zone->getProxyNodeAssignments(node->getId()));
       }
       else
       {
-         value = vm->createValue();
+         value = vm->createValue(0);
       }
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("zone"))
-	{
-      if (IsZoningEnabled())
-      {
-         shared_ptr<Zone> zone = FindZoneByUIN(node->getZoneUIN());
-		   if (zone != nullptr)
-		   {
-			   value = zone->createNXSLObject(vm);
-		   }
-		   else
-		   {
-			   value = vm->createValue();
-		   }
-	   }
-	   else
-	   {
-		   value = vm->createValue();
-	   }
-	}
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("zoneProxyAssignments"))
+   else
    {
-      if (IsZoningEnabled())
-      {
-         shared_ptr<Zone> zone = FindZoneByProxyId(node->getId());
-         if (zone != nullptr)
-         {
-            value = vm->createValue(zone->getProxyNodeAssignments(node->getId()));
-         }
-         else
-         {
-            value = vm->createValue(0);
-         }
-      }
-      else
-      {
-         value = vm->createValue(0);
-      }
+      value = vm->createValue(0);
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("zoneProxyStatus"))
+   return value;
+}
+
+/**
+ * Node::zoneProxyStatus attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, zoneProxyStatus)
+{
+   Node *node = SharedObjectFromData<Node>(object);
+   NXSL_Value *value;
+   if (IsZoningEnabled())
    {
-      if (IsZoningEnabled())
+      shared_ptr<Zone> zone = FindZoneByProxyId(node->getId());
+      if (zone != nullptr)
       {
-         shared_ptr<Zone> zone = FindZoneByProxyId(node->getId());
-         if (zone != nullptr)
-         {
-            value = vm->createValue(zone->isProxyNodeAvailable(node->getId()));
-         }
-         else
-         {
-            value = vm->createValue(0);
-         }
+         value = vm->createValue(zone->isProxyNodeAvailable(node->getId()));
       }
       else
       {
          value = vm->createValue(0);
       }
    }
-   else if (NXSL_COMPARE_ATTRIBUTE_NAME("zoneUIN"))
-	{
-      value = vm->createValue(node->getZoneUIN());
+   else
+   {
+      value = vm->createValue(0);
    }
    return value;
 }
 
+/**
+ * Node::zoneUIN attribute
+ */
+NXSL_ATTRIBUTE_DEFINITION(Node, zoneUIN)
+{
+   return vm->createValue(SharedObjectFromData<Node>(object)->getZoneUIN());
+}
+
+/**
+ * NXSL class Node: constructor
+ */
+NXSL_NodeClass::NXSL_NodeClass() : NXSL_DCTargetClass()
+{
+   setName(_T("Node"));
+
+   NXSL_REGISTER_METHOD(Node, callWebService, -1);
+   NXSL_REGISTER_METHOD(Node, createSNMPTransport, -1);
+   NXSL_REGISTER_METHOD(Node, enable8021xStatusPolling, 1);
+   NXSL_REGISTER_METHOD(Node, enableAgent, 1);
+   NXSL_REGISTER_METHOD(Node, enableDiscoveryPolling, 1);
+   NXSL_REGISTER_METHOD(Node, enableEtherNetIP, 1);
+   NXSL_REGISTER_METHOD(Node, enableIcmp, 1);
+   NXSL_REGISTER_METHOD(Node, enablePrimaryIPPing, 1);
+   NXSL_REGISTER_METHOD(Node, enableRoutingTablePolling, 1);
+   NXSL_REGISTER_METHOD(Node, enableSnmp, 1);
+   NXSL_REGISTER_METHOD(Node, enableSsh, 1);
+   NXSL_REGISTER_METHOD(Node, enableTopologyPolling, 1);
+   NXSL_REGISTER_METHOD(Node, executeAgentCommand, -1);
+   NXSL_REGISTER_METHOD(Node, executeAgentCommandWithOutput, -1);
+   NXSL_REGISTER_METHOD(Node, executeSSHCommand, 1);
+   NXSL_REGISTER_METHOD(Node, getInterface, 1);
+   NXSL_REGISTER_METHOD(Node, getInterfaceByIndex, 1);
+   NXSL_REGISTER_METHOD(Node, getInterfaceByMACAddress, 1);
+   NXSL_REGISTER_METHOD(Node, getInterfaceByName, 1);
+   NXSL_REGISTER_METHOD(Node, getInterfaceName, 1);
+   NXSL_REGISTER_METHOD(Node, getWebService, 1);
+   NXSL_REGISTER_METHOD(Node, readAgentList, 1);
+   NXSL_REGISTER_METHOD(Node, readAgentParameter, 1);
+   NXSL_REGISTER_METHOD(Node, readAgentTable, 1);
+   NXSL_REGISTER_METHOD(Node, readDriverParameter, 1);
+   NXSL_REGISTER_METHOD(Node, readInternalParameter, 1);
+   NXSL_REGISTER_METHOD(Node, readInternalTable, 1);
+   NXSL_REGISTER_METHOD(Node, readWebServiceList, 1);
+   NXSL_REGISTER_METHOD(Node, readWebServiceParameter, 1);
+   NXSL_REGISTER_METHOD(Node, setIfXTableUsageMode, 1);
+
+   NXSL_REGISTER_ATTRIBUTE(Node, agentCertificateMappingData);
+   NXSL_REGISTER_ATTRIBUTE(Node, agentCertificateMappingMethod);
+   NXSL_REGISTER_ATTRIBUTE(Node, agentCertificateSubject);
+   NXSL_REGISTER_ATTRIBUTE(Node, agentId);
+   NXSL_REGISTER_ATTRIBUTE(Node, agentProxy);
+   NXSL_REGISTER_ATTRIBUTE(Node, agentVersion);
+   NXSL_REGISTER_ATTRIBUTE(Node, bootTime);
+   NXSL_REGISTER_ATTRIBUTE(Node, bridgeBaseAddress);
+   NXSL_REGISTER_ATTRIBUTE(Node, capabilities);
+   NXSL_REGISTER_ATTRIBUTE(Node, cipDeviceType);
+   NXSL_REGISTER_ATTRIBUTE(Node, cipDeviceTypeAsText);
+   NXSL_REGISTER_ATTRIBUTE(Node, cipExtendedStatus);
+   NXSL_REGISTER_ATTRIBUTE(Node, cipExtendedStatusAsText);
+   NXSL_REGISTER_ATTRIBUTE(Node, cipStatus);
+   NXSL_REGISTER_ATTRIBUTE(Node, cipStatusAsText);
+   NXSL_REGISTER_ATTRIBUTE(Node, cipState);
+   NXSL_REGISTER_ATTRIBUTE(Node, cipStateAsText);
+   NXSL_REGISTER_ATTRIBUTE(Node, cipVendorCode);
+   NXSL_REGISTER_ATTRIBUTE(Node, components);
+   NXSL_REGISTER_ATTRIBUTE(Node, dependentNodes);
+   NXSL_REGISTER_ATTRIBUTE(Node, driver);
+   NXSL_REGISTER_ATTRIBUTE(Node, downSince);
+   NXSL_REGISTER_ATTRIBUTE(Node, effectiveAgentProxy);
+   NXSL_REGISTER_ATTRIBUTE(Node, effectiveIcmpProxy);
+   NXSL_REGISTER_ATTRIBUTE(Node, effectiveSnmpProxy);
+   NXSL_REGISTER_ATTRIBUTE(Node, flags);
+   NXSL_REGISTER_ATTRIBUTE(Node, hasAgentIfXCounters);
+   NXSL_REGISTER_ATTRIBUTE(Node, hasEntityMIB);
+   NXSL_REGISTER_ATTRIBUTE(Node, hasIfXTable);
+   NXSL_REGISTER_ATTRIBUTE(Node, hasUserAgent);
+   NXSL_REGISTER_ATTRIBUTE(Node, hasVLANs);
+   NXSL_REGISTER_ATTRIBUTE(Node, hardwareId);
+   NXSL_REGISTER_ATTRIBUTE(Node, hardwareComponents);
+   NXSL_REGISTER_ATTRIBUTE(Node, hasWinPDH);
+   NXSL_REGISTER_ATTRIBUTE(Node, hypervisorInfo);
+   NXSL_REGISTER_ATTRIBUTE(Node, hypervisorType);
+   NXSL_REGISTER_ATTRIBUTE(Node, icmpAverageRTT);
+   NXSL_REGISTER_ATTRIBUTE(Node, icmpLastRTT);
+   NXSL_REGISTER_ATTRIBUTE(Node, icmpMaxRTT);
+   NXSL_REGISTER_ATTRIBUTE(Node, icmpMinRTT);
+   NXSL_REGISTER_ATTRIBUTE(Node, icmpPacketLoss);
+   NXSL_REGISTER_ATTRIBUTE(Node, icmpProxy);
+   NXSL_REGISTER_ATTRIBUTE(Node, interfaces);
+   NXSL_REGISTER_ATTRIBUTE(Node, isAgent);
+   NXSL_REGISTER_ATTRIBUTE(Node, isBridge);
+   NXSL_REGISTER_ATTRIBUTE(Node, isCDP);
+   NXSL_REGISTER_ATTRIBUTE(Node, isEtherNetIP);
+   NXSL_REGISTER_ATTRIBUTE(Node, isLLDP);
+   NXSL_REGISTER_ATTRIBUTE(Node, isLocalMgmt);
+   NXSL_REGISTER_ATTRIBUTE_ALIAS(Node, isLocalMgmt, isLocalManagement);
+   NXSL_REGISTER_ATTRIBUTE(Node, isModbusTCP);
+   NXSL_REGISTER_ATTRIBUTE(Node, isOSPF);
+   NXSL_REGISTER_ATTRIBUTE(Node, isPAE);
+   NXSL_REGISTER_ATTRIBUTE_ALIAS(Node, isPAE, is802_1x);
+   NXSL_REGISTER_ATTRIBUTE(Node, isPrinter);
+   NXSL_REGISTER_ATTRIBUTE(Node, isProfiNet);
+   NXSL_REGISTER_ATTRIBUTE(Node, isRemotelyManaged);
+   NXSL_REGISTER_ATTRIBUTE_ALIAS(Node, isRemotelyManaged, isExternalGateway);
+   NXSL_REGISTER_ATTRIBUTE(Node, isRouter);
+   NXSL_REGISTER_ATTRIBUTE(Node, isSMCLP);
+   NXSL_REGISTER_ATTRIBUTE(Node, isSNMP);
+   NXSL_REGISTER_ATTRIBUTE(Node, isSSH);
+   NXSL_REGISTER_ATTRIBUTE(Node, isSONMP);
+   NXSL_REGISTER_ATTRIBUTE_ALIAS(Node, isSONMP, isNDP);
+   NXSL_REGISTER_ATTRIBUTE(Node, isSTP);
+   NXSL_REGISTER_ATTRIBUTE(Node, isVirtual);
+   NXSL_REGISTER_ATTRIBUTE(Node, isVRRP);
+   NXSL_REGISTER_ATTRIBUTE(Node, lastAgentCommTime);
+   NXSL_REGISTER_ATTRIBUTE(Node, nodeSubType);
+   NXSL_REGISTER_ATTRIBUTE(Node, nodeType);
+   NXSL_REGISTER_ATTRIBUTE(Node, ospfAreas);
+   NXSL_REGISTER_ATTRIBUTE(Node, ospfNeighbors);
+   NXSL_REGISTER_ATTRIBUTE(Node, ospfRouterId);
+   NXSL_REGISTER_ATTRIBUTE(Node, physicalContainer);
+   NXSL_REGISTER_ATTRIBUTE(Node, physicalContainerId);
+   NXSL_REGISTER_ATTRIBUTE(Node, platformName);
+   NXSL_REGISTER_ATTRIBUTE(Node, primaryHostName);
+   NXSL_REGISTER_ATTRIBUTE(Node, productCode);
+   NXSL_REGISTER_ATTRIBUTE(Node, productName);
+   NXSL_REGISTER_ATTRIBUTE(Node, productVersion);
+   NXSL_REGISTER_ATTRIBUTE(Node, rack);
+   NXSL_REGISTER_ATTRIBUTE(Node, rackId);
+   NXSL_REGISTER_ATTRIBUTE(Node, rackHeight);
+   NXSL_REGISTER_ATTRIBUTE(Node, rackPosition);
+   NXSL_REGISTER_ATTRIBUTE(Node, runtimeFlags);
+   NXSL_REGISTER_ATTRIBUTE(Node, serialNumber);
+   NXSL_REGISTER_ATTRIBUTE(Node, snmpOID);
+   NXSL_REGISTER_ATTRIBUTE(Node, snmpProxy);
+   NXSL_REGISTER_ATTRIBUTE(Node, snmpSysContact);
+   NXSL_REGISTER_ATTRIBUTE(Node, snmpSysLocation);
+   NXSL_REGISTER_ATTRIBUTE(Node, snmpSysName);
+   NXSL_REGISTER_ATTRIBUTE(Node, snmpVersion);
+   NXSL_REGISTER_ATTRIBUTE(Node, softwarePackages);
+   NXSL_REGISTER_ATTRIBUTE(Node, sysDescription);
+   NXSL_REGISTER_ATTRIBUTE(Node, tunnel);
+   NXSL_REGISTER_ATTRIBUTE(Node, vendor);
+   NXSL_REGISTER_ATTRIBUTE(Node, vlans);
+   NXSL_REGISTER_ATTRIBUTE(Node, zone);
+   NXSL_REGISTER_ATTRIBUTE(Node, zoneProxyAssignments);
+   NXSL_REGISTER_ATTRIBUTE(Node, zoneProxyStatus);
+   NXSL_REGISTER_ATTRIBUTE(Node, zoneUIN);
+}
+
 /**
  * Interface::enableAgentStatusPolling(enabled) method
  */
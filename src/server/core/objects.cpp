@@ -189,6 +189,9 @@ static void CacheLoadingThread()
    ThreadSetName("CacheLoader");
    nxlog_debug_tag(_T("obj.dc"), 1, _T("Started caching of DCI values"));
 
+   // DCIs found in snapshot saved on last shutdown are restored from it, others are loaded from database
+   OpenDCISnapshot();
+
 	UpdateDataCollectionCache(&g_idxNodeById);
 	UpdateDataCollectionCache(&g_idxClusterById);
 	UpdateDataCollectionCache(&g_idxMobileDeviceById);
@@ -196,32 +199,64 @@ static void CacheLoadingThread()
    UpdateDataCollectionCache(&g_idxChassisById);
    UpdateDataCollectionCache(&g_idxSensorById);
 
+   CloseDCISnapshot();
+
    nxlog_debug_tag(_T("obj.dc"), 1, _T("Finished caching of DCI values"));
 }
 
+/**
+ * Map update context
+ */
+struct MapUpdateContext
+{
+   const HashSet<uint32_t> *changedObjects;
+   bool fullUpdate;
+};
+
 /**
  * Callback for map update thread
  */
-static void UpdateMapCallback(NetObj *object, void *data)
+static void UpdateMapCallback(NetObj *object, MapUpdateContext *context)
 {
    if (IsShutdownInProgress())
       return;
-	static_cast<NetworkMap*>(object)->updateContent();
-	static_cast<NetworkMap*>(object)->calculateCompoundStatus();
+
+   NetworkMap *map = static_cast<NetworkMap*>(object);
+   if (context->fullUpdate || map->isContentUpdateRequired(*context->changedObjects))
+   {
+      map->updateContent();
+   }
+   else if (map->getStatus() != STATUS_UNMANAGED)
+   {
+      map->updateLinks();
+   }
+   map->calculateCompoundStatus();
 }
 
 /**
- * Map update thread
+ * Map update thread. Map content is rebuilt only for maps containing objects with changed topology,
+ * with periodic full rebuild of all maps to catch changes not reported via notifications.
  */
 static void MapUpdateThread()
 {
    ThreadSetName("MapUpdate");
 	nxlog_debug_tag(_T("obj.netmap"), 2, _T("Map update thread started"));
+   uint32_t fullUpdateInterval = ConfigReadULong(_T("Objects.NetworkMaps.FullUpdateInterval"), 3600);
+   time_t lastFullUpdate = 0;
 	while(!SleepAndCheckForShutdown(60))
 	{
-	   nxlog_debug_tag(_T("obj.netmap"), 6, _T("Updating maps..."));
-		g_idxNetMapById.forEach(UpdateMapCallback, nullptr);
+	   MapUpdateContext context;
+	   context.changedObjects = CollectNetworkMapTopologyChanges();
+	   time_t now = time(nullptr);
+	   context.fullUpdate = (now - lastFullUpdate >= static_cast<time_t>(fullUpdateInterval));
+	   if (context.fullUpdate)
+	      lastFullUpdate = now;
+
+	   nxlog_debug_tag(_T("obj.netmap"), 6, _T("Updating maps (%s, %d objects with changed topology)..."),
+	            context.fullUpdate ? _T("full") : _T("incremental"), context.changedObjects->size());
+		g_idxNetMapById.forEach(UpdateMapCallback, &context);
 		nxlog_debug_tag(_T("obj.netmap"), 6, _T("Map update completed"));
+		delete context.changedObjects;
 	}
 	nxlog_debug_tag(_T("obj.netmap"), 2, _T("Map update thread stopped"));
 }
@@ -1372,52 +1407,146 @@ uint32_t FindLocalMgmtNode()
 	return (object != nullptr) ? object->getId() : 0;
 }
 
+/**
+ * Number of threads used for loading objects at startup
+ */
+static int s_loaderThreads = 1;
+
+/**
+ * Bulk loading of object configuration tables at startup
+ */
+static bool s_bulkLoad = false;
+static bool s_bulkLoadUseConnectionPool = false;
+
+/**
+ * Minimal number of objects of one class for reading object configuration tables in bulk
+ */
+#define BULK_LOAD_THRESHOLD   64
+
+/**
+ * Context for parallel object loading
+ */
+template<typename T> struct ObjectLoaderContext
+{
+   const uint32_t *ids;
+   shared_ptr<T> *objects;
+   int count;
+   VolatileCounter next;
+};
+
+/**
+ * Object loader thread. Each thread uses own database connection and only constructs objects,
+ * insertion into indexes is done by caller in original order.
+ */
+template<typename T> static void ObjectLoaderThread(ObjectLoaderContext<T> *context)
+{
+   DB_HANDLE hdb = DBConnectionPoolAcquireConnection();
+   int i;
+   while((i = InterlockedIncrement(&context->next) - 1) < context->count)
+   {
+      auto object = make_shared<T>();
+      if (object->loadFromDatabase(hdb, context->ids[i]))
+         context->objects[i] = object;
+      else
+         object->destroy();
+   }
+   DBConnectionPoolReleaseConnection(hdb);
+}
+
 /**
  * Template function for loading objects from database
  * 
  * @param className    object class name
  * @param hdb          database handle
  * @param query        sets table and WHERE condition, if needed
- * @param index        clearing startup mode for specific object index
  * @param beforeInsert function called before object insertion in indexes
  * @param afterInsert  function called after object insertion in indexes
+ * @param parallel     true if objects of this class can be loaded by multiple threads (object loading code
+ *                     should not modify global state other than adding itself to already loaded objects)
  */
-template<typename T> static void LoadObjectsFromTable(const TCHAR* className, DB_HANDLE hdb, const TCHAR* query, void (*beforeInsert)(const shared_ptr<T>& obj) = nullptr, void (*afterInsert)(const shared_ptr<T>& obj) = nullptr)
+template<typename T> static void LoadObjectsFromTable(const TCHAR* className, DB_HANDLE hdb, const TCHAR* query, void (*beforeInsert)(const shared_ptr<T>& obj) = nullptr,
+         void (*afterInsert)(const shared_ptr<T>& obj) = nullptr, bool parallel = false)
 {
    nxlog_debug_tag(_T("obj.init"), 2, _T("Loading %s%s..."), className, _tcscmp(className, _T("chassis")) ? _T("s") : _T(""));
    DB_RESULT hResult = DBSelectFormatted(hdb, _T("SELECT id FROM %s"), query);
-   if (hResult != nullptr)
+   if (hResult == nullptr)
+      return;
+
+   int count = DBGetNumRows(hResult);
+   uint32_t *ids = MemAllocArrayNoInit<uint32_t>(count);
+   for (int i = 0; i < count; i++)
+      ids[i] = DBGetFieldULong(hResult, i, 0);
+   DBFreeResult(hResult);
+
+   // Rows from object configuration tables are read in bulk for all objects of this class
+   // and released as soon as objects are constructed
+   bool bulkLoad = s_bulkLoad && (count > BULK_LOAD_THRESHOLD);
+   if (bulkLoad)
+      BulkLoadStart(hdb, s_bulkLoadUseConnectionPool, s_loaderThreads, query);
+
+   shared_ptr<T> *objects = new shared_ptr<T>[count];
+   if (parallel && (s_loaderThreads > 1) && (count > 64))
+   {
+      // Object loading code may search for already loaded objects
+      g_idxObjectById.sortStartupData();
+
+      ObjectLoaderContext<T> context;
+      context.ids = ids;
+      context.objects = objects;
+      context.count = count;
+      context.next = 0;
+
+      int threadCount = std::min(s_loaderThreads, count / 32);
+      THREAD *threads = MemAllocArrayNoInit<THREAD>(threadCount);
+      for(int i = 0; i < threadCount; i++)
+         threads[i] = ThreadCreateEx(ObjectLoaderThread<T>, &context);
+      for(int i = 0; i < threadCount; i++)
+         ThreadJoin(threads[i]);
+      MemFree(threads);
+   }
+   else
    {
-      int count = DBGetNumRows(hResult);
       for (int i = 0; i < count; i++)
       {
-         uint32_t id = DBGetFieldULong(hResult, i, 0);
          auto object = make_shared<T>();
-         if (object->loadFromDatabase(hdb, id))
-         {
-            // In case we need some logic before inserting object to indexes
-            if (beforeInsert != nullptr)
-            {
-               beforeInsert(object);
-            }
+         if (object->loadFromDatabase(hdb, ids[i]))
+            objects[i] = object;
+         else
+            object->destroy();
+      }
+   }
 
-            // Insert into indexes
-            NetObjInsert(object, false, false);
+   if (bulkLoad)
+      BulkLoadEnd();
 
-            // In case we need some logic after inserting object to indexes
-            if (afterInsert != nullptr)
-            {
-               afterInsert(object);
-            }
+   for (int i = 0; i < count; i++)
+   {
+      shared_ptr<T> object = objects[i];
+      if (object != nullptr)
+      {
+         // In case we need some logic before inserting object to indexes
+         if (beforeInsert != nullptr)
+         {
+            beforeInsert(object);
          }
-         else     // Object load failed
+
+         // Insert into indexes
+         NetObjInsert(object, false, false);
+
+         // In case we need some logic after inserting object to indexes
+         if (afterInsert != nullptr)
          {
-            object->destroy();
-            nxlog_write_tag(NXLOG_ERROR, _T("obj.init"), _T("Failed to load %s object with ID %u from database"), className, id);
+            afterInsert(object);
          }
       }
-      DBFreeResult(hResult);
+      else     // Object load failed
+      {
+         nxlog_write_tag(NXLOG_ERROR, _T("obj.init"), _T("Failed to load %s object with ID %u from database"), className, ids[i]);
+      }
    }
+
+   delete[] objects;
+   MemFree(ids);
 }
 
 /**
@@ -1547,6 +1676,11 @@ bool LoadObjects()
       }
    }
 
+   // Read object configuration tables in bulk for each object class instead of querying them for each object
+   s_loaderThreads = (cachedb != nullptr) ? 1 : ConfigReadInt(_T("Objects.StartupLoaderThreads"), 4);
+   s_bulkLoad = ConfigReadBoolean(_T("Objects.StartupBulkLoad"), true);
+   s_bulkLoadUseConnectionPool = (cachedb == nullptr);
+
    // Load built-in object properties
    nxlog_debug_tag(_T("obj.init"), 2, _T("Loading built-in object properties..."));
    g_entireNetwork->loadFromDatabase(hdb);
@@ -1616,9 +1750,9 @@ bool LoadObjects()
    LoadObjectsFromTable<Rack>(_T("rack"), hdb, _T("racks"));
    LoadObjectsFromTable<Chassis>(_T("chassis"), hdb, _T("chassis"));
    g_idxChassisById.setStartupMode(false);
-   LoadObjectsFromTable<MobileDevice>(_T("mobile device"), hdb, _T("mobile_devices"));
+   LoadObjectsFromTable<MobileDevice>(_T("mobile device"), hdb, _T("mobile_devices"), nullptr, nullptr, true);
    g_idxMobileDeviceById.setStartupMode(false);
-   LoadObjectsFromTable<Sensor>(_T("sensor"), hdb, _T("sensors"));
+   LoadObjectsFromTable<Sensor>(_T("sensor"), hdb, _T("sensors"), nullptr, nullptr, true);
    g_idxSensorById.setStartupMode(false);
 
    LoadObjectsFromTable<Node>(_T("node"), hdb, _T("nodes"), nullptr, IsZoningEnabled() ? [](const shared_ptr<Node>& node) {
@@ -1627,12 +1761,12 @@ bool LoadObjects()
       {
          zone->updateProxyStatus(node, false);
       }
-   } : static_cast<void (*)(const std::shared_ptr<Node>&)>(nullptr));
+   } : static_cast<void (*)(const std::shared_ptr<Node>&)>(nullptr), true);
    g_idxNodeById.setStartupMode(false);
 
-   LoadObjectsFromTable<AccessPoint>(_T("access point"), hdb, _T("access_points"));
+   LoadObjectsFromTable<AccessPoint>(_T("access point"), hdb, _T("access_points"), nullptr, nullptr, true);
    g_idxAccessPointById.setStartupMode(false);
-   LoadObjectsFromTable<Interface>(_T("interface"), hdb, _T("interfaces"));
+   LoadObjectsFromTable<Interface>(_T("interface"), hdb, _T("interfaces"), nullptr, nullptr, true);
    LoadObjectsFromTable<NetworkService>(_T("network service"), hdb, _T("network_services"));
    LoadObjectsFromTable<VPNConnector>(_T("VPN connector"), hdb, _T("vpn_connectors"));
    LoadObjectsFromTable<Cluster>(_T("cluster"), hdb, _T("clusters"));
@@ -1642,7 +1776,7 @@ bool LoadObjects()
    // All data collection targets must be loaded at this point.
    ThreadCreate(CacheLoadingThread);
 
-   LoadObjectsFromTable<Template>(_T("template"), hdb, _T("templates"), nullptr, [](const shared_ptr<Template>& t) { t->calculateCompoundStatus(); });
+   LoadObjectsFromTable<Template>(_T("template"), hdb, _T("templates"), nullptr, [](const shared_ptr<Template>& t) { t->calculateCompoundStatus(); }, true);
    LoadObjectsFromTable<NetworkMap>(_T("network map"), hdb, _T("network_maps"));
    g_idxNetMapById.setStartupMode(false);
    LoadObjectsFromTable<Container>(_T("container"), hdb, _T("object_containers WHERE object_class=") AS_STRING(OBJECT_CONTAINER));
@@ -0,0 +1,248 @@
+/*
+** NetXMS - Network Management System
+** Copyright (C) 2003-2022 Victor Kirhenshtein
+**
+** This program is free software; you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation; either version 2 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+**
+** File: objupdate.cpp
+**
+**/
+
+#include "nxcore.h"
+
+#define DEBUG_TAG _T("obj.notify")
+
+/**
+ * Maximum age (in seconds) of cached update message
+ */
+#define MAX_UPDATE_AGE     30
+
+/**
+ * Update variant flags
+ */
+#define UPDATE_WITH_COMMENTS  0x0001
+#define UPDATE_COMPRESSED     0x0002
+
+/**
+ * Key for cached update message. Message content depends on user only for data collection targets
+ * (DCI access restrictions and password masking), so user ID is set to 0 for all other objects.
+ */
+struct SharedObjectUpdateKey
+{
+   uint32_t objectId;
+   uint32_t userId;
+   uint32_t flags;
+};
+
+/**
+ * Cached update message
+ */
+struct CachedObjectUpdate
+{
+   shared_ptr<SharedObjectUpdate> update;
+   uint32_t generation;
+   time_t timestamp;
+
+   CachedObjectUpdate(const shared_ptr<SharedObjectUpdate>& _update, uint32_t _generation) : update(_update)
+   {
+      generation = _generation;
+      timestamp = time(nullptr);
+   }
+};
+
+/**
+ * Update cache. Each object change increments object's generation, and cached messages with
+ * older generation are considered invalid. Invalid entries are removed periodically.
+ */
+static HashMap<SharedObjectUpdateKey, CachedObjectUpdate> s_cache(Ownership::True);
+static HashMap<uint32_t, uint32_t> s_generations(Ownership::True);
+static Mutex s_cacheLock(MutexType::FAST);
+static time_t s_lastCleanup = 0;
+
+/**
+ * Get current generation of given object (must be called with lock held)
+ */
+static inline uint32_t GetGeneration(uint32_t objectId)
+{
+   uint32_t *generation = s_generations.get(objectId);
+   return (generation != nullptr) ? *generation : 0;
+}
+
+/**
+ * Remove outdated entries from cache (must be called with lock held)
+ */
+static void CleanupCache(time_t now)
+{
+   int count = 0;
+   auto it = s_cache.begin();
+   while(it.hasNext())
+   {
+      CachedObjectUpdate *entry = it.next();
+      if (now - entry->timestamp > MAX_UPDATE_AGE)
+      {
+         it.remove();
+         count++;
+      }
+   }
+   s_lastCleanup = now;
+   nxlog_debug_tag(DEBUG_TAG, 7, _T("Shared object update cache cleanup: %d entries removed, %d entries remaining"), count, s_cache.size());
+}
+
+/**
+ * Invalidate all cached update messages for given object. Should be called on object change
+ * before notifying client sessions.
+ */
+void InvalidateSharedObjectUpdates(uint32_t objectId)
+{
+   s_cacheLock.lock();
+   uint32_t *generation = s_generations.get(objectId);
+   if (generation != nullptr)
+   {
+      (*generation)++;
+   }
+   else
+   {
+      generation = new uint32_t;
+      *generation = 1;
+      s_generations.set(objectId, generation);
+   }
+   s_cacheLock.unlock();
+}
+
+/**
+ * Context for collecting cache keys of given object
+ */
+struct ObjectKeysCollectorContext
+{
+   uint32_t objectId;
+   StructArray<SharedObjectUpdateKey> keys;
+};
+
+/**
+ * Collect cache keys of given object
+ */
+static EnumerationCallbackResult CollectObjectKeys(const SharedObjectUpdateKey& key, CachedObjectUpdate *entry, ObjectKeysCollectorContext *context)
+{
+   if (key.objectId == context->objectId)
+      context->keys.add(key);
+   return _CONTINUE;
+}
+
+/**
+ * Remove all cached update messages and generation counter for given object. Should be called when
+ * deleted object is removed from object indexes.
+ */
+void RemoveSharedObjectUpdates(uint32_t objectId)
+{
+   ObjectKeysCollectorContext context;
+   context.objectId = objectId;
+
+   s_cacheLock.lock();
+   s_generations.remove(objectId);
+   s_cache.forEach(CollectObjectKeys, &context);
+   for(int i = 0; i < context.keys.size(); i++)
+      s_cache.remove(*context.keys.get(i));
+   s_cacheLock.unlock();
+}
+
+/**
+ * Create update message for given object
+ */
+static NXCP_MESSAGE *CreateObjectUpdateMessage(NetObj *object, uint32_t userId, bool includeComments, bool allowCompression)
+{
+   NXCPMessage msg(CMD_OBJECT_UPDATE, 0);
+   object->fillMessage(&msg, userId);
+   if (includeComments)
+      object->commentsToMessage(&msg);
+   if ((object->getObjectClass() == OBJECT_NODE) && !object->checkAccessRights(userId, OBJECT_ACCESS_MODIFY))
+   {
+      // mask passwords
+      msg.setField(VID_SHARED_SECRET, _T("********"));
+      msg.setField(VID_SNMP_AUTH_OBJECT, _T("********"));
+      msg.setField(VID_SNMP_AUTH_PASSWORD, _T("********"));
+      msg.setField(VID_SNMP_PRIV_PASSWORD, _T("********"));
+      msg.setField(VID_SSH_PASSWORD, _T("********"));
+   }
+   return msg.serialize(allowCompression);
+}
+
+/**
+ * Get serialized update message for given object. Message is created once for each object change
+ * and shared by all sessions which need same message variant.
+ */
+shared_ptr<SharedObjectUpdate> GetSharedObjectUpdate(NetObj *object, uint32_t userId, bool includeComments, bool allowCompression)
+{
+   SharedObjectUpdateKey key;
+   key.objectId = object->getId();
+   key.userId = object->isDataCollectionTarget() ? userId : 0;
+   key.flags = (includeComments ? UPDATE_WITH_COMMENTS : 0) | (allowCompression ? UPDATE_COMPRESSED : 0);
+
+   s_cacheLock.lock();
+   uint32_t generation = GetGeneration(key.objectId);
+   CachedObjectUpdate *entry = s_cache.get(key);
+   if ((entry != nullptr) && (entry->generation == generation))
+   {
+      shared_ptr<SharedObjectUpdate> update = entry->update;
+      s_cacheLock.unlock();
+      return update;
+   }
+   s_cacheLock.unlock();
+
+   auto update = make_shared<SharedObjectUpdate>(CreateObjectUpdateMessage(object, userId, includeComments, allowCompression));
+
+   s_cacheLock.lock();
+   // Object could be changed while message was being created
+   if (GetGeneration(key.objectId) == generation)
+      s_cache.set(key, new CachedObjectUpdate(update, generation));
+   time_t now = time(nullptr);
+   if (now - s_lastCleanup > MAX_UPDATE_AGE)
+      CleanupCache(now);
+   s_cacheLock.unlock();
+
+   return update;
+}
+
+/**
+ * Create object update filter from NXCP message
+ */
+ObjectUpdateFilter::ObjectUpdateFilter(const NXCPMessage& msg) : m_rootObjects(0, 16), m_classes(0, 16)
+{
+   msg.getFieldAsInt32Array(VID_OBJECT_LIST, &m_rootObjects);
+
+   IntegerArray<uint32_t> classes(0, 16);
+   msg.getFieldAsInt32Array(VID_CLASS_ID_LIST, &classes);
+   for(int i = 0; i < classes.size(); i++)
+      m_classes.add(static_cast<int32_t>(classes.get(i)));
+}
+
+/**
+ * Check if given object passes filter
+ */
+bool ObjectUpdateFilter::match(const NetObj& object) const
+{
+   if (!m_classes.isEmpty() && !m_classes.contains(object.getObjectClass()))
+      return false;
+
+   if (m_rootObjects.isEmpty())
+      return true;
+
+   for(int i = 0; i < m_rootObjects.size(); i++)
+   {
+      uint32_t id = m_rootObjects.get(i);
+      if ((object.getId() == id) || object.isParent(id))
+         return true;
+   }
+   return false;
+}
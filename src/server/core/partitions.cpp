@@ -0,0 +1,424 @@
+/*
+** NetXMS - Network Management System
+** Copyright (C) 2003-2022 Victor Kirhenshtein
+**
+** This program is free software; you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation; either version 2 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+**
+** File: partitions.cpp
+**
+**/
+
+#include "nxcore.h"
+
+#define DEBUG_TAG _T("db.partitions")
+
+/**
+ * Partition interval (one day)
+ */
+#define PARTITION_INTERVAL    86400
+
+/**
+ * Number of days for which partitions are created in advance
+ */
+#define PARTITIONS_AHEAD      7
+
+/**
+ * Partitioned table
+ */
+struct PartitionedTable
+{
+   const TCHAR *name;
+   const TCHAR *timestampColumn;
+   bool perfData;
+};
+
+/**
+ * Tables which could be partitioned
+ */
+static const PartitionedTable s_partitionedTables[] =
+{
+   { _T("idata"), _T("idata_timestamp"), true },
+   { _T("tdata"), _T("tdata_timestamp"), true },
+   { _T("event_log"), _T("event_timestamp"), false },
+   { _T("syslog"), _T("msg_timestamp"), false },
+   { _T("snmp_trap_log"), _T("trap_timestamp"), false },
+   { nullptr, nullptr, false }
+};
+
+/**
+ * Table partition information
+ */
+struct TablePartition
+{
+   TCHAR name[128];
+   time_t upperBound;   // 0 for partition without upper bound
+   bool defaultPartition;
+};
+
+/**
+ * Check if given table is partitioned
+ */
+bool IsPartitionedTable(const TCHAR *table)
+{
+   if (!(g_flags & AF_PARTITIONED_TABLES))
+      return false;
+
+   for(int i = 0; s_partitionedTables[i].name != nullptr; i++)
+   {
+      if (!_tcscmp(s_partitionedTables[i].name, table))
+         return !s_partitionedTables[i].perfData || (g_flags & AF_SINGLE_TABLE_PERF_DATA);
+   }
+   return false;
+}
+
+/**
+ * Find partitioned table by name
+ */
+static const PartitionedTable *FindPartitionedTable(const TCHAR *table)
+{
+   for(int i = 0; s_partitionedTables[i].name != nullptr; i++)
+   {
+      if (!_tcscmp(s_partitionedTables[i].name, table))
+         return &s_partitionedTables[i];
+   }
+   return nullptr;
+}
+
+/**
+ * Format partition name suffix for partition starting at given time
+ */
+static void FormatPartitionSuffix(time_t t, TCHAR *buffer)
+{
+#if HAVE_GMTIME_R
+   struct tm tmbuff;
+   struct tm *gmt = gmtime_r(&t, &tmbuff);
+#else
+   struct tm *gmt = gmtime(&t);
+#endif
+   _sntprintf(buffer, 16, _T("p%04d%02d%02d"), gmt->tm_year + 1900, gmt->tm_mon + 1, gmt->tm_mday);
+}
+
+/**
+ * Parse upper bound of PostgreSQL partition from expression like FOR VALUES FROM (x) TO (y)
+ */
+static time_t ParsePostgreSQLUpperBound(const TCHAR *expression)
+{
+   const TCHAR *p = _tcsstr(expression, _T(" TO ("));
+   if (p == nullptr)
+      return 0;
+   p += 5;
+   if (*p == _T('\''))
+      p++;
+   return static_cast<time_t>(_tcstoll(p, nullptr, 10));   // MAXVALUE will be parsed as 0
+}
+
+/**
+ * Get list of table partitions
+ */
+static StructArray<TablePartition> *GetTablePartitions(DB_HANDLE hdb, const TCHAR *table)
+{
+   TCHAR query[512];
+   switch(g_dbSyntax)
+   {
+      case DB_SYNTAX_PGSQL:
+         _sntprintf(query, 512, _T("SELECT c.relname,pg_get_expr(c.relpartbound,c.oid) FROM pg_inherits i INNER JOIN pg_class c ON c.oid=i.inhrelid WHERE i.inhparent='%s'::regclass"), table);
+         break;
+      case DB_SYNTAX_MYSQL:
+         _sntprintf(query, 512, _T("SELECT partition_name,partition_description FROM information_schema.partitions WHERE table_schema=DATABASE() AND table_name='%s' AND partition_name IS NOT NULL"), table);
+         break;
+      case DB_SYNTAX_ORACLE:
+         _sntprintf(query, 512, _T("SELECT partition_name,high_value FROM user_tab_partitions WHERE table_name=UPPER('%s')"), table);
+         break;
+      default:
+         return nullptr;
+   }
+
+   DB_RESULT hResult = DBSelect(hdb, query);
+   if (hResult == nullptr)
+      return nullptr;
+
+   int count = DBGetNumRows(hResult);
+   auto partitions = new StructArray<TablePartition>(count);
+   for(int i = 0; i < count; i++)
+   {
+      TablePartition *p = partitions->addPlaceholder();
+      DBGetField(hResult, i, 0, p->name, 128);
+      TCHAR bound[256];
+      DBGetField(hResult, i, 1, bound, 256);
+      p->upperBound = (g_dbSyntax == DB_SYNTAX_PGSQL) ? ParsePostgreSQLUpperBound(bound) : static_cast<time_t>(_tcstoll(bound, nullptr, 10));
+      p->defaultPartition = (g_dbSyntax == DB_SYNTAX_PGSQL) && !_tcscmp(bound, _T("DEFAULT"));
+   }
+   DBFreeResult(hResult);
+   return partitions;
+}
+
+/**
+ * Execute query on given connection
+ */
+static inline bool ExecuteQuery(DB_HANDLE hdb, const TCHAR *query)
+{
+   nxlog_debug_tag(DEBUG_TAG, 5, _T("Executing query \"%s\""), query);
+   return DBQuery(hdb, query);
+}
+
+/**
+ * Create new PostgreSQL partition. If table has default partition, records from new partition's
+ * range are moved out of default partition first, because PostgreSQL does not allow to create
+ * partition while default partition contains records belonging to it.
+ */
+static bool CreatePostgreSQLPartition(DB_HANDLE hdb, const PartitionedTable *table, const TCHAR *suffix, time_t start, time_t upper, bool hasDefaultPartition)
+{
+   TCHAR query[512];
+   if (!hasDefaultPartition)
+   {
+      _sntprintf(query, 512, _T("CREATE TABLE %s_%s PARTITION OF %s FOR VALUES FROM (") INT64_FMT _T(") TO (") INT64_FMT _T(")"),
+               table->name, suffix, table->name, static_cast<int64_t>(start), static_cast<int64_t>(upper));
+      return ExecuteQuery(hdb, query);
+   }
+
+   if (!DBBegin(hdb))
+      return false;
+
+   _sntprintf(query, 512, _T("CREATE TABLE %s_%s (LIKE %s INCLUDING DEFAULTS)"), table->name, suffix, table->name);
+   bool success = ExecuteQuery(hdb, query);
+   if (success)
+   {
+      _sntprintf(query, 512, _T("INSERT INTO %s_%s SELECT * FROM %s_default WHERE %s>=") INT64_FMT _T(" AND %s<") INT64_FMT,
+               table->name, suffix, table->name, table->timestampColumn, static_cast<int64_t>(start), table->timestampColumn, static_cast<int64_t>(upper));
+      success = ExecuteQuery(hdb, query);
+   }
+   if (success)
+   {
+      _sntprintf(query, 512, _T("DELETE FROM %s_default WHERE %s>=") INT64_FMT _T(" AND %s<") INT64_FMT,
+               table->name, table->timestampColumn, static_cast<int64_t>(start), table->timestampColumn, static_cast<int64_t>(upper));
+      success = ExecuteQuery(hdb, query);
+   }
+   if (success)
+   {
+      _sntprintf(query, 512, _T("ALTER TABLE %s ATTACH PARTITION %s_%s FOR VALUES FROM (") INT64_FMT _T(") TO (") INT64_FMT _T(")"),
+               table->name, table->name, suffix, static_cast<int64_t>(start), static_cast<int64_t>(upper));
+      success = ExecuteQuery(hdb, query);
+   }
+
+   if (success)
+      DBCommit(hdb);
+   else
+      DBRollback(hdb);
+   return success;
+}
+
+/**
+ * Create missing partitions for given table. On PostgreSQL default partition is also created if missing,
+ * so records outside of existing partitions' ranges (too far in the future, or older than oldest
+ * partition) can still be stored.
+ */
+static void CreatePartitionsForTable(DB_HANDLE hdb, const PartitionedTable *partitionedTable, time_t now)
+{
+   const TCHAR *table = partitionedTable->name;
+   StructArray<TablePartition> *partitions = GetTablePartitions(hdb, table);
+   if (partitions == nullptr)
+      return;
+
+   if (partitions->isEmpty())
+   {
+      nxlog_debug_tag(DEBUG_TAG, 3, _T("Table %s is not partitioned"), table);
+      delete partitions;
+      return;
+   }
+
+   time_t lastBound = 0;
+   bool hasDefaultPartition = false;
+   for(int i = 0; i < partitions->size(); i++)
+   {
+      TablePartition *p = partitions->get(i);
+      if (p->upperBound > lastBound)
+         lastBound = p->upperBound;
+      if (p->defaultPartition)
+         hasDefaultPartition = true;
+   }
+   delete partitions;
+
+   if ((g_dbSyntax == DB_SYNTAX_PGSQL) && !hasDefaultPartition)
+   {
+      TCHAR query[256];
+      _sntprintf(query, 256, _T("CREATE TABLE %s_default PARTITION OF %s DEFAULT"), table, table);
+      if (ExecuteQuery(hdb, query))
+      {
+         hasDefaultPartition = true;
+         nxlog_debug_tag(DEBUG_TAG, 4, _T("Default partition created for table %s"), table);
+      }
+   }
+
+   time_t today = now - now % PARTITION_INTERVAL;
+   time_t end = today + (PARTITIONS_AHEAD + 1) * PARTITION_INTERVAL;
+   if (lastBound >= end)
+      return;
+
+   // If partitions are missing for past days (for example, because server was down) first new partition will cover whole gap
+   time_t start = lastBound;
+   time_t upper = std::max(lastBound + PARTITION_INTERVAL, today + PARTITION_INTERVAL);
+
+   StringBuffer query;
+   if (g_dbSyntax == DB_SYNTAX_MYSQL)
+   {
+      query.append(_T("ALTER TABLE "));
+      query.append(table);
+      query.append(_T(" REORGANIZE PARTITION pmax INTO ("));
+   }
+
+   int count = 0;
+   for(; upper <= end; start = upper, upper += PARTITION_INTERVAL)
+   {
+      TCHAR suffix[16];
+      FormatPartitionSuffix(upper - PARTITION_INTERVAL, suffix);
+      if (g_dbSyntax == DB_SYNTAX_PGSQL)
+      {
+         if (!CreatePostgreSQLPartition(hdb, partitionedTable, suffix, start, upper, hasDefaultPartition))
+            break;
+      }
+      else
+      {
+         query.append(_T("PARTITION "));
+         query.append(suffix);
+         query.append(_T(" VALUES LESS THAN ("));
+         query.append(static_cast<int64_t>(upper));
+         query.append(_T("),"));
+      }
+      count++;
+   }
+
+   if ((g_dbSyntax == DB_SYNTAX_MYSQL) && (count > 0))
+   {
+      query.append(_T("PARTITION pmax VALUES LESS THAN MAXVALUE)"));
+      if (!ExecuteQuery(hdb, query))
+         count = 0;
+   }
+
+   nxlog_debug_tag(DEBUG_TAG, 4, _T("%d new partitions created for table %s"), count, table);
+}
+
+/**
+ * Create partitions for current day and configured number of days ahead for all partitioned tables.
+ * Oracle creates interval partitions automatically, so nothing is done there.
+ */
+void CreateTablePartitions(DB_HANDLE hdb)
+{
+   if (!(g_flags & AF_PARTITIONED_TABLES) || (g_dbSyntax == DB_SYNTAX_ORACLE))
+      return;
+
+   time_t now = time(nullptr);
+   for(int i = 0; s_partitionedTables[i].name != nullptr; i++)
+   {
+      if (IsPartitionedTable(s_partitionedTables[i].name))
+         CreatePartitionsForTable(hdb, &s_partitionedTables[i], now);
+   }
+}
+
+/**
+ * Delete records older than given cutoff time from given partition
+ */
+static void DeleteExpiredRecords(DB_HANDLE hdb, const TCHAR *table, const TablePartition *partition, time_t cutoffTime)
+{
+   const PartitionedTable *partitionedTable = FindPartitionedTable(table);
+   if (partitionedTable == nullptr)
+      return;
+
+   TCHAR query[512];
+   if (g_dbSyntax == DB_SYNTAX_PGSQL)
+      _sntprintf(query, 512, _T("DELETE FROM %s WHERE %s<") INT64_FMT, partition->name, partitionedTable->timestampColumn, static_cast<int64_t>(cutoffTime));
+   else
+      _sntprintf(query, 512, _T("DELETE FROM %s PARTITION (%s) WHERE %s<") INT64_FMT, table, partition->name, partitionedTable->timestampColumn, static_cast<int64_t>(cutoffTime));
+   ExecuteQuery(hdb, query);
+}
+
+/**
+ * Check if given partition is legacy partition created during table conversion
+ */
+static bool IsLegacyPartition(const TCHAR *table, const TablePartition *partition)
+{
+   if (g_dbSyntax != DB_SYNTAX_PGSQL)
+      return !_tcsicmp(partition->name, _T("p_legacy"));
+
+   TCHAR name[128];
+   _sntprintf(name, 128, _T("%s_legacy"), table);
+   return !_tcscmp(partition->name, name);
+}
+
+/**
+ * Drop partitions of given table which contain only records older than given cutoff time. Records older
+ * than cutoff time are deleted from legacy partition (created during conversion and containing records
+ * which existed before conversion) until it can be dropped. On Oracle legacy partition is range section
+ * partition which cannot be dropped at all. On PostgreSQL records older than cutoff time are also deleted
+ * from default partition. Returns number of dropped partitions.
+ */
+int DropExpiredPartitions(DB_HANDLE hdb, const TCHAR *table, time_t cutoffTime)
+{
+   StructArray<TablePartition> *partitions = GetTablePartitions(hdb, table);
+   if (partitions == nullptr)
+      return 0;
+
+   // Legacy partition covers whole period before conversion, so it could be dropped only when longest
+   // retention time has passed since conversion. Until then expired records are removed by DELETE
+   // statement. Oracle does not allow to drop last partition in range section of interval partitioned
+   // table, so legacy partition is never dropped there.
+   TablePartition *legacyPartition = nullptr;
+   for(int i = 0; i < partitions->size(); i++)
+   {
+      TablePartition *p = partitions->get(i);
+      if (IsLegacyPartition(table, p))
+      {
+         if ((g_dbSyntax == DB_SYNTAX_ORACLE) || (p->upperBound == 0) || (p->upperBound > cutoffTime))
+            legacyPartition = p;
+         break;
+      }
+   }
+
+   int count = 0;
+   for(int i = 0; i < partitions->size(); i++)
+   {
+      TablePartition *p = partitions->get(i);
+      if (p->defaultPartition)
+      {
+         DeleteExpiredRecords(hdb, table, p, cutoffTime);
+         continue;
+      }
+
+      if ((p->upperBound == 0) || (p->upperBound > cutoffTime) || (p == legacyPartition))
+         continue;
+
+      TCHAR query[512];
+      switch(g_dbSyntax)
+      {
+         case DB_SYNTAX_PGSQL:
+            _sntprintf(query, 512, _T("DROP TABLE %s"), p->name);
+            break;
+         case DB_SYNTAX_MYSQL:
+            _sntprintf(query, 512, _T("ALTER TABLE %s DROP PARTITION %s"), table, p->name);
+            break;
+         case DB_SYNTAX_ORACLE:
+            _sntprintf(query, 512, _T("ALTER TABLE %s DROP PARTITION %s UPDATE GLOBAL INDEXES"), table, p->name);
+            break;
+      }
+      if (ExecuteQuery(hdb, query))
+         count++;
+   }
+
+   if (legacyPartition != nullptr)
+      DeleteExpiredRecords(hdb, table, legacyPartition, cutoffTime);
+   delete partitions;
+
+   nxlog_debug_tag(DEBUG_TAG, 4, _T("%d expired partitions dropped for table %s"), count, table);
+   return count;
+}
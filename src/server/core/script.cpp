@@ -145,6 +145,42 @@ ScriptVMHandle NXCORE_EXPORTABLE CreateServerScriptVM(const NXSL_Program *script
    return ScriptVMHandle(SetupServerScriptVM(vm, object, dciInfo));
 }
 
+/**
+ * Create NXSL VM from library script using script's VM pool. VM must be released by calling ScriptVMHandle::destroy().
+ * Created VM will take ownership of DCI descriptor.
+ */
+ScriptVMHandle NXCORE_EXPORTABLE CreatePooledServerScriptVM(const TCHAR *name, const shared_ptr<NetObj>& object, const shared_ptr<DCObjectInfo>& dciInfo)
+{
+   ScriptVMHandle vm = s_scriptLibrary.createPooledVM(name, [] { return new NXSL_ServerEnv(); }, ScriptValidator);
+   if (vm.isValid())
+      SetupServerScriptVM(vm, object, dciInfo);
+   return vm;
+}
+
+/**
+ * Create NXSL VM from compiled script using given VM pool. VM must be released by calling ScriptVMHandle::destroy().
+ * Created VM will take ownership of DCI descriptor.
+ */
+ScriptVMHandle NXCORE_EXPORTABLE CreatePooledServerScriptVM(const NXSL_Program *script, const shared_ptr<NXSL_VMPool>& pool, const shared_ptr<NetObj>& object, const shared_ptr<DCObjectInfo>& dciInfo)
+{
+   if (script->isEmpty())
+      return ScriptVMHandle(ScriptVMFailureReason::SCRIPT_IS_EMPTY);
+
+   uint32_t generation;
+   NXSL_VM *vm = pool->acquire(&generation);
+   if (vm == nullptr)
+   {
+      vm = new NXSL_VM(new NXSL_ServerEnv());
+      if (!vm->load(script))
+      {
+         delete vm;
+         return ScriptVMHandle(ScriptVMFailureReason::SCRIPT_LOAD_ERROR);
+      }
+   }
+
+   return ScriptVMHandle(SetupServerScriptVM(vm, object, dciInfo), pool, generation);
+}
+
 /**
  * Load scripts from database
  */
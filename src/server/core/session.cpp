@@ -1327,6 +1327,9 @@ void ClientSession::processRequest(NXCPMessage *request)
       case CMD_CHANGE_SUBSCRIPTION:
          changeSubscription(*request);
          break;
+      case CMD_SET_OBJECT_UPDATE_FILTER:
+         setObjectUpdateFilter(*request);
+         break;
       case CMD_GET_SERVER_STATS:
          sendServerStats(*request);
          break;
@@ -3306,29 +3309,21 @@ void ClientSession::sendObjectUpdates()
    NXCPMessage response(CMD_OBJECT_UPDATE, 0);
    for(size_t i = 0; i < count; i++)
    {
-      response.deleteAllFields();
       shared_ptr<NetObj> object = FindObjectById(idList[i]);
       if ((object != nullptr) && !object->isDeleted())
       {
-         object->fillMessage(&response, m_dwUserId);
-         if (m_flags & CSF_SYNC_OBJECT_COMMENTS)
-            object->commentsToMessage(&response);
-         if ((object->getObjectClass() == OBJECT_NODE) && !object->checkAccessRights(m_dwUserId, OBJECT_ACCESS_MODIFY))
-         {
-            // mask passwords
-            response.setField(VID_SHARED_SECRET, _T("********"));
-            response.setField(VID_SNMP_AUTH_OBJECT, _T("********"));
-            response.setField(VID_SNMP_AUTH_PASSWORD, _T("********"));
-            response.setField(VID_SNMP_PRIV_PASSWORD, _T("********"));
-            response.setField(VID_SSH_PASSWORD, _T("********"));
-         }
+         // Serialized update is shared with other sessions which need same message variant
+         shared_ptr<SharedObjectUpdate> update = GetSharedObjectUpdate(object.get(), m_dwUserId,
+                  (m_flags & CSF_SYNC_OBJECT_COMMENTS) != 0, (m_flags & CSF_COMPRESSION_ENABLED) != 0);
+         sendRawMessage(update->message);
       }
       else
       {
+         response.deleteAllFields();
          response.setField(VID_OBJECT_ID, idList[i]);
          response.setField(VID_IS_DELETED, true);
+         sendMessage(response);
       }
-      sendMessage(response);
    }
 
    uint32_t elapsedTime = static_cast<uint32_t>(GetCurrentTimeMs() - startTime);
@@ -3386,8 +3381,19 @@ void ClientSession::sendObjectUpdates()
  */
 void ClientSession::onObjectChange(const shared_ptr<NetObj>& object)
 {
-   if (((m_flags & CSF_OBJECT_SYNC_FINISHED) > 0) && isAuthenticated() && isSubscribedTo(NXC_CHANNEL_OBJECTS) &&
-      (object->isDeleted() || object->checkAccessRights(m_dwUserId, OBJECT_ACCESS_READ)))
+   if (((m_flags & CSF_OBJECT_SYNC_FINISHED) == 0) || !isAuthenticated() || !isSubscribedTo(NXC_CHANNEL_OBJECTS))
+      return;
+
+   if (!object->isDeleted())
+   {
+      m_subscriptionLock.lock();
+      shared_ptr<ObjectUpdateFilter> filter = m_objectUpdateFilter;
+      m_subscriptionLock.unlock();
+      if ((filter != nullptr) && !filter->match(*object))
+         return;
+   }
+
+   if (object->isDeleted() || object->checkAccessRights(m_dwUserId, OBJECT_ACCESS_READ))
    {
       m_pendingObjectNotificationsLock.lock();
       m_pendingObjectNotifications->put(object->getId());
@@ -3450,7 +3456,9 @@ void ClientSession::modifyObject(const NXCPMessage& request)
    {
       if (object->checkAccessRights(m_dwUserId, OBJECT_ACCESS_MODIFY))
       {
-         json_t *oldValue = object->toJson();
+         // Object modification cannot change data collection configuration, so it is recorded only if full snapshots are requested
+         bool fullSnapshot = ConfigReadBoolean(_T("AuditLog.FullObjectSnapshots"), false);
+         json_t *oldValue = ObjectToJson(object.get(), fullSnapshot);
 
          // If user attempts to change object's ACL, check
          // if he has OBJECT_ACCESS_ACL permission
@@ -3487,7 +3495,7 @@ void ClientSession::modifyObject(const NXCPMessage& request)
 
 			if (rcc == RCC_SUCCESS)
 			{
-			   json_t *newValue = object->toJson();
+			   json_t *newValue = ObjectToJson(object.get(), fullSnapshot);
 			   writeAuditLogWithValues(AUDIT_OBJECTS, true, dwObjectId, oldValue, newValue, _T("Object %s modified from client"), object->getName());
 	         json_decref(newValue);
 			}
@@ -4017,6 +4025,15 @@ void ClientSession::closeNodeDCIList(const NXCPMessage& request)
    sendMessage(&msg);
 }
 
+/**
+ * Get JSON representation of data collection object for audit log
+ */
+static json_t *DCObjectToJson(const DataCollectionOwner& owner, uint32_t dcObjectId)
+{
+   shared_ptr<DCObject> dcObject = owner.getDCObjectById(dcObjectId, 0);
+   return (dcObject != nullptr) ? dcObject->toJson() : nullptr;
+}
+
 /**
  * Create, modify, or delete data collection item for node
  */
@@ -4035,7 +4052,9 @@ void ClientSession::modifyNodeDCI(const NXCPMessage& request)
          {
             bool success = false;
 
-            json_t *oldValue = object->toJson();
+            // Unless full snapshots are requested, only modified data collection object is recorded in audit log
+            bool fullSnapshot = ConfigReadBoolean(_T("AuditLog.FullObjectSnapshots"), false);
+            json_t *oldValue = fullSnapshot ? ObjectToJson(object.get(), true) : nullptr;
 
             uint32_t itemId;
             int dcObjectType = request.getFieldAsInt16(VID_DCOBJECT_TYPE);
@@ -4089,6 +4108,8 @@ void ClientSession::modifyNodeDCI(const NXCPMessage& request)
                   else
                   {
                      success = true;
+                     if (!fullSnapshot)
+                        oldValue = DCObjectToJson(static_cast<DataCollectionOwner&>(*object), itemId);
                   }
 
                   // Update existing
@@ -4126,6 +4147,8 @@ void ClientSession::modifyNodeDCI(const NXCPMessage& request)
                   break;
                case CMD_DELETE_NODE_DCI:
                   itemId = request.getFieldAsUInt32(VID_DCI_ID);
+                  if (!fullSnapshot)
+                     oldValue = DCObjectToJson(static_cast<DataCollectionOwner&>(*object), itemId);
                   success = static_cast<DataCollectionOwner&>(*object).deleteDCObject(itemId, true, m_dwUserId);
                   response.setField(VID_RCC, success ? RCC_SUCCESS : RCC_INVALID_DCI_ID);
                   break;
@@ -4136,8 +4159,14 @@ void ClientSession::modifyNodeDCI(const NXCPMessage& request)
                   static_cast<DataCollectionOwner&>(*object).setDCIModificationFlag();
                else
                   static_cast<DataCollectionOwner&>(*object).applyDCIChanges(true);
-               json_t *newValue = object->toJson();
-               writeAuditLogWithValues(AUDIT_OBJECTS, true, dwObjectId, oldValue, newValue, _T("Data collection configuration changed for object %s"), object->getName());
+               json_t *newValue;
+               if (fullSnapshot)
+                  newValue = ObjectToJson(object.get(), true);
+               else if (request.getCode() == CMD_MODIFY_NODE_DCI)
+                  newValue = DCObjectToJson(static_cast<DataCollectionOwner&>(*object), itemId);
+               else
+                  newValue = nullptr;
+               writeAuditLogWithValues(AUDIT_OBJECTS, true, dwObjectId, oldValue, newValue, _T("Data collection configuration changed for object %s (DCI %u)"), object->getName(), itemId);
                json_decref(newValue);
             }
             json_decref(oldValue);
@@ -4725,6 +4754,15 @@ static void ProcessDataSelectResults(DB_UNBUFFERED_RESULT hResult, ClientSession
    TCHAR textBuffer[MAX_DCI_STRING_VALUE];
 #endif
 
+   // Only requested column (and instance columns) should be decoded from table values
+   unique_ptr<TableValueDecoder> tableDecoder;
+   StringList tableColumns;
+   if (dci->getType() == DCO_TYPE_TABLE)
+   {
+      tableDecoder = make_unique<TableValueDecoder>(*dci);
+      tableColumns.add(dataColumn);
+   }
+
    // Fill memory block with records
    auto currRow = (DCI_DATA_ROW *)(((char *)pData) + sizeof(DCI_DATA_HEADER));
    while(DBFetch(hResult))
@@ -4820,7 +4858,7 @@ static void ProcessDataSelectResults(DB_UNBUFFERED_RESULT hResult, ClientSession
          char *encodedTable = DBGetFieldUTF8(hResult, 1, nullptr, 0);
          if (encodedTable != nullptr)
          {
-            Table *table = Table::createFromPackedXML(encodedTable);
+            Table *table = tableDecoder->decode(encodedTable, &tableColumns);
             if (table != nullptr)
             {
                int row = table->findRowByInstance(instance);
@@ -4879,15 +4917,16 @@ static void ProcessDataSelectResults(DB_UNBUFFERED_RESULT hResult, ClientSession
 /**
  * Process results from SELECT statement for table DCI data with full tables as result
  */
-static void ProcessTableDataSelectResults(DB_UNBUFFERED_RESULT hResult, ClientSession *session, uint32_t requestId)
+static void ProcessTableDataSelectResults(DB_UNBUFFERED_RESULT hResult, ClientSession *session, uint32_t requestId, const DCObject& dci)
 {
+   TableValueDecoder decoder(dci);
    NXCPMessage msg(CMD_DCI_DATA, requestId);
    while(DBFetch(hResult))
    {
       char *encodedTable = DBGetFieldUTF8(hResult, 1, nullptr, 0);
       if (encodedTable != nullptr)
       {
-         Table *table = Table::createFromPackedXML(encodedTable);
+         Table *table = decoder.decode(encodedTable);
          if (table != nullptr)
          {
             msg.setField(VID_TIMESTAMP, DBGetFieldULong(hResult, 0));
@@ -5123,7 +5162,7 @@ bool ClientSession::getCollectedDataFromDB(const NXCPMessage& request, NXCPMessa
 			sendMessage(response);
 
 			if (historicalDataType == HDT_FULL_TABLE)
-            ProcessTableDataSelectResults(hResult, this, request.getId());
+            ProcessTableDataSelectResults(hResult, this, request.getId(), *dci);
 			else
 			   ProcessDataSelectResults(hResult, this, request.getId(), dci, historicalDataType, dataColumn, instance);
 
@@ -5938,7 +5977,7 @@ void ClientSession::createObject(const NXCPMessage& request)
                   // If creation was successful do binding and set comments if needed
                   if (object != nullptr)
                   {
-                     json_t *objData = object->toJson();
+                     json_t *objData = ObjectToJson(object.get(), true);
                      WriteAuditLogWithJsonValues(AUDIT_OBJECTS, true, m_dwUserId, m_workstation, m_id, object->getId(), nullptr, objData,
                         _T("Object %s created (class %s)"), object->getName(), object->getObjectClassName());
                      json_decref(objData);
@@ -8630,6 +8669,26 @@ void ClientSession::changeSubscription(const NXCPMessage& request)
    sendMessage(&msg);
 }
 
+/**
+ * Set filter for object change notifications. Empty filter removes existing one.
+ */
+void ClientSession::setObjectUpdateFilter(const NXCPMessage& request)
+{
+   NXCPMessage msg(CMD_REQUEST_COMPLETED, request.getId());
+
+   auto filter = make_shared<ObjectUpdateFilter>(request);
+   m_subscriptionLock.lock();
+   if (filter->isEmpty())
+      m_objectUpdateFilter.reset();
+   else
+      m_objectUpdateFilter = filter;
+   m_subscriptionLock.unlock();
+   debugPrintf(5, _T("Object update filter %s"), filter->isEmpty() ? _T("removed") : _T("set"));
+
+   msg.setField(VID_RCC, RCC_SUCCESS);
+   sendMessage(&msg);
+}
+
 /**
  * Callback for counting DCIs in the system
  */
@@ -137,16 +137,16 @@ bool Subnet::saveToDatabase(DB_HANDLE hdb)
    if (success && (m_modified & MODIFY_RELATIONS))
    {
       success = executeQueryOnObject(hdb, _T("DELETE FROM nsmap WHERE subnet_id=?"));
-      readLockChildList();
-      if (success && !getChildList().isEmpty())
+      shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+      if (success && !childList->isEmpty())
       {
-         DB_STATEMENT hStmt = DBPrepare(hdb,  _T("INSERT INTO nsmap (subnet_id,node_id) VALUES (?,?)"), getChildList().size() > 1);
+         DB_STATEMENT hStmt = DBPrepare(hdb,  _T("INSERT INTO nsmap (subnet_id,node_id) VALUES (?,?)"), childList->size() > 1);
          if (hStmt != nullptr)
          {
             DBBind(hStmt, 1, DB_SQLTYPE_INTEGER, m_id);
-            for(int i = 0; success && (i < getChildList().size()); i++)
+            for(int i = 0; success && (i < childList->size()); i++)
             {
-               DBBind(hStmt, 2, DB_SQLTYPE_INTEGER, getChildList().get(i)->getId());
+               DBBind(hStmt, 2, DB_SQLTYPE_INTEGER, childList->get(i)->getId());
                success = DBExecute(hStmt);
             }
             DBFreeStatement(hStmt);
@@ -156,7 +156,6 @@ bool Subnet::saveToDatabase(DB_HANDLE hdb)
             success = false;
          }
       }
-      unlockChildList();
    }
 
    return success;
@@ -233,10 +232,10 @@ MacAddress Subnet::findMacAddress(const InetAddress& ipAddr)
    nxlog_debug_tag(DEBUG_TAG_TOPO_ARP, 6, _T("Subnet[%s]::findMacAddress: searching for IP address %s"), m_name, ipAddr.toString(buffer));
 
    SharedObjectArray<Node> nodes(256, 256);
-   readLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
    {
-      shared_ptr<NetObj> o = getChildList().getShared(i);
+      shared_ptr<NetObj> o = childList->getShared(i);
       if ((o->getObjectClass() == OBJECT_NODE) &&
           (o->getStatus() != STATUS_UNMANAGED) &&
           (static_cast<Node*>(o.get())->isNativeAgent() || static_cast<Node*>(o.get())->isSNMPSupported()))
@@ -244,7 +243,6 @@ MacAddress Subnet::findMacAddress(const InetAddress& ipAddr)
          nodes.add(static_pointer_cast<Node>(o));
       }
    }
-   unlockChildList();
 
    bool success = false;
    MacAddress macAddr(MacAddress::ZERO);
@@ -93,7 +93,7 @@ void ShowSyncerStats(ServerConsole *console)
  */
 static void SaveObject(NetObj *object)
 {
-   DB_HANDLE hdb = DBConnectionPoolAcquireConnection();
+   DB_HANDLE hdb = DBConnectionPoolAcquireConnectionEx(DBConnectionPoolClass::BACKGROUND);
    DBBegin(hdb);
    if (object->saveToDatabase(hdb))
    {
@@ -133,6 +133,7 @@ void SaveObjects(DB_HANDLE hdb, UINT32 watchdogId, bool saveRuntimeData)
 
             // Remove object from global object index by ID
             g_idxObjectById.remove(object->getId());
+            RemoveSharedObjectUpdates(object->getId());
          }
          else
          {
@@ -208,7 +209,7 @@ void Syncer()
       if ((g_flags & (AF_DB_CONNECTION_LOST | AF_SERVER_INITIALIZED)) == AF_SERVER_INITIALIZED)
       {
          int64_t startTime = GetCurrentTimeMs();
-         DB_HANDLE hdb = DBConnectionPoolAcquireConnection();
+         DB_HANDLE hdb = DBConnectionPoolAcquireConnectionEx(DBConnectionPoolClass::BACKGROUND);
          SaveObjects(hdb, watchdogId, false);
          nxlog_debug_tag(DEBUG_TAG_SYNC, 5, _T("Saving user database"));
          SaveUsers(hdb, watchdogId);
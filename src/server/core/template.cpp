@@ -120,16 +120,16 @@ bool Template::saveToDatabase(DB_HANDLE hdb)
    {
       // Update members list
       success = executeQueryOnObject(hdb, _T("DELETE FROM dct_node_map WHERE template_id=?"));
-      readLockChildList();
-      if (success && !getChildList().isEmpty())
+      shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+      if (success && !childList->isEmpty())
       {
-         DB_STATEMENT hStmt = DBPrepare(hdb, _T("INSERT INTO dct_node_map (template_id,node_id) VALUES (?,?)"), getChildList().size() > 1);
+         DB_STATEMENT hStmt = DBPrepare(hdb, _T("INSERT INTO dct_node_map (template_id,node_id) VALUES (?,?)"), childList->size() > 1);
          if (hStmt != nullptr)
          {
             DBBind(hStmt, 1, DB_SQLTYPE_INTEGER, m_id);
-            for(int i = 0; success && (i < getChildList().size()); i++)
+            for(int i = 0; success && (i < childList->size()); i++)
             {
-               DBBind(hStmt, 2, DB_SQLTYPE_INTEGER, getChildList().get(i)->getId());
+               DBBind(hStmt, 2, DB_SQLTYPE_INTEGER, childList->get(i)->getId());
                success = DBExecute(hStmt);
             }
             DBFreeStatement(hStmt);
@@ -139,7 +139,6 @@ bool Template::saveToDatabase(DB_HANDLE hdb)
             success = false;
          }
       }
-      unlockChildList();
    }
 
    if (success && (m_modified & MODIFY_OTHER))
@@ -254,6 +253,7 @@ bool Template::loadFromDatabase(DB_HANDLE hdb, UINT32 id)
       if (hResult != nullptr)
       {
          int count = DBGetNumRows(hResult);
+         SharedObjectArray<NetObj> targets(count, 64);
          for(int i = 0; i < count; i++)
          {
             uint32_t objectId = DBGetFieldULong(hResult, i, 0);
@@ -262,8 +262,7 @@ bool Template::loadFromDatabase(DB_HANDLE hdb, UINT32 id)
             {
                if (object->isDataCollectionTarget())
                {
-                  addChild(object);
-                  object->addParent(self());
+                  targets.add(object);
                }
                else
                {
@@ -279,6 +278,7 @@ bool Template::loadFromDatabase(DB_HANDLE hdb, UINT32 id)
             }
          }
          DBFreeResult(hResult);
+         linkChildObjects(targets);
       }
    }
 
@@ -506,10 +506,10 @@ void Template::onDataCollectionChange()
  */
 void Template::prepareForDeletion()
 {
-   readLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
    {
-      NetObj *object = getChildList().get(i);
+      NetObj *object = childList->get(i);
       if (object->isDataCollectionTarget())
          queueRemoveFromTarget(object->getId(), true);
       if (object->getObjectClass() == OBJECT_NODE)
@@ -517,7 +517,6 @@ void Template::prepareForDeletion()
          removeAllPolicies(static_cast<Node*>(object));
       }
    }
-   unlockChildList();
    super::prepareForDeletion();
 }
 
@@ -705,10 +704,10 @@ bool Template::removePolicy(const uuid& guid)
 
    if (policy != nullptr)
    {
-      readLockChildList();
-      for(int i = 0; i < getChildList().size(); i++)
+      shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+      for(int i = 0; i < childList->size(); i++)
       {
-         shared_ptr<NetObj> object = getChildList().getShared(i);
+         shared_ptr<NetObj> object = childList->getShared(i);
          if (object->getObjectClass() == OBJECT_NODE)
          {
             auto data = make_shared<AgentPolicyRemovalData>(static_pointer_cast<Node>(object), policy->getGuid(), policy->getType(), static_cast<Node*>(object.get())->isNewPolicyTypeFormatSupported());
@@ -718,7 +717,6 @@ bool Template::removePolicy(const uuid& guid)
             ThreadPoolExecute(g_pollerThreadPool, RemoveAgentPolicy, data);
          }
       }
-      unlockChildList();
 
       updateVersion();
 
@@ -736,10 +734,10 @@ bool Template::removePolicy(const uuid& guid)
  */
 void Template::applyPolicyChanges()
 {
-   readLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
    {
-      NetObj *object = getChildList().get(i);
+      NetObj *object = childList->get(i);
       if (object->getObjectClass() == OBJECT_NODE)
       {
          AgentPolicyInfo *ap;
@@ -749,13 +747,12 @@ void Template::applyPolicyChanges()
             UINT32 rcc = conn->getPolicyInventory(&ap);
             if (rcc == RCC_SUCCESS)
             {
-               checkPolicyDeployment(static_pointer_cast<Node>(getChildList().getShared(i)), ap);
+               checkPolicyDeployment(static_pointer_cast<Node>(childList->getShared(i)), ap);
                delete ap;
             }
          }
       }
    }
-   unlockChildList();
 }
 
 /**
@@ -764,16 +761,15 @@ void Template::applyPolicyChanges()
 void Template::forceApplyPolicyChanges()
 {
    SharedObjectArray<Node> nodes(64, 64);
-   readLockChildList();
-   for(int i = 0; i < getChildList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
    {
-      NetObj *object = getChildList().get(i);
+      NetObj *object = childList->get(i);
       if (object->getObjectClass() == OBJECT_NODE)
       {
-         nodes.add(static_pointer_cast<Node>(getChildList().getShared(i)));
+         nodes.add(static_pointer_cast<Node>(childList->getShared(i)));
       }
    }
-   unlockChildList();
 
    if (!nodes.isEmpty())
    {
@@ -932,6 +928,7 @@ void Template::autobindPoll(PollerInfo *poller, ClientSession *session, uint32_t
    filterData.processSensors = ConfigReadBoolean(_T("Objects.Sensors.TemplateAutoApply"), false);
 
    NXSL_VM *cachedFilterVM = nullptr;
+   SharedObjectArray<NetObj> newTargets(0, 64);
    unique_ptr<SharedObjectArray<NetObj>> objects = g_idxObjectById.getObjects(AutoBindObjectFilter, &filterData);
    for (int i = 0; i < objects->size(); i++)
    {
@@ -947,12 +944,7 @@ void Template::autobindPoll(PollerInfo *poller, ClientSession *session, uint32_t
          _sntprintf(key, 50, _T("Delete.Template.%u.NetObj.%u"), m_id, object->getId());
          DeleteScheduledTaskByKey(key);
          if (!isDirectChild(object->getId()))
-         {
-            sendPollerMsg(_T("   Applying to %s\r\n"), object->getName());
-            nxlog_debug_tag(DEBUG_TAG_AUTOBIND_POLL, 4, _T("Template::autobindPoll(): binding object \"%s\" [%u] to template \"%s\" [%u]"), object->getName(), object->getId(), m_name, m_id);
-            applyToTarget(static_pointer_cast<DataCollectionTarget>(object));
-            PostSystemEvent(EVENT_TEMPLATE_AUTOAPPLY, g_dwMgmtNode, "isis", object->getId(), object->getName(), m_id, m_name);
-         }
+            newTargets.add(object);
       }
       else if ((decision == AutoBindDecision_Unbind) && isDirectChild(object->getId()))
       {
@@ -973,6 +965,17 @@ void Template::autobindPoll(PollerInfo *poller, ClientSession *session, uint32_t
    }
    delete cachedFilterVM;
 
+   // Link all new targets at once, so applying template to many objects does not copy child list for each of them
+   linkChildObjects(newTargets);
+   for(int i = 0; i < newTargets.size(); i++)
+   {
+      NetObj *object = newTargets.get(i);
+      sendPollerMsg(_T("   Applying to %s\r\n"), object->getName());
+      nxlog_debug_tag(DEBUG_TAG_AUTOBIND_POLL, 4, _T("Template::autobindPoll(): binding object \"%s\" [%u] to template \"%s\" [%u]"), object->getName(), object->getId(), m_name, m_id);
+      applyToTarget(static_pointer_cast<DataCollectionTarget>(newTargets.getShared(i)));
+      PostSystemEvent(EVENT_TEMPLATE_AUTOAPPLY, g_dwMgmtNode, "isis", object->getId(), object->getName(), m_id, m_name);
+   }
+
    pollerUnlock();
    nxlog_debug_tag(DEBUG_TAG_AUTOBIND_POLL, 5, _T("Finished autobind poll of template %s [%u])"), m_name, m_id);
 }
@@ -27,6 +27,8 @@
 
 #define REQUEST_TIMEOUT 10000
 
+#define WRITE_BUFFER_SIZE  65536
+
 #define DEBUG_TAG       _T("agent.tunnel")
 
 /**
@@ -89,6 +91,13 @@ static ObjectArray<BackgroundSocketPollerHandle> s_pollers(64, 64, Ownership::Tr
 static uint32_t s_maxTunnelsPerPoller = MIN(SOCKET_POLLER_MAX_SOCKETS - 1, 256);
 static Mutex s_pollerListLock(MutexType::FAST);
 
+/**
+ * Outbound queue limits. Channel data senders are blocked when queue size exceeds soft limit,
+ * control messages are rejected only when queue size exceeds hard limit.
+ */
+static size_t s_outboundQueueSoftLimit = 4 * 1024 * 1024;
+static size_t s_outboundQueueHardLimit = 16 * 1024 * 1024;
+
 /**
  * Execute tunnel establishing hook script in the separate thread
  */
@@ -328,7 +337,9 @@ static VolatileCounter s_nextTunnelId = 0;
  */
 AgentTunnel::AgentTunnel(SSL_CTX *context, SSL *ssl, SOCKET sock, const InetAddress& addr,
          uint32_t nodeId, int32_t zoneUIN, const TCHAR *certificateSubject, const TCHAR *certificateIssuer,
-         time_t certificateExpirationTime, time_t certificateIssueTime, BackgroundSocketPollerHandle *socketPoller) : m_channelLock(MutexType::FAST)
+         time_t certificateExpirationTime, time_t certificateIssueTime, BackgroundSocketPollerHandle *socketPoller) :
+         m_outboundLock(MutexType::FAST), m_controlQueue(64, Ownership::True), m_channelQueue(64, Ownership::True),
+         m_outboundSpaceCondition(true), m_channelLock(MutexType::FAST)
 {
    m_id = InterlockedIncrement(&s_nextTunnelId);
    m_address = addr;
@@ -338,6 +349,8 @@ AgentTunnel::AgentTunnel(SSL_CTX *context, SSL *ssl, SOCKET sock, const InetAddr
    _sntprintf(m_threadPoolKey, 12, _T("TN%u"), m_id);
    m_context = context;
    m_ssl = ssl;
+   m_outboundBytes = 0;
+   m_writerActive = false;
    m_requestId = 0;
    m_nodeId = nodeId;
    m_zoneUIN = zoneUIN;
@@ -494,7 +507,7 @@ void AgentTunnel::processMessage(NXCPMessage *msg)
  */
 void AgentTunnel::finalize()
 {
-   m_state = AGENT_TUNNEL_SHUTDOWN;
+   setShutdownState();
    UnregisterTunnel(this);
 
    // shutdown all channels
@@ -509,6 +522,8 @@ void AgentTunnel::finalize()
    m_channels.clear();
    m_channelLock.unlock();
 
+   clearOutboundQueue();
+
    debugPrintf(4, _T("Tunnel closure completed"));
 }
 
@@ -533,13 +548,12 @@ void AgentTunnel::socketPollerCallback(BackgroundSocketPollResult pollResult, SO
 }
 
 /**
- * Write to SSL
+ * Write to SSL. Should be called only from outbound queue processor.
  */
 int AgentTunnel::sslWrite(const void *data, size_t size)
 {
    bool canRetry;
    int bytes;
-   m_writeLock.lock();
    do
    {
       canRetry = false;
@@ -567,27 +581,153 @@ int AgentTunnel::sslWrite(const void *data, size_t size)
       m_sslLock.unlock();
    }
    while(canRetry);
-   m_writeLock.unlock();
    return bytes;
 }
 
 /**
- * Send message on tunnel
+ * Put serialized message into outbound queue and start queue processor if needed. Takes ownership of message.
  */
-bool AgentTunnel::sendMessage(const NXCPMessage& msg)
+bool AgentTunnel::enqueueMessage(NXCP_MESSAGE *msg, bool channelData)
 {
-   if (m_state == AGENT_TUNNEL_SHUTDOWN)
+   size_t size = ntohl(msg->size);
+
+   m_outboundLock.lock();
+   bool shutdown = (m_state == AGENT_TUNNEL_SHUTDOWN);
+   if (shutdown || (m_outboundBytes + size > s_outboundQueueHardLimit))
+   {
+      size_t queueSize = m_outboundBytes;
+      m_outboundLock.unlock();
+      if (!shutdown)
+         debugPrintf(5, _T("Outbound queue limit reached (%u bytes queued), message discarded"), static_cast<uint32_t>(queueSize));
+      MemFree(msg);
       return false;
+   }
+
+   if (channelData)
+      m_channelQueue.put(msg);
+   else
+      m_controlQueue.put(msg);
+   m_outboundBytes += size;
+
+   bool startWriter = !m_writerActive;
+   m_writerActive = true;
+   m_outboundLock.unlock();
+
+   if (startWriter)
+      ThreadPoolExecute(g_agentConnectionThreadPool, self(), &AgentTunnel::processOutboundQueue);
+   return true;
+}
+
+/**
+ * Process outbound queue. Messages are coalesced into larger writes to reduce number of TLS records,
+ * control and channel queues are served in round-robin order so bulk channel transfer cannot delay
+ * control messages for long.
+ */
+void AgentTunnel::processOutboundQueue()
+{
+   BYTE *buffer = MemAllocArrayNoInit<BYTE>(WRITE_BUFFER_SIZE);
+   size_t pending = 0;
+   bool channelTurn = false;
+   bool success = true;
+   while(true)
+   {
+      m_outboundLock.lock();
+      Queue *first = channelTurn ? &m_channelQueue : &m_controlQueue;
+      Queue *second = channelTurn ? &m_controlQueue : &m_channelQueue;
+      auto msg = static_cast<NXCP_MESSAGE*>(first->get());
+      if (msg == nullptr)
+         msg = static_cast<NXCP_MESSAGE*>(second->get());
+      channelTurn = !channelTurn;
+
+      if (msg == nullptr)
+      {
+         if (pending == 0)
+         {
+            m_writerActive = false;
+            m_outboundLock.unlock();
+            break;
+         }
+         m_outboundLock.unlock();
+
+         // Queue is empty, send what was collected so far
+         success = (sslWrite(buffer, pending) == static_cast<int>(pending));
+         pending = 0;
+         if (!success)
+            break;
+         continue;
+      }
+
+      size_t size = ntohl(msg->size);
+      m_outboundBytes -= size;
+      if (m_outboundBytes < s_outboundQueueSoftLimit)
+         m_outboundSpaceCondition.set();
+      m_outboundLock.unlock();
+
+      if ((pending > 0) && (pending + size > WRITE_BUFFER_SIZE))
+      {
+         success = (sslWrite(buffer, pending) == static_cast<int>(pending));
+         pending = 0;
+      }
+
+      if (success)
+      {
+         if (size > WRITE_BUFFER_SIZE)
+         {
+            success = (sslWrite(msg, size) == static_cast<int>(size));
+         }
+         else
+         {
+            memcpy(&buffer[pending], msg, size);
+            pending += size;
+         }
+      }
+      MemFree(msg);
+
+      if (!success)
+         break;
+   }
+   MemFree(buffer);
+
+   if (!success)
+   {
+      // Partially written TLS record cannot be recovered, so tunnel should be closed
+      debugPrintf(4, _T("Write to TLS connection failed, shutting down tunnel"));
+      shutdown();
+      clearOutboundQueue();
+
+      // Tunnel is in shutdown state now, so new writer will not be started
+      m_outboundLock.lock();
+      m_writerActive = false;
+      m_outboundLock.unlock();
+   }
+}
 
+/**
+ * Discard all messages in outbound queue. Writer activity flag is managed by writer itself, because
+ * writer may still be running (for example, blocked in TLS write) when queue is cleared.
+ */
+void AgentTunnel::clearOutboundQueue()
+{
+   m_outboundLock.lock();
+   m_controlQueue.clear();
+   m_channelQueue.clear();
+   m_outboundBytes = 0;
+   m_outboundLock.unlock();
+   m_outboundSpaceCondition.set();
+}
+
+/**
+ * Send message on tunnel. Message is placed into outbound queue and will be sent asynchronously.
+ */
+bool AgentTunnel::sendMessage(const NXCPMessage& msg)
+{
    if (nxlog_get_debug_level_tag(DEBUG_TAG) >= 6)
    {
       TCHAR buffer[64];
       debugPrintf(6, _T("Sending message %s (%u)"), NXCPMessageCodeName(msg.getCode(), buffer), msg.getId());
    }
-   NXCP_MESSAGE *data = msg.serialize(true);
-   bool success = (sslWrite(data, ntohl(data->size)) == static_cast<int>(ntohl(data->size)));
-   MemFree(data);
-   return success;
+   // Channel close notification should go after all data already queued for that channel
+   return enqueueMessage(msg.serialize(true), msg.getCode() == CMD_CLOSE_CHANNEL);
 }
 
 /**
@@ -607,10 +747,21 @@ void AgentTunnel::shutdown()
 {
    if (m_socket != INVALID_SOCKET)
       ::shutdown(m_socket, SHUT_RDWR);
-   m_state = AGENT_TUNNEL_SHUTDOWN;
+   setShutdownState();
    debugPrintf(4, _T("Tunnel shutdown"));
 }
 
+/**
+ * Set tunnel state to "shutdown". State is changed under outbound queue lock, so no messages
+ * can be added to outbound queue after that.
+ */
+void AgentTunnel::setShutdownState()
+{
+   m_outboundLock.lock();
+   m_state = AGENT_TUNNEL_SHUTDOWN;
+   m_outboundLock.unlock();
+}
+
 /**
  * Background certificate renewal
  */
@@ -1023,12 +1174,27 @@ void AgentTunnel::closeChannel(AgentTunnelCommChannel *channel)
  */
 ssize_t AgentTunnel::sendChannelData(uint32_t id, const void *data, size_t len)
 {
+   // Wait for outbound queue to drain below soft limit
+   int64_t startTime = GetCurrentTimeMs();
+   while(true)
+   {
+      if (m_state == AGENT_TUNNEL_SHUTDOWN)
+         return -1;
+
+      m_outboundSpaceCondition.reset();
+      if (getOutboundQueueSize() < s_outboundQueueSoftLimit)
+         break;
+
+      if (GetCurrentTimeMs() - startTime > REQUEST_TIMEOUT)
+      {
+         debugPrintf(5, _T("sendChannelData: timeout waiting for outbound queue space (channel %u)"), id);
+         return -1;
+      }
+      m_outboundSpaceCondition.wait(100);
+   }
+
    NXCP_MESSAGE *msg = CreateRawNXCPMessage(CMD_CHANNEL_DATA, id, 0, data, len, nullptr, false);
-   ssize_t rc = sslWrite(msg, ntohl(msg->size));
-   if (rc == static_cast<ssize_t>(ntohl(msg->size)))
-      rc = len;  // adjust number of bytes to exclude tunnel overhead
-   MemFree(msg);
-   return rc;
+   return enqueueMessage(msg, true) ? static_cast<ssize_t>(len) : -1;  // number of bytes excludes tunnel overhead
 }
 
 /**
@@ -1786,6 +1952,11 @@ void TunnelListenerThread()
    if (s_maxTunnelsPerPoller > SOCKET_POLLER_MAX_SOCKETS - 1)
       s_maxTunnelsPerPoller = SOCKET_POLLER_MAX_SOCKETS - 1;
 
+   s_outboundQueueSoftLimit = static_cast<size_t>(ConfigReadULong(_T("AgentTunnels.OutboundQueueSize"), 4096)) * 1024;
+   if (s_outboundQueueSoftLimit < WRITE_BUFFER_SIZE)
+      s_outboundQueueSoftLimit = WRITE_BUFFER_SIZE;
+   s_outboundQueueHardLimit = s_outboundQueueSoftLimit * 4;
+
    s_tunnelListenerLock.lock();
    uint16_t listenPort = static_cast<uint16_t>(ConfigReadULong(_T("AgentTunnels.ListenPort"), 4703));
    TunnelListener listener(listenPort);
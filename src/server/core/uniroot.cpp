@@ -54,17 +54,19 @@ void UniversalRoot::linkObjects()
    if (hResult != nullptr)
    {
       int count = DBGetNumRows(hResult);
+      SharedObjectArray<NetObj> children(count, 64);
       for(int i = 0; i < count; i++)
       {
          uint32_t objectId = DBGetFieldULong(hResult, i, 0);
          shared_ptr<NetObj> object = FindObjectById(objectId);
          if (object != nullptr)
-            linkObject(object);
+            children.add(object);
          else
             nxlog_write(NXLOG_ERROR, _T("Inconsistent database: %s object %s [%u] has reference to non-existent child object [%u]"),
                      getObjectClassName(), m_name, m_id, objectId);
       }
       DBFreeResult(hResult);
+      linkChildObjects(children);
    }
 
    DBConnectionPoolReleaseConnection(hdb);
@@ -81,16 +83,16 @@ bool UniversalRoot::saveToDatabase(DB_HANDLE hdb)
    if (success && (m_modified & MODIFY_RELATIONS))
    {
       success = executeQueryOnObject(hdb, _T("DELETE FROM container_members WHERE container_id=?"));
-      readLockChildList();
-      if (success && !getChildList().isEmpty())
+      shared_ptr<const SharedObjectArray<NetObj>> childList = getChildList();
+      if (success && !childList->isEmpty())
       {
          DB_STATEMENT hStmt = DBPrepare(hdb, _T("INSERT INTO container_members (container_id,object_id) VALUES (?,?)"));
          if (hStmt != nullptr)
          {
             DBBind(hStmt, 1, DB_SQLTYPE_INTEGER, m_id);
-            for(int i = 0; (i < getChildList().size()) && success; i++)
+            for(int i = 0; (i < childList->size()) && success; i++)
             {
-               DBBind(hStmt, 2, DB_SQLTYPE_INTEGER, getChildList().get(i)->getId());
+               DBBind(hStmt, 2, DB_SQLTYPE_INTEGER, childList->get(i)->getId());
                success = DBExecute(hStmt);
             }
             DBFreeStatement(hStmt);
@@ -100,7 +102,6 @@ bool UniversalRoot::saveToDatabase(DB_HANDLE hdb)
             success = false;
          }
       }
-      unlockChildList();
    }
    return success;
 }
@@ -193,17 +193,16 @@ bool VPNConnector::deleteFromDatabase(DB_HANDLE hdb)
 shared_ptr<Node> VPNConnector::getParentNode() const
 {
    shared_ptr<Node> pNode;
-   readLockParentList();
-   for(int i = 0; i < getParentList().size(); i++)
+   shared_ptr<const SharedObjectArray<NetObj>> parentList = getParentList();
+   for(int i = 0; i < parentList->size(); i++)
    {
-      NetObj *object = getParentList().get(i);
+      NetObj *object = parentList->get(i);
       if (object->getObjectClass() == OBJECT_NODE)
       {
-         pNode = static_pointer_cast<Node>(getParentList().getShared(i));
+         pNode = static_pointer_cast<Node>(parentList->getShared(i));
          break;
       }
    }
-   unlockParentList();
    return pNode;
 }
 
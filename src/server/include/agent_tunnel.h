@@ -105,7 +105,12 @@ class AgentTunnel
    SSL_CTX *m_context;
    SSL *m_ssl;
    Mutex m_sslLock;
-   Mutex m_writeLock;
+   Mutex m_outboundLock;
+   Queue m_controlQueue;      // Serialized control messages waiting for transmission
+   Queue m_channelQueue;      // Serialized channel data messages waiting for transmission
+   size_t m_outboundBytes;    // Total size of all messages in outbound queues
+   bool m_writerActive;
+   Condition m_outboundSpaceCondition;
    MsgWaitQueue m_queue;
    VolatileCounter m_requestId;
    uint32_t m_nodeId;
@@ -147,6 +152,10 @@ class AgentTunnel
    static void socketPollerCallback(BackgroundSocketPollResult pollResult, SOCKET hSocket, AgentTunnel *tunnel);
    
    int sslWrite(const void *data, size_t size);
+   bool enqueueMessage(NXCP_MESSAGE *msg, bool channelData);
+   void processOutboundQueue();
+   void clearOutboundQueue();
+   void setShutdownState();
    bool sendMessage(const NXCPMessage& msg);
    NXCPMessage *waitForMessage(uint16_t code, uint32_t id) { return m_queue.waitForMessage(code, id, g_agentCommandTimeout); }
 
@@ -200,6 +209,14 @@ class AgentTunnel
    AgentTunnelState getState() const { return m_state; }
    time_t getStartTime() const { return m_startTime; }
 
+   size_t getOutboundQueueSize()
+   {
+      m_outboundLock.lock();
+      size_t size = m_outboundBytes;
+      m_outboundLock.unlock();
+      return size;
+   }
+
    int getChannelCount()
    {
       m_channelLock.lock();
@@ -115,8 +115,8 @@ class NXCORE_EXPORTABLE Alarm
 
    void fillMessage(NXCPMessage *msg) const;
 
-   void createInDatabase();
-   void updateInDatabase();
+   bool createInDatabase(DB_HANDLE hdb);
+   bool updateInDatabase(DB_HANDLE hdb);
 
    void clearTimeout() { m_timeout = 0; }
    void onAckTimeoutExpiration() { m_ackTimeout = 0; m_state = ALARM_STATE_OUTSTANDING; }
@@ -495,6 +495,35 @@ class SyslogMessage;
  */
 struct LoginInfo;
 
+/**
+ * Object update message serialized once and shared between client sessions (immutable once created)
+ */
+struct SharedObjectUpdate
+{
+   NXCP_MESSAGE *message;
+
+   SharedObjectUpdate(NXCP_MESSAGE *m) { message = m; }
+   ~SharedObjectUpdate() { MemFree(message); }
+};
+
+/**
+ * Filter for object change notifications set by client. Object passes filter if it is one of
+ * given root objects or their child (directly or indirectly), and its class is within given class list.
+ * Empty root object or class list matches any object.
+ */
+class ObjectUpdateFilter
+{
+private:
+   IntegerArray<uint32_t> m_rootObjects;
+   IntegerArray<int32_t> m_classes;
+
+public:
+   ObjectUpdateFilter(const NXCPMessage& msg);
+
+   bool isEmpty() const { return m_rootObjects.isEmpty() && m_classes.isEmpty(); }
+   bool match(const NetObj& object) const;
+};
+
 /**
  * Client (user) session
  */
@@ -547,6 +576,7 @@ class NXCORE_EXPORTABLE ClientSession
    bool m_objectNotificationScheduled;
    uint32_t m_objectNotificationDelay;
    size_t m_objectNotificationBatchSize;
+   shared_ptr<ObjectUpdateFilter> m_objectUpdateFilter;  // Protected by subscription lock
    
 
    static void socketPollerCallback(BackgroundSocketPollResult pollResult, SOCKET hSocket, ClientSession *session);
@@ -706,6 +736,7 @@ class NXCORE_EXPORTABLE ClientSession
    void generateObjectToolId(const NXCPMessage& request);
    void execTableTool(const NXCPMessage& request);
    void changeSubscription(const NXCPMessage& request);
+   void setObjectUpdateFilter(const NXCPMessage& request);
    void sendServerStats(const NXCPMessage& request);
    void sendScriptList(const NXCPMessage& request);
    void sendScript(const NXCPMessage& request);
@@ -1008,6 +1039,25 @@ enum ThreadPoolStat
    THREAD_POOL_AVERAGE_WAIT_TIME
 };
 
+/**
+ * Database connection pool stats
+ */
+enum DBConnectionPoolStat
+{
+   DBCP_STAT_SIZE,
+   DBCP_STAT_ACQUIRED,
+   DBCP_STAT_WAITING,
+   DBCP_STAT_WAIT_COUNT,
+   DBCP_STAT_AVERAGE_WAIT_TIME,
+   DBCP_STAT_MAX_WAIT_TIME,
+   DBCP_STAT_WAIT_TIME_HISTOGRAM,
+   DBCP_STAT_AVERAGE_CONNECT_TIME,
+   DBCP_STAT_MAX_CONNECT_TIME,
+   DBCP_STAT_AVERAGE_HOLD_TIME,
+   DBCP_STAT_MAX_HOLD_TIME,
+   DBCP_STAT_HOLD_TIME_HISTOGRAM
+};
+
 /**
  * Server command execution data
  */
@@ -1314,6 +1364,9 @@ void NXCORE_EXPORTABLE NotifyClientSessions(uint32_t code, uint32_t data, const
 void NXCORE_EXPORTABLE NotifyClientSessions(const NXCPMessage& msg, const TCHAR *channel = nullptr);
 void NXCORE_EXPORTABLE NotifyClientSession(session_id_t sessionId, uint32_t code, uint32_t data);
 void NXCORE_EXPORTABLE NotifyClientSession(session_id_t sessionId, NXCPMessage *data);
+shared_ptr<SharedObjectUpdate> GetSharedObjectUpdate(NetObj *object, uint32_t userId, bool includeComments, bool allowCompression);
+void InvalidateSharedObjectUpdates(uint32_t objectId);
+void RemoveSharedObjectUpdates(uint32_t objectId);
 void NXCORE_EXPORTABLE NotifyClientsOnGraphUpdate(const NXCPMessage& msg, uint32_t graphId);
 void NotifyClientsOnPolicyUpdate(const NXCPMessage& msg, const Template& object);
 void NotifyClientsOnPolicyDelete(uuid guid, const Template& object);
@@ -1443,6 +1496,7 @@ void ShowQueueStats(CONSOLE_CTX console, int64_t size, const TCHAR *name);
 void ShowThreadPoolPendingQueue(CONSOLE_CTX console, ThreadPool *p, const TCHAR *name);
 void ShowThreadPool(CONSOLE_CTX console, const TCHAR *p);
 DataCollectionError GetThreadPoolStat(ThreadPoolStat stat, const TCHAR *param, TCHAR *value);
+DataCollectionError GetDBConnectionPoolStat(DBConnectionPoolStat stat, const TCHAR *param, TCHAR *value);
 void DumpProcess(CONSOLE_CTX console);
 
 #define GRAPH_FLAG_TEMPLATE 1
@@ -1618,6 +1672,8 @@ extern uint32_t g_agentRestartWaitTime;
 extern uint32_t g_thresholdRepeatInterval;
 extern uint32_t g_requiredPolls;
 extern uint32_t g_offlineDataRelevanceTime;
+extern bool g_tableValueBinaryFormat;
+extern uint32_t g_tableValueKeyframeInterval;
 extern int32_t g_instanceRetentionTime;
 extern uint32_t g_snmpTrapStormCountThreshold;
 extern uint32_t g_snmpTrapStormDurationThreshold;
@@ -136,6 +136,74 @@ class NXCORE_EXPORTABLE ItemValue
 class DCItem;
 class DataCollectionTarget;
 
+/**
+ * Reader for DCI state snapshot record. Data is read directly from memory mapped snapshot file,
+ * any attempt to read past the end of record sets error flag.
+ */
+class NXCORE_EXPORTABLE DCISnapshotReader
+{
+private:
+   const BYTE *m_curr;
+   const BYTE *m_end;
+   bool m_error;
+
+   bool check(size_t size)
+   {
+      if (m_error || (static_cast<size_t>(m_end - m_curr) < size))
+      {
+         m_error = true;
+         return false;
+      }
+      return true;
+   }
+
+public:
+   DCISnapshotReader(const BYTE *data, size_t size)
+   {
+      m_curr = data;
+      m_end = data + size;
+      m_error = false;
+   }
+
+   BYTE readByte()
+   {
+      if (!check(1))
+         return 0;
+      return *m_curr++;
+   }
+   uint32_t readUInt32()
+   {
+      if (!check(4))
+         return 0;
+      uint32_t v;
+      memcpy(&v, m_curr, 4);
+      m_curr += 4;
+      return LittleEndianToHost32(v);
+   }
+   int64_t readInt64()
+   {
+      if (!check(8))
+         return 0;
+      uint64_t v;
+      memcpy(&v, m_curr, 8);
+      m_curr += 8;
+      return static_cast<int64_t>(LittleEndianToHost64(v));
+   }
+   TCHAR *readString(TCHAR *buffer, size_t size);
+   const BYTE *readBytes(size_t size)
+   {
+      if (!check(size))
+         return nullptr;
+      const BYTE *p = m_curr;
+      m_curr += size;
+      return p;
+   }
+
+   bool isError() const { return m_error; }
+};
+
+void NXCORE_EXPORTABLE DCISnapshotWriteString(ByteStream *out, const TCHAR *value);
+
 /**
  * Threshold definition class
  */
@@ -200,6 +268,9 @@ class NXCORE_EXPORTABLE Threshold
    void updateBeforeMaintenanceState() { m_wasReachedBeforeMaint = m_isReached; }
    void setLastCheckedValue(const ItemValue &value) { m_lastCheckValue = value; }
 
+   void writeSnapshot(ByteStream *out) const;
+   void restoreFromSnapshot(DCISnapshotReader *reader);
+
    bool saveToDB(DB_HANDLE hdb, uint32_t index);
    ThresholdCheckResult check(ItemValue &value, ItemValue **ppPrevValues, ItemValue &fvalue, ItemValue &tvalue, shared_ptr<NetObj> target, DCItem *dci);
    ThresholdCheckResult checkError(UINT32 dwErrorCount);
@@ -529,6 +600,9 @@ class NXCORE_EXPORTABLE DCItem : public DCObject
    void updateCacheSize() { lock(); updateCacheSizeInternal(true); unlock(); }
    void reloadCache(bool forceReload);
 
+   void writeSnapshot(ByteStream *out);
+   bool restoreFromSnapshot(DCISnapshotReader *reader);
+
    int getDataType() const { return m_dataType; }
    int getNXSLDataType() const;
    int getDeltaCalculationMethod() const { return m_deltaCalculation; }
@@ -784,6 +858,9 @@ class NXCORE_EXPORTABLE DCTable : public DCObject
 	ObjectArray<DCTableColumn> *m_columns;
    ObjectArray<DCTableThreshold> *m_thresholds;
 	shared_ptr<Table> m_lastValue;
+   shared_ptr<Table> m_keyframe;    // Reference sample for delta encoding
+   time_t m_keyframeTimestamp;
+   uint32_t m_keyframeDistance;     // Number of samples since last keyframe
 
 	static TC_ID_MAP_ENTRY *m_cache;
 	static int m_cacheSize;
@@ -848,6 +925,26 @@ class NXCORE_EXPORTABLE DCTable : public DCObject
 	static INT32 columnIdFromName(const TCHAR *name);
 };
 
+/**
+ * Decoder for table DCI values read from database. Loads reference samples for delta encoded values when needed.
+ */
+class NXCORE_EXPORTABLE TableValueDecoder
+{
+private:
+   uint32_t m_dciId;
+   uint32_t m_ownerId;
+   DCObjectStorageClass m_storageClass;
+   shared_ptr<Table> m_reference;
+   time_t m_referenceTimestamp;
+
+   shared_ptr<Table> loadReference(time_t timestamp);
+
+public:
+   TableValueDecoder(const DCObject& dci) : m_dciId(dci.getId()), m_ownerId(dci.getOwnerId()), m_storageClass(dci.getStorageClass()), m_referenceTimestamp(0) { }
+
+   Table *decode(const char *encodedValue, const StringList *columns = nullptr);
+};
+
 /**
  * Callback data for after maintenance event generation
  */
@@ -944,4 +1041,12 @@ uint64_t GetDCICacheMemoryUsage();
  */
 extern SharedObjectQueue<DCObjectInfo> g_dciCacheLoaderQueue;
 
+/**
+ * DCI state snapshot
+ */
+void SaveDCISnapshot();
+bool OpenDCISnapshot();
+const BYTE *FindDCISnapshotRecord(uint32_t dciId, size_t *size);
+void CloseDCISnapshot();
+
 #endif   /* _nms_dcoll_h_ */
@@ -302,6 +302,8 @@ class EPRule
    NXSL_Program *m_filterScript;
    TCHAR *m_actionScriptSource;
    NXSL_Program *m_actionScript;
+   shared_ptr<NXSL_VMPool> m_filterScriptVMPool;
+   shared_ptr<NXSL_VMPool> m_actionScriptVMPool;
 
    TCHAR *m_alarmMessage;
    TCHAR *m_alarmImpact;
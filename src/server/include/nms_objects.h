@@ -299,6 +299,7 @@ class NXCORE_EXPORTABLE AbstractIndexBase
    size_t size() const;
    bool put(uint64_t key, void *object);
    void remove(uint64_t key);
+   void sortStartupData();
    void clear();
    void *get(uint64_t key) const;
    bool contains(uint64_t key) const { return get(key) != nullptr; }
@@ -1111,6 +1112,65 @@ class SearchQuery
    bool match(const SearchAttributeProvider &provider) const;
 };
 
+/**
+ * Tables loaded in bulk at server startup
+ */
+enum class BulkLoadTable
+{
+   OBJECT_PROPERTIES = 0,
+   CUSTOM_ATTRIBUTES = 1,
+   DASHBOARD_ASSOCIATIONS = 2,
+   OBJECT_URLS = 3,
+   TRUSTED_NODES = 4,
+   RESPONSIBLE_USERS = 5,
+   ACL = 6,
+   ITEMS = 7,
+   RAW_DCI_VALUES = 8,
+   THRESHOLDS = 9,
+   DCI_ACCESS = 10,
+   DCI_SCHEDULES = 11
+};
+
+#define BULK_LOAD_TABLE_COUNT 12
+
+/**
+ * Database rows related to single object. During server startup rows are taken from
+ * tables loaded in bulk, otherwise they are selected from database.
+ */
+class NXCORE_EXPORTABLE ObjectRows
+{
+private:
+   DB_RESULT m_hResult;
+   int m_first;
+   int m_count;
+   bool m_owner;
+
+public:
+   ObjectRows()
+   {
+      m_hResult = nullptr;
+      m_first = 0;
+      m_count = 0;
+      m_owner = false;
+   }
+   ObjectRows(const ObjectRows& src) = delete;
+   ~ObjectRows()
+   {
+      if (m_owner)
+         DBFreeResult(m_hResult);
+   }
+
+   bool select(DB_HANDLE hdb, BulkLoadTable table, uint32_t id);
+
+   DB_RESULT getResult() const { return m_hResult; }
+   int begin() const { return m_first; }
+   int end() const { return m_first + m_count; }
+   int size() const { return m_count; }
+};
+
+void BulkLoadStart(DB_HANDLE hdb, bool useConnectionPool, int threads, const TCHAR *objectQuery);
+void BulkLoadEnd();
+
 /**
  * Base class for network objects
  */
@@ -1186,8 +1246,16 @@ class NXCORE_EXPORTABLE NetObj : public NObject
 
    Pollable* m_asPollable; // Only changed in Pollable class constructor
 
-   const SharedObjectArray<NetObj> &getChildList() const { return reinterpret_cast<const SharedObjectArray<NetObj>&>(super::getChildList()); }
-   const SharedObjectArray<NetObj> &getParentList() const { return reinterpret_cast<const SharedObjectArray<NetObj>&>(super::getParentList()); }
+   shared_ptr<const SharedObjectArray<NetObj>> getChildList() const
+   {
+      shared_ptr<const SharedObjectArray<NObject>> list = super::getChildList();
+      return shared_ptr<const SharedObjectArray<NetObj>>(list, reinterpret_cast<const SharedObjectArray<NetObj>*>(list.get()));
+   }
+   shared_ptr<const SharedObjectArray<NetObj>> getParentList() const
+   {
+      shared_ptr<const SharedObjectArray<NObject>> list = super::getParentList();
+      return shared_ptr<const SharedObjectArray<NetObj>>(list, reinterpret_cast<const SharedObjectArray<NetObj>*>(list.get()));
+   }
 
    void lockProperties() const { m_mutexProperties.lock(); }
    void unlockProperties() const { m_mutexProperties.unlock(); }
@@ -1197,6 +1265,7 @@ class NXCORE_EXPORTABLE NetObj : public NObject
    void unlockResponsibleUsersList() const { m_mutexResponsibleUsers.unlock(); }
 
    void setModified(uint32_t flags, bool notify = true);                  // Used to mark object as modified
+   void propagateStatusToParents();
 
    bool loadACLFromDB(DB_HANDLE hdb);
    bool loadCommonProperties(DB_HANDLE hdb);
@@ -1240,6 +1309,7 @@ class NXCORE_EXPORTABLE NetObj : public NObject
    virtual InetAddress getPrimaryIpAddress() const { return InetAddress::INVALID; }
 
    virtual bool getObjectAttribute(const TCHAR *name, TCHAR **value, bool *isAllocated) const override;
+   virtual shared_ptr<NObject> lookupObject(uint32_t id) const override;
 
    int getStatus() const { return m_status; }
    uint32_t getState() const { return m_state; }
@@ -1283,6 +1353,7 @@ class NXCORE_EXPORTABLE NetObj : public NObject
 
    void addChild(const shared_ptr<NetObj>& object);     // Add reference to child object
    void addParent(const shared_ptr<NetObj>& object);    // Add reference to parent object
+   void linkChildObjects(const SharedObjectArray<NetObj>& objects);  // Add references to multiple child objects and set this object as their parent
 
    void deleteChild(const NetObj& object);  // Delete reference to child object
    void deleteParent(const NetObj& object); // Delete reference to parent object
@@ -1331,6 +1402,7 @@ class NXCORE_EXPORTABLE NetObj : public NObject
 
    virtual bool setMgmtStatus(bool bIsManaged);
    virtual void calculateCompoundStatus(bool forcedRecalc = false);
+   int getHierarchyDepth() const;
 
    uint32_t getUserRights(uint32_t userId) const;
    bool checkAccessRights(uint32_t userId, uint32_t requiredRights) const;
@@ -1734,6 +1806,7 @@ class NXCORE_EXPORTABLE DataCollectionOwner : public NetObj
    virtual void getEventReferences(uint32_t eventCode, ObjectArray<EventReference>* eventReferences) const;
 
    virtual json_t *toJson() override;
+   json_t *dcObjectsToJson();
 
    int getItemCount() const { return m_dcObjects.size(); }
    bool addDCObject(DCObject *object, bool alreadyLocked = false, bool notify = true);
@@ -2129,16 +2202,7 @@ class NXCORE_EXPORTABLE Interface : public NetObj
       unlockProperties();
    }
    void setPeer(Node *node, Interface *iface, LinkLayerProtocol protocol, bool reflection);
-   void clearPeer()
-   {
-      lockProperties();
-      m_peerNodeId = 0;
-      m_peerInterfaceId = 0;
-      m_peerDiscoveryProtocol = LL_PROTO_UNKNOWN;
-      m_flags &= ~IF_PEER_REFLECTION;
-      setModified(MODIFY_INTERFACE_PROPERTIES | MODIFY_COMMON_PROPERTIES);
-      unlockProperties();
-   }
+   void clearPeer();
    void setDescription(const TCHAR *description)
    {
       lockProperties();
@@ -2462,8 +2526,9 @@ class NXCORE_EXPORTABLE DataCollectionTarget : public DataCollectionOwner, publi
    void updateDciCache();
    void updateDCItemCacheSize(uint32_t dciId);
    void reloadDCItemCache(uint32_t dciId);
-   void cleanDCIData(DB_HANDLE hdb);
+   void cleanDCIData(DB_HANDLE hdb, time_t partitionCutoffIData = 0, time_t partitionCutoffTData = 0);
    void calculateDciCutoffTimes(time_t *cutoffTimeIData, time_t *cutoffTimeTData);
+   void calculateOldestDciCutoffTimes(time_t now, time_t *cutoffTimeIData, time_t *cutoffTimeTData);
    void queueItemsForPolling();
    bool processNewDCValue(const shared_ptr<DCObject>& dco, time_t currTime, const TCHAR *itemValue, const shared_ptr<Table>& tableValue);
    void scheduleItemDataCleanup(uint32_t dciId);
@@ -3303,6 +3368,7 @@ class NXCORE_EXPORTABLE Node : public DataCollectionTarget
    NetworkPathCheckResult checkNetworkPathLayer3(uint32_t requestId, bool secondPass);
    NetworkPathCheckResult checkNetworkPathElement(uint32_t nodeId, const TCHAR *nodeType, bool isProxy, bool isSwitch, uint32_t requestId, bool secondPass);
    void icmpPollAddress(AgentConnection *conn, const TCHAR *target, const InetAddress& addr);
+   void processIcmpPollResult(const TCHAR *target, const InetAddress& addr, uint32_t status, uint32_t rtt);
 
    bool checkSshConnection();
 
@@ -4241,12 +4307,14 @@ class NXCORE_EXPORTABLE NetworkMap : public NetObj
    ObjectArray<NetworkMapElement> m_elements;
    ObjectArray<NetworkMapLink> m_links;
    StructArray<NetworkMapObjectLocation> m_deletedObjects;
+   HashSet<uint32_t> m_dependencies;   // Seed objects and objects placed on map
+   bool m_contentUpdateRequired;
 
    virtual void fillMessageInternal(NXCPMessage *msg, uint32_t userId) override;
    virtual uint32_t modifyFromMessageInternal(const NXCPMessage& msg) override;
 
    void updateObjects(NetworkMapObjectList *objects);
-   void updateLinks();
+   void updateDependencies();
    uint32_t objectIdFromElementId(uint32_t eid);
    uint32_t elementIdFromObjectId(uint32_t eid);
 
@@ -4273,6 +4341,8 @@ class NXCORE_EXPORTABLE NetworkMap : public NetObj
    virtual json_t *toJson() override;
 
    void updateContent();
+   void updateLinks();
+   bool isContentUpdateRequired(const HashSet<uint32_t>& changedObjects);
    void clone(const TCHAR *name, const TCHAR *alias);
 
    int getBackgroundColor() { return m_backgroundColor; }
@@ -4807,6 +4877,9 @@ void NXCORE_EXPORTABLE MacDbRemoveInterface(const Interface& iface);
 void NXCORE_EXPORTABLE MacDbRemoveObject(const MacAddress& macAddr, const uint32_t objectId);
 shared_ptr<NetObj> NXCORE_EXPORTABLE MacDbFind(const BYTE *macAddr);
 shared_ptr<NetObj> NXCORE_EXPORTABLE MacDbFind(const MacAddress& macAddr);
+void NXCORE_EXPORTABLE NotifyNetworkMapsOnTopologyChange(uint32_t objectId);
+HashSet<uint32_t> *CollectNetworkMapTopologyChanges();
+
 const TCHAR * FindVendorByMac(const MacAddress& macAddr);
 void FindVendorByMacList(const NXCPMessage& request, NXCPMessage* response);
 
@@ -4843,6 +4916,7 @@ shared_ptr<Zone> NXCORE_EXPORTABLE FindZoneByProxyId(uint32_t proxyId);
 int32_t FindUnusedZoneUIN();
 bool NXCORE_EXPORTABLE IsClusterIP(int32_t zoneUIN, const InetAddress& ipAddr);
 bool NXCORE_EXPORTABLE IsParentObject(uint32_t object1, uint32_t object2);
+json_t NXCORE_EXPORTABLE *ObjectToJson(NetObj *object, bool includeDataCollection);
 unique_ptr<StructArray<DependentNode>> GetNodeDependencies(uint32_t nodeId);
 IntegerArray<uint32_t> CheckSubnetOverlap(const InetAddress &addr, int32_t uin);
 
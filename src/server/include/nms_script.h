@@ -54,8 +54,6 @@ class NXSL_DCTargetClass : public NXSL_NetObjClass
 {
 public:
    NXSL_DCTargetClass();
-
-   virtual NXSL_Value *getAttr(NXSL_Object *object, const NXSL_Identifier& attr) override;
 };
 
 /**
@@ -65,8 +63,6 @@ class NXSL_NodeClass : public NXSL_DCTargetClass
 {
 public:
    NXSL_NodeClass();
-
-   virtual NXSL_Value *getAttr(NXSL_Object *object, const NXSL_Identifier& attr) override;
 };
 
 /**
@@ -489,6 +485,16 @@ ScriptVMHandle NXCORE_EXPORTABLE CreateServerScriptVM(const TCHAR *name, const s
  */
 ScriptVMHandle NXCORE_EXPORTABLE CreateServerScriptVM(const NXSL_Program *script, const shared_ptr<NetObj>& object, const shared_ptr<DCObjectInfo>& dciInfo = shared_ptr<DCObjectInfo>());
 
+/**
+ * Create NXSL VM from library script using script's VM pool
+ */
+ScriptVMHandle NXCORE_EXPORTABLE CreatePooledServerScriptVM(const TCHAR *name, const shared_ptr<NetObj>& object, const shared_ptr<DCObjectInfo>& dciInfo = shared_ptr<DCObjectInfo>());
+
+/**
+ * Create NXSL VM from compiled script using given VM pool
+ */
+ScriptVMHandle NXCORE_EXPORTABLE CreatePooledServerScriptVM(const NXSL_Program *script, const shared_ptr<NXSL_VMPool>& pool, const shared_ptr<NetObj>& object, const shared_ptr<DCObjectInfo>& dciInfo = shared_ptr<DCObjectInfo>());
+
 /**
  * Report script error
  */
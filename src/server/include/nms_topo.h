@@ -230,6 +230,7 @@ class NXCORE_EXPORTABLE LinkLayerNeighbors
    void *getData() const { return getData(0); }
 
    int size() const { return m_connections.size(); }
+   bool equals(const LinkLayerNeighbors *other) const;
 
    void markMultipointInterface(uint32_t ifIndex) { m_multipointInterfaces.put(ifIndex); }
    bool isMultipointInterface(uint32_t ifIndex) const { return m_multipointInterfaces.contains(ifIndex); }
@@ -163,6 +163,7 @@
 #define AF_LOG_ALL_SNMP_TRAPS                  _LL(0x0008000000000000)
 #define AF_ALLOW_TRAP_VARBIND_CONVERSION       _LL(0x0010000000000000)
 #define AF_TSDB_DROP_CHUNKS_V2                 _LL(0x0020000000000000)
+#define AF_PARTITIONED_TABLES                  _LL(0x0040000000000000)
 #define AF_SERVER_INITIALIZED                  _LL(0x2000000000000000)
 #define AF_SHUTDOWN                            _LL(0x4000000000000000)
 
@@ -523,6 +524,10 @@ template class LIBNXSRV_EXPORTABLE shared_ptr<NObject>;
 template class LIBNXSRV_EXPORTABLE weak_ptr<NObject>;
 template class LIBNXSRV_EXPORTABLE ObjectMemoryPool<shared_ptr<NObject>>;
 template class LIBNXSRV_EXPORTABLE SharedObjectArray<NObject>;
+template class LIBNXSRV_EXPORTABLE shared_ptr<SharedObjectArray<NObject>>;
+template class LIBNXSRV_EXPORTABLE shared_ptr_store<SharedObjectArray<NObject>>;
+template class LIBNXSRV_EXPORTABLE shared_ptr<IntegerArray<uint32_t>>;
+template class LIBNXSRV_EXPORTABLE shared_ptr_store<IntegerArray<uint32_t>>;
 template class LIBNXSRV_EXPORTABLE StringObjectMap<CustomAttribute>;
 #endif
 
@@ -532,8 +537,9 @@ template class LIBNXSRV_EXPORTABLE StringObjectMap<CustomAttribute>;
 class LIBNXSRV_EXPORTABLE NObject : public enable_shared_from_this<NObject>
 {
 private:
-   SharedObjectArray<NObject> m_childList;     // Array of pointers to child objects
-   SharedObjectArray<NObject> m_parentList;    // Array of pointers to parent objects
+   mutable shared_ptr_store<SharedObjectArray<NObject>> m_childList;   // Current snapshot of child list (never modified after publication)
+   mutable shared_ptr_store<SharedObjectArray<NObject>> m_parentList;  // Current snapshot of parent list (never modified after publication)
+   mutable shared_ptr_store<IntegerArray<uint32_t>> m_ancestors;        // Sorted IDs of all direct and indirect parents
 
    StringObjectMap<CustomAttribute> m_customAttributes;
    Mutex m_customAttributeLock;
@@ -546,49 +552,37 @@ class LIBNXSRV_EXPORTABLE NObject : public enable_shared_from_this<NObject>
    void propagateCustomAttributeChange(const TCHAR *name, const SharedString& value, uint32_t parentId);
    void propagateCustomAttributeRemove(const TCHAR *name, uint32_t parentId);
    bool checkCustomAttributeInConflict(const TCHAR *name, uint32_t newParent);
+   void inheritCustomAttributes(const SharedObjectArray<NObject>& children);
+   void updateAncestorIndex();
+   void updateAncestorIndexInternal(int depth);
 
 protected:
    uint32_t m_id;
    uuid m_guid;
    TCHAR m_name[MAX_OBJECT_NAME];
 
-   RWLock m_rwlockParentList; // Lock for parent list
-   RWLock m_rwlockChildList;  // Lock for child list
+   Mutex m_parentListWriteLock;  // Serializes parent list modifications
+   Mutex m_childListWriteLock;   // Serializes child list modifications
 
-   const SharedObjectArray<NObject>& getChildList() const { return m_childList; }
-   const SharedObjectArray<NObject>& getParentList() const { return m_parentList; }
+   // Snapshots are immutable and can be iterated without locking
+   shared_ptr<const SharedObjectArray<NObject>> getChildList() const { return m_childList.get(); }
+   shared_ptr<const SharedObjectArray<NObject>> getParentList() const { return m_parentList.get(); }
 
    void clearChildList();
    void clearParentList();
 
-   bool isDirectChildInternal(uint32_t id) const
-   {
-      for(int i = 0; i < m_childList.size(); i++)
-         if (m_childList.get(i)->getId() == id)
-            return true;
-      return false;
-   }
-   bool isDirectParentInternal(uint32_t id) const
-   {
-      for(int i = 0; i < m_parentList.size(); i++)
-         if (m_parentList.get(i)->getId() == id)
-            return true;
-      return false;
-   }
-
    void lockCustomAttributes() const { m_customAttributeLock.lock(); }
    void unlockCustomAttributes() const { m_customAttributeLock.unlock(); }
 
-   void readLockParentList() const { m_rwlockParentList.readLock(); }
-   void writeLockParentList() { m_rwlockParentList.writeLock(); }
-   void unlockParentList() const { m_rwlockParentList.unlock(); }
+   void writeLockParentList() { m_parentListWriteLock.lock(); }
+   void unlockParentList() { m_parentListWriteLock.unlock(); }
 
-   void readLockChildList() const { m_rwlockChildList.readLock(); }
-   void writeLockChildList() { m_rwlockChildList.writeLock(); }
-   void unlockChildList() const { m_rwlockChildList.unlock(); }
+   void writeLockChildList() { m_childListWriteLock.lock(); }
+   void unlockChildList() { m_childListWriteLock.unlock(); }
 
    virtual void onCustomAttributeChange();
    virtual bool getObjectAttribute(const TCHAR *name, TCHAR **value, bool *isAllocated) const;
+   virtual shared_ptr<NObject> lookupObject(uint32_t id) const;
 
 public:
    NObject();
@@ -603,6 +597,7 @@ class LIBNXSRV_EXPORTABLE NObject : public enable_shared_from_this<NObject>
    const TCHAR *getName() const { return m_name; }
 
    void addChild(const shared_ptr<NObject>& object);     // Add reference to child object
+   void addChildren(const SharedObjectArray<NObject>& objects);   // Add references to multiple child objects
    void addParent(const shared_ptr<NObject>& object);    // Add reference to parent object
 
    void deleteChild(uint32_t objectId);  // Delete reference to child object
@@ -613,8 +608,8 @@ class LIBNXSRV_EXPORTABLE NObject : public enable_shared_from_this<NObject>
    bool isParent(uint32_t id) const;
    bool isDirectParent(uint32_t id) const;
 
-   int getChildCount() const { return m_childList.size(); }
-   int getParentCount() const { return m_parentList.size(); }
+   int getChildCount() const { return m_childList.get()->size(); }
+   int getParentCount() const { return m_parentList.get()->size(); }
 
    TCHAR *getCustomAttribute(const TCHAR *name, TCHAR *buffer, size_t size) const;
    SharedString getInheritableCustomAttribute(const TCHAR *name) const;
@@ -639,6 +634,7 @@ class LIBNXSRV_EXPORTABLE NObject : public enable_shared_from_this<NObject>
 
    void setCustomAttributesFromMessage(const NXCPMessage& msg);
    void setCustomAttributesFromDatabase(DB_RESULT hResult);
+   void setCustomAttributesFromDatabase(DB_RESULT hResult, int startRow, int endRow);
    void deleteCustomAttribute(const TCHAR *name);
    void updateOrDeleteCustomAttributeOnParentRemove(const TCHAR *name, uint32_t parentId);
    NXSL_Value *getCustomAttributeForNXSL(NXSL_VM *vm, const TCHAR *name) const;
@@ -24,10 +24,21 @@
 #include <nxsrvapi.h>
 #include <netxms-regex.h>
 
+/**
+ * Maximum containment depth processed by ancestor index update (protects against loops in object graph)
+ */
+#define MAX_ANCESTOR_UPDATE_DEPTH   256
+
+/**
+ * Lock for ancestor index updates
+ */
+static Mutex s_ancestorIndexLock(MutexType::FAST);
+
 /**
  * Default constructor for the class
  */
-NObject::NObject() : m_childList(0, 32), m_parentList(8, 8), m_customAttributes(Ownership::True), m_customAttributeLock(MutexType::FAST)
+NObject::NObject() : m_childList(make_shared<SharedObjectArray<NObject>>(0, 32)), m_parentList(make_shared<SharedObjectArray<NObject>>(8, 8)), m_ancestors(make_shared<IntegerArray<uint32_t>>(0, 16)),
+         m_customAttributes(Ownership::True), m_customAttributeLock(MutexType::FAST), m_parentListWriteLock(MutexType::FAST), m_childListWriteLock(MutexType::FAST)
 {
    m_id = 0;
    m_name[0] = 0;
@@ -40,13 +51,81 @@ NObject::~NObject()
 {
 }
 
+/**
+ * Check if object with given ID is in the list
+ */
+static inline bool IsObjectInList(const SharedObjectArray<NObject>& list, uint32_t id)
+{
+   for(int i = 0; i < list.size(); i++)
+      if (list.get(i)->getId() == id)
+         return true;
+   return false;
+}
+
 /**
  * Clear parent list. Should be called only when parent list is write locked.
  * This method will not check for custom attribute inheritance changes.
  */
 void NObject::clearParentList()
 {
-   m_parentList.clear();
+   m_parentList.set(make_shared<SharedObjectArray<NObject>>(8, 8));
+   updateAncestorIndex();
+}
+
+/**
+ * Find object by ID. Used for checking indirect child objects via ancestor index.
+ * Default implementation does not have access to any object index.
+ */
+shared_ptr<NObject> NObject::lookupObject(uint32_t id) const
+{
+   return shared_ptr<NObject>();
+}
+
+/**
+ * Rebuild ancestor index for this object and propagate changes to child objects
+ */
+void NObject::updateAncestorIndex()
+{
+   s_ancestorIndexLock.lock();
+   updateAncestorIndexInternal(0);
+   s_ancestorIndexLock.unlock();
+}
+
+/**
+ * Rebuild ancestor index for this object and propagate changes to child objects (should be called with ancestor index lock held)
+ */
+void NObject::updateAncestorIndexInternal(int depth)
+{
+   auto ancestors = make_shared<IntegerArray<uint32_t>>(16, 16);
+   shared_ptr<const SharedObjectArray<NObject>> parentList = getParentList();
+   for(int i = 0; i < parentList->size(); i++)
+   {
+      NObject *parent = parentList->get(i);
+      ancestors->add(parent->m_id);
+      ancestors->addAll(*parent->m_ancestors.get());
+   }
+
+   // Sort and remove duplicates (object reachable via different paths)
+   ancestors->sortAscending();
+   uint32_t *ids = ancestors->getBuffer();
+   int count = 0;
+   for(int i = 0; i < ancestors->size(); i++)
+   {
+      if ((count == 0) || (ids[count - 1] != ids[i]))
+         ids[count++] = ids[i];
+   }
+   ancestors->shrinkTo(count);
+
+   if (ancestors->equals(*m_ancestors.get()))
+      return;  // No changes, no need to update children
+   m_ancestors.set(ancestors);
+
+   if (depth >= MAX_ANCESTOR_UPDATE_DEPTH)
+      return;
+
+   shared_ptr<const SharedObjectArray<NObject>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
+      childList->get(i)->updateAncestorIndexInternal(depth + 1);
 }
 
 /**
@@ -54,7 +133,7 @@ void NObject::clearParentList()
  */
 void NObject::clearChildList()
 {
-   m_childList.clear();
+   m_childList.set(make_shared<SharedObjectArray<NObject>>(0, 32));
 }
 
 /**
@@ -63,15 +142,64 @@ void NObject::clearChildList()
 void NObject::addChild(const shared_ptr<NObject>& object)
 {
    writeLockChildList();
-   if (isDirectChildInternal(object->getId()))
+   shared_ptr<SharedObjectArray<NObject>> childList = m_childList.get();
+   if (IsObjectInList(*childList, object->getId()))
    {
       unlockChildList();
       return;     // Already in the child list
    }
-   m_childList.add(object);
+   auto newChildList = make_shared<SharedObjectArray<NObject>>(*childList);
+   newChildList->add(object);
+   m_childList.set(newChildList);
+   unlockChildList();
+
+   SharedObjectArray<NObject> children(1, 16);
+   children.add(object);
+   inheritCustomAttributes(children);
+}
+
+/**
+ * Add references to multiple child objects. Child list snapshot is copied only once, so this method
+ * should be used instead of addChild when many objects are linked at once (on load or template apply).
+ */
+void NObject::addChildren(const SharedObjectArray<NObject>& objects)
+{
+   if (objects.isEmpty())
+      return;
+
+   SharedObjectArray<NObject> added(objects.size(), 64);
+
+   writeLockChildList();
+   shared_ptr<SharedObjectArray<NObject>> childList = m_childList.get();
+   HashSet<uint32_t> ids;
+   for(int i = 0; i < childList->size(); i++)
+      ids.put(childList->get(i)->getId());
+
+   auto newChildList = make_shared<SharedObjectArray<NObject>>(*childList);
+   for(int i = 0; i < objects.size(); i++)
+   {
+      uint32_t id = objects.get(i)->getId();
+      if (ids.contains(id))
+         continue;   // Already in the child list
+      ids.put(id);
+      newChildList->add(objects.getShared(i));
+      added.add(objects.getShared(i));
+   }
+   if (!added.isEmpty())
+      m_childList.set(newChildList);
    unlockChildList();
 
-   // Update custom attribute inheritance
+   inheritCustomAttributes(added);
+}
+
+/**
+ * Pass inheritable custom attributes to new child objects
+ */
+void NObject::inheritCustomAttributes(const SharedObjectArray<NObject>& children)
+{
+   if (children.isEmpty())
+      return;
+
    ObjectArray<std::pair<String, uint32_t>> updateList(0, 16, Ownership::True);
    lockCustomAttributes();
    auto it = m_customAttributes.begin();
@@ -84,7 +212,11 @@ void NObject::addChild(const shared_ptr<NObject>& object)
    unlockCustomAttributes();
 
    for(int i = 0; i < updateList.size(); i++)
-      object->setCustomAttribute(updateList.get(i)->first, getCustomAttribute(updateList.get(i)->first), updateList.get(i)->second);
+   {
+      SharedString value = getCustomAttribute(updateList.get(i)->first);
+      for(int j = 0; j < children.size(); j++)
+         children.get(j)->setCustomAttribute(updateList.get(i)->first, value, updateList.get(i)->second);
+   }
 }
 
 /**
@@ -93,13 +225,18 @@ void NObject::addChild(const shared_ptr<NObject>& object)
 void NObject::addParent(const shared_ptr<NObject>& object)
 {
    writeLockParentList();
-   if (isDirectParentInternal(object->getId()))
+   shared_ptr<SharedObjectArray<NObject>> parentList = m_parentList.get();
+   if (IsObjectInList(*parentList, object->getId()))
    {
       unlockParentList();
       return;     // Already in the parents list
    }
-   m_parentList.add(object);
+   auto newParentList = make_shared<SharedObjectArray<NObject>>(*parentList);
+   newParentList->add(object);
+   m_parentList.set(newParentList);
    unlockParentList();
+
+   updateAncestorIndex();
 }
 
 /**
@@ -108,10 +245,13 @@ void NObject::addParent(const shared_ptr<NObject>& object)
 void NObject::deleteChild(uint32_t objectId)
 {
    writeLockChildList();
-   for(int i = 0; i < m_childList.size(); i++)
-      if (m_childList.get(i)->getId() == objectId)
+   shared_ptr<SharedObjectArray<NObject>> childList = m_childList.get();
+   for(int i = 0; i < childList->size(); i++)
+      if (childList->get(i)->getId() == objectId)
       {
-         m_childList.remove(i);
+         auto newChildList = make_shared<SharedObjectArray<NObject>>(*childList);
+         newChildList->remove(i);
+         m_childList.set(newChildList);
          break;
       }
    unlockChildList();
@@ -124,10 +264,13 @@ void NObject::deleteParent(uint32_t objectId)
 {
    writeLockParentList();
    bool success = false;
-   for(int i = 0; i < m_parentList.size(); i++)
-      if (m_parentList.get(i)->getId() == objectId)
+   shared_ptr<SharedObjectArray<NObject>> parentList = m_parentList.get();
+   for(int i = 0; i < parentList->size(); i++)
+      if (parentList->get(i)->getId() == objectId)
       {
-         m_parentList.remove(i);
+         auto newParentList = make_shared<SharedObjectArray<NObject>>(*parentList);
+         newParentList->remove(i);
+         m_parentList.set(newParentList);
          success = true;
          break;
       }
@@ -135,6 +278,8 @@ void NObject::deleteParent(uint32_t objectId)
 
    if (success)
    {
+      updateAncestorIndex();
+
       StringList removeList;
 
       lockCustomAttributes();
@@ -159,19 +304,26 @@ void NObject::deleteParent(uint32_t objectId)
  */
 bool NObject::isChild(uint32_t id) const
 {
+   if (m_id == id)
+      return true;
+
+   // Use ancestor index of given object if it can be found
+   shared_ptr<NObject> object = lookupObject(id);
+   if (object != nullptr)
+      return object->isParent(m_id);
+
    bool result = isDirectChild(id);
 
    // If given object is not in child list, check if it is indirect child
    if (!result)
    {
-      readLockChildList();
-      for(int i = 0; i < m_childList.size(); i++)
-         if (m_childList.get(i)->isChild(id))
+      shared_ptr<const SharedObjectArray<NObject>> childList = getChildList();
+      for(int i = 0; i < childList->size(); i++)
+         if (childList->get(i)->isChild(id))
          {
             result = true;
             break;
          }
-      unlockChildList();
    }
 
    return result;
@@ -188,10 +340,7 @@ bool NObject::isDirectChild(uint32_t id) const
    if (m_id == id)
       return true;
 
-   readLockChildList();
-   bool result = isDirectChildInternal(id);
-   unlockChildList();
-   return result;
+   return IsObjectInList(*getChildList(), id);
 }
 
 /**
@@ -201,22 +350,23 @@ bool NObject::isDirectChild(uint32_t id) const
  */
 bool NObject::isParent(uint32_t id) const
 {
-   bool result = isDirectParent(id);
+   if (m_id == id)
+      return true;
 
-   // If given object is not in parent list, check if it is indirect parent
-   if (!result)
+   shared_ptr<IntegerArray<uint32_t>> ancestors = m_ancestors.get();
+   const uint32_t *ids = ancestors->getBuffer();
+   int low = 0, high = ancestors->size() - 1;
+   while(low <= high)
    {
-      readLockParentList();
-      for(int i = 0; i < m_parentList.size(); i++)
-         if (m_parentList.get(i)->isParent(id))
-         {
-            result = true;
-            break;
-         }
-      unlockParentList();
+      int mid = (low + high) / 2;
+      if (ids[mid] == id)
+         return true;
+      if (ids[mid] < id)
+         low = mid + 1;
+      else
+         high = mid - 1;
    }
-
-   return result;
+   return false;
 }
 
 /**
@@ -230,10 +380,7 @@ bool NObject::isDirectParent(uint32_t id) const
    if (m_id == id)
       return true;
 
-   readLockParentList();
-   bool result = isDirectParentInternal(id);
-   unlockParentList();
-   return result;
+   return IsObjectInList(*getParentList(), id);
 }
 
 /**
@@ -242,16 +389,15 @@ bool NObject::isDirectParent(uint32_t id) const
 SharedString NObject::getCustomAttributeFromParent(const TCHAR *name, uint32_t id)
 {
    SharedString value;
-   readLockParentList();
-   for(int i = 0; i < m_parentList.size(); i++)
+   shared_ptr<const SharedObjectArray<NObject>> parentList = getParentList();
+   for(int i = 0; i < parentList->size(); i++)
    {
-      if (m_parentList.get(i)->getId() == id)
+      if (parentList->get(i)->getId() == id)
       {
-         value = m_parentList.get(i)->getInheritableCustomAttribute(name);
+         value = parentList->get(i)->getInheritableCustomAttribute(name);
          break;
       }
    }
-   unlockParentList();
    return value;
 }
 
@@ -262,17 +408,16 @@ std::pair<uint32_t, SharedString> NObject::getCustomAttributeFromParent(const TC
 {
    SharedString value;
    uint32_t sourceId = 0;
-   readLockParentList();
-   for(int i = 0; i < m_parentList.size(); i++)
+   shared_ptr<const SharedObjectArray<NObject>> parentList = getParentList();
+   for(int i = 0; i < parentList->size(); i++)
    {
-      value = m_parentList.get(i)->getInheritableCustomAttribute(name);
+      value = parentList->get(i)->getInheritableCustomAttribute(name);
       if (!value.isNull())
       {
-         sourceId = m_parentList.get(i)->getInheritableCustomAttributeParent(name);
+         sourceId = parentList->get(i)->getInheritableCustomAttributeParent(name);
          break;
       }
    }
-   unlockParentList();
    return std::pair<uint32_t, SharedString>(sourceId, value);
 }
 
@@ -283,10 +428,10 @@ bool NObject::checkCustomAttributeInConflict(const TCHAR *name, uint32_t newPare
 {
    uint32_t sourceId = newParent;
    bool inConflict = false;
-   readLockParentList();
-   for(int i = 0; i < m_parentList.size(); i++)
+   shared_ptr<const SharedObjectArray<NObject>> parentList = getParentList();
+   for(int i = 0; i < parentList->size(); i++)
    {
-      uint32_t tmp = m_parentList.get(i)->getInheritableCustomAttributeParent(name);
+      uint32_t tmp = parentList->get(i)->getInheritableCustomAttributeParent(name);
       if (tmp != 0)
       {
          if (sourceId != 0 && sourceId != tmp)
@@ -297,7 +442,6 @@ bool NObject::checkCustomAttributeInConflict(const TCHAR *name, uint32_t newPare
          sourceId = tmp;
       }
    }
-   unlockParentList();
    return inConflict;
 }
 
@@ -321,10 +465,7 @@ static StringBuffer ObjectListToString(const SharedObjectArray<NObject>& list)
  */
 StringBuffer NObject::dbgGetChildList() const
 {
-   readLockChildList();
-   StringBuffer list = ObjectListToString(m_childList);
-   unlockChildList();
-   return list;
+   return ObjectListToString(*getChildList());
 }
 
 /**
@@ -332,10 +473,7 @@ StringBuffer NObject::dbgGetChildList() const
  */
 StringBuffer NObject::dbgGetParentList() const
 {
-   readLockParentList();
-   StringBuffer list = ObjectListToString(m_parentList);
-   unlockParentList();
-   return list;
+   return ObjectListToString(*getParentList());
 }
 
 /**
@@ -487,12 +625,11 @@ void NObject::setCustomAttribute(const TCHAR *key, uint64_t value)
  */
 void NObject::propagateCustomAttributeChange(const TCHAR *name, const SharedString& value, uint32_t source)
 {
-   writeLockChildList();
-   for(int i = 0; i < m_childList.size(); i++)
+   shared_ptr<const SharedObjectArray<NObject>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
    {
-      m_childList.get(i)->setCustomAttribute(name, value, source);
+      childList->get(i)->setCustomAttribute(name, value, source);
    }
-   unlockChildList();
 }
 
 /**
@@ -500,12 +637,11 @@ void NObject::propagateCustomAttributeChange(const TCHAR *name, const SharedStri
  */
 void NObject::propagateCustomAttributeRemove(const TCHAR *name, uint32_t parentId)
 {
-   writeLockChildList();
-   for(int i = 0; i < m_childList.size(); i++)
+   shared_ptr<const SharedObjectArray<NObject>> childList = getChildList();
+   for(int i = 0; i < childList->size(); i++)
    {
-      m_childList.get(i)->deleteInheritedCustomAttribute(name, parentId);
+      childList->get(i)->deleteInheritedCustomAttribute(name, parentId);
    }
-   unlockChildList();
 }
 
 /**
@@ -513,8 +649,15 @@ void NObject::propagateCustomAttributeRemove(const TCHAR *name, uint32_t parentI
  */
 void NObject::setCustomAttributesFromDatabase(DB_RESULT hResult)
 {
-   int count = DBGetNumRows(hResult);
-   for(int i = 0; i < count; i++)
+   setCustomAttributesFromDatabase(hResult, 0, DBGetNumRows(hResult));
+}
+
+/**
+ * Set custom attributes from given range of rows in database query result
+ */
+void NObject::setCustomAttributesFromDatabase(DB_RESULT hResult, int startRow, int endRow)
+{
+   for(int i = startRow; i < endRow; i++)
    {
       TCHAR *name = DBGetField(hResult, i, 0, nullptr, 0);
       if (name != nullptr)
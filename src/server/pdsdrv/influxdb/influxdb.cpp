@@ -40,9 +40,11 @@ static const TCHAR *s_driverName = _T("InfluxDB");
 /**
  * Constructor
  */
-InfluxDBStorageDriver::InfluxDBStorageDriver() : m_senders(0, 16, Ownership::True)
+InfluxDBStorageDriver::InfluxDBStorageDriver() : m_senders(0, 16, Ownership::True), m_objectTagCache(Ownership::True), m_objectTagCacheLock(MutexType::FAST)
 {
    m_enableUnsignedType = false;
+   m_tagCacheHits = 0;
+   m_tagCacheMisses = 0;
 }
 
 /**
@@ -164,7 +166,7 @@ static void FindAndReplaceAll(StringBuffer *data, const TCHAR *toSearch, const T
 }
 
 /**
- * Get tags from given object. Returns true if
+ * Get tags from given object. Returns true if metrics for this object should be ignored.
  */
 static bool GetTagsFromObject(const NetObj& object, StringBuffer *tags)
 {
@@ -214,23 +216,46 @@ static bool GetTagsFromObject(const NetObj& object, StringBuffer *tags)
 }
 
 /**
- * Build and queue metric from item DCI's
+ * Get tags from given object using object tag cache. Cached entry is considered valid while object's
+ * modification timestamp is unchanged (any change to custom attributes updates it). Entries built
+ * within the same second as last object modification are marked as provisional and rebuilt on next
+ * access, because timestamp has one second resolution. Returns true if metrics for this object should be ignored.
  */
-bool InfluxDBStorageDriver::saveDCItemValue(DCItem *dci, time_t timestamp, const TCHAR *value)
+bool InfluxDBStorageDriver::getObjectTags(const NetObj& object, StringBuffer *tags)
 {
-   nxlog_debug_tag(DEBUG_TAG, 8,
-            _T("Raw metric: OwnerName:%s DataSource:%i Type:%i Name:%s Description: %s Instance:%s DataType:%i DeltaCalculationMethod:%i RelatedObject:%i Value:%s timestamp:") INT64_FMT,
-            dci->getOwnerName(), dci->getDataSource(), dci->getType(), dci->getName().cstr(), dci->getDescription().cstr(),
-            dci->getInstanceName().cstr(), dci->getDataType(), dci->getDeltaCalculationMethod(), dci->getRelatedObject(),
-            value, static_cast<INT64>(timestamp));
+   time_t objectTimestamp = object.getTimeStamp();
 
-   // Dont't try to send empty values
-   if (*value == 0)
+   m_objectTagCacheLock.lock();
+   ObjectTagCacheEntry *entry = m_objectTagCache.get(object.getId());
+   if ((entry != nullptr) && !entry->provisional && (entry->objectTimestamp == objectTimestamp))
    {
-      nxlog_debug_tag(DEBUG_TAG, 7, _T("Metric %s [%u] not sent: empty value"), dci->getName().cstr(), dci->getId());
-      return true;
+      tags->append(entry->tags);
+      bool ignoreMetrics = entry->ignoreMetrics;
+      m_objectTagCacheLock.unlock();
+      return ignoreMetrics;
    }
+   m_objectTagCacheLock.unlock();
+
+   // Build tags outside of lock - retrieving custom attributes will lock object
+   auto newEntry = new ObjectTagCacheEntry();
+   newEntry->objectTimestamp = objectTimestamp;
+   newEntry->provisional = (time(nullptr) <= objectTimestamp);
+   newEntry->ignoreMetrics = GetTagsFromObject(object, &newEntry->tags);
+   tags->append(newEntry->tags);
+   bool ignoreMetrics = newEntry->ignoreMetrics;
 
+   m_objectTagCacheLock.lock();
+   m_objectTagCache.set(object.getId(), newEntry);
+   m_objectTagCacheLock.unlock();
+
+   return ignoreMetrics;
+}
+
+/**
+ * Build cached line prefix for DCI (everything up to field value) and suffix (type marker after value)
+ */
+void InfluxDBStorageDriver::buildDCITagCacheEntry(DCItem *dci, const NetObj& owner, const NetObj *relatedObject, DCITagCacheEntry *entry)
+{
    const TCHAR *ds; // Data sources
    switch (dci->getDataSource())
    {
@@ -344,20 +369,19 @@ bool InfluxDBStorageDriver::saveDCItemValue(DCItem *dci, time_t timestamp, const
 
    // Get Host CA's
    StringBuffer tags;
-   if (GetTagsFromObject(static_cast<NetObj&>(*dci->getOwner()), &tags))
+   if (getObjectTags(owner, &tags))
    {
-      nxlog_debug_tag(DEBUG_TAG, 7, _T("Metric not sent: ignore flag set on owner object"));
-      return true;
+      entry->ignoreMetrics = true;
+      return;
    }
 
    // Get RelatedObject (Interface) CA's
-   shared_ptr<NetObj> relatedObject = FindObjectById(dci->getRelatedObject());
    if (relatedObject != nullptr)
    {
-      if (GetTagsFromObject(static_cast<NetObj&>(*relatedObject), &tags))
+      if (getObjectTags(*relatedObject, &tags))
       {
-         nxlog_debug_tag(DEBUG_TAG, 7, _T("Metric not sent: ignore flag set on related object %s"), relatedObject->getName());
-         return true;
+         entry->ignoreMetrics = true;
+         return;
       }
    }
 
@@ -388,14 +412,14 @@ bool InfluxDBStorageDriver::saveDCItemValue(DCItem *dci, time_t timestamp, const
    }
 
    // Host
-   StringBuffer host(dci->getOwner()->getName());
+   StringBuffer host(owner.getName());
    host.replace(_T(" "), _T("_"));
    host.replace(_T(","), _T("_"));
    host.replace(_T(":"), _T("_"));
    FindAndReplaceAll(&host, _T("__"), _T("_"));
    host.toLowercase();
 
-   // Build final metric structure
+   // Build line prefix
    StringBuffer data(name);
    data.append(_T(",host="));
    data.append(host);
@@ -413,24 +437,131 @@ bool InfluxDBStorageDriver::saveDCItemValue(DCItem *dci, time_t timestamp, const
    if (dci->getDataType() == DCI_DT_STRING)
    {
       data.append(_T(" value=\""));
-      data.append(value);
-      data.append(_T("\" "));
+      entry->suffix = "\" ";
    }
    else
    {
       data.append(_T(" value="));
-      data.append(value);
       if (isInteger)
-         data.append((isUnsigned && m_enableUnsignedType) ? _T("u ") : _T("i "));
+         entry->suffix = (isUnsigned && m_enableUnsignedType) ? "u " : "i ";
       else
-         data.append(_T(' '));
+         entry->suffix = " ";
+   }
+
+   entry->prefix = data.getUTF8String();
+   entry->ignoreMetrics = false;
+}
+
+/**
+ * Callback for finding object tag cache entries for deleted objects
+ */
+static EnumerationCallbackResult CheckDeletedObject(const uint32_t& id, ObjectTagCacheEntry *entry, IntegerArray<uint32_t> *deletedObjects)
+{
+   if (FindObjectById(id) == nullptr)
+      deletedObjects->add(id);
+   return _CONTINUE;
+}
+
+/**
+ * Build and queue metric from item DCI's
+ */
+bool InfluxDBStorageDriver::saveDCItemValue(DCItem *dci, time_t timestamp, const TCHAR *value)
+{
+   nxlog_debug_tag(DEBUG_TAG, 8,
+            _T("Raw metric: OwnerName:%s DataSource:%i Type:%i Name:%s Description: %s Instance:%s DataType:%i DeltaCalculationMethod:%i RelatedObject:%i Value:%s timestamp:") INT64_FMT,
+            dci->getOwnerName(), dci->getDataSource(), dci->getType(), dci->getName().cstr(), dci->getDescription().cstr(),
+            dci->getInstanceName().cstr(), dci->getDataType(), dci->getDeltaCalculationMethod(), dci->getRelatedObject(),
+            value, static_cast<INT64>(timestamp));
+
+   // Dont't try to send empty values
+   if (*value == 0)
+   {
+      nxlog_debug_tag(DEBUG_TAG, 7, _T("Metric %s [%u] not sent: empty value"), dci->getName().cstr(), dci->getId());
+      return true;
    }
-   data.append(static_cast<uint64_t>(timestamp));
-   data.append(_T("000000000")); // Use nanosecond precision
+
+   shared_ptr<DataCollectionOwner> owner = dci->getOwner();
+   if (owner == nullptr)
+   {
+      nxlog_debug_tag(DEBUG_TAG, 7, _T("Metric %s [%u] not sent: owner object not set"), dci->getName().cstr(), dci->getId());
+      return true;
+   }
+
+   uint32_t relatedObjectId = dci->getRelatedObject();
+   shared_ptr<NetObj> relatedObject = (relatedObjectId != 0) ? FindObjectById(relatedObjectId) : shared_ptr<NetObj>();
+   time_t relatedObjectTimestamp = (relatedObject != nullptr) ? relatedObject->getTimeStamp() : 0;
+
+   // Changes to DCI configuration mark owner object as modified, so owner's timestamp
+   // covers both DCI and owner's custom attributes
+   time_t now = time(nullptr);
+   DCITagCacheShard *shard = &m_dciTagCache[dci->getId() % DCI_TAG_CACHE_SHARDS];
+   shard->mutex.lock();
+   DCITagCacheEntry *entry = shard->entries.get(dci->getId());
+   if ((entry != nullptr) && !entry->provisional && (entry->ownerTimestamp == owner->getTimeStamp()) &&
+       (entry->relatedObjectId == ((relatedObject != nullptr) ? relatedObjectId : 0)) && (entry->relatedObjectTimestamp == relatedObjectTimestamp))
+   {
+      InterlockedIncrement64(&m_tagCacheHits);
+   }
+   else
+   {
+      InterlockedIncrement64(&m_tagCacheMisses);
+      entry = new DCITagCacheEntry();
+      entry->ownerTimestamp = owner->getTimeStamp();
+      entry->relatedObjectId = (relatedObject != nullptr) ? relatedObjectId : 0;
+      entry->relatedObjectTimestamp = relatedObjectTimestamp;
+      entry->provisional = (now <= entry->ownerTimestamp) || (now <= relatedObjectTimestamp);
+      buildDCITagCacheEntry(dci, *owner, relatedObject.get(), entry);
+      shard->entries.set(dci->getId(), entry);
+   }
+   entry->lastUseTime = now;
+
+   if (entry->ignoreMetrics)
+   {
+      shard->mutex.unlock();
+      nxlog_debug_tag(DEBUG_TAG, 7, _T("Metric %s [%u] not sent: ignore flag set on owner or related object"), dci->getName().cstr(), dci->getId());
+      return true;
+   }
+
+   // Build line: prefix, value, suffix, timestamp in nanoseconds
+   size_t prefixLen = strlen(entry->prefix);
+   size_t suffixLen = strlen(entry->suffix);
+   size_t valueLen = _tcslen(value);
+   InfluxDBLine *line = InfluxDBLine::create(prefixLen + valueLen * 4 + suffixLen + 32);
+   memcpy(line->data, entry->prefix, prefixLen);
+   size_t pos = prefixLen;
+   pos += tchar_to_utf8(value, valueLen, &line->data[pos], valueLen * 4);
+   memcpy(&line->data[pos], entry->suffix, suffixLen);
+   pos += suffixLen;
+   pos += snprintf(&line->data[pos], 32, UINT64_FMTA "000000000", static_cast<uint64_t>(timestamp)); // Use nanosecond precision
+   line->length = pos;
+
+   // Remove entries for DCIs not seen for an hour (deleted or disabled)
+   if (now - shard->lastCleanupTime >= 3600)
+   {
+      Iterator<DCITagCacheEntry> it = shard->entries.begin();
+      while(it.hasNext())
+      {
+         if (now - it.next()->lastUseTime >= 3600)
+            it.remove();
+      }
+      shard->lastCleanupTime = now;
+
+      // Object tag cache is cleaned up together with first shard
+      if (shard == &m_dciTagCache[0])
+      {
+         IntegerArray<uint32_t> deletedObjects;
+         m_objectTagCacheLock.lock();
+         m_objectTagCache.forEach(CheckDeletedObject, &deletedObjects);
+         for(int i = 0; i < deletedObjects.size(); i++)
+            m_objectTagCache.remove(deletedObjects.get(i));
+         m_objectTagCacheLock.unlock();
+      }
+   }
+   shard->mutex.unlock();
 
    int senderIndex = dci->getId() % m_senders.size();
-   nxlog_debug_tag(DEBUG_TAG, 7, _T("Queuing data to sender #%d: %s"), senderIndex, data.cstr());
-   m_senders.get(senderIndex)->enqueue(data);
+   nxlog_debug_tag(DEBUG_TAG, 7, _T("Queuing data to sender #%d: %hs"), senderIndex, line->data);
+   m_senders.get(senderIndex)->enqueue(line);
 
    return true;
 }
@@ -475,6 +606,14 @@ DataCollectionError InfluxDBStorageDriver::getInternalMetric(const TCHAR *metric
          size += m_senders.get(i)->getQueueSizeInBytes();
       ret_uint64(value, size);
    }
+   else if (!_tcsicmp(metric, _T("tagCache.hits")))
+   {
+      ret_uint64(value, static_cast<uint64_t>(m_tagCacheHits));
+   }
+   else if (!_tcsicmp(metric, _T("tagCache.misses")))
+   {
+      ret_uint64(value, static_cast<uint64_t>(m_tagCacheMisses));
+   }
    else if (!_tcsicmp(metric, _T("queueSize.messages")))
    {
       uint32_t size = 0;
@@ -44,48 +44,43 @@
 // debug pdsdrv.influxdb 1-8
 #define DEBUG_TAG _T("pdsdrv.influxdb")
 
+/**
+ * Line in sender queue (UTF-8 encoded, without terminating new line character)
+ */
+struct InfluxDBLine
+{
+   InfluxDBLine *next;
+   size_t length;
+   char data[1];
+
+   static InfluxDBLine *create(size_t maxLength)
+   {
+      auto line = static_cast<InfluxDBLine*>(MemAlloc(sizeof(InfluxDBLine) + maxLength));
+      line->next = nullptr;
+      line->length = 0;
+      return line;
+   }
+};
+
 /**
  * Abstract sender
  */
 class InfluxDBSender
 {
 protected:
-   StringBuffer m_queue;
+   std::atomic<InfluxDBLine*> m_queue;   // Lines in reverse order of enqueue
+   VolatileCounter64 m_queueSize;
+   VolatileCounter m_queuedMessages;
+   VolatileCounter64 m_messageDrops;
    uint32_t m_queueFlushThreshold;
    uint32_t m_queueSizeLimit;
    uint32_t m_maxCacheWaitTime;
    String m_hostname;
    uint16_t m_port;
    time_t m_lastConnect;
-#ifdef _WIN32
-   CRITICAL_SECTION m_mutex;
-   CONDITION_VARIABLE m_condition;
-#else
-   pthread_mutex_t m_mutex;
-   pthread_cond_t m_condition;
-#endif
+   Condition m_wakeupCondition;
    bool m_shutdown;
    THREAD m_workerThread;
-   uint64_t m_messageDrops;
-   uint32_t m_queuedMessages;
-
-   void lock()
-   {
-#ifdef _WIN32
-      EnterCriticalSection(&m_mutex);
-#else
-      pthread_mutex_lock(&m_mutex);
-#endif
-   }
-
-   void unlock()
-   {
-#ifdef _WIN32
-   LeaveCriticalSection(&m_mutex);
-#else
-   pthread_mutex_unlock(&m_mutex);
-#endif
-   }
 
    void workerThread();
 
@@ -97,7 +92,7 @@ class InfluxDBSender
 
    void start();
    void stop();
-   void enqueue(const TCHAR *data);
+   void enqueue(InfluxDBLine *line);
 
    uint64_t getQueueSizeInBytes();
    uint32_t getQueueSizeInMessages();
@@ -180,6 +175,69 @@ class APIv2Sender : public APISender
 
 #endif
 
+/**
+ * Cached tags for object
+ */
+struct ObjectTagCacheEntry
+{
+   StringBuffer tags;
+   bool ignoreMetrics;
+   bool provisional;       // Built within same second as last object modification and may miss changes
+   time_t objectTimestamp;
+};
+
+/**
+ * Cached line prefix for DCI
+ */
+struct DCITagCacheEntry
+{
+   char *prefix;           // Measurement name and tags followed by value field name (UTF-8)
+   const char *suffix;     // Value type marker and separator before timestamp
+   bool ignoreMetrics;
+   bool provisional;
+   time_t ownerTimestamp;
+   uint32_t relatedObjectId;
+   time_t relatedObjectTimestamp;
+   time_t lastUseTime;
+
+   DCITagCacheEntry()
+   {
+      prefix = nullptr;
+      suffix = "";
+      ignoreMetrics = false;
+      provisional = false;
+      ownerTimestamp = 0;
+      relatedObjectId = 0;
+      relatedObjectTimestamp = 0;
+      lastUseTime = 0;
+   }
+
+   ~DCITagCacheEntry()
+   {
+      MemFree(prefix);
+   }
+};
+
+/**
+ * Number of DCI tag cache shards
+ */
+#define DCI_TAG_CACHE_SHARDS  16
+
+/**
+ * DCI tag cache shard
+ */
+struct DCITagCacheShard
+{
+   Mutex mutex;
+   HashMap<uint32_t, DCITagCacheEntry> entries;
+   time_t lastCleanupTime;
+
+   DCITagCacheShard() : mutex(MutexType::FAST), entries(Ownership::True)
+   {
+      lastCleanupTime = time(nullptr);
+   }
+};
+
 /**
  * Driver class definition
  */
@@ -188,6 +246,14 @@ class InfluxDBStorageDriver : public PerfDataStorageDriver
 private:
    ObjectArray<InfluxDBSender> m_senders;
    bool m_enableUnsignedType;
+   DCITagCacheShard m_dciTagCache[DCI_TAG_CACHE_SHARDS];
+   HashMap<uint32_t, ObjectTagCacheEntry> m_objectTagCache;
+   Mutex m_objectTagCacheLock;
+   VolatileCounter64 m_tagCacheHits;
+   VolatileCounter64 m_tagCacheMisses;
+
+   bool getObjectTags(const NetObj& object, StringBuffer *tags);
+   void buildDCITagCacheEntry(DCItem *dci, const NetObj& owner, const NetObj *relatedObject, DCITagCacheEntry *entry);
 
 public:
    InfluxDBStorageDriver();
@@ -35,8 +35,9 @@
 /**
  * Constructor for abstract sender
  */
-InfluxDBSender::InfluxDBSender(const Config& config) : m_hostname(config.getValue(_T("/InfluxDB/Hostname"), _T("localhost")))
+InfluxDBSender::InfluxDBSender(const Config& config) : m_queue(nullptr), m_hostname(config.getValue(_T("/InfluxDB/Hostname"), _T("localhost"))), m_wakeupCondition(false)
 {
+   m_queueSize = 0;
    m_queuedMessages = 0;
    m_messageDrops = 0;
    m_queueFlushThreshold = config.getValueAsUInt(_T("/InfluxDB/QueueFlushThreshold"), 32768);   // Flush after 32K
@@ -44,21 +45,6 @@ InfluxDBSender::InfluxDBSender(const Config& config) : m_hostname(config.getValu
    m_maxCacheWaitTime = config.getValueAsUInt(_T("/InfluxDB/MaxCacheWaitTime"), 30000);
    m_port = static_cast<uint16_t>(config.getValueAsUInt(_T("/InfluxDB/Port"), 0));
    m_lastConnect = 0;
-#ifdef _WIN32
-   InitializeCriticalSectionAndSpinCount(&m_mutex, 4000);
-   InitializeConditionVariable(&m_condition);
-#else
-#if HAVE_DECL_PTHREAD_MUTEX_ADAPTIVE_NP
-   pthread_mutexattr_t a;
-   pthread_mutexattr_init(&a);
-   MUTEXATTR_SETTYPE(&a, PTHREAD_MUTEX_ADAPTIVE_NP);
-   pthread_mutex_init(&m_mutex, &a);
-   pthread_mutexattr_destroy(&a);
-#else
-   pthread_mutex_init(&m_mutex, nullptr);
-#endif
-   pthread_cond_init(&m_condition, nullptr);
-#endif
    m_shutdown = false;
    m_workerThread = INVALID_THREAD_HANDLE;
 }
@@ -69,12 +55,14 @@ InfluxDBSender::InfluxDBSender(const Config& config) : m_hostname(config.getValu
 InfluxDBSender::~InfluxDBSender()
 {
    stop();
-#ifdef _WIN32
-   DeleteCriticalSection(&m_mutex);
-#else
-   pthread_mutex_destroy(&m_mutex);
-   pthread_cond_destroy(&m_condition);
-#endif
+
+   InfluxDBLine *line = m_queue.exchange(nullptr);
+   while(line != nullptr)
+   {
+      InfluxDBLine *next = line->next;
+      MemFree(line);
+      line = next;
+   }
 }
 
 /**
@@ -86,64 +74,42 @@ void InfluxDBSender::workerThread()
 
    while(!m_shutdown)
    {
-#ifdef _WIN32
-      EnterCriticalSection(&m_mutex);
-      if (m_queue.length() < m_queueFlushThreshold)
-      {
-         // SleepConditionVariableCS is subject to spurious wakeups so we need a loop here
-         BOOL signalled = FALSE;
-         uint32_t timeout = m_maxCacheWaitTime;
-         do
-         {
-            int64_t startTime = GetCurrentTimeMs();
-            signalled = SleepConditionVariableCS(&m_condition, &m_mutex, timeout);
-            if (signalled)
-               break;
-            timeout -= std::min(timeout, static_cast<uint32_t>(GetCurrentTimeMs() - startTime));
-         } while (timeout > 0);
-      }
-#else
-      pthread_mutex_lock(&m_mutex);
-      if (m_queue.length() < m_queueFlushThreshold)
-      {
-#if HAVE_PTHREAD_COND_RELTIMEDWAIT_NP
-         struct timespec timeout;
-         timeout.tv_sec = m_maxCacheWaitTime / 1000;
-         timeout.tv_nsec = (m_maxCacheWaitTime % 1000) * 1000000;
-         pthread_cond_reltimedwait_np(&m_condition, &m_mutex, &timeout);
-#else
-         struct timeval now;
-         gettimeofday(&now, nullptr);
+      if (m_queueSize < static_cast<int64_t>(m_queueFlushThreshold))
+         m_wakeupCondition.wait(m_maxCacheWaitTime);
 
-         struct timespec timeout;
-         timeout.tv_sec = now.tv_sec + (m_maxCacheWaitTime / 1000);
-         now.tv_usec += (m_maxCacheWaitTime % 1000) * 1000;
-         timeout.tv_sec += now.tv_usec / 1000000;
-         timeout.tv_nsec = (now.tv_usec % 1000000) * 1000;
-         pthread_cond_timedwait(&m_condition, &m_mutex, &timeout);
-#endif
-      }
-#endif
+      // Take all queued lines at once, producers can continue adding new lines without waiting
+      InfluxDBLine *lines = m_queue.exchange(nullptr, std::memory_order_acquire);
+      if (lines == nullptr)
+         continue;
 
-      if (m_queue.isEmpty())
+      // Restore original order and calculate block size
+      InfluxDBLine *head = nullptr;
+      size_t size = 0;
+      int32_t count = 0;
+      while(lines != nullptr)
       {
-#ifdef _WIN32
-         LeaveCriticalSection(&m_mutex);
-#else
-         pthread_mutex_unlock(&m_mutex);
-#endif
-         continue;
+         InfluxDBLine *next = lines->next;
+         lines->next = head;
+         head = lines;
+         size += lines->length + 1;
+         count++;
+         lines = next;
       }
+      InterlockedAdd64(&m_queueSize, -static_cast<int64_t>(size));
+      InterlockedAdd(&m_queuedMessages, -count);
 
-      char *data = m_queue.getUTF8String();
-      m_queue.clear();
-      m_queuedMessages = 0;
-
-#ifdef _WIN32
-      LeaveCriticalSection(&m_mutex);
-#else
-      pthread_mutex_unlock(&m_mutex);
-#endif
+      char *data = MemAllocStringA(size + 1);
+      char *curr = data;
+      while(head != nullptr)
+      {
+         memcpy(curr, head->data, head->length);
+         curr += head->length;
+         *curr++ = '\n';
+         InfluxDBLine *next = head->next;
+         MemFree(head);
+         head = next;
+      }
+      *curr = 0;
 
       if (!send(data))
       {
@@ -176,42 +142,35 @@ void InfluxDBSender::start()
 void InfluxDBSender::stop()
 {
    m_shutdown = true;
-#ifdef _WIN32
-   WakeAllConditionVariable(&m_condition);
-#else
-   pthread_cond_broadcast(&m_condition);
-#endif
+   m_wakeupCondition.set();
    ThreadJoin(m_workerThread);
    m_workerThread = INVALID_THREAD_HANDLE;
 }
 
 /**
- * Enqueue data
+ * Enqueue data. Sender takes ownership of line object.
  */
-void InfluxDBSender::enqueue(const TCHAR *data)
+void InfluxDBSender::enqueue(InfluxDBLine *line)
 {
-   lock();
-
-   if (m_queue.length() < m_queueSizeLimit)
+   if (m_queueSize >= static_cast<int64_t>(m_queueSizeLimit))
    {
-      m_queue.append(data);
-      m_queue.append(_T('\n'));
-      m_queuedMessages++;
-      if (m_queue.length() >= m_queueFlushThreshold)
-      {
-#ifdef _WIN32
-         WakeAllConditionVariable(&m_condition);
-#else
-         pthread_cond_broadcast(&m_condition);
-#endif
-      }
+      InterlockedIncrement64(&m_messageDrops);
+      MemFree(line);
+      return;
    }
-   else
+
+   // Line size should be calculated before line is added to the queue, because sender thread can take it immediately
+   int64_t size = static_cast<int64_t>(line->length + 1);
+   InfluxDBLine *head = m_queue.load(std::memory_order_relaxed);
+   do
    {
-      m_messageDrops++;
-   }
+      line->next = head;
+   } while(!m_queue.compare_exchange_weak(head, line, std::memory_order_release, std::memory_order_relaxed));
 
-   unlock();
+   InterlockedIncrement(&m_queuedMessages);
+   int64_t queueSize = InterlockedAdd64(&m_queueSize, size);
+   if ((queueSize >= static_cast<int64_t>(m_queueFlushThreshold)) && (queueSize - size < static_cast<int64_t>(m_queueFlushThreshold)))
+      m_wakeupCondition.set();
 }
 
 /**
@@ -219,10 +178,8 @@ void InfluxDBSender::enqueue(const TCHAR *data)
  */
 uint64_t InfluxDBSender::getQueueSizeInBytes()
 {
-   lock();
-   uint64_t s = m_queue.length();
-   unlock();
-   return s;
+   int64_t s = m_queueSize;
+   return (s > 0) ? static_cast<uint64_t>(s) : 0;
 }
 
 /**
@@ -230,10 +187,8 @@ uint64_t InfluxDBSender::getQueueSizeInBytes()
  */
 uint32_t InfluxDBSender::getQueueSizeInMessages()
 {
-   lock();
-   uint32_t s = m_queuedMessages;
-   unlock();
-   return s;
+   int32_t s = m_queuedMessages;
+   return (s > 0) ? static_cast<uint32_t>(s) : 0;
 }
 
 /**
@@ -241,10 +196,7 @@ uint32_t InfluxDBSender::getQueueSizeInMessages()
  */
 bool InfluxDBSender::isFull()
 {
-   lock();
-   bool result = (m_queue.length() >= m_queueSizeLimit);
-   unlock();
-   return result;
+   return m_queueSize >= static_cast<int64_t>(m_queueSizeLimit);
 }
 
 /**
@@ -252,8 +204,5 @@ bool InfluxDBSender::isFull()
  */
 uint64_t InfluxDBSender::getMessageDrops()
 {
-   lock();
-   uint64_t count = m_messageDrops;
-   unlock();
-   return count;
+   return static_cast<uint64_t>(m_messageDrops);
 }
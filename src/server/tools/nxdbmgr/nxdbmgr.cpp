@@ -375,6 +375,7 @@ int main(int argc, char *argv[])
                      _T("   batch <file>         : Run SQL batch file\n")
                      _T("   check                : Check database for errors\n")
                      _T("   check-data-tables    : Check database for missing data tables\n")
+                     _T("   enable-partitioning  : Convert collected data and log tables to time partitioned layout\n")
                      _T("   export <file>        : Export database to file\n")
                      _T("   get <name>           : Get value of server configuration variable\n")
                      _T("   import <file>        : Import database from file\n")
@@ -597,6 +598,7 @@ int main(int argc, char *argv[])
        strcmp(argv[optind], "batch") &&
        strcmp(argv[optind], "check") &&
        strcmp(argv[optind], "check-data-tables") &&
+       strcmp(argv[optind], "enable-partitioning") &&
        strcmp(argv[optind], "export") &&
        strcmp(argv[optind], "get") &&
        strcmp(argv[optind], "import") &&
@@ -818,6 +820,10 @@ int main(int argc, char *argv[])
       {
          UnlockDatabase();
       }
+      else if (!strcmp(argv[optind], "enable-partitioning"))
+      {
+         EnablePartitioning();
+      }
       else if (!strcmp(argv[optind], "export"))
       {
          ExportDatabase(argv[optind + 1], excludedTables, includedTables);
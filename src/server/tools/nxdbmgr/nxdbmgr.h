@@ -54,6 +54,7 @@ void ImportDatabase(const char *file, const StringList& excludedTables, const St
 void MigrateDatabase(const TCHAR *sourceConfig, TCHAR *destConfFields, const StringList& excludedTables, const StringList& includedTables);
 void UpgradeDatabase();
 void UnlockDatabase();
+void EnablePartitioning();
 void ReindexIData();
 
 bool ExecSQLBatch(const char *pszFile, bool showOutput);
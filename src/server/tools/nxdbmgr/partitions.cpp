@@ -0,0 +1,316 @@
+/*
+** nxdbmgr - NetXMS database manager
+** Copyright (C) 2004-2022 Victor Kirhenshtein
+**
+** This program is free software; you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation; either version 2 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+**
+** File: partitions.cpp
+**
+**/
+
+#include "nxdbmgr.h"
+
+/**
+ * Partition interval (one day)
+ */
+#define PARTITION_INTERVAL    86400
+
+/**
+ * Number of days for which partitions are created in advance
+ */
+#define PARTITIONS_AHEAD      7
+
+/**
+ * Table to be partitioned
+ */
+struct PartitionedTable
+{
+   const TCHAR *name;
+   const TCHAR *timestampColumn;
+   const TCHAR *primaryKey;   // Primary key for partitioned table (should include timestamp column)
+   bool perfData;
+};
+
+/**
+ * Tables to be partitioned
+ */
+static const PartitionedTable s_tables[] =
+{
+   { _T("idata"), _T("idata_timestamp"), _T("item_id,idata_timestamp"), true },
+   { _T("tdata"), _T("tdata_timestamp"), _T("item_id,tdata_timestamp"), true },
+   { _T("event_log"), _T("event_timestamp"), _T("event_id,event_timestamp"), false },
+   { _T("syslog"), _T("msg_timestamp"), _T("msg_id,msg_timestamp"), false },
+   { _T("snmp_trap_log"), _T("trap_timestamp"), _T("trap_id,trap_timestamp"), false },
+   { nullptr, nullptr, nullptr, false }
+};
+
+/**
+ * Format partition name suffix for partition starting at given time
+ */
+static void FormatPartitionSuffix(time_t t, TCHAR *buffer)
+{
+#if HAVE_GMTIME_R
+   struct tm tmbuff;
+   struct tm *gmt = gmtime_r(&t, &tmbuff);
+#else
+   struct tm *gmt = gmtime(&t);
+#endif
+   _sntprintf(buffer, 16, _T("p%04d%02d%02d"), gmt->tm_year + 1900, gmt->tm_mon + 1, gmt->tm_mday);
+}
+
+/**
+ * Check if table is already partitioned
+ */
+static bool IsTablePartitioned(const TCHAR *table)
+{
+   TCHAR query[512];
+   switch(g_dbSyntax)
+   {
+      case DB_SYNTAX_PGSQL:
+         _sntprintf(query, 512, _T("SELECT count(*) FROM pg_class WHERE relname='%s' AND relkind='p'"), table);
+         break;
+      case DB_SYNTAX_MYSQL:
+         _sntprintf(query, 512, _T("SELECT count(*) FROM information_schema.partitions WHERE table_schema=DATABASE() AND table_name='%s' AND partition_name IS NOT NULL"), table);
+         break;
+      case DB_SYNTAX_ORACLE:
+         _sntprintf(query, 512, _T("SELECT count(*) FROM user_tables WHERE table_name=UPPER('%s') AND partitioned='YES'"), table);
+         break;
+      default:
+         return false;
+   }
+
+   bool partitioned = false;
+   DB_RESULT hResult = SQLSelect(query);
+   if (hResult != nullptr)
+   {
+      partitioned = (DBGetNumRows(hResult) > 0) && (DBGetFieldLong(hResult, 0, 0) > 0);
+      DBFreeResult(hResult);
+   }
+   return partitioned;
+}
+
+/**
+ * Get upper bound for partition with existing records (start of next day after newest record but not earlier than tomorrow)
+ */
+static time_t GetLegacyPartitionBound(const PartitionedTable *table, time_t tomorrow)
+{
+   TCHAR query[256];
+   _sntprintf(query, 256, _T("SELECT max(%s) FROM %s"), table->timestampColumn, table->name);
+   DB_RESULT hResult = SQLSelect(query);
+   if (hResult == nullptr)
+      return 0;
+
+   time_t bound = tomorrow;
+   if (DBGetNumRows(hResult) > 0)
+   {
+      time_t t = static_cast<time_t>(DBGetFieldInt64(hResult, 0, 0));
+      t = t - t % PARTITION_INTERVAL + PARTITION_INTERVAL;
+      if (t > bound)
+         bound = t;
+   }
+   DBFreeResult(hResult);
+   return bound;
+}
+
+/**
+ * Convert PostgreSQL table. Existing table is renamed and attached to new partitioned table as first partition.
+ * Default partition is created for records which do not fit into any daily partition.
+ */
+static bool ConvertTablePostgreSQL(const PartitionedTable *table, time_t legacyBound, time_t end)
+{
+   // Read index definitions (except primary key) to re-create them on partitioned table
+   TCHAR query[1024];
+   _sntprintf(query, 1024, _T("SELECT indexname,indexdef FROM pg_indexes WHERE tablename='%s' AND indexname NOT IN (SELECT conname FROM pg_constraint WHERE conrelid='%s'::regclass AND contype='p')"), table->name, table->name);
+   DB_RESULT hResult = SQLSelect(query);
+   if (hResult == nullptr)
+      return false;
+   StringList indexDefinitions;
+   int count = DBGetNumRows(hResult);
+   for(int i = 0; i < count; i++)
+      indexDefinitions.addPreallocated(DBGetField(hResult, i, 1, nullptr, 0));
+   DBFreeResult(hResult);
+
+   _sntprintf(query, 1024, _T("SELECT indexname FROM pg_indexes WHERE tablename='%s'"), table->name);
+   hResult = SQLSelect(query);
+   if (hResult == nullptr)
+      return false;
+
+   if (!DBBegin(g_dbHandle))
+   {
+      DBFreeResult(hResult);
+      return false;
+   }
+
+   bool success = SQLQueryFormatted(_T("ALTER TABLE %s RENAME TO %s_legacy"), table->name, table->name);
+   count = DBGetNumRows(hResult);
+   for(int i = 0; (i < count) && success; i++)
+   {
+      TCHAR indexName[256];
+      DBGetField(hResult, i, 0, indexName, 256);
+      success = SQLQueryFormatted(_T("ALTER INDEX %s RENAME TO %s_legacy"), indexName, indexName);
+   }
+   DBFreeResult(hResult);
+
+   if (success)
+      success = SQLQueryFormatted(_T("CREATE TABLE %s (LIKE %s_legacy INCLUDING DEFAULTS) PARTITION BY RANGE (%s)"), table->name, table->name, table->timestampColumn);
+   if (success)
+      success = SQLQueryFormatted(_T("ALTER TABLE %s ADD PRIMARY KEY (%s)"), table->name, table->primaryKey);
+   for(int i = 0; (i < indexDefinitions.size()) && success; i++)
+      success = SQLQuery(indexDefinitions.get(i));
+   if (success)
+      success = SQLQueryFormatted(_T("ALTER TABLE %s ATTACH PARTITION %s_legacy FOR VALUES FROM (MINVALUE) TO (") INT64_FMT _T(")"),
+               table->name, table->name, static_cast<int64_t>(legacyBound));
+   for(time_t t = legacyBound; (t < end) && success; t += PARTITION_INTERVAL)
+   {
+      TCHAR suffix[16];
+      FormatPartitionSuffix(t, suffix);
+      success = SQLQueryFormatted(_T("CREATE TABLE %s_%s PARTITION OF %s FOR VALUES FROM (") INT64_FMT _T(") TO (") INT64_FMT _T(")"),
+               table->name, suffix, table->name, static_cast<int64_t>(t), static_cast<int64_t>(t + PARTITION_INTERVAL));
+   }
+
+   // Default partition keeps records outside of ranges of existing partitions
+   if (success)
+      success = SQLQueryFormatted(_T("CREATE TABLE %s_default PARTITION OF %s DEFAULT"), table->name, table->name);
+
+   if (success)
+      DBCommit(g_dbHandle);
+   else
+      DBRollback(g_dbHandle);
+   return success;
+}
+
+/**
+ * Convert MySQL table. Existing records are placed into first partition.
+ */
+static bool ConvertTableMySQL(const PartitionedTable *table, time_t legacyBound, time_t end)
+{
+   // All unique keys (including primary key) must include partitioning column
+   if (!SQLQueryFormatted(_T("ALTER TABLE %s DROP PRIMARY KEY, ADD PRIMARY KEY (%s)"), table->name, table->primaryKey))
+      return false;
+
+   StringBuffer query(_T("ALTER TABLE "));
+   query.append(table->name);
+   query.append(_T(" PARTITION BY RANGE ("));
+   query.append(table->timestampColumn);
+   query.append(_T(") (PARTITION p_legacy VALUES LESS THAN ("));
+   query.append(static_cast<int64_t>(legacyBound));
+   query.append(_T("),"));
+   for(time_t t = legacyBound; t < end; t += PARTITION_INTERVAL)
+   {
+      TCHAR suffix[16];
+      FormatPartitionSuffix(t, suffix);
+      query.append(_T("PARTITION "));
+      query.append(suffix);
+      query.append(_T(" VALUES LESS THAN ("));
+      query.append(static_cast<int64_t>(t + PARTITION_INTERVAL));
+      query.append(_T("),"));
+   }
+   query.append(_T("PARTITION pmax VALUES LESS THAN MAXVALUE)"));
+   return SQLQuery(query);
+}
+
+/**
+ * Convert Oracle table. Interval partitioning is used, so new partitions will be created by database automatically.
+ */
+static bool ConvertTableOracle(const PartitionedTable *table, time_t legacyBound)
+{
+   return SQLQueryFormatted(_T("ALTER TABLE %s MODIFY PARTITION BY RANGE (%s) INTERVAL (%d) (PARTITION p_legacy VALUES LESS THAN (") INT64_FMT _T(")) ONLINE UPDATE INDEXES"),
+            table->name, table->timestampColumn, PARTITION_INTERVAL, static_cast<int64_t>(legacyBound));
+}
+
+/**
+ * Convert collected data and log tables to time partitioned layout
+ */
+void EnablePartitioning()
+{
+   if ((g_dbSyntax != DB_SYNTAX_PGSQL) && (g_dbSyntax != DB_SYNTAX_MYSQL) && (g_dbSyntax != DB_SYNTAX_ORACLE))
+   {
+      _tprintf(_T("Table partitioning is only supported for PostgreSQL, MySQL, and Oracle databases\n"));
+      return;
+   }
+
+   if (!ValidateDatabase())
+      return;
+
+   if (g_dbSyntax == DB_SYNTAX_PGSQL)
+   {
+      DB_RESULT hResult = SQLSelect(_T("SHOW server_version_num"));
+      if (hResult == nullptr)
+         return;
+      int32_t version = DBGetFieldLong(hResult, 0, 0);
+      DBFreeResult(hResult);
+      if (version < 110000)
+      {
+         _tprintf(_T("Table partitioning requires PostgreSQL 11 or later\n"));
+         return;
+      }
+   }
+
+   bool singleTablePerfData = (DBMgrMetaDataReadInt32(_T("SingeTablePerfData"), 0) != 0);
+
+   WriteToTerminal(_T("\n\n\x1b[1mWARNING!!!\x1b[0m\n"));
+   if (!GetYesNo(_T("This operation will convert collected data and log tables to partitioned layout. Depending on database size it may take long time.\nAre you sure?")))
+      return;
+
+   time_t now = time(nullptr);
+   time_t tomorrow = now - now % PARTITION_INTERVAL + PARTITION_INTERVAL;
+   time_t end = tomorrow + PARTITIONS_AHEAD * PARTITION_INTERVAL;
+
+   bool success = true;
+   for(int i = 0; s_tables[i].name != nullptr; i++)
+   {
+      const PartitionedTable *table = &s_tables[i];
+      if (table->perfData && !singleTablePerfData)
+      {
+         _tprintf(_T("Table %s skipped (single table mode for collected data is not enabled)\n"), table->name);
+         continue;
+      }
+
+      if (IsTablePartitioned(table->name))
+      {
+         _tprintf(_T("Table %s is already partitioned\n"), table->name);
+         continue;
+      }
+
+      time_t legacyBound = GetLegacyPartitionBound(table, tomorrow);
+      if (legacyBound == 0)
+      {
+         success = false;
+         break;
+      }
+
+      WriteToTerminalEx(_T("Converting table \x1b[1m%s\x1b[0m\n"), table->name);
+      switch(g_dbSyntax)
+      {
+         case DB_SYNTAX_PGSQL:
+            success = ConvertTablePostgreSQL(table, legacyBound, std::max(end, legacyBound + PARTITION_INTERVAL));
+            break;
+         case DB_SYNTAX_MYSQL:
+            success = ConvertTableMySQL(table, legacyBound, std::max(end, legacyBound + PARTITION_INTERVAL));
+            break;
+         case DB_SYNTAX_ORACLE:
+            success = ConvertTableOracle(table, legacyBound);
+            break;
+      }
+      if (!success)
+      {
+         _tprintf(_T("Conversion of table %s failed\n"), table->name);
+         break;
+      }
+   }
+
+   if (success && DBMgrMetaDataWriteInt32(_T("PartitionedTables"), 1))
+      _tprintf(_T("Table partitioning enabled\n"));
+}
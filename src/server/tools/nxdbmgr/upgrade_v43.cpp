@@ -22,6 +22,126 @@
 
 #include "nxdbmgr.h"
 
+/**
+ * Upgrade from 43.14 to 43.15
+ */
+static bool H_UpgradeFromV14()
+{
+   CHK_EXEC(CreateConfigParam(_T("Objects.NetworkMaps.FullUpdateInterval"), _T("3600"), _T("Interval between full rebuilds of all automatically populated network maps. Between full rebuilds only maps containing objects with changed topology are updated."), _T("seconds"), 'I', true, true, false, false));
+   CHK_EXEC(SetMinorSchemaVersion(15));
+   return true;
+}
+
+/**
+ * Upgrade from 43.13 to 43.14
+ */
+static bool H_UpgradeFromV13()
+{
+   CHK_EXEC(CreateConfigParam(_T("DataCollection.CacheSnapshot.Enable"), _T("1"), _T("Enable/disable saving DCI value cache snapshot to local file on server shutdown and restoring cached values from it on server startup."), nullptr, 'B', true, false, false, false));
+   CHK_EXEC(SetMinorSchemaVersion(14));
+   return true;
+}
+
+/**
+ * Upgrade from 43.12 to 43.13
+ */
+static bool H_UpgradeFromV12()
+{
+   CHK_EXEC(CreateConfigParam(_T("DBConnectionPool.Background.BaseSize"), _T("0"), _T("A number of connections in background tasks connection pool created on the server startup."), _T("connections"), 'I', true, true, false, false));
+   CHK_EXEC(CreateConfigParam(_T("DBConnectionPool.Background.MaxSize"), _T("10"), _T("A maximum number of connections in background tasks connection pool."), _T("connections"), 'I', true, true, false, false));
+   CHK_EXEC(CreateConfigParam(_T("DBConnectionPool.Housekeeping.BaseSize"), _T("0"), _T("A number of connections in housekeeping connection pool created on the server startup."), _T("connections"), 'I', true, true, false, false));
+   CHK_EXEC(CreateConfigParam(_T("DBConnectionPool.Housekeeping.MaxSize"), _T("4"), _T("A maximum number of connections in housekeeping connection pool."), _T("connections"), 'I', true, true, false, false));
+   CHK_EXEC(CreateConfigParam(_T("DBConnectionPool.Writers.BaseSize"), _T("2"), _T("A number of connections in background writers connection pool created on the server startup."), _T("connections"), 'I', true, true, false, false));
+   CHK_EXEC(CreateConfigParam(_T("DBConnectionPool.Writers.MaxSize"), _T("20"), _T("A maximum number of connections in background writers connection pool."), _T("connections"), 'I', true, true, false, false));
+   CHK_EXEC(SetMinorSchemaVersion(13));
+   return true;
+}
+
+/**
+ * Upgrade from 43.11 to 43.12
+ */
+static bool H_UpgradeFromV11()
+{
+   CHK_EXEC(CreateConfigParam(_T("DBConnectionPool.StatementCacheSize"), _T("32"), _T("Maximum number of prepared statements cached on each pooled database connection. Set to 0 to disable statement cache."), _T("statements"), 'I', true, true, false, false));
+   CHK_EXEC(SetMinorSchemaVersion(12));
+   return true;
+}
+
+/**
+ * Upgrade from 43.10 to 43.11
+ */
+static bool H_UpgradeFromV10()
+{
+   CHK_EXEC(CreateConfigParam(_T("Objects.StartupBulkLoad"), _T("1"), _T("Enable/disable reading of object configuration tables in bulk for each object class on server startup instead of querying them separately for each object."), nullptr, 'B', true, true, false, false));
+   CHK_EXEC(CreateConfigParam(_T("Objects.StartupLoaderThreads"), _T("4"), _T("Number of threads used for reading object configuration tables and constructing objects on server startup."), nullptr, 'I', true, true, false, false));
+   CHK_EXEC(SetMinorSchemaVersion(11));
+   return true;
+}
+
+/**
+ * Upgrade from 43.9 to 43.10
+ */
+static bool H_UpgradeFromV9()
+{
+   CHK_EXEC(CreateConfigParam(_T("DataCollection.TableStorage.BinaryFormat"), _T("1"), _T("Store table DCI values in compact binary format instead of XML. Old values in XML format remain readable."), nullptr, 'B', true, true, false, false));
+   CHK_EXEC(CreateConfigParam(_T("DataCollection.TableStorage.KeyframeInterval"), _T("0"), _T("Number of table DCI values stored as delta against previous full value before next full value is stored. Value of 0 or 1 disables delta encoding. Used only when binary storage format is enabled."), nullptr, 'I', true, true, false, false));
+   CHK_EXEC(SetMinorSchemaVersion(10));
+   return true;
+}
+
+/**
+ * Upgrade from 43.8 to 43.9
+ */
+static bool H_UpgradeFromV8()
+{
+   CHK_EXEC(CreateConfigParam(_T("AgentTunnels.OutboundQueueSize"), _T("4096"), _T("Size of outbound message queue for each agent tunnel. Senders are throttled when queue size exceeds this limit, and messages are discarded when queue size exceeds four times this limit."), _T("kilobytes"), 'I', true, true, false, false));
+   CHK_EXEC(SetMinorSchemaVersion(9));
+   return true;
+}
+
+/**
+ * Upgrade from 43.7 to 43.8
+ */
+static bool H_UpgradeFromV7()
+{
+   CHK_EXEC(CreateConfigParam(_T("AuditLog.FullObjectSnapshots"), _T("0"), _T("When enabled, audit log records for object and data collection configuration changes contain full object snapshots instead of changed fields only."), nullptr, 'B', true, false, false, false));
+   CHK_EXEC(SetMinorSchemaVersion(8));
+   return true;
+}
+
+/**
+ * Upgrade from 43.6 to 43.7
+ */
+static bool H_UpgradeFromV6()
+{
+   CHK_EXEC(CreateConfigParam(_T("Events.Deduplication.Enable"), _T("0"), _T("Enable/disable collapsing of identical events (same code, source, DCI, and parameters) received within deduplication window into single event with repeat count."), nullptr, 'B', true, true, false, false));
+   CHK_EXEC(CreateConfigParam(_T("Events.Deduplication.IgnoredParameters"), _T(""), _T("Comma separated list of event parameter names ignored when comparing events for deduplication."), nullptr, 'S', true, true, false, false));
+   CHK_EXEC(CreateConfigParam(_T("Events.Deduplication.MaxEntries"), _T("65536"), _T("Maximum number of active event deduplication windows. Events which do not fit are processed without deduplication."), nullptr, 'I', true, true, false, false));
+   CHK_EXEC(CreateConfigParam(_T("Events.Deduplication.Window"), _T("30"), _T("Time window for event deduplication."), _T("seconds"), 'I', true, true, false, false));
+   CHK_EXEC(SetMinorSchemaVersion(7));
+   return true;
+}
+
+/**
+ * Upgrade from 43.5 to 43.6
+ */
+static bool H_UpgradeFromV5()
+{
+   CHK_EXEC(CreateConfigParam(_T("Housekeeper.DataCleanupThreads"), _T("3"), _T("Number of threads used by housekeeper for collected data cleanup (should be less than maximum size of housekeeping database connection pool)."), nullptr, 'I', true, false, false, false));
+   CHK_EXEC(SetMinorSchemaVersion(6));
+   return true;
+}
+
+/**
+ * Upgrade from 43.4 to 43.5
+ */
+static bool H_UpgradeFromV4()
+{
+   CHK_EXEC(CreateConfigParam(_T("ICMP.MaxPacketRate"), _T("1000"), _T("Maximum rate of ICMP echo requests sent by ICMP polls and address range scans (0 to disable rate limiting)."), _T("packets per second"), 'I', true, false, false, false));
+   CHK_EXEC(SetMinorSchemaVersion(5));
+   return true;
+}
+
 /**
  * Upgrade from 43.3 to 43.4
  */
@@ -208,6 +328,17 @@ static struct
    int nextMinor;
    bool (*upgradeProc)();
 } s_dbUpgradeMap[] = {
+   { 14, 43, 15, H_UpgradeFromV14 },
+   { 13, 43, 14, H_UpgradeFromV13 },
+   { 12, 43, 13, H_UpgradeFromV12 },
+   { 11, 43, 12, H_UpgradeFromV11 },
+   { 10, 43, 11, H_UpgradeFromV10 },
+   { 9,  43, 10, H_UpgradeFromV9  },
+   { 8,  43, 9,  H_UpgradeFromV8  },
+   { 7,  43, 8,  H_UpgradeFromV7  },
+   { 6,  43, 7,  H_UpgradeFromV6  },
+   { 5,  43, 6,  H_UpgradeFromV5  },
+   { 4,  43, 5,  H_UpgradeFromV4  },
    { 3,  43, 4,  H_UpgradeFromV3  },
    { 2,  43, 3,  H_UpgradeFromV2  },
    { 1,  43, 2,  H_UpgradeFromV1  },
@@ -142,4 +142,87 @@ void TestMessageClass()
    }
    EndTest(GetCurrentTimeMs() - start);
 #endif
+
+   StartTest(_T("NXCP message deserialization"));
+
+   NXCPMessage smsg(CMD_GET_PARAMETER, 17);
+   smsg.setField(1, static_cast<uint32_t>(0x01020304));
+   smsg.setField(2, _ULL(0x0102030405060708));
+   smsg.setField(3, static_cast<uint16_t>(0x0102));
+   smsg.setField(4, 3.5);
+   smsg.setField(5, _T("test text"));
+   smsg.setFieldFromUtf8String(6, "utf8 text");
+   smsg.setField(7, InetAddress::parse("10.0.0.1"));
+   BYTE binData[5] = { 1, 2, 3, 4, 5 };
+   smsg.setField(8, binData, 5);
+   binMsg = smsg.serialize(false);
+   AssertNotNull(binMsg);
+
+   dmsg = NXCPMessage::deserialize(binMsg);
+   AssertNotNull(dmsg);
+   AssertEquals(dmsg->getCode(), CMD_GET_PARAMETER);
+   AssertEquals(dmsg->getId(), 17);
+   AssertEquals(dmsg->getFieldAsUInt32(1), 0x01020304);
+   AssertEquals(dmsg->getFieldAsUInt64(2), _ULL(0x0102030405060708));
+   AssertEquals(dmsg->getFieldAsUInt16(3), 0x0102);
+   AssertTrue(dmsg->getFieldAsDouble(4) == 3.5);
+   AssertTrue(!safe_tcscmp(dmsg->getFieldAsString(5, buffer, 64), _T("test text")));
+   AssertTrue(dmsg->getFieldAsInetAddress(7).equals(InetAddress::parse("10.0.0.1")));
+
+   size_t size;
+   const char *utf8 = dmsg->getUtf8StringFieldPtr(6, &size);
+   AssertNotNull(utf8);
+   AssertEquals(size, 9);
+   AssertTrue(!memcmp(utf8, "utf8 text", 9));
+   AssertNull(dmsg->getUtf8StringFieldPtr(1, &size));
+   AssertEquals(size, 0);
+
+   const BYTE *binPtr = dmsg->getBinaryFieldPtr(8, &size);
+   AssertNotNull(binPtr);
+   AssertEquals(size, 5);
+   AssertTrue(!memcmp(binPtr, binData, 5));
+
+   // Message fields should not depend on source buffer
+   memset(binMsg, 0, ntohl(binMsg->size));
+   MemFree(binMsg);
+   AssertTrue(!safe_tcscmp(dmsg->getFieldAsString(6, buffer, 64), _T("utf8 text")));
+
+   TCHAR *pooledString = dmsg->getFieldAsString(5, dmsg->getMemoryPool());
+   AssertTrue(!safe_tcscmp(pooledString, _T("test text")));
+
+   // Copy should be independent from original message
+   NXCPMessage *cmsg = new NXCPMessage(*dmsg);
+   dmsg->setField(5, _T("changed"));
+   delete dmsg;
+   AssertEquals(cmsg->getFieldAsUInt32(1), 0x01020304);
+   AssertTrue(!safe_tcscmp(cmsg->getFieldAsString(5, buffer, 64), _T("test text")));
+   AssertTrue(!safe_tcscmp(cmsg->getFieldAsString(6, buffer, 64), _T("utf8 text")));
+
+   // Re-serialized copy should match original
+   binMsg = cmsg->serialize(false);
+   dmsg = NXCPMessage::deserialize(binMsg);
+   MemFree(binMsg);
+   AssertNotNull(dmsg);
+   AssertEquals(dmsg->getFieldAsUInt64(2), _ULL(0x0102030405060708));
+   AssertTrue(!safe_tcscmp(dmsg->getFieldAsString(5, buffer, 64), _T("test text")));
+   delete dmsg;
+   delete cmsg;
+
+   EndTest();
+
+#if !WITH_ADDRESS_SANITIZER
+   StartTest(_T("NXCP message deserialization performance"));
+   smsg.deleteAllFields();
+   for(uint32_t i = 0; i < 200; i++)
+      smsg.setField(VID_ENUM_VALUE_BASE + i, longText);
+   binMsg = smsg.serialize(false);
+   start = GetCurrentTimeMs();
+   for(int i = 0; i < 10000; i++)
+   {
+      NXCPMessage *m = NXCPMessage::deserialize(binMsg);
+      delete m;
+   }
+   MemFree(binMsg);
+   EndTest(GetCurrentTimeMs() - start);
+#endif
 }
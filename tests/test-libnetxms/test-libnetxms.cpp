@@ -496,6 +496,85 @@ static void TestPatternMatching()
    EndTest();
 }
 
+/**
+ * Find first matching pattern by sequential scan
+ */
+static int FindPatternLinear(const StringList& patterns, const TCHAR *name)
+{
+   for(int i = 0; i < patterns.size(); i++)
+      if (MatchString(patterns.get(i), name, false))
+         return i;
+   return -1;
+}
+
+/**
+ * Test pattern index
+ */
+static void TestPatternIndex()
+{
+   static const TCHAR *patterns[] =
+   {
+      _T("Agent.Version"), _T("System.CPU.Usage"), _T("System.CPU.Usage(*)"), _T("System.Uptime"),
+      _T("FileSystem.Free(*)"), _T("FileSystem.Used(*)"), _T("Net.Interface.BytesIn(*)"), _T("Net.Interface.BytesOut(*)"),
+      _T("Process.Count(*)"), _T("Process.CountEx(*)"), _T("Custom.*"), _T("*.Debug"), _T("system.uptime"),
+      _T("File.Hash.MD5(*)"), _T("File.Hash.MD5(/etc/passwd)"), _T("Net.IP.Forwarding"), _T("Test(?)"), _T("Test(*"),
+      _T("Test("), _T("DB.Query(*,*)"), _T("??.Status"), _T("Net.Interface.BytesIn(eth0)"), nullptr
+   };
+   static const TCHAR *names[] =
+   {
+      _T("Agent.Version"), _T("agent.version"), _T("System.CPU.Usage"), _T("System.CPU.Usage(1)"), _T("SYSTEM.CPU.USAGE(2)"),
+      _T("System.CPU.Usage("), _T("System.CPU.Usage()"), _T("System.Uptime"), _T("FileSystem.Free(/)"), _T("FileSystem.Free"),
+      _T("Net.Interface.BytesIn(eth0)"), _T("Net.Interface.BytesIn(eth1)"), _T("Process.Count(nxagentd)"),
+      _T("Custom.Metric(1)"), _T("Custom."), _T("Agent.Debug"), _T("File.Hash.MD5(/etc/passwd)"), _T("File.Hash.MD5(/etc/hosts)"),
+      _T("Test(1)"), _T("Test(12)"), _T("Test("), _T("Test(1,2"), _T("DB.Query(a,b)"), _T("DB.Query(a)"), _T("DB.Status"),
+      _T("Unknown.Metric"), _T("Unknown.Metric(1)"), _T("("), _T(""), _T("*"), nullptr
+   };
+
+   StartTest(_T("Pattern index - lookup"));
+   PatternIndex index;
+   StringList list;
+   for(int i = 0; patterns[i] != nullptr; i++)
+   {
+      AssertEquals(index.add(patterns[i]), i);
+      list.add(patterns[i]);
+   }
+   AssertEquals(index.size(), list.size());
+   for(int i = 0; names[i] != nullptr; i++)
+      AssertEquals(index.find(names[i]), FindPatternLinear(list, names[i]));
+   AssertEquals(index.find(_T("System.Uptime")), 3);
+   AssertEquals(index.find(_T("Custom.Metric(1)")), 10);
+   AssertEquals(index.find(_T("Unknown.Metric")), -1);
+   EndTest();
+
+   StartTest(_T("Pattern index - compare with sequential lookup"));
+   index.clear();
+   list.clear();
+   for(int i = 0; i < 2000; i++)
+   {
+      TCHAR pattern[64];
+      _sntprintf(pattern, 64, (i % 3 == 0) ? _T("Metric%d.Value") : _T("Metric%d.Value(*)"), i % 1500);
+      index.add(pattern);
+      list.add(pattern);
+   }
+   index.add(_T("Metric1?.*"));
+   list.add(_T("Metric1?.*"));
+   IntegerArray<int32_t> expected(3000, 1000);
+   for(int i = 0; i < 3000; i++)
+   {
+      TCHAR name[64];
+      _sntprintf(name, 64, (i % 2 == 0) ? _T("metric%d.value") : _T("Metric%d.Value(%d)"), i, i);
+      expected.add(FindPatternLinear(list, name));
+   }
+   int64_t start = GetCurrentTimeMs();
+   for(int i = 0; i < 3000; i++)
+   {
+      TCHAR name[64];
+      _sntprintf(name, 64, (i % 2 == 0) ? _T("metric%d.value") : _T("Metric%d.Value(%d)"), i, i);
+      AssertEquals(index.find(name), expected.get(i));
+   }
+   EndTest(GetCurrentTimeMs() - start);
+}
+
 /**
  * Test string class
  */
@@ -1709,6 +1788,74 @@ static void TestTable()
    AssertTrue(!_tcscmp(table2->getAsString(15, 0), table->getAsString(15, 0)));
    EndTest(GetCurrentTimeMs() - start);
 
+   StartTest(_T("Table: pack binary"));
+   start = GetCurrentTimeMs();
+   table->setStatusAt(3, 2, 4);
+   table->setCellObjectIdAt(4, 0, 1234);
+   packedTable = table->createPackedBinary();
+   AssertNotNull(packedTable);
+   AssertEquals(Table::getPackedDataReference(packedTable), 0);
+   EndTest(GetCurrentTimeMs() - start);
+
+   StartTest(_T("Table: unpack binary"));
+   start = GetCurrentTimeMs();
+   Table *binaryTable = Table::createFromPackedData(packedTable);
+   AssertNotNull(binaryTable);
+   AssertEquals(binaryTable->getNumColumns(), table->getNumColumns());
+   AssertEquals(binaryTable->getNumRows(), table->getNumRows());
+   for(int r = 0; r < table->getNumRows(); r++)
+   {
+      for(int c = 0; c < table->getNumColumns(); c++)
+      {
+         const TCHAR *v1 = table->getAsString(r, c);
+         const TCHAR *v2 = binaryTable->getAsString(r, c);
+         AssertTrue((v1 == nullptr) ? (v2 == nullptr) : ((v2 != nullptr) && !_tcscmp(v1, v2)));
+      }
+   }
+   AssertEquals(binaryTable->getStatus(3, 2), 4);
+   AssertEquals(binaryTable->getCellObjectId(4, 0), 1234);
+   delete binaryTable;
+
+   // Old entry point should accept binary format as well
+   binaryTable = Table::createFromPackedXML(packedTable);
+   AssertNotNull(binaryTable);
+   AssertEquals(binaryTable->getNumRows(), table->getNumRows());
+   delete binaryTable;
+   MemFree(packedTable);
+   EndTest(GetCurrentTimeMs() - start);
+
+   StartTest(_T("Table: unpack binary selected columns"));
+   StringList columns;
+   columns.add(_T("data2"));
+   packedTable = table->createPackedBinary();
+   binaryTable = Table::createFromPackedData(packedTable, nullptr, &columns);
+   MemFree(packedTable);
+   AssertNotNull(binaryTable);
+   AssertEquals(binaryTable->getNumColumns(), 1);
+   AssertEquals(binaryTable->getNumRows(), table->getNumRows());
+   AssertEquals(binaryTable->getAsInt(10, 0), table->getAsInt(10, 3));
+   delete binaryTable;
+   EndTest();
+
+   StartTest(_T("Table: pack binary with delta"));
+   Table *nextSample = new Table(*table);
+   nextSample->setAt(10, 1, _T("changed"));
+   nextSample->setAt(20, 3, 42);
+   packedTable = nextSample->createPackedBinary(table, 1000);
+   AssertEquals(Table::getPackedDataReference(packedTable), 1000);
+   AssertNull(Table::createFromPackedData(packedTable));
+   binaryTable = Table::createFromPackedData(packedTable, table);
+   MemFree(packedTable);
+   AssertNotNull(binaryTable);
+   AssertEquals(binaryTable->getNumRows(), nextSample->getNumRows());
+   AssertTrue(!_tcscmp(binaryTable->getAsString(10, 1), _T("changed")));
+   AssertEquals(binaryTable->getAsInt(20, 3), 42);
+   AssertTrue(!_tcscmp(binaryTable->getAsString(15, 0), table->getAsString(15, 0)));
+   AssertEquals(binaryTable->getAsInt(30, 2), table->getAsInt(30, 2));
+   delete binaryTable;
+   delete nextSample;
+   EndTest();
+
    StartTest(_T("Table: merge"));
    Table *table3 = new Table();
    table3->addColumn(_T("NAME"));
@@ -2118,6 +2265,53 @@ static void TestDebugTags()
    EndTest();
 }
 
+/**
+ * Log writer thread for background writer test
+ */
+static void LogWriterThread(int threadNumber)
+{
+   for(int i = 0; i < 2000; i++)
+      nxlog_write_tag(NXLOG_INFO, _T("test.log"), _T("Thread %d message %d"), threadNumber, i);
+}
+
+/**
+ * Test background log writer
+ */
+static void TestBackgroundLogWriter()
+{
+   StartTest(_T("Background log writer"));
+   AssertTrue(nxlog_open(_T("test-libnetxms.log"), NXLOG_BACKGROUND_WRITER));
+   THREAD threads[8];
+   for(int i = 0; i < 8; i++)
+      threads[i] = ThreadCreateEx(LogWriterThread, i);
+   for(int i = 0; i < 8; i++)
+      ThreadJoin(threads[i]);
+   nxlog_close();
+
+   FILE *f = _tfopen(_T("test-libnetxms.log"), _T("r"));
+   AssertNotNull(f);
+   int count = 0;
+   int lastMessage[8] = { -1, -1, -1, -1, -1, -1, -1, -1 };
+   char line[1024];
+   while(fgets(line, 1024, f) != nullptr)
+   {
+      const char *p = strstr(line, "] Thread ");
+      if (p == nullptr)
+         continue;
+      AssertNotNull(strstr(line, " *I* [test.log"));
+      int t, m;
+      AssertEquals(sscanf(p, "] Thread %d message %d", &t, &m), 2);
+      AssertTrue((t >= 0) && (t < 8));
+      AssertEquals(m, lastMessage[t] + 1);   // Messages from same thread should be in order
+      lastMessage[t] = m;
+      count++;
+   }
+   fclose(f);
+   _tremove(_T("test-libnetxms.log"));
+   AssertEquals(count, 16000);
+   EndTest();
+}
+
 /**
  * Debug writer for logger
  */
@@ -2182,6 +2376,7 @@ int main(int argc, char *argv[])
    TestStringFunctionsA();
    TestStringFunctionsW();
    TestPatternMatching();
+   TestPatternIndex();
    TestMessageClass();
    TestMsgWaitQueue();
    TestMacAddress();
@@ -2201,6 +2396,7 @@ int main(int argc, char *argv[])
    TestRingBuffer();
    TestDebugLevel();
    TestDebugTags();
+   TestBackgroundLogWriter();
    TestGeoLocation();
 
    if (debug)
@@ -124,6 +124,40 @@ static void CommonTests(const TCHAR *prefix, const TCHAR *driver, const TCHAR *s
    AssertEquals(count, 200);
    EndTest();
 
+   /*** prepared statement cache ***/
+   StartTest(prefix, _T("prepared statement cache"));
+   DBSetStatementCacheSize(session, 2);
+   hStmt = DBPrepareEx(session, _T("SELECT value2_new FROM nx_test WHERE id=?"), false, buffer);
+   AssertNotNullEx(hStmt, buffer);
+   DBFreeStatement(hStmt);
+   DB_STATEMENT hStmt2 = DBPrepareEx(session, _T("SELECT value2_new FROM nx_test WHERE id=?"), false, buffer);
+   AssertTrue(hStmt2 == hStmt);
+   DBBind(hStmt2, 1, DB_SQLTYPE_INTEGER, (INT32)42);
+   hResult = DBSelectPreparedEx(hStmt2, buffer);
+   AssertNotNullEx(hResult, buffer);
+   AssertEquals(DBGetFieldLong(hResult, 0, 0), 42);
+   DBFreeResult(hResult);
+   DBFreeStatement(hStmt2);
+   hStmt2 = DBPrepareEx(session, _T("SELECT value2_new FROM nx_test WHERE id=?"), false, buffer);
+   AssertTrue(hStmt2 == hStmt);
+   hResult = DBSelectPreparedEx(hStmt2, buffer);  // parameter bound by previous user should be cleared
+   AssertNotNullEx(hResult, buffer);
+   AssertEquals(DBGetNumRows(hResult), 0);
+   DBFreeResult(hResult);
+   DBFreeStatement(hStmt2);
+   DBFreeStatement(DBPrepare(session, _T("SELECT value1 FROM nx_test WHERE id=?")));
+   DBFreeStatement(DBPrepare(session, _T("SELECT id FROM nx_test WHERE value2_new=?")));
+   uint64_t hits, misses;
+   DBGetStatementCacheStats(session, &hits, &misses);
+   AssertEquals(hits, 2);
+   AssertEquals(misses, 3);
+   DBFreeStatement(DBPrepare(session, _T("SELECT value2_new FROM nx_test WHERE id=?")));  // should be evicted
+   DBGetStatementCacheStats(session, &hits, &misses);
+   AssertEquals(hits, 2);
+   AssertEquals(misses, 4);
+   DBSetStatementCacheSize(session, 0);
+   EndTest();
+
    /*** drop test table ***/
    StartTest(prefix, _T("drop test table"));
    AssertTrue(DBQuery(session, _T("DROP TABLE nx_test")));
@@ -137,6 +171,71 @@ static void CommonTests(const TCHAR *prefix, const TCHAR *driver, const TCHAR *s
    EndTest();
 }
 
+/**
+ * Connection pool test thread
+ */
+static void PoolWaiterThread(int64_t *waitTime)
+{
+   int64_t startTime = GetCurrentTimeMs();
+   DB_HANDLE hdb = DBConnectionPoolAcquireConnectionEx(DBConnectionPoolClass::HOUSEKEEPING);
+   *waitTime = GetCurrentTimeMs() - startTime;
+   DBConnectionPoolReleaseConnection(hdb);
+}
+
+/**
+ * Connection pool tests
+ */
+static void TestConnectionPool(const TCHAR *prefix, const TCHAR *driver, const TCHAR *server,
+         const TCHAR *dbName, const TCHAR *login, const TCHAR *password)
+{
+   StartTest(prefix, _T("connection pool startup"));
+   DB_DRIVER drv = DBLoadDriver(driver, _T(""), NULL, NULL);
+   AssertNotNull(drv);
+   DBConnectionPoolSetClassLimits(DBConnectionPoolClass::HOUSEKEEPING, 0, 1);
+   AssertTrue(DBConnectionPoolStartup(drv, server, dbName, login, password, NULL, 1, 2, 300, 0));
+   DBConnectionPoolClassStats stats;
+   DBConnectionPoolGetClassStats(DBConnectionPoolClass::INTERACTIVE, &stats);
+   AssertEquals(stats.size, 1);
+   DBConnectionPoolGetClassStats(DBConnectionPoolClass::HOUSEKEEPING, &stats);
+   AssertEquals(stats.size, 0);
+   EndTest();
+
+   StartTest(prefix, _T("connection pool class isolation"));
+   DB_HANDLE hk = DBConnectionPoolAcquireConnectionEx(DBConnectionPoolClass::HOUSEKEEPING);
+   AssertNotNull(hk);
+   int64_t waitTime = -1;
+   THREAD waiter = ThreadCreateEx(PoolWaiterThread, &waitTime);
+   ThreadSleepMs(200);
+   DBConnectionPoolGetClassStats(DBConnectionPoolClass::HOUSEKEEPING, &stats);
+   AssertEquals(stats.size, 1);
+   AssertEquals(stats.waiting, 1);
+
+   // Interactive class should not be affected by exhausted housekeeping class
+   DB_HANDLE h1 = DBConnectionPoolAcquireConnection();
+   DB_HANDLE h2 = DBConnectionPoolAcquireConnection();
+   AssertNotNull(h1);
+   AssertNotNull(h2);
+   AssertTrue(h1 != h2);
+   DBConnectionPoolReleaseConnection(h1);
+   DBConnectionPoolReleaseConnection(h2);
+
+   DBConnectionPoolReleaseConnection(hk);
+   ThreadJoin(waiter);
+   AssertTrue(waitTime >= 200);
+   DBConnectionPoolGetClassStats(DBConnectionPoolClass::HOUSEKEEPING, &stats);
+   AssertEquals(stats.waiting, 0);
+   AssertEquals(stats.acquired, 0);
+   AssertEquals(stats.acquireCount, 2);
+   AssertEquals(stats.waitCount, 1);
+   AssertEquals(stats.releaseCount, 2);
+   EndTest();
+
+   StartTest(prefix, _T("connection pool shutdown"));
+   DBConnectionPoolShutdown();
+   DBUnloadDriver(drv);
+   EndTest();
+}
+
 /**
  * main()
  */
@@ -174,6 +273,7 @@ int main(int argc, char *argv[])
    if (!skipSQLite)
    {
       CommonTests(_T("SQLite"), _T("sqlite.ddr"), SQLITE_DB, NULL, NULL, NULL, _T("SQLITE"));
+      TestConnectionPool(_T("SQLite"), _T("sqlite.ddr"), SQLITE_DB, NULL, NULL, NULL);
    }
    return 0;
 }
@@ -72,6 +72,51 @@ static void TestStop()
    EndTest();
 }
 
+/**
+ * Test script library VM pool
+ */
+static void TestVMPool()
+{
+   StartTest(_T("NXSL_Library::createPooledVM"));
+
+   NXSL_Environment env;
+   NXSL_Library library;
+   library.addScript(new NXSL_LibraryScript(1, uuid::generate(), _T("Test"), MemCopyString(_T("return defined($x) ? 1 : 0;")), &env));
+   AssertNotNull(library.findScript(_T("TEST")));
+   AssertNotNull(library.findScript(1));
+
+   ScriptVMHandle vm = library.createPooledVM(_T("test"), [] { return new NXSL_Environment(); }, nullptr);
+   AssertTrue(vm.isValid());
+   NXSL_VM *firstVM = vm.vm();
+   vm->setGlobalVariable("$x", vm->createValue(1));
+   AssertTrue(vm->run());
+   AssertEquals(vm->getResult()->getValueAsInt32(), 1);
+   vm.destroy();
+
+   // VM should be taken from pool with globals cleared
+   vm = library.createPooledVM(_T("test"), [] { return new NXSL_Environment(); }, nullptr);
+   AssertTrue(vm.isValid());
+   AssertTrue(vm.vm() == firstVM);
+   AssertTrue(vm->run());
+   AssertEquals(vm->getResult()->getValueAsInt32(), 0);
+
+   // Library change while VM is in use should invalidate pool
+   library.addScript(new NXSL_LibraryScript(2, uuid::generate(), _T("Other"), MemCopyString(_T("return 0;")), &env));
+   vm.destroy();
+   vm = library.createPooledVM(_T("test"), [] { return new NXSL_Environment(); }, nullptr);
+   AssertTrue(vm.isValid());
+   AssertTrue(vm->run());
+   AssertEquals(vm->getResult()->getValueAsInt32(), 0);
+   vm.destroy();
+
+   library.deleteScript(_T("Test"));
+   AssertNull(library.findScript(_T("Test")));
+   AssertNull(library.findScript(1));
+   AssertFalse(library.createPooledVM(_T("test"), [] { return new NXSL_Environment(); }, nullptr).isValid());
+
+   EndTest();
+}
+
 /**
  * Run test NXSL script
  */
@@ -140,6 +185,7 @@ int main(int argc, char *argv[])
 
    TestCompiler();
    TestStop();
+   TestVMPool();
    RunTestScript(_T("addr.nxsl"));
    RunTestScript(_T("arrays.nxsl"));
    RunTestScript(_T("base64.nxsl"));
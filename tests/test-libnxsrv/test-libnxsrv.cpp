@@ -0,0 +1,502 @@
+#include <nms_common.h>
+#include <nms_util.h>
+#include <nxsrvapi.h>
+#include <testtools.h>
+#include <netxms-version.h>
+
+NETXMS_EXECUTABLE_HEADER(test-libnxsrv)
+
+/**
+ * Synthetic tree layout: root -> groups -> containers -> leaves
+ */
+#define TREE_GROUPS        10
+#define TREE_CONTAINERS    10
+#define TREE_LEAVES        1000
+#define TREE_SIZE          (1 + TREE_GROUPS + TREE_GROUPS * TREE_CONTAINERS + TREE_GROUPS * TREE_CONTAINERS * TREE_LEAVES)
+
+/**
+ * Number of reader threads in concurrent test
+ */
+#define READER_THREADS     4
+
+/**
+ * Number of children in wide fan-out test (linking one by one is quadratic, so it is tested on smaller set)
+ */
+#define FANOUT_CHILDREN          50000
+#define FANOUT_SINGLE_CHILDREN   10000
+
+class TestObject;
+
+/**
+ * Index of registered test objects
+ */
+static SharedHashMap<uint32_t, TestObject> s_objectIndex;
+
+/**
+ * Test object
+ */
+class TestObject : public NObject
+{
+protected:
+   virtual shared_ptr<NObject> lookupObject(uint32_t id) const override;
+
+public:
+   TestObject(uint32_t id) : NObject()
+   {
+      m_id = id;
+      _sntprintf(m_name, MAX_OBJECT_NAME, _T("Object %u"), id);
+   }
+
+   shared_ptr<const SharedObjectArray<NObject>> childListSnapshot() const { return getChildList(); }
+   shared_ptr<const SharedObjectArray<NObject>> parentListSnapshot() const { return getParentList(); }
+
+   /**
+    * Remove all children (each child's parent list is updated as well)
+    */
+   void unlinkChildren()
+   {
+      writeLockChildList();
+      shared_ptr<const SharedObjectArray<NObject>> children = getChildList();
+      clearChildList();
+      unlockChildList();
+      for(int i = 0; i < children->size(); i++)
+         children->get(i)->deleteParent(m_id);
+   }
+
+   /**
+    * Reference implementation of isChild (recursive walk over child lists)
+    */
+   bool isChildRecursive(uint32_t id) const
+   {
+      if (m_id == id)
+         return true;
+      shared_ptr<const SharedObjectArray<NObject>> children = getChildList();
+      for(int i = 0; i < children->size(); i++)
+         if (static_cast<TestObject*>(children->get(i))->isChildRecursive(id))
+            return true;
+      return false;
+   }
+
+   /**
+    * Reference implementation of isParent (recursive walk over parent lists)
+    */
+   bool isParentRecursive(uint32_t id) const
+   {
+      if (m_id == id)
+         return true;
+      shared_ptr<const SharedObjectArray<NObject>> parents = getParentList();
+      for(int i = 0; i < parents->size(); i++)
+         if (static_cast<TestObject*>(parents->get(i))->isParentRecursive(id))
+            return true;
+      return false;
+   }
+};
+
+/**
+ * Find registered test object
+ */
+shared_ptr<NObject> TestObject::lookupObject(uint32_t id) const
+{
+   return s_objectIndex.getShared(id);
+}
+
+/**
+ * Synthetic object tree
+ */
+struct ObjectTree
+{
+   shared_ptr<TestObject> root;
+   SharedObjectArray<TestObject> containers;
+   SharedObjectArray<TestObject> leaves;
+   VolatileCounter stop;
+   VolatileCounter readerErrors;
+
+   ObjectTree() : containers(TREE_GROUPS * TREE_CONTAINERS, 16), leaves(TREE_GROUPS * TREE_CONTAINERS * TREE_LEAVES, 1024)
+   {
+      stop = 0;
+      readerErrors = 0;
+   }
+};
+
+/**
+ * Link two objects
+ */
+static inline void Link(const shared_ptr<TestObject>& parent, const shared_ptr<TestObject>& child)
+{
+   parent->addChild(child);
+   child->addParent(parent);
+}
+
+/**
+ * Unlink two objects
+ */
+static inline void Unlink(const shared_ptr<TestObject>& parent, const shared_ptr<TestObject>& child)
+{
+   parent->deleteChild(child->getId());
+   child->deleteParent(parent->getId());
+}
+
+/**
+ * Test basic child/parent list operations
+ */
+static void TestObjectLists()
+{
+   StartTest(_T("NObject: child and parent lists"));
+
+   auto parent = make_shared<TestObject>(1);
+   auto child = make_shared<TestObject>(2);
+   auto grandchild = make_shared<TestObject>(3);
+   Link(parent, child);
+   Link(child, grandchild);
+   Link(parent, child);   // Duplicate link should be ignored
+
+   AssertEquals(parent->getChildCount(), 1);
+   AssertEquals(child->getParentCount(), 1);
+   AssertTrue(parent->isDirectChild(2));
+   AssertFalse(parent->isDirectChild(3));
+   AssertTrue(parent->isChild(3));
+   AssertTrue(grandchild->isParent(1));
+   AssertFalse(grandchild->isDirectParent(1));
+
+   // Snapshot taken before modification should not change
+   shared_ptr<const SharedObjectArray<NObject>> snapshot = parent->childListSnapshot();
+   auto child2 = make_shared<TestObject>(4);
+   Link(parent, child2);
+   AssertEquals(snapshot->size(), 1);
+   AssertEquals(parent->getChildCount(), 2);
+   AssertTrue(parent->childListSnapshot().get() != snapshot.get());
+
+   Unlink(parent, child);
+   AssertEquals(snapshot->size(), 1);
+   AssertTrue(snapshot->get(0) == child.get());
+   AssertEquals(parent->getChildCount(), 1);
+   AssertFalse(parent->isChild(3));
+   AssertFalse(grandchild->isParent(1));
+
+   Unlink(parent, child2);
+   Unlink(child, grandchild);
+   AssertEquals(parent->getChildCount(), 0);
+   AssertEquals(grandchild->getParentCount(), 0);
+
+   EndTest();
+}
+
+/**
+ * Test linking multiple child objects at once
+ */
+static void TestBulkLink()
+{
+   StartTest(_T("NObject: bulk link"));
+
+   auto parent = make_shared<TestObject>(1);
+   parent->setCustomAttribute(_T("inherited"), SharedString(_T("value")), StateChange::SET);
+   auto existing = make_shared<TestObject>(2);
+   parent->addChild(existing);
+
+   SharedObjectArray<NObject> children(16, 16);
+   children.add(existing);   // Already linked, should be ignored
+   for(uint32_t id = 3; id <= 10; id++)
+      children.add(make_shared<TestObject>(id));
+   children.add(children.getShared(1));   // Duplicate within same batch
+
+   shared_ptr<const SharedObjectArray<NObject>> snapshot = parent->childListSnapshot();
+   parent->addChildren(children);
+   AssertEquals(snapshot->size(), 1);
+   AssertEquals(parent->getChildCount(), 9);
+   for(uint32_t id = 2; id <= 10; id++)
+      AssertTrue(parent->isDirectChild(id));
+   AssertTrue(!_tcscmp(CHECK_NULL(children.get(5)->getCustomAttribute(_T("inherited")).cstr()), _T("value")));
+
+   // Empty batch and batch of already linked objects should not replace snapshot
+   snapshot = parent->childListSnapshot();
+   parent->addChildren(SharedObjectArray<NObject>());
+   parent->addChildren(children);
+   AssertTrue(parent->childListSnapshot().get() == snapshot.get());
+
+   EndTest();
+}
+
+/**
+ * Validate ancestor index against recursive implementation
+ */
+static void ValidateAncestorIndex(const SharedObjectArray<TestObject>& objects)
+{
+   for(int i = 0; i < objects.size(); i++)
+   {
+      TestObject *object = objects.get(i);
+      for(int j = 0; j < objects.size(); j++)
+      {
+         uint32_t id = objects.get(j)->getId();
+         AssertEquals(object->isChild(id), object->isChildRecursive(id));
+         AssertEquals(object->isParent(id), object->isParentRecursive(id));
+      }
+   }
+}
+
+/**
+ * Test ancestor index on random object graph
+ */
+static void TestAncestorIndex()
+{
+   StartTest(_T("NObject: ancestor index"));
+
+   SharedObjectArray<TestObject> objects(200, 16);
+   for(uint32_t id = 1; id <= 200; id++)
+   {
+      auto object = make_shared<TestObject>(id);
+      objects.add(object);
+      s_objectIndex.set(id, object);
+   }
+
+   // Random graph without loops - parent always has lower ID than child
+   srand(42);
+   for(int i = 0; i < 600; i++)
+   {
+      int p = rand() % (objects.size() - 1);
+      int c = p + 1 + rand() % (objects.size() - p - 1);
+      Link(objects.getShared(p), objects.getShared(c));
+   }
+   ValidateAncestorIndex(objects);
+
+   // Remove some links and add new ones, validating after each batch
+   for(int pass = 0; pass < 5; pass++)
+   {
+      for(int i = 0; i < 100; i++)
+      {
+         shared_ptr<TestObject> child = objects.getShared(1 + rand() % (objects.size() - 1));
+         shared_ptr<const SharedObjectArray<NObject>> parents = child->parentListSnapshot();
+         if (parents->isEmpty())
+            continue;
+         shared_ptr<TestObject> parent = s_objectIndex.getShared(parents->get(rand() % parents->size())->getId());
+         Unlink(parent, child);
+      }
+      for(int i = 0; i < 50; i++)
+      {
+         int p = rand() % (objects.size() - 1);
+         int c = p + 1 + rand() % (objects.size() - p - 1);
+         Link(objects.getShared(p), objects.getShared(c));
+      }
+      ValidateAncestorIndex(objects);
+   }
+
+   // Object not registered in index should be checked by recursive walk
+   auto unregistered = make_shared<TestObject>(1000);
+   Link(objects.getShared(199), unregistered);
+   AssertTrue(objects.get(199)->isChild(1000));
+   AssertTrue(unregistered->isParent(200));
+   Unlink(objects.getShared(199), unregistered);
+   AssertFalse(objects.get(199)->isChild(1000));
+   AssertFalse(unregistered->isParent(200));
+
+   for(int i = 0; i < objects.size(); i++)
+   {
+      TestObject *object = objects.get(i);
+      shared_ptr<const SharedObjectArray<NObject>> children = object->childListSnapshot();
+      for(int j = 0; j < children->size(); j++)
+         Unlink(objects.getShared(i), s_objectIndex.getShared(children->get(j)->getId()));
+      s_objectIndex.remove(object->getId());
+   }
+
+   EndTest();
+}
+
+/**
+ * Build synthetic tree
+ */
+static void BuildTree(ObjectTree *tree)
+{
+   uint32_t id = 1;
+   tree->root = make_shared<TestObject>(id++);
+   for(int g = 0; g < TREE_GROUPS; g++)
+   {
+      auto group = make_shared<TestObject>(id++);
+      Link(tree->root, group);
+      for(int c = 0; c < TREE_CONTAINERS; c++)
+      {
+         auto container = make_shared<TestObject>(id++);
+         Link(group, container);
+         tree->containers.add(container);
+         for(int l = 0; l < TREE_LEAVES; l++)
+         {
+            auto leaf = make_shared<TestObject>(id++);
+            s_objectIndex.set(leaf->getId(), leaf);
+            Link(container, leaf);
+            tree->leaves.add(leaf);
+         }
+      }
+   }
+}
+
+/**
+ * Destroy subtree (break reference cycles between parents and children)
+ */
+static void DestroySubtree(TestObject *object)
+{
+   shared_ptr<const SharedObjectArray<NObject>> children = object->childListSnapshot();
+   for(int i = 0; i < children->size(); i++)
+   {
+      TestObject *child = static_cast<TestObject*>(children->get(i));
+      DestroySubtree(child);
+      child->deleteParent(object->getId());
+      object->deleteChild(child->getId());
+   }
+}
+
+/**
+ * Reader thread for concurrent test - walks tree from leaves to root and iterates container child lists
+ */
+static void ReaderThread(ObjectTree *tree)
+{
+   uint32_t rootId = tree->root->getId();
+   int index = 0;
+   while(tree->stop == 0)
+   {
+      TestObject *leaf = tree->leaves.get(index);
+      if (!leaf->isParent(rootId))
+         InterlockedIncrement(&tree->readerErrors);
+
+      TestObject *container = tree->containers.get(index % tree->containers.size());
+      shared_ptr<const SharedObjectArray<NObject>> children = container->childListSnapshot();
+      int count = 0;
+      for(int i = 0; i < children->size(); i++)
+         if (children->get(i) != nullptr)
+            count++;
+      if ((count < TREE_LEAVES - 1) || (count > TREE_LEAVES))
+         InterlockedIncrement(&tree->readerErrors);
+
+      index = (index + 7919) % tree->leaves.size();
+   }
+}
+
+/**
+ * Benchmark object list operations on synthetic tree
+ */
+static void BenchmarkObjectTree()
+{
+   ObjectTree tree;
+
+   TCHAR name[128];
+   _sntprintf(name, 128, _T("NObject: build tree of %d objects"), TREE_SIZE);
+   StartTest(name);
+   int64_t start = GetCurrentTimeMs();
+   BuildTree(&tree);
+   AssertEquals(tree.leaves.size(), TREE_GROUPS * TREE_CONTAINERS * TREE_LEAVES);
+   EndTest(GetCurrentTimeMs() - start);
+
+   StartTest(_T("NObject: isParent (1000000 calls)"));
+   start = GetCurrentTimeMs();
+   uint32_t rootId = tree.root->getId();
+   for(int i = 0; i < 1000000; i++)
+      AssertTrue(tree.leaves.get(i % tree.leaves.size())->isParent(rootId));
+   EndTest(GetCurrentTimeMs() - start);
+
+   StartTest(_T("NObject: isChild via index (1000000 calls)"));
+   start = GetCurrentTimeMs();
+   for(int i = 0; i < 1000000; i++)
+      AssertTrue(tree.root->isChild(tree.leaves.get(i % tree.leaves.size())->getId()));
+   EndTest(GetCurrentTimeMs() - start);
+
+   StartTest(_T("NObject: isChild via recursion (100 full tree scans)"));
+   start = GetCurrentTimeMs();
+   for(int i = 0; i < 100; i++)
+      AssertFalse(tree.root->isChild(TREE_SIZE + 1 + i));
+   EndTest(GetCurrentTimeMs() - start);
+
+   StartTest(_T("NObject: child list iteration (1000 passes)"));
+   start = GetCurrentTimeMs();
+   int count = 0;
+   for(int i = 0; i < 1000; i++)
+   {
+      shared_ptr<const SharedObjectArray<NObject>> children = tree.containers.get(i % tree.containers.size())->childListSnapshot();
+      for(int j = 0; j < children->size(); j++)
+         count += (children->get(j)->getId() != 0) ? 1 : 0;
+   }
+   AssertEquals(count, 1000 * TREE_LEAVES);
+   EndTest(GetCurrentTimeMs() - start);
+
+   _sntprintf(name, 128, _T("NObject: %d readers with concurrent modifications"), READER_THREADS);
+   StartTest(name);
+   start = GetCurrentTimeMs();
+   THREAD readers[READER_THREADS];
+   for(int i = 0; i < READER_THREADS; i++)
+      readers[i] = ThreadCreateEx(ReaderThread, &tree);
+   for(int i = 0; i < 2000; i++)
+   {
+      shared_ptr<TestObject> container = tree.containers.getShared(i % tree.containers.size());
+      shared_ptr<TestObject> leaf = tree.leaves.getShared((i % tree.containers.size()) * TREE_LEAVES + (i / tree.containers.size()) % TREE_LEAVES);
+      container->deleteChild(leaf->getId());
+      container->addChild(leaf);
+   }
+   InterlockedIncrement(&tree.stop);
+   for(int i = 0; i < READER_THREADS; i++)
+      ThreadJoin(readers[i]);
+   AssertEquals(tree.readerErrors, 0);
+   EndTest(GetCurrentTimeMs() - start);
+
+   StartTest(_T("NObject: destroy tree"));
+   start = GetCurrentTimeMs();
+   DestroySubtree(tree.root.get());
+   s_objectIndex.clear();
+   AssertEquals(tree.root->getChildCount(), 0);
+   AssertEquals(tree.leaves.get(0)->getParentCount(), 0);
+   EndTest(GetCurrentTimeMs() - start);
+}
+
+/**
+ * Benchmark linking large number of children to single parent (like template applied to many nodes)
+ */
+static void BenchmarkWideFanOut()
+{
+   SharedObjectArray<TestObject> children(FANOUT_CHILDREN, 1024);
+   for(uint32_t id = 2; id < FANOUT_CHILDREN + 2; id++)
+      children.add(make_shared<TestObject>(id));
+
+   TCHAR name[128];
+   _sntprintf(name, 128, _T("NObject: link %d children one by one"), FANOUT_SINGLE_CHILDREN);
+   StartTest(name);
+   auto parent = make_shared<TestObject>(1);
+   int64_t start = GetCurrentTimeMs();
+   for(int i = 0; i < FANOUT_SINGLE_CHILDREN; i++)
+      Link(parent, children.getShared(i));
+   AssertEquals(parent->getChildCount(), FANOUT_SINGLE_CHILDREN);
+   EndTest(GetCurrentTimeMs() - start);
+
+   _sntprintf(name, 128, _T("NObject: unlink %d children at once"), FANOUT_SINGLE_CHILDREN);
+   StartTest(name);
+   start = GetCurrentTimeMs();
+   parent->unlinkChildren();
+   AssertEquals(parent->getChildCount(), 0);
+   AssertEquals(children.get(0)->getParentCount(), 0);
+   EndTest(GetCurrentTimeMs() - start);
+
+   _sntprintf(name, 128, _T("NObject: link %d children at once"), FANOUT_CHILDREN);
+   StartTest(name);
+   start = GetCurrentTimeMs();
+   SharedObjectArray<NObject> batch(FANOUT_CHILDREN, 1024);
+   for(int i = 0; i < children.size(); i++)
+      batch.add(children.getShared(i));
+   parent->addChildren(batch);
+   for(int i = 0; i < children.size(); i++)
+      children.get(i)->addParent(parent);
+   AssertEquals(parent->getChildCount(), FANOUT_CHILDREN);
+   AssertTrue(children.get(FANOUT_CHILDREN - 1)->isParent(1));
+   EndTest(GetCurrentTimeMs() - start);
+
+   parent->unlinkChildren();
+}
+
+/**
+ * main()
+ */
+int main(int argc, char *argv[])
+{
+   InitNetXMSProcess(true);
+
+   TestObjectLists();
+   TestBulkLink();
+   TestAncestorIndex();
+   BenchmarkObjectTree();
+   BenchmarkWideFanOut();
+
+   return 0;
+}
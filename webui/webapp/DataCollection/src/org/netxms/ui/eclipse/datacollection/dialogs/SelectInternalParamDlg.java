@@ -158,6 +158,18 @@ private void fillMetricList()
          list.add(new AgentParameter("Server.ClientSessions.Web", "Client sessions: web clients", DataType.UINT32)); //$NON-NLS-1$
          list.add(new AgentParameter("Server.ClientSessions.Web(*)", "Client sessions for user {instance}: web clients", DataType.UINT32)); //$NON-NLS-1$
          list.add(new AgentParameter("Server.DataCollectionItems", "Number of data collection items in the system", DataType.UINT32)); //$NON-NLS-1$
+         list.add(new AgentParameter("Server.DB.ConnectionPool.Acquired(*)", "DB connection pool {instance}: acquired connections", DataType.INT32)); //$NON-NLS-1$
+         list.add(new AgentParameter("Server.DB.ConnectionPool.AcquireWaitTime.Average(*)", "DB connection pool {instance}: average acquire wait time", DataType.UINT32)); //$NON-NLS-1$
+         list.add(new AgentParameter("Server.DB.ConnectionPool.AcquireWaitTime.Histogram(*)", "DB connection pool {instance}: acquire wait time histogram bucket", DataType.COUNTER64)); //$NON-NLS-1$
+         list.add(new AgentParameter("Server.DB.ConnectionPool.AcquireWaitTime.Max(*)", "DB connection pool {instance}: maximum acquire wait time", DataType.UINT32)); //$NON-NLS-1$
+         list.add(new AgentParameter("Server.DB.ConnectionPool.ConnectTime.Average(*)", "DB connection pool {instance}: average time to create new connection", DataType.UINT32)); //$NON-NLS-1$
+         list.add(new AgentParameter("Server.DB.ConnectionPool.ConnectTime.Max(*)", "DB connection pool {instance}: maximum time to create new connection", DataType.UINT32)); //$NON-NLS-1$
+         list.add(new AgentParameter("Server.DB.ConnectionPool.HoldTime.Average(*)", "DB connection pool {instance}: average connection hold time", DataType.UINT32)); //$NON-NLS-1$
+         list.add(new AgentParameter("Server.DB.ConnectionPool.HoldTime.Histogram(*)", "DB connection pool {instance}: connection hold time histogram bucket", DataType.COUNTER64)); //$NON-NLS-1$
+         list.add(new AgentParameter("Server.DB.ConnectionPool.HoldTime.Max(*)", "DB connection pool {instance}: maximum connection hold time", DataType.UINT32)); //$NON-NLS-1$
+         list.add(new AgentParameter("Server.DB.ConnectionPool.Size(*)", "DB connection pool {instance}: size", DataType.INT32)); //$NON-NLS-1$
+         list.add(new AgentParameter("Server.DB.ConnectionPool.Waiting(*)", "DB connection pool {instance}: waiting threads", DataType.INT32)); //$NON-NLS-1$
+         list.add(new AgentParameter("Server.DB.ConnectionPool.Waits(*)", "DB connection pool {instance}: acquire requests that had to wait", DataType.COUNTER64)); //$NON-NLS-1$
          list.add(new AgentParameter("Server.DB.Queries.Failed", "Failed DB queries", DataType.COUNTER64)); //$NON-NLS-1$
          list.add(new AgentParameter("Server.DB.Queries.LongRunning", "Long running DB queries", DataType.COUNTER64)); //$NON-NLS-1$
          list.add(new AgentParameter("Server.DB.Queries.NonSelect", "Non-SELECT DB queries", DataType.COUNTER64)); //$NON-NLS-1$